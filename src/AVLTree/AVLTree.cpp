@@ -1,49 +1,148 @@
+#ifndef AVLTREE_CPP
+#define AVLTREE_CPP
+
 #include "AVLTree.hpp"
 
+#include <stdexcept>
+
 namespace s21 {
-template <typename T, typename V>
-AVLTree<T, V>::AVLTree() : root(nullptr), nil(nullptr), inserted(false) {}
+template <typename T, typename V, typename Compare, typename KeyOfValue,
+          typename Allocator>
+AVLTree<T, V, Compare, KeyOfValue, Allocator>::AVLTree(const Compare& comp,
+                                                       const Allocator& alloc)
+    : root(nullptr), nil(nullptr), comp_(comp), pool_(alloc) {}
+
+template <typename T, typename V, typename Compare, typename KeyOfValue,
+          typename Allocator>
+AVLTree<T, V, Compare, KeyOfValue, Allocator>::AVLTree(const AVLTree& other)
+    : AVLTree(other, alloc_traits::select_on_container_copy_construction(
+                         other.GetAllocator())) {}
+
+template <typename T, typename V, typename Compare, typename KeyOfValue,
+          typename Allocator>
+AVLTree<T, V, Compare, KeyOfValue, Allocator>::AVLTree(const AVLTree& other,
+                                                       const Allocator& alloc)
+    : root(nullptr), nil(nullptr), comp_(other.comp_), pool_(alloc) {
+  root = CopyTree(other.GetRoot());
+}
+
+template <typename T, typename V, typename Compare, typename KeyOfValue,
+          typename Allocator>
+AVLTree<T, V, Compare, KeyOfValue, Allocator>::AVLTree(AVLTree&& other) noexcept
+    : root(std::exchange(other.root, nullptr)),
+      nil(nullptr),
+      comp_(other.comp_),
+      pool_(std::move(other.pool_)) {}
+
+template <typename T, typename V, typename Compare, typename KeyOfValue,
+          typename Allocator>
+AVLTree<T, V, Compare, KeyOfValue, Allocator>::AVLTree(AVLTree&& other,
+                                                       const Allocator& alloc)
+    : root(nullptr), nil(nullptr), comp_(other.comp_), pool_(alloc) {
+  if (GetAllocator() == other.GetAllocator()) {
+    root = std::exchange(other.root, nullptr);
+    pool_.Swap(other.pool_);
+  } else {
+    root = CopyTree(other.GetRoot());
+  }
+}
 
-template <typename T, typename V>
-AVLTree<T, V>::AVLTree(const AVLTree& other)
-    : root(CopyTree(other.GetRoot())) {}
+// The copy is built aside, so a failed copy leaves this tree unchanged. It
+// is made with the allocator this tree keeps: other's if it propagates on
+// copy assignment, the current one otherwise
+template <typename T, typename V, typename Compare, typename KeyOfValue,
+          typename Allocator>
+AVLTree<T, V, Compare, KeyOfValue, Allocator>&
+AVLTree<T, V, Compare, KeyOfValue, Allocator>::operator=(const AVLTree& other) {
+  if (this != &other) {
+    if constexpr (alloc_traits::propagate_on_container_copy_assignment::value) {
+      AVLTree copy(other, other.GetAllocator());
+      Clear();
+      root = std::exchange(copy.root, nullptr);
+      comp_ = copy.comp_;
+      pool_ = std::move(copy.pool_);
+    } else {
+      AVLTree copy(other, GetAllocator());
+      Swap(copy);
+    }
+  }
+  return *this;
+}
 
-template <typename T, typename V>
-AVLTree<T, V>& AVLTree<T, V>::operator=(AVLTree&& other) noexcept {
+// Nodes from an unequal allocator that does not propagate cannot be freed
+// here, so they are copied instead
+template <typename T, typename V, typename Compare, typename KeyOfValue,
+          typename Allocator>
+AVLTree<T, V, Compare, KeyOfValue, Allocator>&
+AVLTree<T, V, Compare, KeyOfValue, Allocator>::operator=(
+    AVLTree&& other) noexcept(kNothrowMoveAssign) {
   if (this != &other) {
-    Clear(root);
-    root = exchange(other.root, nullptr);
+    if (kNothrowMoveAssign || GetAllocator() == other.GetAllocator()) {
+      Clear();
+      root = std::exchange(other.root, nullptr);
+      comp_ = other.comp_;
+      pool_ = std::move(other.pool_);
+    } else {
+      *this = static_cast<const AVLTree&>(other);
+    }
   }
 
   return *this;
 }
 
-template <typename T, typename V>
-AVLTree<T, V>::~AVLTree() {
-  Clear(root);
+template <typename T, typename V, typename Compare, typename KeyOfValue,
+          typename Allocator>
+AVLTree<T, V, Compare, KeyOfValue, Allocator>::~AVLTree() {
+  Clear();
 }
 
-template <typename T, typename V>
-int AVLTree<T, V>::Height(Node<T, V>* node) {
+// Counts every call of the comparator
+template <typename T, typename V, typename Compare, typename KeyOfValue,
+          typename Allocator>
+template <typename A, typename B>
+bool AVLTree<T, V, Compare, KeyOfValue, Allocator>::Less(const A& lhs,
+                                                         const B& rhs) const {
+  S21_STATS(Comparison());
+  return comp_(lhs, rhs);
+}
+
+template <typename T, typename V, typename Compare, typename KeyOfValue,
+          typename Allocator>
+const typename AVLTree<T, V, Compare, KeyOfValue, Allocator>::key_type&
+AVLTree<T, V, Compare, KeyOfValue, Allocator>::KeyOf(
+    const Node<T, V>* node) const {
+  return KeyOfValue()(node->key);
+}
+
+template <typename T, typename V, typename Compare, typename KeyOfValue,
+          typename Allocator>
+int AVLTree<T, V, Compare, KeyOfValue, Allocator>::Height(Node<T, V>* node) {
   if (!node) return 0;
   return node->height;
 }
 
-template <typename T, typename V>
-int AVLTree<T, V>::BalanceFactor(Node<T, V>* node) {
+template <typename T, typename V, typename Compare, typename KeyOfValue,
+          typename Allocator>
+int AVLTree<T, V, Compare, KeyOfValue, Allocator>::BalanceFactor(
+    Node<T, V>* node) {
   if (!node) return 0;
   return Height(node->left) - Height(node->right);
 }
 
-template <typename T, typename V>
-void AVLTree<T, V>::UpdateHeight(Node<T, V>* node) {
+template <typename T, typename V, typename Compare, typename KeyOfValue,
+          typename Allocator>
+void AVLTree<T, V, Compare, KeyOfValue, Allocator>::UpdateHeight(
+    Node<T, V>* node) {
   int hl = Height(node->left);
   int hr = Height(node->right);
   node->height = (hl > hr ? hl : hr) + 1;
 }
 
-template <typename T, typename V>
-Node<T, V>* AVLTree<T, V>::RotateRight(Node<T, V>* node) {
+template <typename T, typename V, typename Compare, typename KeyOfValue,
+          typename Allocator>
+Node<T, V>* AVLTree<T, V, Compare, KeyOfValue, Allocator>::RotateRight(
+    Node<T, V>* node) {
+  S21_STATS(Rotation());
   Node<T, V>* newRoot = node->left;
   node->left = newRoot->right;
   if (newRoot->right) newRoot->right->parent = node;
@@ -52,14 +151,19 @@ Node<T, V>* AVLTree<T, V>::RotateRight(Node<T, V>* node) {
   newRoot->parent = node->parent;
   node->parent = newRoot;
 
-  UpdateHeight(newRoot);
   UpdateHeight(node);
+  UpdateHeight(newRoot);
+  UpdateSize(node);
+  UpdateSize(newRoot);
 
   return newRoot;
 }
 
-template <typename T, typename V>
-Node<T, V>* AVLTree<T, V>::RotateLeft(Node<T, V>* node) {
+template <typename T, typename V, typename Compare, typename KeyOfValue,
+          typename Allocator>
+Node<T, V>* AVLTree<T, V, Compare, KeyOfValue, Allocator>::RotateLeft(
+    Node<T, V>* node) {
+  S21_STATS(Rotation());
   Node<T, V>* newRoot = node->right;
   node->right = newRoot->left;
   if (newRoot->left) newRoot->left->parent = node;
@@ -68,132 +172,612 @@ Node<T, V>* AVLTree<T, V>::RotateLeft(Node<T, V>* node) {
   newRoot->parent = node->parent;
   node->parent = newRoot;
 
-  UpdateHeight(newRoot);
   UpdateHeight(node);
+  UpdateHeight(newRoot);
+  UpdateSize(node);
+  UpdateSize(newRoot);
 
   return newRoot;
 }
 
-template <typename T, typename V>
-Node<T, V>* AVLTree<T, V>::Balance(Node<T, V>* node) {
+template <typename T, typename V, typename Compare, typename KeyOfValue,
+          typename Allocator>
+Node<T, V>* AVLTree<T, V, Compare, KeyOfValue, Allocator>::Balance(
+    Node<T, V>* node) {
   UpdateHeight(node);
+  UpdateSize(node);
 
   if (BalanceFactor(node) == 2) {
-    if (BalanceFactor(node->right) < -1) {
+    if (BalanceFactor(node->left) < 0) {
       node->left = RotateLeft(node->left);
-      UpdateSize(node->left);
     }
     node = RotateRight(node);
-    UpdateSize(node);
-  }
-
-  if (BalanceFactor(node) == -2) {
-    if (BalanceFactor(node->left) > 1) {
+  } else if (BalanceFactor(node) == -2) {
+    if (BalanceFactor(node->right) > 0) {
       node->right = RotateRight(node->right);
-      UpdateSize(node->right);
     }
-
     node = RotateLeft(node);
-    UpdateSize(node);
   }
 
-  UpdateSize(node);
   return node;
 }
 
-template <typename T, typename V>
-Node<T, V>* AVLTree<T, V>::Insert(Node<T, V>* node, T key, Node<T, V>* parent) {
-  this->inserted = false;
+// Balances every node from node up to the root and relinks the subtrees
+// that were rotated
+template <typename T, typename V, typename Compare, typename KeyOfValue,
+          typename Allocator>
+void AVLTree<T, V, Compare, KeyOfValue, Allocator>::Rebalance(
+    Node<T, V>* node) {
+  while (node != nullptr) {
+    Node<T, V>* parent = node->parent;
+    Node<T, V>* balanced = Balance(node);
+    if (parent == nullptr) {
+      root = balanced;
+    } else if (parent->left == node) {
+      parent->left = balanced;
+    } else {
+      parent->right = balanced;
+    }
+    node = parent;
+  }
+}
+
+// Puts replacement, possibly null, in the place of node under its parent
+template <typename T, typename V, typename Compare, typename KeyOfValue,
+          typename Allocator>
+void AVLTree<T, V, Compare, KeyOfValue, Allocator>::Replace(
+    Node<T, V>* node, Node<T, V>* replacement) {
+  Node<T, V>* parent = node->parent;
+  if (parent == nullptr) {
+    root = replacement;
+  } else if (parent->left == node) {
+    parent->left = replacement;
+  } else {
+    parent->right = replacement;
+  }
+  if (replacement) replacement->parent = parent;
+}
+
+// Inserts value unless an equal key is present. Returns the node holding the
+// key and whether it was inserted. The descent keeps the last node that is
+// not greater than the key, so equality costs a single extra comparison at
+// the bottom instead of a second one at every level
+template <typename T, typename V, typename Compare, typename KeyOfValue,
+          typename Allocator>
+std::pair<Node<T, V>*, bool>
+AVLTree<T, V, Compare, KeyOfValue, Allocator>::Insert(const T& value) {
+  const key_type& key = KeyOfValue()(value);
+  Node<T, V>* parent = nullptr;
+  Node<T, V>* candidate = nullptr;
+  Node<T, V>* node = root;
+  bool left = false;
+
+  while (node != nullptr) {
+    parent = node;
+    left = Less(key, KeyOf(node));
+    if (left) {
+      node = node->left;
+    } else {
+      candidate = node;
+      node = node->right;
+    }
+  }
+  if (candidate != nullptr && !Less(KeyOf(candidate), key)) {
+    return std::make_pair(candidate, false);
+  }
+
+  node = NewNode(value);
+  Link(parent, node, left);
+  Rebalance(parent);
+
+  return std::make_pair(node, true);
+}
 
-  if (!node) {
-    node = new Node<T, V>(key);
-    node->parent = parent;
-    this->inserted = true;
+// Inserts value after the elements with an equivalent key, so duplicates keep
+// their insertion order
+template <typename T, typename V, typename Compare, typename KeyOfValue,
+          typename Allocator>
+Node<T, V>* AVLTree<T, V, Compare, KeyOfValue, Allocator>::InsertEqual(
+    const T& value) {
+  const key_type& key = KeyOfValue()(value);
+  Node<T, V>* parent = nullptr;
+  Node<T, V>* node = root;
+  bool left = false;
 
-    return Balance(node);
+  while (node != nullptr) {
+    parent = node;
+    left = Less(key, KeyOf(node));
+    node = left ? node->left : node->right;
   }
 
-  if (key < node->key) {
-    node->left = Insert(node->left, key, node);
-  } else if (key > node->key) {
-    node->right = Insert(node->right, key, node);
+  node = NewNode(value);
+  Link(parent, node, left);
+  Rebalance(parent);
+
+  return node;
+}
+
+// Hangs a new leaf under parent, or makes it the root
+template <typename T, typename V, typename Compare, typename KeyOfValue,
+          typename Allocator>
+void AVLTree<T, V, Compare, KeyOfValue, Allocator>::Link(Node<T, V>* parent,
+                                                         Node<T, V>* node,
+                                                         bool left) {
+  node->parent = parent;
+  if (parent == nullptr) {
+    root = node;
+  } else if (left) {
+    parent->left = node;
+  } else {
+    parent->right = node;
+  }
+}
+
+// Removes the node holding key, if any
+template <typename T, typename V, typename Compare, typename KeyOfValue,
+          typename Allocator>
+void AVLTree<T, V, Compare, KeyOfValue, Allocator>::Remove(
+    const key_type& key) {
+  Node<T, V>* node = Search(key);
+  if (node != nullptr) Erase(node);
+}
+
+// Removes every element with a key equivalent to key and returns how many
+// there were. The tree is split into the keys below and above key, the k
+// matching nodes are deleted on the way and the two halves are joined again:
+// O(log n + k) instead of k separate O(log n) erasures
+template <typename T, typename V, typename Compare, typename KeyOfValue,
+          typename Allocator>
+size_t AVLTree<T, V, Compare, KeyOfValue, Allocator>::RemoveAll(
+    const key_type& key) {
+  if (Search(key) == nullptr) return 0;
+
+  Node<T, V>* less = nullptr;
+  Node<T, V>* greater = nullptr;
+  size_t removed = 0;
+  SplitOut(root, key, less, greater, removed);
+  root = Join(less, greater);
+  if (root != nullptr) root->parent = nullptr;
+
+  return removed;
+}
+
+// Unlinks and deletes node; a node with two children is replaced by its
+// in-order successor
+template <typename T, typename V, typename Compare, typename KeyOfValue,
+          typename Allocator>
+void AVLTree<T, V, Compare, KeyOfValue, Allocator>::Erase(Node<T, V>* node) {
+  Node<T, V>* rebalance_from;
+
+  if (node->left == nullptr || node->right == nullptr) {
+    rebalance_from = node->parent;
+    Replace(node, node->left ? node->left : node->right);
   } else {
-    this->inserted = false;
+    Node<T, V>* successor = node->right;
+    while (successor->left != nullptr) successor = successor->left;
+
+    if (successor->parent != node) {
+      rebalance_from = successor->parent;
+      Replace(successor, successor->right);
+      successor->right = node->right;
+      successor->right->parent = successor;
+    } else {
+      rebalance_from = successor;
+    }
+    successor->left = node->left;
+    successor->left->parent = successor;
+    Replace(node, successor);
   }
 
+  DeleteNode(node);
+  Rebalance(rebalance_from);
+}
+
+// Splits the subtree of node into the keys less than key and the keys
+// greater than key; nodes equivalent to key are deleted and counted
+template <typename T, typename V, typename Compare, typename KeyOfValue,
+          typename Allocator>
+void AVLTree<T, V, Compare, KeyOfValue, Allocator>::SplitOut(
+    Node<T, V>* node, const key_type& key, Node<T, V>*& less,
+    Node<T, V>*& greater, size_t& removed) {
+  less = nullptr;
+  greater = nullptr;
+  if (node == nullptr) return;
+
+  S21_STATS(NodeVisit());
+  Node<T, V>* left = node->left;
+  Node<T, V>* right = node->right;
+  Node<T, V>* rest = nullptr;
+
+  if (Less(KeyOf(node), key)) {
+    SplitOut(right, key, rest, greater, removed);
+    less = Join(left, node, rest);
+  } else if (Less(key, KeyOf(node))) {
+    SplitOut(left, key, less, rest, removed);
+    greater = Join(rest, node, right);
+  } else {
+    // left holds no greater keys and right no smaller ones
+    SplitOut(left, key, less, rest, removed);
+    SplitOut(right, key, rest, greater, removed);
+    DeleteNode(node);
+    ++removed;
+  }
+}
+
+// Joins two trees and a pivot node with left < pivot < right. Walks down the
+// taller tree to the height of the shorter one, so the cost is O(difference
+// of the heights). Returns the new root with a null parent
+template <typename T, typename V, typename Compare, typename KeyOfValue,
+          typename Allocator>
+Node<T, V>* AVLTree<T, V, Compare, KeyOfValue, Allocator>::Join(
+    Node<T, V>* left, Node<T, V>* pivot, Node<T, V>* right) {
+  Node<T, V>* joined = Height(left) > Height(right)
+                           ? JoinRight(left, pivot, right)
+                           : JoinLeft(left, pivot, right);
+  joined->parent = nullptr;
+  return joined;
+}
+
+template <typename T, typename V, typename Compare, typename KeyOfValue,
+          typename Allocator>
+Node<T, V>* AVLTree<T, V, Compare, KeyOfValue, Allocator>::JoinRight(
+    Node<T, V>* left, Node<T, V>* pivot, Node<T, V>* right) {
+  if (Height(left) <= Height(right) + 1) {
+    pivot->left = left;
+    pivot->right = right;
+    if (left) left->parent = pivot;
+    if (right) right->parent = pivot;
+    UpdateHeight(pivot);
+    UpdateSize(pivot);
+    return pivot;
+  }
+
+  left->right = JoinRight(left->right, pivot, right);
+  left->right->parent = left;
+  return Balance(left);
+}
+
+template <typename T, typename V, typename Compare, typename KeyOfValue,
+          typename Allocator>
+Node<T, V>* AVLTree<T, V, Compare, KeyOfValue, Allocator>::JoinLeft(
+    Node<T, V>* left, Node<T, V>* pivot, Node<T, V>* right) {
+  if (Height(right) <= Height(left) + 1) {
+    pivot->left = left;
+    pivot->right = right;
+    if (left) left->parent = pivot;
+    if (right) right->parent = pivot;
+    UpdateHeight(pivot);
+    UpdateSize(pivot);
+    return pivot;
+  }
+
+  right->left = JoinLeft(left, pivot, right->left);
+  right->left->parent = right;
+  return Balance(right);
+}
+
+// Joins two trees with every key of left before every key of right, using
+// the minimum of right as the pivot
+template <typename T, typename V, typename Compare, typename KeyOfValue,
+          typename Allocator>
+Node<T, V>* AVLTree<T, V, Compare, KeyOfValue, Allocator>::Join(
+    Node<T, V>* left, Node<T, V>* right) {
+  if (left == nullptr) return right;
+  if (right == nullptr) return left;
+
+  Node<T, V>* min = nullptr;
+  right = DetachMin(right, min);
+  return Join(left, min, right);
+}
+
+// Unlinks the leftmost node of the subtree into min, returns the rebalanced
+// subtree
+template <typename T, typename V, typename Compare, typename KeyOfValue,
+          typename Allocator>
+Node<T, V>* AVLTree<T, V, Compare, KeyOfValue, Allocator>::DetachMin(
+    Node<T, V>* node, Node<T, V>*& min) {
+  if (node->left == nullptr) {
+    min = node;
+    if (node->right) node->right->parent = node->parent;
+    return node->right;
+  }
+
+  node->left = DetachMin(node->left, min);
+  if (node->left) node->left->parent = node;
   return Balance(node);
 }
 
-template <typename T, typename V>
-Node<T, V>* AVLTree<T, V>::FindMin(Node<T, V>* node) {
-  if (!node->left) return node;
-  return FindMin(node->left);
+// Destroys every node and returns the node blocks. Nodes without a
+// destructor to run are not visited one by one
+template <typename T, typename V, typename Compare, typename KeyOfValue,
+          typename Allocator>
+void AVLTree<T, V, Compare, KeyOfValue, Allocator>::Clear() {
+  if (std::is_trivially_destructible<Node<T, V>>::value) {
+    for (int count = Size(root); count > 0; --count) {
+      S21_STATS(Deallocation());
+    }
+  } else {
+    DeleteSubtree(root);
+  }
+  root = nullptr;
+  pool_.Release();
 }
 
-template <typename T, typename V>
-Node<T, V>* AVLTree<T, V>::RemoveMin(Node<T, V>* node) {
-  if (!node->left) return node->right;
-  node->left = RemoveMin(node->left);
-  return Balance(node);
+template <typename T, typename V, typename Compare, typename KeyOfValue,
+          typename Allocator>
+void AVLTree<T, V, Compare, KeyOfValue, Allocator>::ShrinkToFit() {
+  pool_.ShrinkToFit();
 }
 
-template <typename T, typename V>
-Node<T, V>* AVLTree<T, V>::Remove(Node<T, V>* node, T key) {
-  if (!node) return nullptr;
+template <typename T, typename V, typename Compare, typename KeyOfValue,
+          typename Allocator>
+void AVLTree<T, V, Compare, KeyOfValue, Allocator>::DeleteSubtree(
+    Node<T, V>* node) {
+  if (node != nullptr) {
+    DeleteSubtree(node->left);
+    DeleteSubtree(node->right);
+    DeleteNode(node);
+  }
+}
 
-  if (key < node->key) {
-    node->left = Remove(node->left, key);
-  } else if (key > node->key) {
-    node->right = Remove(node->right, key);
-  } else {
-    Node<T, V>* left = node->left;
-    Node<T, V>* right = node->right;
-    delete node;
+// The nodes are first created as a list linked through right, checking the
+// order on the way, then shaped into a tree: every subtree gets half of its
+// nodes on each side, so sibling heights differ by at most one
+template <typename T, typename V, typename Compare, typename KeyOfValue,
+          typename Allocator>
+template <typename Generator>
+void AVLTree<T, V, Compare, KeyOfValue, Allocator>::AssignSorted(
+    size_t count, Generator next) {
+  Clear();
+  pool_.Reserve(count);
+  Node<T, V>* head = nullptr;
+  Node<T, V>* tail = nullptr;
+  try {
+    for (size_t i = 0; i < count; ++i) {
+      Node<T, V>* node = NewNode(next());
+      if (tail != nullptr) {
+        tail->right = node;
+      } else {
+        head = node;
+      }
+      if (tail != nullptr && !Less(KeyOf(tail), KeyOf(node))) {
+        throw std::invalid_argument("Keys are not in ascending order");
+      }
+      tail = node;
+    }
+  } catch (...) {
+    while (head != nullptr) {
+      Node<T, V>* right = head->right;
+      DeleteNode(head);
+      head = right;
+    }
+    throw;
+  }
+  root = BuildBalanced(count, head, nullptr);
+}
+
+// Takes count nodes off the front of list and returns them as a balanced
+// subtree
+template <typename T, typename V, typename Compare, typename KeyOfValue,
+          typename Allocator>
+Node<T, V>* AVLTree<T, V, Compare, KeyOfValue, Allocator>::BuildBalanced(
+    size_t count, Node<T, V>*& list, Node<T, V>* parent) {
+  if (count == 0) return nullptr;
+  Node<T, V>* left_subtree = BuildBalanced(count / 2, list, nullptr);
+  Node<T, V>* node = list;
+  list = list->right;
+  node->parent = parent;
+  node->left = left_subtree;
+  if (left_subtree != nullptr) left_subtree->parent = node;
+  node->right = BuildBalanced(count - count / 2 - 1, list, node);
+  UpdateHeight(node);
+  UpdateSize(node);
+  return node;
+}
+
+template <typename T, typename V, typename Compare, typename KeyOfValue,
+          typename Allocator>
+template <typename F>
+void AVLTree<T, V, Compare, KeyOfValue, Allocator>::ForEach(F visit) const {
+  // An AVL tree of n nodes is at most 1.44 log2(n) high
+  Node<T, V>* path[128];
+  int depth = 0;
+  Node<T, V>* node = root;
+  while (node != nullptr || depth > 0) {
+    while (node != nullptr) {
+      S21_PREFETCH(node->right);
+      path[depth++] = node;
+      node = node->left;
+    }
+    node = path[--depth];
+    visit(static_cast<const T&>(node->key));
+    node = node->right;
+  }
+}
+
+// The lower-bound descent pushes exactly the nodes an in-order walk would
+// still hold on its stack at the first element not less than first
+template <typename T, typename V, typename Compare, typename KeyOfValue,
+          typename Allocator>
+template <typename K, typename F>
+void AVLTree<T, V, Compare, KeyOfValue, Allocator>::VisitRange(const K& first,
+                                                               const K& last,
+                                                               F visit) const {
+  S21_STATS(Lookup());
+  Node<T, V>* path[128];
+  int depth = 0;
+  Node<T, V>* node = root;
+  while (node != nullptr) {
+    if (Less(KeyOf(node), first)) {
+      node = node->right;
+    } else {
+      S21_PREFETCH(node->right);
+      path[depth++] = node;
+      node = node->left;
+    }
+  }
+  while (depth > 0) {
+    node = path[--depth];
+    if (!Less(KeyOf(node), last)) return;
+    visit(static_cast<const T&>(node->key));
+    for (node = node->right; node != nullptr; node = node->left) {
+      S21_PREFETCH(node->right);
+      path[depth++] = node;
+    }
+  }
+}
 
-    if (!right) return left;
-    if (!left) return right;
+// First node whose key is not less than key, one comparison per level
+template <typename T, typename V, typename Compare, typename KeyOfValue,
+          typename Allocator>
+template <typename K>
+Node<T, V>* AVLTree<T, V, Compare, KeyOfValue, Allocator>::LowerBound(
+    const K& key) const {
+  S21_STATS(Lookup());
+  return LowerBound(root, key, nullptr);
+}
+
+// First node whose key is greater than key, one comparison per level
+template <typename T, typename V, typename Compare, typename KeyOfValue,
+          typename Allocator>
+template <typename K>
+Node<T, V>* AVLTree<T, V, Compare, KeyOfValue, Allocator>::UpperBound(
+    const K& key) const {
+  S21_STATS(Lookup());
+  return UpperBound(root, key, nullptr);
+}
+
+// Both bounds in one descent: the paths are shared down to the first node
+// equivalent to key, where they split into its two subtrees
+template <typename T, typename V, typename Compare, typename KeyOfValue,
+          typename Allocator>
+template <typename K>
+std::pair<Node<T, V>*, Node<T, V>*>
+AVLTree<T, V, Compare, KeyOfValue, Allocator>::EqualRange(const K& key) const {
+  S21_STATS(Lookup());
+  Node<T, V>* upper = nullptr;
+  Node<T, V>* node = root;
+
+  while (node != nullptr) {
+    S21_STATS(NodeVisit());
+    if (Less(KeyOf(node), key)) {
+      node = node->right;
+    } else if (Less(key, KeyOf(node))) {
+      upper = node;
+      node = node->left;
+    } else {
+      return std::make_pair(LowerBound(node->left, key, node),
+                            UpperBound(node->right, key, upper));
+    }
+  }
 
-    Node<T, V>* min = FindMin(right);
-    min->right = RemoveMin(right);
+  return std::make_pair(upper, upper);
+}
 
-    min->left = left;
-    min->size_--;
-    min->parent = node->parent;
+// Number of elements equivalent to key in O(log n), from the subtree sizes
+template <typename T, typename V, typename Compare, typename KeyOfValue,
+          typename Allocator>
+template <typename K>
+size_t AVLTree<T, V, Compare, KeyOfValue, Allocator>::Count(
+    const K& key) const {
+  S21_STATS(Lookup());
+  return CountNotGreater(key) - CountLess(key);
+}
 
-    UpdateHeight(min);
-    return Balance(min);
+template <typename T, typename V, typename Compare, typename KeyOfValue,
+          typename Allocator>
+template <typename K>
+size_t AVLTree<T, V, Compare, KeyOfValue, Allocator>::CountLess(
+    const K& key) const {
+  size_t result = 0;
+  Node<T, V>* node = root;
+
+  while (node != nullptr) {
+    S21_STATS(NodeVisit());
+    if (Less(KeyOf(node), key)) {
+      result += (node->left ? node->left->size_ : 0) + 1;
+      node = node->right;
+    } else {
+      node = node->left;
+    }
   }
 
-  node->size_--;
-  UpdateHeight(node);
-  return Balance(node);
+  return result;
 }
 
-template <typename T, typename V>
-void AVLTree<T, V>::Clear(Node<T, V>* node) {
-  if (node != nullptr) {
-    Clear(node->left);
-    Clear(node->right);
-    delete node;
+template <typename T, typename V, typename Compare, typename KeyOfValue,
+          typename Allocator>
+template <typename K>
+size_t AVLTree<T, V, Compare, KeyOfValue, Allocator>::CountNotGreater(
+    const K& key) const {
+  size_t result = 0;
+  Node<T, V>* node = root;
+
+  while (node != nullptr) {
+    S21_STATS(NodeVisit());
+    if (Less(key, KeyOf(node))) {
+      node = node->left;
+    } else {
+      result += (node->left ? node->left->size_ : 0) + 1;
+      node = node->right;
+    }
   }
-  root = nullptr;
+
+  return result;
 }
 
-template <typename T, typename V>
-Node<T, V>* AVLTree<T, V>::Search(Node<T, V>* node, T key) {
-  if (!node || node->key == key) {
-    return node;
+// Lower bound inside the subtree of node; result is the answer if every key
+// of the subtree is less than key
+template <typename T, typename V, typename Compare, typename KeyOfValue,
+          typename Allocator>
+template <typename K>
+Node<T, V>* AVLTree<T, V, Compare, KeyOfValue, Allocator>::LowerBound(
+    Node<T, V>* node, const K& key, Node<T, V>* result) const {
+  while (node != nullptr) {
+    S21_STATS(NodeVisit());
+    if (Less(KeyOf(node), key)) {
+      node = node->right;
+    } else {
+      result = node;
+      node = node->left;
+    }
   }
 
-  if (key < node->key) {
-    return Search(node->left, key);
-  } else {
-    return Search(node->right, key);
+  return result;
+}
+
+template <typename T, typename V, typename Compare, typename KeyOfValue,
+          typename Allocator>
+template <typename K>
+Node<T, V>* AVLTree<T, V, Compare, KeyOfValue, Allocator>::UpperBound(
+    Node<T, V>* node, const K& key, Node<T, V>* result) const {
+  while (node != nullptr) {
+    S21_STATS(NodeVisit());
+    if (Less(key, KeyOf(node))) {
+      result = node;
+      node = node->left;
+    } else {
+      node = node->right;
+    }
   }
+
+  return result;
 }
 
-template <typename T, typename V>
-void AVLTree<T, V>::SetRoot(Node<T, V>* root) {
+// Node holding a key equivalent to key, or null
+template <typename T, typename V, typename Compare, typename KeyOfValue,
+          typename Allocator>
+template <typename K>
+Node<T, V>* AVLTree<T, V, Compare, KeyOfValue, Allocator>::Search(
+    const K& key) const {
+  Node<T, V>* node = LowerBound(key);
+  if (node != nullptr && Less(key, KeyOf(node))) node = nullptr;
+  return node;
+}
+
+template <typename T, typename V, typename Compare, typename KeyOfValue,
+          typename Allocator>
+void AVLTree<T, V, Compare, KeyOfValue, Allocator>::SetRoot(Node<T, V>* root) {
   this->root = root;
 
   if (this->root != nullptr) {
@@ -201,76 +785,133 @@ void AVLTree<T, V>::SetRoot(Node<T, V>* root) {
   }
 }
 
-template <typename T, typename V>
-void AVLTree<T, V>::UpdateSize(Node<T, V>* node) {
+template <typename T, typename V, typename Compare, typename KeyOfValue,
+          typename Allocator>
+void AVLTree<T, V, Compare, KeyOfValue, Allocator>::UpdateSize(
+    Node<T, V>* node) {
   if (node) {
     node->size_ = Size(node->left) + Size(node->right) + 1;
-    UpdateSize(node->left);
-    UpdateSize(node->right);
   }
 }
 
-template <typename T, typename V>
-int AVLTree<T, V>::Size(Node<T, V>* node) {
+template <typename T, typename V, typename Compare, typename KeyOfValue,
+          typename Allocator>
+int AVLTree<T, V, Compare, KeyOfValue, Allocator>::Size(Node<T, V>* node) {
   if (node) return node->size_;
 
   return 0;
 }
 
-template <typename T, typename V>
-Node<T, V>* AVLTree<T, V>::Insert(T key) {
-  root = Insert(root, key, nullptr);
-  return root;
+template <typename T, typename V, typename Compare, typename KeyOfValue,
+          typename Allocator>
+Node<T, V>* AVLTree<T, V, Compare, KeyOfValue, Allocator>::GetRoot() const {
+  return this->root;
 }
 
-template <typename T, typename V>
-void AVLTree<T, V>::Remove(T key) {
-  root = Remove(root, key);
+template <typename T, typename V, typename Compare, typename KeyOfValue,
+          typename Allocator>
+void AVLTree<T, V, Compare, KeyOfValue, Allocator>::Swap(AVLTree& other) {
+  std::swap(root, other.root);
+  std::swap(comp_, other.comp_);
+  pool_.Swap(other.pool_);
 }
 
-template <typename T, typename V>
-Node<T, V>* AVLTree<T, V>::Search(T key) {
-  return Search(root, key);
+template <typename T, typename V, typename Compare, typename KeyOfValue,
+          typename Allocator>
+const Compare& AVLTree<T, V, Compare, KeyOfValue, Allocator>::GetCompare()
+    const {
+  return comp_;
 }
 
-template <typename T, typename V>
-Node<T, V>* AVLTree<T, V>::GetRoot() const {
-  return this->root;
+template <typename T, typename V, typename Compare, typename KeyOfValue,
+          typename Allocator>
+typename AVLTree<T, V, Compare, KeyOfValue, Allocator>::allocator_type
+AVLTree<T, V, Compare, KeyOfValue, Allocator>::GetAllocator() const {
+  return pool_.GetAllocator();
 }
 
-template <typename T, typename V>
-void AVLTree<T, V>::Swap(AVLTree<T, V>& other) {
-  std::swap(root, other.root);
+// Counters of the instrumentation mode, zeros when it is disabled
+template <typename T, typename V, typename Compare, typename KeyOfValue,
+          typename Allocator>
+container_stats AVLTree<T, V, Compare, KeyOfValue, Allocator>::GetStats()
+    const {
+  return S21_STATS_GET();
 }
 
-template <typename T, typename V>
-bool AVLTree<T, V>::GetInserted() {
-  return inserted;
-}
-
-template <typename T, typename V>
-Node<T, V>* AVLTree<T, V>::CopyTree(Node<T, V>* node) {
+// Copies the subtree of node in preorder, with an explicit stack instead of
+// recursion, into a single block of the pool. Heights and sizes are copied
+// and parent links point into the copy, so nothing is rebalanced
+template <typename T, typename V, typename Compare, typename KeyOfValue,
+          typename Allocator>
+Node<T, V>* AVLTree<T, V, Compare, KeyOfValue, Allocator>::CopyTree(
+    Node<T, V>* node) {
   if (node == nullptr) return nullptr;
+  pool_.Reserve(node->size_);
+
+  struct Frame {
+    const Node<T, V>* source;
+    Node<T, V>* copy;
+  };
+  // Holds at most one pending right child per level
+  Frame stack[128];
+  int depth = 0;
+  Node<T, V>* copy = CloneNode(node, nullptr);
+  stack[depth++] = {node, copy};
+  try {
+    while (depth > 0) {
+      Frame frame = stack[--depth];
+      if (frame.source->right != nullptr) {
+        frame.copy->right = CloneNode(frame.source->right, frame.copy);
+        stack[depth++] = {frame.source->right, frame.copy->right};
+      }
+      if (frame.source->left != nullptr) {
+        frame.copy->left = CloneNode(frame.source->left, frame.copy);
+        stack[depth++] = {frame.source->left, frame.copy->left};
+      }
+    }
+  } catch (...) {
+    DeleteSubtree(copy);
+    throw;
+  }
+  return copy;
+}
+
+template <typename T, typename V, typename Compare, typename KeyOfValue,
+          typename Allocator>
+Node<T, V>* AVLTree<T, V, Compare, KeyOfValue, Allocator>::CloneNode(
+    const Node<T, V>* node, Node<T, V>* parent) {
+  Node<T, V>* copy = NewNode(node->key);
+  copy->height = node->height;
+  copy->size_ = node->size_;
+  copy->parent = parent;
+  return copy;
+}
+
+template <typename T, typename V, typename Compare, typename KeyOfValue,
+          typename Allocator>
+Node<T, V>* AVLTree<T, V, Compare, KeyOfValue, Allocator>::NewNode(
+    const T& value) {
+  Node<T, V>* node = pool_.Create(value);
+  S21_STATS(Allocation(sizeof(Node<T, V>)));
+  return node;
+}
 
-  Node<T, V>* new_node = new Node<T, V>(node->key);
-  new_node->size_ = node->size_;
-  new_node->left = CopyTree(node->left);
-  new_node->right = CopyTree(node->right);
-  new_node->parent = node->parent;
-
-  return new_node;
+template <typename T, typename V, typename Compare, typename KeyOfValue,
+          typename Allocator>
+void AVLTree<T, V, Compare, KeyOfValue, Allocator>::DeleteNode(
+    Node<T, V>* node) {
+  pool_.Destroy(node);
+  S21_STATS(Deallocation());
 }
 
-template <typename T, typename V>
-Node<T, V>* AVLTree<T, V>::MaxKey(Node<T, V>* node) {
+template <typename T, typename V, typename Compare, typename KeyOfValue,
+          typename Allocator>
+Node<T, V>* AVLTree<T, V, Compare, KeyOfValue, Allocator>::MaxKey(
+    Node<T, V>* node) {
   if (node != nullptr) {
-    while (node->right != nullptr) {
-      return this->MaxKey(node->right);
-    }
-    return node;
+    while (node->right != nullptr) node = node->right;
   }
-
-  return nullptr;
+  return node;
 }
 
 template <typename T, typename V>
@@ -297,6 +938,8 @@ Iterator<T, V>& Iterator<T, V>::operator++() {
         node_ = parent;
         parent = parent->parent;
       }
+      // Past the last element the climb has reached the root
+      if (parent == nullptr) root_ = node_;
       node_ = parent;
     }
     return *this;
@@ -314,10 +957,7 @@ Iterator<T, V> Iterator<T, V>::operator++(int) {
 
 template <typename T, typename V>
 Iterator<T, V>& Iterator<T, V>::operator--() {
-  if (Size(root_) > 0) {
-    if (node_ != nullptr) {
-      return OperatorHelper();
-    }
+  if (node_ == nullptr) {
     node_ = MaxKey(root_);
     return *this;
   }
@@ -345,12 +985,9 @@ T& Iterator<T, V>::operator*() {
 template <typename T, typename V>
 Node<T, V>* Iterator<T, V>::MaxKey(Node<T, V>* node) {
   if (node != nullptr) {
-    while (node->right != nullptr) {
-      this->MaxKey(node->right);
-    }
-    return node;
+    while (node->right != nullptr) node = node->right;
   }
-  return nullptr;
+  return node;
 }
 
 template <typename T, typename V>
@@ -377,3 +1014,5 @@ Iterator<T, V>& Iterator<T, V>::OperatorHelper() {
 }
 
 }  // namespace s21
+
+#endif  // AVLTREE_CPP
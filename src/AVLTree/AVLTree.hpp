@@ -2,7 +2,18 @@
 #define AVLTREE_H
 
 #include <cstddef>
+#include <functional>
 #include <iostream>
+#include <memory>
+#include <memory_resource>
+#include <type_traits>
+#include <utility>
+
+#include "../KeyOfValue/s21_key_of_value.h"
+#include "../NodePool/s21_node_pool.h"
+#include "../Prefetch/s21_prefetch.h"
+#include "../RangeView/s21_range_view.h"
+#include "../Stats/s21_stats.h"
 
 namespace s21 {
 template <typename T, typename V>
@@ -33,29 +44,112 @@ class Node {
         parent(nullptr) {}
 };
 
-template <typename T, typename V>
+// AVL tree ordered by Compare(KeyOfValue(element)); every descent makes
+// exactly one Compare call per visited node. Insert keeps keys unique,
+// InsertEqual admits duplicates for the multi containers. Lookup functions
+// are templates so that a comparator with is_transparent can be probed with
+// any type it accepts. Nodes live in a NodePool that allocates its blocks
+// through Allocator, with the propagation rules of the standard containers.
+template <typename T, typename V, typename Compare = std::less<T>,
+          typename KeyOfValue = IdentityKey<T>,
+          typename Allocator = std::allocator<T>>
 class AVLTree {
+  using alloc_traits = std::allocator_traits<Allocator>;
+  static constexpr bool kNothrowMoveAssign =
+      alloc_traits::propagate_on_container_move_assignment::value ||
+      alloc_traits::is_always_equal::value;
+
  public:
-  AVLTree();
+  using key_type = typename KeyOfValue::key_type;
+  using key_compare = Compare;
+  using allocator_type = Allocator;
+
+  explicit AVLTree(const Compare& comp = Compare(),
+                   const Allocator& alloc = Allocator());
+  // Structure-preserving O(n) copy, see CopyTree
   AVLTree(const AVLTree& other);
+  AVLTree(const AVLTree& other, const Allocator& alloc);
+  AVLTree(AVLTree&& other) noexcept;
+  // Takes over the nodes of other if the allocators are equal and copies
+  // them otherwise
+  AVLTree(AVLTree&& other, const Allocator& alloc);
   ~AVLTree();
-  AVLTree<T, V>& operator=(AVLTree&& other) noexcept;
-
-  Node<T, V>* Insert(T key);
-  void Remove(T key);
-  Node<T, V>* Search(T key);
-  void Swap(AVLTree<T, V>& other);
-  void Clear(Node<T, V>* node);
+  AVLTree& operator=(const AVLTree& other);
+  AVLTree& operator=(AVLTree&& other) noexcept(kNothrowMoveAssign);
+
+  std::pair<Node<T, V>*, bool> Insert(const T& value);
+  Node<T, V>* InsertEqual(const T& value);
+  void Remove(const key_type& key);
+  size_t RemoveAll(const key_type& key);
+  void Erase(Node<T, V>* node);
+  template <typename K>
+  Node<T, V>* Search(const K& key) const;
+  template <typename K>
+  Node<T, V>* LowerBound(const K& key) const;
+  template <typename K>
+  Node<T, V>* UpperBound(const K& key) const;
+  template <typename K>
+  std::pair<Node<T, V>*, Node<T, V>*> EqualRange(const K& key) const;
+  template <typename K>
+  size_t Count(const K& key) const;
+  void Swap(AVLTree& other);
+  // Empties the whole tree
+  void Clear();
+  // Returns the node blocks left without live nodes by erasures
+  void ShrinkToFit();
+  // Replaces the contents by count elements, each returned by next() in
+  // strictly ascending key order, in O(n) without rotations. Throws
+  // std::invalid_argument, leaving the tree empty, if the order is broken
+  template <typename Generator>
+  void AssignSorted(size_t count, Generator next);
+  // Calls visit(element) in key order. Iterative with an explicit stack, so
+  // parent pointers are never read, and each right child is prefetched when
+  // its parent is pushed, well before the walk reaches it
+  template <typename F>
+  void ForEach(F visit) const;
+  // Same walk over the elements with keys in [first, last), started by a
+  // single lower-bound descent
+  template <typename K, typename F>
+  void VisitRange(const K& first, const K& last, F visit) const;
 
   Node<T, V>* GetRoot() const;
-  bool GetInserted();
   void SetRoot(Node<T, V>* root);
   Node<T, V>* MaxKey(Node<T, V>* node);
+  const Compare& GetCompare() const;
+  allocator_type GetAllocator() const;
+  container_stats GetStats() const;
 
  private:
   Node<T, V>* root;
   Node<T, V>* nil;
-  bool inserted;
+  Compare comp_;
+  S21_STATS_MEMBER
+  NodePool<Node<T, V>, Allocator> pool_;
+
+  template <typename A, typename B>
+  bool Less(const A& lhs, const B& rhs) const;
+  const key_type& KeyOf(const Node<T, V>* node) const;
+  template <typename K>
+  Node<T, V>* LowerBound(Node<T, V>* node, const K& key,
+                         Node<T, V>* result) const;
+  template <typename K>
+  Node<T, V>* UpperBound(Node<T, V>* node, const K& key,
+                         Node<T, V>* result) const;
+  template <typename K>
+  size_t CountLess(const K& key) const;
+  template <typename K>
+  size_t CountNotGreater(const K& key) const;
+
+  void Link(Node<T, V>* parent, Node<T, V>* node, bool left);
+  Node<T, V>* Join(Node<T, V>* left, Node<T, V>* pivot, Node<T, V>* right);
+  Node<T, V>* JoinRight(Node<T, V>* left, Node<T, V>* pivot,
+                        Node<T, V>* right);
+  Node<T, V>* JoinLeft(Node<T, V>* left, Node<T, V>* pivot,
+                       Node<T, V>* right);
+  Node<T, V>* Join(Node<T, V>* left, Node<T, V>* right);
+  Node<T, V>* DetachMin(Node<T, V>* node, Node<T, V>*& min);
+  void SplitOut(Node<T, V>* node, const key_type& key, Node<T, V>*& less,
+                Node<T, V>*& greater, size_t& removed);
 
   int Size(Node<T, V>* node);
   int Height(Node<T, V>* node);
@@ -64,16 +158,17 @@ class AVLTree {
   void UpdateHeight(Node<T, V>* node);
 
   Node<T, V>* Balance(Node<T, V>* node);
+  void Rebalance(Node<T, V>* node);
+  void Replace(Node<T, V>* node, Node<T, V>* replacement);
   Node<T, V>* CopyTree(Node<T, V>* node);
+  Node<T, V>* CloneNode(const Node<T, V>* node, Node<T, V>* parent);
+  Node<T, V>* NewNode(const T& value);
+  void DeleteNode(Node<T, V>* node);
+  void DeleteSubtree(Node<T, V>* node);
+  Node<T, V>* BuildBalanced(size_t count, Node<T, V>*& list,
+                            Node<T, V>* parent);
   Node<T, V>* RotateLeft(Node<T, V>* node);
   Node<T, V>* RotateRight(Node<T, V>* node);
-
-  Node<T, V>* Search(Node<T, V>* node, T key);
-  Node<T, V>* FindMin(Node<T, V>* node);
-
-  Node<T, V>* Insert(Node<T, V>* node, T key, Node<T, V>* parent);
-  Node<T, V>* Remove(Node<T, V>* node, T key);
-  Node<T, V>* RemoveMin(Node<T, V>* node);
 };
 
 template <typename T, typename V>
@@ -84,7 +179,7 @@ class Iterator {
   using const_reference = const reference;
   using pointer = T*;
 
-  Iterator(Node<T, V>* node = nullptr) : node_(node) {}
+  Iterator(Node<T, V>* node = nullptr) : node_(node), root_(nullptr) {}
   Iterator(Node<T, V>* nil, Node<T, V>* root) : node_(nil), root_(root) {}
   Iterator(const Iterator&) = default;
   Iterator& operator=(const Iterator&) = default;
@@ -105,9 +200,12 @@ class Iterator {
   int Size(Node<T, V>* node) { return node ? node->size_ : 0; }
   Node<T, V>* MaxKey(Node<T, V>* node);
   Iterator& OperatorHelper();
+  Node<T, V>* GetNode() const { return node_; }
 
  protected:
   Node<T, V>* node_;
+  // Root of the tree, for operator-- on end(); set by the containers' end()
+  // and by operator++ when it steps past the last element
   Node<T, V>* root_;
 };
 
@@ -6,6 +6,8 @@
 #include <limits>
 #include <stdexcept>
 
+#include "../Stats/s21_stats.h"
+
 namespace s21 {
 template <class T, size_t N>
 class S21Array {
@@ -32,6 +34,7 @@ class S21Array {
   const_reference front();
   const_reference back();
   iterator data();
+  const_iterator data() const;
 
   // Vector Iterators
   iterator begin();
@@ -46,6 +49,9 @@ class S21Array {
   void swap(S21Array &other);
   void fill(const_reference value);
 
+  // Array instrumentation, the storage is inline so there is nothing to count
+  container_stats stats() const;
+
   //   void print_array();
  private:
   T array[N];
@@ -135,6 +141,11 @@ typename S21Array<T, N>::iterator S21Array<T, N>::data() {
   return array;
 }
 
+template <class T, size_t N>
+typename S21Array<T, N>::const_iterator S21Array<T, N>::data() const {
+  return array;
+}
+
 // returns an iterator to the beginning
 template <class T, size_t N>
 typename S21Array<T, N>::iterator S21Array<T, N>::begin() {
@@ -180,6 +191,12 @@ void S21Array<T, N>::fill(const_reference value) {
   }
 }
 
+// returns empty counters, the array never allocates
+template <class T, size_t N>
+container_stats S21Array<T, N>::stats() const {
+  return container_stats();
+}
+
 // template <class T, size_t N>
 // void S21Array<T, N>::print_array() {
 //   for (size_type i = 0; i < size(); ++i) {
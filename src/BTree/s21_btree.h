@@ -0,0 +1,294 @@
+#ifndef S21_CONTAINERS_BTREE_H
+#define S21_CONTAINERS_BTREE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "../KeyOfValue/s21_key_of_value.h"
+#include "../RangeView/s21_range_view.h"
+#include "../Stats/s21_stats.h"
+
+namespace s21 {
+namespace btree_detail {
+// Fixed array of N slots whose elements are constructed one by one, so that
+// a node does not require a default-constructible element type
+template <typename U, size_t N>
+class SlotArray {
+ public:
+  U& operator[](size_t i) {
+    return *std::launder(reinterpret_cast<U*>(data_ + i * sizeof(U)));
+  }
+  const U& operator[](size_t i) const {
+    return *std::launder(reinterpret_cast<const U*>(data_ + i * sizeof(U)));
+  }
+
+  template <typename... Args>
+  void Construct(size_t i, Args&&... args) {
+    ::new (static_cast<void*>(data_ + i * sizeof(U)))
+        U(std::forward<Args>(args)...);
+  }
+  void Destroy(size_t i) { (*this)[i].~U(); }
+
+  // Moves source[from] into the free slot to, source[from] becomes free
+  void Relocate(size_t to, SlotArray& source, size_t from) {
+    Construct(to, std::move(source[from]));
+    source.Destroy(from);
+  }
+  // Frees slot i of count used slots by shifting [i, count) to the right
+  void Open(size_t i, size_t count) {
+    for (size_t j = count; j > i; --j) Relocate(j, *this, j - 1);
+  }
+  // Fills the free slot i by shifting (i, count) to the left
+  void Close(size_t i, size_t count) {
+    for (size_t j = i + 1; j < count; ++j) Relocate(j - 1, *this, j);
+  }
+
+ private:
+  alignas(U) unsigned char data_[N * sizeof(U)];
+};
+}  // namespace btree_detail
+
+// B+-tree: elements live in leaves of up to kLeafSlots sorted elements that
+// are linked into a list, inner nodes hold up to kInnerSlots separator keys.
+// NodeBytes sets the fan-out; the default of 256 bytes (four cache lines)
+// fits 56 ints per leaf, so a lookup touches a handful of nodes instead of
+// ~log2(n) scattered AVL nodes, and a scan walks contiguous arrays.
+// Separators satisfy left < separator <= right and descents take the child
+// after the last separator not greater than the key. Any insertion or
+// erasure invalidates iterators. Leaves and inner nodes come from Allocator
+// rebound to each node type, with the propagation rules of the standard
+// containers.
+template <typename T, typename Compare = std::less<T>,
+          typename KeyOfValue = IdentityKey<T>, size_t NodeBytes = 256,
+          typename Allocator = std::allocator<T>>
+class BTree {
+ private:
+  struct Leaf;
+  struct Inner;
+
+  using alloc_traits = std::allocator_traits<Allocator>;
+  using leaf_allocator = typename alloc_traits::template rebind_alloc<Leaf>;
+  using leaf_traits = std::allocator_traits<leaf_allocator>;
+  using inner_allocator = typename alloc_traits::template rebind_alloc<Inner>;
+  using inner_traits = std::allocator_traits<inner_allocator>;
+  static constexpr bool kNothrowMoveAssign =
+      alloc_traits::propagate_on_container_move_assignment::value ||
+      alloc_traits::is_always_equal::value;
+
+ public:
+  template <bool IsConst>
+  class TreeIterator;
+
+  using key_type = typename KeyOfValue::key_type;
+  using key_compare = Compare;
+  using allocator_type = Allocator;
+  using size_type = size_t;
+  using iterator = TreeIterator<false>;
+  using const_iterator = TreeIterator<true>;
+
+  static constexpr size_type kLeafSlots =
+      (NodeBytes - 4 * sizeof(void*)) / sizeof(T) > 3
+          ? (NodeBytes - 4 * sizeof(void*)) / sizeof(T)
+          : 3;
+  static constexpr size_type kInnerSlots =
+      (NodeBytes - 3 * sizeof(void*)) / (sizeof(key_type) + sizeof(void*)) > 3
+          ? (NodeBytes - 3 * sizeof(void*)) /
+                (sizeof(key_type) + sizeof(void*))
+          : 3;
+  static_assert(NodeBytes >= 64, "NodeBytes is too small");
+  static_assert(kLeafSlots <= UINT16_MAX && kInnerSlots < UINT16_MAX,
+                "NodeBytes is too large");
+
+  explicit BTree(const Compare& comp = Compare(),
+                 const Allocator& alloc = Allocator());
+  BTree(const BTree& other);
+  BTree(const BTree& other, const Allocator& alloc);
+  BTree(BTree&& other) noexcept;
+  // Takes over the nodes of other if the allocators are equal and copies
+  // them otherwise
+  BTree(BTree&& other, const Allocator& alloc);
+  ~BTree();
+  BTree& operator=(const BTree& other);
+  BTree& operator=(BTree&& other) noexcept(kNothrowMoveAssign);
+
+  iterator Begin();
+  iterator End();
+  const_iterator Begin() const;
+  const_iterator End() const;
+
+  size_type Size() const;
+  std::pair<iterator, bool> Insert(const T& value);
+  void Erase(const_iterator pos);
+  void Clear();
+  void Swap(BTree& other) noexcept;
+
+  template <typename K>
+  iterator Find(const K& key) const;
+  template <typename K>
+  iterator LowerBound(const K& key) const;
+  template <typename K>
+  iterator UpperBound(const K& key) const;
+
+  const Compare& GetCompare() const;
+  allocator_type GetAllocator() const;
+  // Bytes held by the nodes, the denominator of the bytes per element
+  size_type MemoryUsage() const;
+  int Height() const;
+  container_stats GetStats() const;
+
+ private:
+  // Both halves of a split node stay at or above these
+  static constexpr size_type kMinLeaf = kLeafSlots / 2;
+  static constexpr size_type kMinInner = (kInnerSlots - 1) / 2;
+
+  struct Node {
+    explicit Node(bool is_leaf) : leaf(is_leaf) {}
+
+    Inner* parent = nullptr;
+    uint16_t position = 0;  // index among the children of parent
+    uint16_t count = 0;     // elements of a leaf, keys of an inner node
+    bool leaf;
+  };
+
+  struct Leaf : Node {
+    Leaf() : Node(true) {}
+
+    Leaf* prev = nullptr;
+    Leaf* next = nullptr;
+    btree_detail::SlotArray<T, kLeafSlots> values;
+  };
+
+  struct Inner : Node {
+    Inner() : Node(false) {}
+
+    btree_detail::SlotArray<key_type, kInnerSlots> keys;
+    Node* children[kInnerSlots + 1];
+  };
+
+  Node* root_;
+  Leaf* first_;
+  Leaf* last_;
+  size_type size_;
+  size_type leaves_;
+  size_type inners_;
+  Compare comp_;
+  Allocator allocator_;
+  S21_STATS_MEMBER
+
+  template <typename A, typename B>
+  bool Less(const A& lhs, const B& rhs) const;
+  const key_type& KeyAt(const Leaf* leaf, size_type i) const;
+  template <typename K>
+  Leaf* FindLeaf(const K& key) const;
+  template <typename K>
+  size_type LeafLowerBound(const Leaf* leaf, const K& key) const;
+  template <typename K>
+  size_type LeafUpperBound(const Leaf* leaf, const K& key) const;
+
+  Leaf* SplitLeaf(Leaf* leaf);
+  Inner* SplitInner(Inner* node, Inner*& spare);
+  void InsertInParent(Node* left, key_type&& key, Node* right, Inner*& spare);
+  void InsertIntoInner(Inner* node, size_type pos, key_type&& key,
+                       Node* child);
+  size_type SplitInners(const Leaf* leaf) const;
+  static Inner* TakeSpare(Inner*& spare);
+  void RebalanceLeaf(Leaf* leaf);
+  void RebalanceInner(Inner* node);
+  void MergeLeaves(Leaf* left, Leaf* right);
+  void MergeInner(Inner* left, Inner* right, const key_type& separator);
+  void RemoveFromInner(Inner* node, size_type index);
+  void SetChild(Inner* node, size_type index, Node* child);
+
+  Leaf* NewLeaf();
+  Inner* NewInner();
+  void DeleteLeaf(Leaf* leaf);
+  void DeleteInner(Inner* node);
+  void DeleteSubtree(Node* node);
+  void Adopt(BTree& other);
+  void CloneTree(const BTree& other);
+  Node* CloneSubtree(const Node* node, Inner* parent, size_type position,
+                     Leaf*& last);
+};
+
+// Bidirectional iterator: a leaf and a slot in it. End() is the slot past
+// the last element of the last leaf
+template <typename T, typename Compare, typename KeyOfValue, size_t NodeBytes,
+          typename Allocator>
+template <bool IsConst>
+class BTree<T, Compare, KeyOfValue, NodeBytes, Allocator>::TreeIterator {
+ public:
+  using value_type = T;
+  using reference = typename std::conditional<IsConst, const T&, T&>::type;
+  using pointer = typename std::conditional<IsConst, const T*, T*>::type;
+  using difference_type = std::ptrdiff_t;
+  using iterator_category = std::bidirectional_iterator_tag;
+
+  TreeIterator() : leaf_(nullptr), index_(0) {}
+  TreeIterator(Leaf* leaf, size_type index) : leaf_(leaf), index_(index) {
+    if (leaf_ != nullptr && index_ == leaf_->count && leaf_->next != nullptr) {
+      leaf_ = leaf_->next;
+      index_ = 0;
+    }
+  }
+  operator TreeIterator<true>() const {
+    return TreeIterator<true>(leaf_, index_);
+  }
+
+  reference operator*() const { return leaf_->values[index_]; }
+  pointer operator->() const { return &leaf_->values[index_]; }
+
+  TreeIterator& operator++() {
+    if (++index_ == leaf_->count && leaf_->next != nullptr) {
+      leaf_ = leaf_->next;
+      index_ = 0;
+    }
+    return *this;
+  }
+  TreeIterator operator++(int) {
+    TreeIterator temp = *this;
+    ++*this;
+    return temp;
+  }
+  TreeIterator& operator--() {
+    if (index_ == 0) {
+      leaf_ = leaf_->prev;
+      index_ = leaf_->count;
+    }
+    --index_;
+    return *this;
+  }
+  TreeIterator operator--(int) {
+    TreeIterator temp = *this;
+    --*this;
+    return temp;
+  }
+
+  // Mutable and const iterators compare with each other
+  template <bool OtherConst>
+  bool operator==(const TreeIterator<OtherConst>& other) const {
+    return leaf_ == other.leaf_ && index_ == other.index_;
+  }
+  template <bool OtherConst>
+  bool operator!=(const TreeIterator<OtherConst>& other) const {
+    return !(*this == other);
+  }
+
+ private:
+  friend class BTree;
+  template <bool>
+  friend class TreeIterator;
+
+  Leaf* leaf_;
+  size_type index_;
+};
+}  // namespace s21
+
+#include "s21_btree.tpp"
+
+#endif
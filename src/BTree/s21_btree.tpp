@@ -0,0 +1,842 @@
+#ifndef S21_CONTAINERS_BTREE_TPP
+#define S21_CONTAINERS_BTREE_TPP
+
+namespace s21 {
+
+// functions
+
+template <typename T, typename Compare, typename KeyOfValue, size_t NodeBytes,
+          typename Allocator>
+BTree<T, Compare, KeyOfValue, NodeBytes, Allocator>::BTree(
+    const Compare& comp, const Allocator& alloc)
+    : root_(nullptr),
+      first_(nullptr),
+      last_(nullptr),
+      size_(0),
+      leaves_(0),
+      inners_(0),
+      comp_(comp),
+      allocator_(alloc) {}
+
+template <typename T, typename Compare, typename KeyOfValue, size_t NodeBytes,
+          typename Allocator>
+BTree<T, Compare, KeyOfValue, NodeBytes, Allocator>::BTree(const BTree& other)
+    : BTree(other, alloc_traits::select_on_container_copy_construction(
+                       other.allocator_)) {}
+
+// Copies node by node, the shape of the tree is kept. If an element copy
+// throws, CloneSubtree has already freed every node it built
+template <typename T, typename Compare, typename KeyOfValue, size_t NodeBytes,
+          typename Allocator>
+BTree<T, Compare, KeyOfValue, NodeBytes, Allocator>::BTree(
+    const BTree& other, const Allocator& alloc)
+    : BTree(other.comp_, alloc) {
+  CloneTree(other);
+}
+
+template <typename T, typename Compare, typename KeyOfValue, size_t NodeBytes,
+          typename Allocator>
+BTree<T, Compare, KeyOfValue, NodeBytes, Allocator>::BTree(
+    BTree&& other) noexcept
+    : root_(std::exchange(other.root_, nullptr)),
+      first_(std::exchange(other.first_, nullptr)),
+      last_(std::exchange(other.last_, nullptr)),
+      size_(std::exchange(other.size_, 0)),
+      leaves_(std::exchange(other.leaves_, 0)),
+      inners_(std::exchange(other.inners_, 0)),
+      comp_(other.comp_),
+      allocator_(std::move(other.allocator_)) {}
+
+template <typename T, typename Compare, typename KeyOfValue, size_t NodeBytes,
+          typename Allocator>
+BTree<T, Compare, KeyOfValue, NodeBytes, Allocator>::BTree(
+    BTree&& other, const Allocator& alloc)
+    : BTree(other.comp_, alloc) {
+  if (allocator_ == other.allocator_) {
+    Adopt(other);
+  } else {
+    CloneTree(other);
+  }
+}
+
+template <typename T, typename Compare, typename KeyOfValue, size_t NodeBytes,
+          typename Allocator>
+BTree<T, Compare, KeyOfValue, NodeBytes, Allocator>::~BTree() {
+  Clear();
+}
+
+// Clones other first, so a throwing copy leaves this tree as it was. Under
+// propagate_on_container_copy_assignment the clone and this tree switch to
+// other's allocator
+template <typename T, typename Compare, typename KeyOfValue, size_t NodeBytes,
+          typename Allocator>
+BTree<T, Compare, KeyOfValue, NodeBytes, Allocator>&
+BTree<T, Compare, KeyOfValue, NodeBytes, Allocator>::operator=(
+    const BTree& other) {
+  if (this != &other) {
+    if constexpr (alloc_traits::propagate_on_container_copy_assignment::
+                      value) {
+      BTree tmp(other, other.allocator_);
+      Clear();
+      allocator_ = other.allocator_;
+      Adopt(tmp);
+    } else {
+      BTree tmp(other, allocator_);
+      Clear();
+      Adopt(tmp);
+    }
+  }
+  return *this;
+}
+
+// Nodes of an unequal allocator that stays behind cannot be freed by this
+// tree, so they are cloned instead of taken over
+template <typename T, typename Compare, typename KeyOfValue, size_t NodeBytes,
+          typename Allocator>
+BTree<T, Compare, KeyOfValue, NodeBytes, Allocator>&
+BTree<T, Compare, KeyOfValue, NodeBytes, Allocator>::operator=(
+    BTree&& other) noexcept(kNothrowMoveAssign) {
+  if (this != &other) {
+    if constexpr (alloc_traits::propagate_on_container_move_assignment::
+                      value) {
+      Clear();
+      allocator_ = std::move(other.allocator_);
+      Adopt(other);
+    } else if (allocator_ == other.allocator_) {
+      Clear();
+      Adopt(other);
+    } else {
+      BTree tmp(other, allocator_);
+      Clear();
+      Adopt(tmp);
+    }
+  }
+  return *this;
+}
+
+// iterators
+
+template <typename T, typename Compare, typename KeyOfValue, size_t NodeBytes,
+          typename Allocator>
+typename BTree<T, Compare, KeyOfValue, NodeBytes, Allocator>::iterator
+BTree<T, Compare, KeyOfValue, NodeBytes, Allocator>::Begin() {
+  return iterator(first_, 0);
+}
+
+template <typename T, typename Compare, typename KeyOfValue, size_t NodeBytes,
+          typename Allocator>
+typename BTree<T, Compare, KeyOfValue, NodeBytes, Allocator>::iterator
+BTree<T, Compare, KeyOfValue, NodeBytes, Allocator>::End() {
+  return iterator(last_, last_ ? last_->count : 0);
+}
+
+template <typename T, typename Compare, typename KeyOfValue, size_t NodeBytes,
+          typename Allocator>
+typename BTree<T, Compare, KeyOfValue, NodeBytes, Allocator>::const_iterator
+BTree<T, Compare, KeyOfValue, NodeBytes, Allocator>::Begin() const {
+  return const_iterator(first_, 0);
+}
+
+template <typename T, typename Compare, typename KeyOfValue, size_t NodeBytes,
+          typename Allocator>
+typename BTree<T, Compare, KeyOfValue, NodeBytes, Allocator>::const_iterator
+BTree<T, Compare, KeyOfValue, NodeBytes, Allocator>::End() const {
+  return const_iterator(last_, last_ ? last_->count : 0);
+}
+
+// capacity
+
+template <typename T, typename Compare, typename KeyOfValue, size_t NodeBytes,
+          typename Allocator>
+typename BTree<T, Compare, KeyOfValue, NodeBytes, Allocator>::size_type
+BTree<T, Compare, KeyOfValue, NodeBytes, Allocator>::Size() const {
+  return size_;
+}
+
+// modifiers
+
+// Inserts value unless an element with an equivalent key exists. A full
+// leaf is split first; the split may propagate up to the root
+template <typename T, typename Compare, typename KeyOfValue, size_t NodeBytes,
+          typename Allocator>
+std::pair<
+    typename BTree<T, Compare, KeyOfValue, NodeBytes, Allocator>::iterator,
+    bool>
+BTree<T, Compare, KeyOfValue, NodeBytes, Allocator>::Insert(const T& value) {
+  if (root_ == nullptr) {
+    first_ = last_ = NewLeaf();
+    root_ = first_;
+  }
+
+  const key_type& key = KeyOfValue()(value);
+  Leaf* leaf = FindLeaf(key);
+  size_type index = LeafLowerBound(leaf, key);
+  if (index < leaf->count && !Less(key, KeyAt(leaf, index))) {
+    return std::make_pair(iterator(leaf, index), false);
+  }
+
+  if (leaf->count == kLeafSlots) {
+    Leaf* right = SplitLeaf(leaf);
+    if (index > leaf->count) {
+      index -= leaf->count;
+      leaf = right;
+    }
+  }
+  leaf->values.Open(index, leaf->count);
+  try {
+    leaf->values.Construct(index, value);
+  } catch (...) {
+    leaf->values.Close(index, leaf->count + 1);
+    throw;
+  }
+  ++leaf->count;
+  ++size_;
+
+  return std::make_pair(iterator(leaf, index), true);
+}
+
+// Removes one element; an underfull node borrows from a sibling or is merged
+// with it
+template <typename T, typename Compare, typename KeyOfValue, size_t NodeBytes,
+          typename Allocator>
+void BTree<T, Compare, KeyOfValue, NodeBytes, Allocator>::Erase(
+    const_iterator pos) {
+  Leaf* leaf = pos.leaf_;
+  leaf->values.Destroy(pos.index_);
+  leaf->values.Close(pos.index_, leaf->count);
+  --leaf->count;
+  --size_;
+
+  if (leaf == root_) {
+    if (leaf->count == 0) {
+      DeleteLeaf(leaf);
+      root_ = first_ = last_ = nullptr;
+    }
+  } else if (leaf->count < kMinLeaf) {
+    RebalanceLeaf(leaf);
+  }
+}
+
+template <typename T, typename Compare, typename KeyOfValue, size_t NodeBytes,
+          typename Allocator>
+void BTree<T, Compare, KeyOfValue, NodeBytes, Allocator>::Clear() {
+  if (root_ != nullptr) DeleteSubtree(root_);
+  root_ = first_ = last_ = nullptr;
+  size_ = 0;
+}
+
+template <typename T, typename Compare, typename KeyOfValue, size_t NodeBytes,
+          typename Allocator>
+void BTree<T, Compare, KeyOfValue, NodeBytes, Allocator>::Swap(
+    BTree& other) noexcept {
+  std::swap(root_, other.root_);
+  std::swap(first_, other.first_);
+  std::swap(last_, other.last_);
+  std::swap(size_, other.size_);
+  std::swap(leaves_, other.leaves_);
+  std::swap(inners_, other.inners_);
+  std::swap(comp_, other.comp_);
+  if constexpr (alloc_traits::propagate_on_container_swap::value) {
+    using std::swap;
+    swap(allocator_, other.allocator_);
+  }
+}
+
+// lookup
+
+template <typename T, typename Compare, typename KeyOfValue, size_t NodeBytes,
+          typename Allocator>
+template <typename K>
+typename BTree<T, Compare, KeyOfValue, NodeBytes, Allocator>::iterator
+BTree<T, Compare, KeyOfValue, NodeBytes, Allocator>::Find(const K& key) const {
+  if (root_ == nullptr) return iterator();
+  Leaf* leaf = FindLeaf(key);
+  size_type index = LeafLowerBound(leaf, key);
+  if (index == leaf->count || Less(key, KeyAt(leaf, index))) {
+    return iterator(last_, last_->count);
+  }
+  return iterator(leaf, index);
+}
+
+// The leaf of key holds the answer, or it is the first element of the next
+// leaf, which the iterator constructor steps to
+template <typename T, typename Compare, typename KeyOfValue, size_t NodeBytes,
+          typename Allocator>
+template <typename K>
+typename BTree<T, Compare, KeyOfValue, NodeBytes, Allocator>::iterator
+BTree<T, Compare, KeyOfValue, NodeBytes, Allocator>::LowerBound(
+    const K& key) const {
+  if (root_ == nullptr) return iterator();
+  Leaf* leaf = FindLeaf(key);
+  return iterator(leaf, LeafLowerBound(leaf, key));
+}
+
+template <typename T, typename Compare, typename KeyOfValue, size_t NodeBytes,
+          typename Allocator>
+template <typename K>
+typename BTree<T, Compare, KeyOfValue, NodeBytes, Allocator>::iterator
+BTree<T, Compare, KeyOfValue, NodeBytes, Allocator>::UpperBound(
+    const K& key) const {
+  if (root_ == nullptr) return iterator();
+  Leaf* leaf = FindLeaf(key);
+  return iterator(leaf, LeafUpperBound(leaf, key));
+}
+
+template <typename T, typename Compare, typename KeyOfValue, size_t NodeBytes,
+          typename Allocator>
+const Compare&
+BTree<T, Compare, KeyOfValue, NodeBytes, Allocator>::GetCompare() const {
+  return comp_;
+}
+
+template <typename T, typename Compare, typename KeyOfValue, size_t NodeBytes,
+          typename Allocator>
+typename BTree<T, Compare, KeyOfValue, NodeBytes, Allocator>::allocator_type
+BTree<T, Compare, KeyOfValue, NodeBytes, Allocator>::GetAllocator() const {
+  return allocator_;
+}
+
+template <typename T, typename Compare, typename KeyOfValue, size_t NodeBytes,
+          typename Allocator>
+typename BTree<T, Compare, KeyOfValue, NodeBytes, Allocator>::size_type
+BTree<T, Compare, KeyOfValue, NodeBytes, Allocator>::MemoryUsage() const {
+  return leaves_ * sizeof(Leaf) + inners_ * sizeof(Inner);
+}
+
+// Number of levels, all leaves are at the same depth
+template <typename T, typename Compare, typename KeyOfValue, size_t NodeBytes,
+          typename Allocator>
+int BTree<T, Compare, KeyOfValue, NodeBytes, Allocator>::Height() const {
+  int height = 0;
+  const Node* node = root_;
+  while (node != nullptr) {
+    ++height;
+    node = node->leaf ? nullptr : static_cast<const Inner*>(node)->children[0];
+  }
+  return height;
+}
+
+template <typename T, typename Compare, typename KeyOfValue, size_t NodeBytes,
+          typename Allocator>
+container_stats
+BTree<T, Compare, KeyOfValue, NodeBytes, Allocator>::GetStats() const {
+  return S21_STATS_GET();
+}
+
+// helpers
+
+template <typename T, typename Compare, typename KeyOfValue, size_t NodeBytes,
+          typename Allocator>
+template <typename A, typename B>
+bool BTree<T, Compare, KeyOfValue, NodeBytes, Allocator>::Less(
+    const A& lhs, const B& rhs) const {
+  S21_STATS(Comparison());
+  return comp_(lhs, rhs);
+}
+
+template <typename T, typename Compare, typename KeyOfValue, size_t NodeBytes,
+          typename Allocator>
+const typename BTree<T, Compare, KeyOfValue, NodeBytes, Allocator>::key_type&
+BTree<T, Compare, KeyOfValue, NodeBytes, Allocator>::KeyAt(
+    const Leaf* leaf, size_type i) const {
+  return KeyOfValue()(leaf->values[i]);
+}
+
+// Descends to the only leaf that may hold key; the tree must not be empty
+template <typename T, typename Compare, typename KeyOfValue, size_t NodeBytes,
+          typename Allocator>
+template <typename K>
+typename BTree<T, Compare, KeyOfValue, NodeBytes, Allocator>::Leaf*
+BTree<T, Compare, KeyOfValue, NodeBytes, Allocator>::FindLeaf(
+    const K& key) const {
+  S21_STATS(Lookup());
+  Node* node = root_;
+  while (!node->leaf) {
+    S21_STATS(NodeVisit());
+    const Inner* inner = static_cast<const Inner*>(node);
+    size_type low = 0;
+    size_type high = inner->count;
+    while (low < high) {
+      size_type middle = (low + high) / 2;
+      if (Less(key, inner->keys[middle])) {
+        high = middle;
+      } else {
+        low = middle + 1;
+      }
+    }
+    node = inner->children[low];
+  }
+  S21_STATS(NodeVisit());
+  return static_cast<Leaf*>(node);
+}
+
+template <typename T, typename Compare, typename KeyOfValue, size_t NodeBytes,
+          typename Allocator>
+template <typename K>
+typename BTree<T, Compare, KeyOfValue, NodeBytes, Allocator>::size_type
+BTree<T, Compare, KeyOfValue, NodeBytes, Allocator>::LeafLowerBound(
+    const Leaf* leaf, const K& key) const {
+  size_type low = 0;
+  size_type high = leaf->count;
+  while (low < high) {
+    size_type middle = (low + high) / 2;
+    if (Less(KeyAt(leaf, middle), key)) {
+      low = middle + 1;
+    } else {
+      high = middle;
+    }
+  }
+  return low;
+}
+
+template <typename T, typename Compare, typename KeyOfValue, size_t NodeBytes,
+          typename Allocator>
+template <typename K>
+typename BTree<T, Compare, KeyOfValue, NodeBytes, Allocator>::size_type
+BTree<T, Compare, KeyOfValue, NodeBytes, Allocator>::LeafUpperBound(
+    const Leaf* leaf, const K& key) const {
+  size_type low = 0;
+  size_type high = leaf->count;
+  while (low < high) {
+    size_type middle = (low + high) / 2;
+    if (Less(key, KeyAt(leaf, middle))) {
+      high = middle;
+    } else {
+      low = middle + 1;
+    }
+  }
+  return low;
+}
+
+// Moves the upper half of a full leaf to a new right sibling and adds the
+// first key of the sibling to the parent. The separator copy and every node
+// the split needs up to the root are made first, so nothing that can throw
+// runs once elements start moving
+template <typename T, typename Compare, typename KeyOfValue, size_t NodeBytes,
+          typename Allocator>
+typename BTree<T, Compare, KeyOfValue, NodeBytes, Allocator>::Leaf*
+BTree<T, Compare, KeyOfValue, NodeBytes, Allocator>::SplitLeaf(Leaf* leaf) {
+  size_type middle = leaf->count / 2;
+  key_type separator(KeyAt(leaf, middle));
+  Leaf* right = NewLeaf();
+  Inner* spare = nullptr;
+  try {
+    for (size_type i = SplitInners(leaf); i > 0; --i) {
+      Inner* node = NewInner();
+      node->parent = spare;
+      spare = node;
+    }
+  } catch (...) {
+    while (spare != nullptr) DeleteInner(TakeSpare(spare));
+    DeleteLeaf(right);
+    throw;
+  }
+
+  for (size_type i = middle; i < leaf->count; ++i) {
+    right->values.Relocate(i - middle, leaf->values, i);
+  }
+  right->count = static_cast<uint16_t>(leaf->count - middle);
+  leaf->count = static_cast<uint16_t>(middle);
+
+  right->prev = leaf;
+  right->next = leaf->next;
+  if (leaf->next != nullptr) {
+    leaf->next->prev = right;
+  } else {
+    last_ = right;
+  }
+  leaf->next = right;
+
+  InsertInParent(leaf, std::move(separator), right, spare);
+  return right;
+}
+
+// Moves the keys and children after the middle key of a full inner node to
+// a new right sibling taken from spare; the middle key goes up to the parent
+template <typename T, typename Compare, typename KeyOfValue, size_t NodeBytes,
+          typename Allocator>
+typename BTree<T, Compare, KeyOfValue, NodeBytes, Allocator>::Inner*
+BTree<T, Compare, KeyOfValue, NodeBytes, Allocator>::SplitInner(
+    Inner* node, Inner*& spare) {
+  Inner* right = TakeSpare(spare);
+  size_type middle = node->count / 2;
+  for (size_type i = middle + 1; i < node->count; ++i) {
+    right->keys.Relocate(i - middle - 1, node->keys, i);
+  }
+  for (size_type i = middle + 1; i <= node->count; ++i) {
+    SetChild(right, i - middle - 1, node->children[i]);
+  }
+  right->count = static_cast<uint16_t>(node->count - middle - 1);
+
+  key_type separator(std::move(node->keys[middle]));
+  node->keys.Destroy(middle);
+  node->count = static_cast<uint16_t>(middle);
+
+  InsertInParent(node, std::move(separator), right, spare);
+  return right;
+}
+
+// Links right as the sibling after left, separated by key; new inner nodes
+// come from spare
+template <typename T, typename Compare, typename KeyOfValue, size_t NodeBytes,
+          typename Allocator>
+void BTree<T, Compare, KeyOfValue, NodeBytes, Allocator>::InsertInParent(
+    Node* left, key_type&& key, Node* right, Inner*& spare) {
+  if (left == root_) {
+    Inner* root = TakeSpare(spare);
+    root->keys.Construct(0, std::move(key));
+    root->count = 1;
+    SetChild(root, 0, left);
+    SetChild(root, 1, right);
+    root_ = root;
+    return;
+  }
+
+  Inner* parent = left->parent;
+  size_type position = left->position;
+  if (parent->count == kInnerSlots) {
+    Inner* sibling = SplitInner(parent, spare);
+    if (position > parent->count) {
+      position -= parent->count + 1;
+      parent = sibling;
+    }
+  }
+  InsertIntoInner(parent, position, std::move(key), right);
+}
+
+// Inserts key at pos and child right after it at pos + 1
+template <typename T, typename Compare, typename KeyOfValue, size_t NodeBytes,
+          typename Allocator>
+void BTree<T, Compare, KeyOfValue, NodeBytes, Allocator>::InsertIntoInner(
+    Inner* node, size_type pos, key_type&& key, Node* child) {
+  node->keys.Open(pos, node->count);
+  node->keys.Construct(pos, std::move(key));
+  for (size_type i = node->count + 1; i > pos + 1; --i) {
+    SetChild(node, i, node->children[i - 1]);
+  }
+  SetChild(node, pos + 1, child);
+  ++node->count;
+}
+
+// Returns the number of inner nodes a split of leaf creates: one for every
+// full ancestor it propagates through and a new root if it reaches the root
+template <typename T, typename Compare, typename KeyOfValue, size_t NodeBytes,
+          typename Allocator>
+typename BTree<T, Compare, KeyOfValue, NodeBytes, Allocator>::size_type
+BTree<T, Compare, KeyOfValue, NodeBytes, Allocator>::SplitInners(
+    const Leaf* leaf) const {
+  size_type inners = 0;
+  const Node* node = leaf;
+  while (node != root_ && node->parent->count == kInnerSlots) {
+    ++inners;
+    node = node->parent;
+  }
+  return node == root_ ? inners + 1 : inners;
+}
+
+// Pops a node from a list of empty inner nodes chained through parent
+template <typename T, typename Compare, typename KeyOfValue, size_t NodeBytes,
+          typename Allocator>
+typename BTree<T, Compare, KeyOfValue, NodeBytes, Allocator>::Inner*
+BTree<T, Compare, KeyOfValue, NodeBytes, Allocator>::TakeSpare(Inner*& spare) {
+  Inner* node = spare;
+  spare = node->parent;
+  node->parent = nullptr;
+  return node;
+}
+
+// Refills a leaf that fell below kMinLeaf elements from a sibling with
+// spare elements, otherwise merges it with a sibling
+template <typename T, typename Compare, typename KeyOfValue, size_t NodeBytes,
+          typename Allocator>
+void BTree<T, Compare, KeyOfValue, NodeBytes, Allocator>::RebalanceLeaf(
+    Leaf* leaf) {
+  Inner* parent = leaf->parent;
+  size_type position = leaf->position;
+  Leaf* left = position > 0
+                   ? static_cast<Leaf*>(parent->children[position - 1])
+                   : nullptr;
+  Leaf* right = position < parent->count
+                    ? static_cast<Leaf*>(parent->children[position + 1])
+                    : nullptr;
+
+  if (left != nullptr && left->count > kMinLeaf) {
+    leaf->values.Open(0, leaf->count);
+    leaf->values.Relocate(0, left->values, left->count - 1);
+    --left->count;
+    ++leaf->count;
+    parent->keys[position - 1] = KeyAt(leaf, 0);
+  } else if (right != nullptr && right->count > kMinLeaf) {
+    leaf->values.Relocate(leaf->count, right->values, 0);
+    right->values.Close(0, right->count);
+    --right->count;
+    ++leaf->count;
+    parent->keys[position] = KeyAt(right, 0);
+  } else if (left != nullptr) {
+    MergeLeaves(left, leaf);
+    RemoveFromInner(parent, position - 1);
+  } else {
+    MergeLeaves(leaf, right);
+    RemoveFromInner(parent, position);
+  }
+}
+
+// Same for an inner node below kMinInner keys; keys rotate through the
+// separator in the parent
+template <typename T, typename Compare, typename KeyOfValue, size_t NodeBytes,
+          typename Allocator>
+void BTree<T, Compare, KeyOfValue, NodeBytes, Allocator>::RebalanceInner(
+    Inner* node) {
+  Inner* parent = node->parent;
+  size_type position = node->position;
+  Inner* left = position > 0
+                    ? static_cast<Inner*>(parent->children[position - 1])
+                    : nullptr;
+  Inner* right = position < parent->count
+                     ? static_cast<Inner*>(parent->children[position + 1])
+                     : nullptr;
+
+  if (left != nullptr && left->count > kMinInner) {
+    node->keys.Open(0, node->count);
+    node->keys.Construct(0, std::move(parent->keys[position - 1]));
+    for (size_type i = node->count + 1; i > 0; --i) {
+      SetChild(node, i, node->children[i - 1]);
+    }
+    SetChild(node, 0, left->children[left->count]);
+    parent->keys[position - 1] = std::move(left->keys[left->count - 1]);
+    left->keys.Destroy(left->count - 1);
+    --left->count;
+    ++node->count;
+  } else if (right != nullptr && right->count > kMinInner) {
+    node->keys.Construct(node->count, std::move(parent->keys[position]));
+    SetChild(node, node->count + 1, right->children[0]);
+    parent->keys[position] = std::move(right->keys[0]);
+    right->keys.Destroy(0);
+    right->keys.Close(0, right->count);
+    for (size_type i = 0; i < right->count; ++i) {
+      SetChild(right, i, right->children[i + 1]);
+    }
+    --right->count;
+    ++node->count;
+  } else if (left != nullptr) {
+    MergeInner(left, node, parent->keys[position - 1]);
+    RemoveFromInner(parent, position - 1);
+  } else {
+    MergeInner(node, right, parent->keys[position]);
+    RemoveFromInner(parent, position);
+  }
+}
+
+// Appends the elements of right to left and unlinks right from the list
+template <typename T, typename Compare, typename KeyOfValue, size_t NodeBytes,
+          typename Allocator>
+void BTree<T, Compare, KeyOfValue, NodeBytes, Allocator>::MergeLeaves(
+    Leaf* left, Leaf* right) {
+  for (size_type i = 0; i < right->count; ++i) {
+    left->values.Relocate(left->count + i, right->values, i);
+  }
+  left->count = static_cast<uint16_t>(left->count + right->count);
+  right->count = 0;
+
+  left->next = right->next;
+  if (right->next != nullptr) {
+    right->next->prev = left;
+  } else {
+    last_ = left;
+  }
+  DeleteLeaf(right);
+}
+
+// Appends separator, then the keys and children of right, to left
+template <typename T, typename Compare, typename KeyOfValue, size_t NodeBytes,
+          typename Allocator>
+void BTree<T, Compare, KeyOfValue, NodeBytes, Allocator>::MergeInner(
+    Inner* left, Inner* right, const key_type& separator) {
+  left->keys.Construct(left->count, separator);
+  size_type offset = left->count + 1;
+  for (size_type i = 0; i < right->count; ++i) {
+    left->keys.Relocate(offset + i, right->keys, i);
+  }
+  for (size_type i = 0; i <= right->count; ++i) {
+    SetChild(left, offset + i, right->children[i]);
+  }
+  left->count = static_cast<uint16_t>(offset + right->count);
+  right->count = 0;
+  DeleteInner(right);
+}
+
+// Drops key index and the child after it; the root shrinks once it is left
+// with a single child
+template <typename T, typename Compare, typename KeyOfValue, size_t NodeBytes,
+          typename Allocator>
+void BTree<T, Compare, KeyOfValue, NodeBytes, Allocator>::RemoveFromInner(
+    Inner* node, size_type index) {
+  node->keys.Destroy(index);
+  node->keys.Close(index, node->count);
+  for (size_type i = index + 1; i < node->count; ++i) {
+    SetChild(node, i, node->children[i + 1]);
+  }
+  --node->count;
+
+  if (node == root_) {
+    if (node->count == 0) {
+      root_ = node->children[0];
+      root_->parent = nullptr;
+      root_->position = 0;
+      DeleteInner(node);
+    }
+  } else if (node->count < kMinInner) {
+    RebalanceInner(node);
+  }
+}
+
+template <typename T, typename Compare, typename KeyOfValue, size_t NodeBytes,
+          typename Allocator>
+void BTree<T, Compare, KeyOfValue, NodeBytes, Allocator>::SetChild(
+    Inner* node, size_type index, Node* child) {
+  node->children[index] = child;
+  child->parent = node;
+  child->position = static_cast<uint16_t>(index);
+}
+
+template <typename T, typename Compare, typename KeyOfValue, size_t NodeBytes,
+          typename Allocator>
+typename BTree<T, Compare, KeyOfValue, NodeBytes, Allocator>::Leaf*
+BTree<T, Compare, KeyOfValue, NodeBytes, Allocator>::NewLeaf() {
+  leaf_allocator alloc(allocator_);
+  Leaf* leaf = leaf_traits::allocate(alloc, 1);
+  leaf_traits::construct(alloc, leaf);
+  S21_STATS(Allocation(sizeof(Leaf)));
+  ++leaves_;
+  return leaf;
+}
+
+template <typename T, typename Compare, typename KeyOfValue, size_t NodeBytes,
+          typename Allocator>
+typename BTree<T, Compare, KeyOfValue, NodeBytes, Allocator>::Inner*
+BTree<T, Compare, KeyOfValue, NodeBytes, Allocator>::NewInner() {
+  inner_allocator alloc(allocator_);
+  Inner* node = inner_traits::allocate(alloc, 1);
+  inner_traits::construct(alloc, node);
+  S21_STATS(Allocation(sizeof(Inner)));
+  ++inners_;
+  return node;
+}
+
+template <typename T, typename Compare, typename KeyOfValue, size_t NodeBytes,
+          typename Allocator>
+void BTree<T, Compare, KeyOfValue, NodeBytes, Allocator>::DeleteLeaf(
+    Leaf* leaf) {
+  for (size_type i = 0; i < leaf->count; ++i) leaf->values.Destroy(i);
+  leaf_allocator alloc(allocator_);
+  leaf_traits::destroy(alloc, leaf);
+  leaf_traits::deallocate(alloc, leaf, 1);
+  S21_STATS(Deallocation());
+  --leaves_;
+}
+
+template <typename T, typename Compare, typename KeyOfValue, size_t NodeBytes,
+          typename Allocator>
+void BTree<T, Compare, KeyOfValue, NodeBytes, Allocator>::DeleteInner(
+    Inner* node) {
+  for (size_type i = 0; i < node->count; ++i) node->keys.Destroy(i);
+  inner_allocator alloc(allocator_);
+  inner_traits::destroy(alloc, node);
+  inner_traits::deallocate(alloc, node, 1);
+  S21_STATS(Deallocation());
+  --inners_;
+}
+
+template <typename T, typename Compare, typename KeyOfValue, size_t NodeBytes,
+          typename Allocator>
+void BTree<T, Compare, KeyOfValue, NodeBytes, Allocator>::DeleteSubtree(
+    Node* node) {
+  if (node->leaf) {
+    DeleteLeaf(static_cast<Leaf*>(node));
+    return;
+  }
+  Inner* inner = static_cast<Inner*>(node);
+  for (size_type i = 0; i <= inner->count; ++i) {
+    DeleteSubtree(inner->children[i]);
+  }
+  DeleteInner(inner);
+}
+
+// Takes over the nodes of other, which is left empty
+template <typename T, typename Compare, typename KeyOfValue, size_t NodeBytes,
+          typename Allocator>
+void BTree<T, Compare, KeyOfValue, NodeBytes, Allocator>::Adopt(BTree& other) {
+  root_ = std::exchange(other.root_, nullptr);
+  first_ = std::exchange(other.first_, nullptr);
+  last_ = std::exchange(other.last_, nullptr);
+  size_ = std::exchange(other.size_, 0);
+  leaves_ = std::exchange(other.leaves_, 0);
+  inners_ = std::exchange(other.inners_, 0);
+  comp_ = other.comp_;
+}
+
+// Fills an empty tree with a copy of the nodes of other
+template <typename T, typename Compare, typename KeyOfValue, size_t NodeBytes,
+          typename Allocator>
+void BTree<T, Compare, KeyOfValue, NodeBytes, Allocator>::CloneTree(
+    const BTree& other) {
+  if (other.root_ == nullptr) return;
+  Leaf* last = nullptr;
+  root_ = CloneSubtree(other.root_, nullptr, 0, last);
+  last_ = last;
+  size_ = other.size_;
+}
+
+// Copies a subtree, threading its leaves after last. If a copy throws, the
+// nodes of the subtree built so far are freed before rethrowing
+template <typename T, typename Compare, typename KeyOfValue, size_t NodeBytes,
+          typename Allocator>
+typename BTree<T, Compare, KeyOfValue, NodeBytes, Allocator>::Node*
+BTree<T, Compare, KeyOfValue, NodeBytes, Allocator>::CloneSubtree(
+    const Node* node, Inner* parent, size_type position, Leaf*& last) {
+  Node* copy = nullptr;
+  if (node->leaf) {
+    const Leaf* source = static_cast<const Leaf*>(node);
+    Leaf* leaf = NewLeaf();
+    try {
+      for (; leaf->count < source->count; ++leaf->count) {
+        leaf->values.Construct(leaf->count, source->values[leaf->count]);
+      }
+    } catch (...) {
+      DeleteLeaf(leaf);
+      throw;
+    }
+    leaf->prev = last;
+    if (last != nullptr) {
+      last->next = leaf;
+    } else {
+      first_ = leaf;
+    }
+    last = leaf;
+    copy = leaf;
+  } else {
+    const Inner* source = static_cast<const Inner*>(node);
+    Inner* inner = NewInner();
+    size_type cloned = 0;
+    try {
+      for (; inner->count < source->count; ++inner->count) {
+        inner->keys.Construct(inner->count, source->keys[inner->count]);
+      }
+      for (; cloned <= source->count; ++cloned) {
+        CloneSubtree(source->children[cloned], inner, cloned, last);
+      }
+    } catch (...) {
+      for (size_type i = 0; i < cloned; ++i) DeleteSubtree(inner->children[i]);
+      DeleteInner(inner);
+      throw;
+    }
+    copy = inner;
+  }
+
+  if (parent != nullptr) SetChild(parent, position, copy);
+  return copy;
+}
+
+}  // namespace s21
+
+#endif
@@ -0,0 +1,113 @@
+#ifndef S21_CONTAINERS_BTREE_MAP_H
+#define S21_CONTAINERS_BTREE_MAP_H
+
+#include <initializer_list>
+#include <limits>
+#include <memory>
+#include <memory_resource>
+#include <stdexcept>
+
+#include "../BTree/s21_btree.h"
+
+namespace s21 {
+// Ordered map on a B+-tree (see BTree) with the interface of s21::map. Any
+// insertion or erasure invalidates iterators and references
+template <typename Key, typename T, typename Compare = std::less<Key>,
+          size_t NodeBytes = 256,
+          typename Allocator = std::allocator<std::pair<const Key, T>>>
+class btree_map {
+ public:
+  // member type
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<const Key, T>;
+  using key_compare = Compare;
+  using reference = value_type&;
+  using const_reference = const value_type&;
+  using tree_type = BTree<value_type, Compare, PairFirstKey<value_type>,
+                          NodeBytes, Allocator>;
+  using iterator = typename tree_type::iterator;
+  using const_iterator = typename tree_type::const_iterator;
+  using size_type = size_t;
+  using allocator_type = Allocator;
+
+  // functions
+  btree_map();
+  explicit btree_map(const Compare& comp, const Allocator& alloc = Allocator());
+  explicit btree_map(const Allocator& alloc);
+  btree_map(std::initializer_list<value_type> const& items,
+            const Allocator& alloc = Allocator());
+  btree_map(const btree_map& other) = default;
+  btree_map(btree_map&& other) noexcept = default;
+  btree_map(const btree_map& other, const Allocator& alloc);
+  btree_map(btree_map&& other, const Allocator& alloc);
+  ~btree_map() = default;
+  btree_map& operator=(const btree_map& other) = default;
+  btree_map& operator=(btree_map&& other) = default;
+  allocator_type get_allocator() const;
+
+  // element access
+  mapped_type& at(const Key& key);
+  const mapped_type& at(const Key& key) const;
+  mapped_type& operator[](const Key& key);
+
+  // iterators
+  iterator begin();
+  iterator end();
+  const_iterator begin() const;
+  const_iterator end() const;
+
+  // capacity
+  bool empty() const;
+  size_type size() const;
+  size_type max_size() const;
+
+  // modifiers
+  void clear();
+  std::pair<iterator, bool> insert(const value_type& value);
+  std::pair<iterator, bool> insert(const Key& key, const T& obj);
+  std::pair<iterator, bool> insert_or_assign(const Key& key, const T& obj);
+  void erase(const_iterator pos);
+  void swap(btree_map& other) noexcept;
+  void merge(btree_map& other);
+
+  // lookup
+  bool contains(const Key& key) const;
+  iterator find(const Key& key);
+  const_iterator find(const Key& key) const;
+  // Heterogeneous lookup, only with a comparator that has is_transparent
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  bool contains(const K& key) const;
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  iterator find(const K& key);
+  iterator lower_bound(const Key& key);
+  iterator upper_bound(const Key& key);
+  std::pair<iterator, iterator> equal_range(const Key& key);
+  // Elements with keys in [first, last)
+  RangeView<iterator> range(const Key& first, const Key& last);
+
+  // observers
+  key_compare key_comp() const;
+  const tree_type& get_tree() const;
+
+  // instrumentation, zeros unless built with S21_CONTAINERS_STATS
+  container_stats stats() const;
+
+ private:
+  tree_type tree_;
+};
+
+namespace pmr {
+template <typename Key, typename T, typename Compare = std::less<Key>,
+          size_t NodeBytes = 256>
+using btree_map =
+    s21::btree_map<Key, T, Compare, NodeBytes,
+                   std::pmr::polymorphic_allocator<std::pair<const Key, T>>>;
+}  // namespace pmr
+}  // namespace s21
+
+#include "s21_btree_map.tpp"
+
+#endif
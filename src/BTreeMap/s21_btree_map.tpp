@@ -0,0 +1,292 @@
+#ifndef S21_CONTAINERS_BTREE_MAP_TPP
+#define S21_CONTAINERS_BTREE_MAP_TPP
+
+#include <utility>
+
+namespace s21 {
+
+// functions
+
+template <typename Key, typename T, typename Compare, size_t NodeBytes,
+          typename Allocator>
+btree_map<Key, T, Compare, NodeBytes, Allocator>::btree_map() : tree_() {}
+
+template <typename Key, typename T, typename Compare, size_t NodeBytes,
+          typename Allocator>
+btree_map<Key, T, Compare, NodeBytes, Allocator>::btree_map(
+    const Compare& comp, const Allocator& alloc)
+    : tree_(comp, alloc) {}
+
+template <typename Key, typename T, typename Compare, size_t NodeBytes,
+          typename Allocator>
+btree_map<Key, T, Compare, NodeBytes, Allocator>::btree_map(
+    const Allocator& alloc)
+    : tree_(Compare(), alloc) {}
+
+template <typename Key, typename T, typename Compare, size_t NodeBytes,
+          typename Allocator>
+btree_map<Key, T, Compare, NodeBytes, Allocator>::btree_map(
+    std::initializer_list<value_type> const& items, const Allocator& alloc)
+    : tree_(Compare(), alloc) {
+  for (const auto& item : items) insert(item);
+}
+
+template <typename Key, typename T, typename Compare, size_t NodeBytes,
+          typename Allocator>
+btree_map<Key, T, Compare, NodeBytes, Allocator>::btree_map(
+    const btree_map& other, const Allocator& alloc)
+    : tree_(other.tree_, alloc) {}
+
+template <typename Key, typename T, typename Compare, size_t NodeBytes,
+          typename Allocator>
+btree_map<Key, T, Compare, NodeBytes, Allocator>::btree_map(
+    btree_map&& other, const Allocator& alloc)
+    : tree_(std::move(other.tree_), alloc) {}
+
+template <typename Key, typename T, typename Compare, size_t NodeBytes,
+          typename Allocator>
+typename btree_map<Key, T, Compare, NodeBytes, Allocator>::allocator_type
+btree_map<Key, T, Compare, NodeBytes, Allocator>::get_allocator() const {
+  return tree_.GetAllocator();
+}
+
+// element access
+
+template <typename Key, typename T, typename Compare, size_t NodeBytes,
+          typename Allocator>
+typename btree_map<Key, T, Compare, NodeBytes, Allocator>::mapped_type&
+btree_map<Key, T, Compare, NodeBytes, Allocator>::at(const Key& key) {
+  iterator it = tree_.Find(key);
+  if (it == tree_.End()) throw std::invalid_argument("This key doesn't exist");
+  return it->second;
+}
+
+template <typename Key, typename T, typename Compare, size_t NodeBytes,
+          typename Allocator>
+const typename btree_map<Key, T, Compare, NodeBytes, Allocator>::mapped_type&
+btree_map<Key, T, Compare, NodeBytes, Allocator>::at(const Key& key) const {
+  const_iterator it = tree_.Find(key);
+  if (it == tree_.End()) throw std::invalid_argument("This key doesn't exist");
+  return it->second;
+}
+
+template <typename Key, typename T, typename Compare, size_t NodeBytes,
+          typename Allocator>
+typename btree_map<Key, T, Compare, NodeBytes, Allocator>::mapped_type&
+btree_map<Key, T, Compare, NodeBytes, Allocator>::operator[](const Key& key) {
+  iterator it = tree_.Find(key);
+  if (it == tree_.End()) it = tree_.Insert(value_type(key, T())).first;
+  return it->second;
+}
+
+// iterators
+
+template <typename Key, typename T, typename Compare, size_t NodeBytes,
+          typename Allocator>
+typename btree_map<Key, T, Compare, NodeBytes, Allocator>::iterator
+btree_map<Key, T, Compare, NodeBytes, Allocator>::begin() {
+  return tree_.Begin();
+}
+
+template <typename Key, typename T, typename Compare, size_t NodeBytes,
+          typename Allocator>
+typename btree_map<Key, T, Compare, NodeBytes, Allocator>::iterator
+btree_map<Key, T, Compare, NodeBytes, Allocator>::end() {
+  return tree_.End();
+}
+
+template <typename Key, typename T, typename Compare, size_t NodeBytes,
+          typename Allocator>
+typename btree_map<Key, T, Compare, NodeBytes, Allocator>::const_iterator
+btree_map<Key, T, Compare, NodeBytes, Allocator>::begin() const {
+  return tree_.Begin();
+}
+
+template <typename Key, typename T, typename Compare, size_t NodeBytes,
+          typename Allocator>
+typename btree_map<Key, T, Compare, NodeBytes, Allocator>::const_iterator
+btree_map<Key, T, Compare, NodeBytes, Allocator>::end() const {
+  return tree_.End();
+}
+
+// capacity
+
+template <typename Key, typename T, typename Compare, size_t NodeBytes,
+          typename Allocator>
+bool btree_map<Key, T, Compare, NodeBytes, Allocator>::empty() const {
+  return tree_.Size() == 0;
+}
+
+template <typename Key, typename T, typename Compare, size_t NodeBytes,
+          typename Allocator>
+typename btree_map<Key, T, Compare, NodeBytes, Allocator>::size_type
+btree_map<Key, T, Compare, NodeBytes, Allocator>::size() const {
+  return tree_.Size();
+}
+
+template <typename Key, typename T, typename Compare, size_t NodeBytes,
+          typename Allocator>
+typename btree_map<Key, T, Compare, NodeBytes, Allocator>::size_type
+btree_map<Key, T, Compare, NodeBytes, Allocator>::max_size() const {
+  return std::numeric_limits<size_type>::max() / sizeof(value_type);
+}
+
+// modifiers
+
+template <typename Key, typename T, typename Compare, size_t NodeBytes,
+          typename Allocator>
+void btree_map<Key, T, Compare, NodeBytes, Allocator>::clear() {
+  tree_.Clear();
+}
+
+template <typename Key, typename T, typename Compare, size_t NodeBytes,
+          typename Allocator>
+std::pair<typename btree_map<Key, T, Compare, NodeBytes, Allocator>::iterator,
+          bool>
+btree_map<Key, T, Compare, NodeBytes, Allocator>::insert(
+    const value_type& value) {
+  return tree_.Insert(value);
+}
+
+template <typename Key, typename T, typename Compare, size_t NodeBytes,
+          typename Allocator>
+std::pair<typename btree_map<Key, T, Compare, NodeBytes, Allocator>::iterator,
+          bool>
+btree_map<Key, T, Compare, NodeBytes, Allocator>::insert(
+    const Key& key, const T& obj) {
+  return tree_.Insert(value_type(key, obj));
+}
+
+template <typename Key, typename T, typename Compare, size_t NodeBytes,
+          typename Allocator>
+std::pair<typename btree_map<Key, T, Compare, NodeBytes, Allocator>::iterator,
+          bool>
+btree_map<Key, T, Compare, NodeBytes, Allocator>::insert_or_assign(
+    const Key& key, const T& obj) {
+  auto result = tree_.Insert(value_type(key, obj));
+  if (!result.second) result.first->second = obj;
+  return result;
+}
+
+template <typename Key, typename T, typename Compare, size_t NodeBytes,
+          typename Allocator>
+void btree_map<Key, T, Compare, NodeBytes, Allocator>::erase(
+    const_iterator pos) {
+  tree_.Erase(pos);
+}
+
+template <typename Key, typename T, typename Compare, size_t NodeBytes,
+          typename Allocator>
+void btree_map<Key, T, Compare, NodeBytes, Allocator>::swap(
+    btree_map& other) noexcept {
+  tree_.Swap(other.tree_);
+}
+
+// Moves the keys missing here, duplicates stay in other. Erasing from a
+// B-tree invalidates iterators, so the leftovers are collected in a new tree
+template <typename Key, typename T, typename Compare, size_t NodeBytes,
+          typename Allocator>
+void btree_map<Key, T, Compare, NodeBytes, Allocator>::merge(btree_map& other) {
+  if (this == &other) return;
+  tree_type rest(other.tree_.GetCompare(), other.tree_.GetAllocator());
+  for (const auto& item : other) {
+    if (!tree_.Insert(item).second) rest.Insert(item);
+  }
+  other.tree_ = std::move(rest);
+}
+
+// lookup
+
+template <typename Key, typename T, typename Compare, size_t NodeBytes,
+          typename Allocator>
+bool btree_map<Key, T, Compare, NodeBytes, Allocator>::contains(
+    const Key& key) const {
+  return tree_.Find(key) != tree_.End();
+}
+
+template <typename Key, typename T, typename Compare, size_t NodeBytes,
+          typename Allocator>
+typename btree_map<Key, T, Compare, NodeBytes, Allocator>::iterator
+btree_map<Key, T, Compare, NodeBytes, Allocator>::find(const Key& key) {
+  return tree_.Find(key);
+}
+
+template <typename Key, typename T, typename Compare, size_t NodeBytes,
+          typename Allocator>
+typename btree_map<Key, T, Compare, NodeBytes, Allocator>::const_iterator
+btree_map<Key, T, Compare, NodeBytes, Allocator>::find(const Key& key) const {
+  return tree_.Find(key);
+}
+
+template <typename Key, typename T, typename Compare, size_t NodeBytes,
+          typename Allocator>
+template <typename K, typename, typename>
+bool btree_map<Key, T, Compare, NodeBytes, Allocator>::contains(
+    const K& key) const {
+  return tree_.Find(key) != tree_.End();
+}
+
+template <typename Key, typename T, typename Compare, size_t NodeBytes,
+          typename Allocator>
+template <typename K, typename, typename>
+typename btree_map<Key, T, Compare, NodeBytes, Allocator>::iterator
+btree_map<Key, T, Compare, NodeBytes, Allocator>::find(const K& key) {
+  return tree_.Find(key);
+}
+
+template <typename Key, typename T, typename Compare, size_t NodeBytes,
+          typename Allocator>
+typename btree_map<Key, T, Compare, NodeBytes, Allocator>::iterator
+btree_map<Key, T, Compare, NodeBytes, Allocator>::lower_bound(const Key& key) {
+  return tree_.LowerBound(key);
+}
+
+template <typename Key, typename T, typename Compare, size_t NodeBytes,
+          typename Allocator>
+typename btree_map<Key, T, Compare, NodeBytes, Allocator>::iterator
+btree_map<Key, T, Compare, NodeBytes, Allocator>::upper_bound(const Key& key) {
+  return tree_.UpperBound(key);
+}
+
+template <typename Key, typename T, typename Compare, size_t NodeBytes,
+          typename Allocator>
+std::pair<typename btree_map<Key, T, Compare, NodeBytes, Allocator>::iterator,
+          typename btree_map<Key, T, Compare, NodeBytes, Allocator>::iterator>
+btree_map<Key, T, Compare, NodeBytes, Allocator>::equal_range(const Key& key) {
+  return std::make_pair(lower_bound(key), upper_bound(key));
+}
+
+template <typename Key, typename T, typename Compare, size_t NodeBytes,
+          typename Allocator>
+RangeView<typename btree_map<Key, T, Compare, NodeBytes, Allocator>::iterator>
+btree_map<Key, T, Compare, NodeBytes, Allocator>::range(
+    const Key& first, const Key& last) {
+  return RangeView<iterator>(lower_bound(first), lower_bound(last));
+}
+
+// observers
+
+template <typename Key, typename T, typename Compare, size_t NodeBytes,
+          typename Allocator>
+typename btree_map<Key, T, Compare, NodeBytes, Allocator>::key_compare
+btree_map<Key, T, Compare, NodeBytes, Allocator>::key_comp() const {
+  return tree_.GetCompare();
+}
+
+template <typename Key, typename T, typename Compare, size_t NodeBytes,
+          typename Allocator>
+const typename btree_map<Key, T, Compare, NodeBytes, Allocator>::tree_type&
+btree_map<Key, T, Compare, NodeBytes, Allocator>::get_tree() const {
+  return tree_;
+}
+
+template <typename Key, typename T, typename Compare, size_t NodeBytes,
+          typename Allocator>
+container_stats
+btree_map<Key, T, Compare, NodeBytes, Allocator>::stats() const {
+  return tree_.GetStats();
+}
+
+}  // namespace s21
+
+#endif
@@ -0,0 +1,97 @@
+#ifndef S21_CONTAINERS_BTREE_SET_H
+#define S21_CONTAINERS_BTREE_SET_H
+
+#include <initializer_list>
+#include <limits>
+#include <memory>
+#include <memory_resource>
+
+#include "../BTree/s21_btree.h"
+
+namespace s21 {
+// Ordered set on a B+-tree (see BTree) with the interface of s21::set. Any
+// insertion or erasure invalidates iterators
+template <typename T, typename Compare = std::less<T>, size_t NodeBytes = 256,
+          typename Allocator = std::allocator<T>>
+class btree_set {
+ public:
+  // member type
+  using key_type = T;
+  using value_type = T;
+  using key_compare = Compare;
+  using reference = const T&;
+  using const_reference = const T&;
+  using tree_type = BTree<T, Compare, IdentityKey<T>, NodeBytes, Allocator>;
+  using iterator = typename tree_type::const_iterator;
+  using const_iterator = typename tree_type::const_iterator;
+  using size_type = size_t;
+  using allocator_type = Allocator;
+
+  // functions
+  btree_set();
+  explicit btree_set(const Compare& comp, const Allocator& alloc = Allocator());
+  explicit btree_set(const Allocator& alloc);
+  btree_set(std::initializer_list<value_type> const& items,
+            const Allocator& alloc = Allocator());
+  btree_set(const btree_set& other) = default;
+  btree_set(btree_set&& other) noexcept = default;
+  btree_set(const btree_set& other, const Allocator& alloc);
+  btree_set(btree_set&& other, const Allocator& alloc);
+  ~btree_set() = default;
+  btree_set& operator=(const btree_set& other) = default;
+  btree_set& operator=(btree_set&& other) = default;
+  allocator_type get_allocator() const;
+
+  // iterators
+  iterator begin() const;
+  iterator end() const;
+
+  // capacity
+  bool empty() const;
+  size_type size() const;
+  size_type max_size() const;
+
+  // modifiers
+  void clear();
+  std::pair<iterator, bool> insert(const value_type& value);
+  void erase(iterator pos);
+  void swap(btree_set& other) noexcept;
+  void merge(btree_set& other);
+
+  // lookup
+  bool contains(const T& key) const;
+  iterator find(const T& key) const;
+  // Heterogeneous lookup, only with a comparator that has is_transparent
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  bool contains(const K& key) const;
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  iterator find(const K& key) const;
+  iterator lower_bound(const T& key) const;
+  iterator upper_bound(const T& key) const;
+  std::pair<iterator, iterator> equal_range(const T& key) const;
+  // Elements with keys in [first, last)
+  RangeView<iterator> range(const T& first, const T& last) const;
+
+  // observers
+  key_compare key_comp() const;
+  const tree_type& get_tree() const;
+
+  // instrumentation, zeros unless built with S21_CONTAINERS_STATS
+  container_stats stats() const;
+
+ private:
+  tree_type tree_;
+};
+
+namespace pmr {
+template <typename T, typename Compare = std::less<T>, size_t NodeBytes = 256>
+using btree_set =
+    s21::btree_set<T, Compare, NodeBytes, std::pmr::polymorphic_allocator<T>>;
+}  // namespace pmr
+}  // namespace s21
+
+#include "s21_btree_set.tpp"
+
+#endif
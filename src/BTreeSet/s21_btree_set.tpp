@@ -0,0 +1,188 @@
+#ifndef S21_CONTAINERS_BTREE_SET_TPP
+#define S21_CONTAINERS_BTREE_SET_TPP
+
+#include <utility>
+
+namespace s21 {
+
+// functions
+
+template <typename T, typename Compare, size_t NodeBytes, typename Allocator>
+btree_set<T, Compare, NodeBytes, Allocator>::btree_set() : tree_() {}
+
+template <typename T, typename Compare, size_t NodeBytes, typename Allocator>
+btree_set<T, Compare, NodeBytes, Allocator>::btree_set(
+    const Compare& comp, const Allocator& alloc)
+    : tree_(comp, alloc) {}
+
+template <typename T, typename Compare, size_t NodeBytes, typename Allocator>
+btree_set<T, Compare, NodeBytes, Allocator>::btree_set(const Allocator& alloc)
+    : tree_(Compare(), alloc) {}
+
+template <typename T, typename Compare, size_t NodeBytes, typename Allocator>
+btree_set<T, Compare, NodeBytes, Allocator>::btree_set(
+    std::initializer_list<value_type> const& items, const Allocator& alloc)
+    : tree_(Compare(), alloc) {
+  for (const auto& item : items) insert(item);
+}
+
+template <typename T, typename Compare, size_t NodeBytes, typename Allocator>
+btree_set<T, Compare, NodeBytes, Allocator>::btree_set(
+    const btree_set& other, const Allocator& alloc)
+    : tree_(other.tree_, alloc) {}
+
+template <typename T, typename Compare, size_t NodeBytes, typename Allocator>
+btree_set<T, Compare, NodeBytes, Allocator>::btree_set(
+    btree_set&& other, const Allocator& alloc)
+    : tree_(std::move(other.tree_), alloc) {}
+
+template <typename T, typename Compare, size_t NodeBytes, typename Allocator>
+typename btree_set<T, Compare, NodeBytes, Allocator>::allocator_type
+btree_set<T, Compare, NodeBytes, Allocator>::get_allocator() const {
+  return tree_.GetAllocator();
+}
+
+// iterators
+
+template <typename T, typename Compare, size_t NodeBytes, typename Allocator>
+typename btree_set<T, Compare, NodeBytes, Allocator>::iterator
+btree_set<T, Compare, NodeBytes, Allocator>::begin() const {
+  return tree_.Begin();
+}
+
+template <typename T, typename Compare, size_t NodeBytes, typename Allocator>
+typename btree_set<T, Compare, NodeBytes, Allocator>::iterator
+btree_set<T, Compare, NodeBytes, Allocator>::end() const {
+  return tree_.End();
+}
+
+// capacity
+
+template <typename T, typename Compare, size_t NodeBytes, typename Allocator>
+bool btree_set<T, Compare, NodeBytes, Allocator>::empty() const {
+  return tree_.Size() == 0;
+}
+
+template <typename T, typename Compare, size_t NodeBytes, typename Allocator>
+typename btree_set<T, Compare, NodeBytes, Allocator>::size_type
+btree_set<T, Compare, NodeBytes, Allocator>::size() const {
+  return tree_.Size();
+}
+
+template <typename T, typename Compare, size_t NodeBytes, typename Allocator>
+typename btree_set<T, Compare, NodeBytes, Allocator>::size_type
+btree_set<T, Compare, NodeBytes, Allocator>::max_size() const {
+  return std::numeric_limits<size_type>::max() / sizeof(value_type);
+}
+
+// modifiers
+
+template <typename T, typename Compare, size_t NodeBytes, typename Allocator>
+void btree_set<T, Compare, NodeBytes, Allocator>::clear() {
+  tree_.Clear();
+}
+
+template <typename T, typename Compare, size_t NodeBytes, typename Allocator>
+std::pair<typename btree_set<T, Compare, NodeBytes, Allocator>::iterator, bool>
+btree_set<T, Compare, NodeBytes, Allocator>::insert(const value_type& value) {
+  auto result = tree_.Insert(value);
+  return std::make_pair(iterator(result.first), result.second);
+}
+
+template <typename T, typename Compare, size_t NodeBytes, typename Allocator>
+void btree_set<T, Compare, NodeBytes, Allocator>::erase(iterator pos) {
+  tree_.Erase(pos);
+}
+
+template <typename T, typename Compare, size_t NodeBytes, typename Allocator>
+void btree_set<T, Compare, NodeBytes, Allocator>::swap(
+    btree_set& other) noexcept {
+  tree_.Swap(other.tree_);
+}
+
+// Moves the keys missing here, duplicates stay in other. Erasing from a
+// B-tree invalidates iterators, so the leftovers are collected in a new tree
+template <typename T, typename Compare, size_t NodeBytes, typename Allocator>
+void btree_set<T, Compare, NodeBytes, Allocator>::merge(btree_set& other) {
+  if (this == &other) return;
+  tree_type rest(other.tree_.GetCompare(), other.tree_.GetAllocator());
+  for (const auto& item : other) {
+    if (!tree_.Insert(item).second) rest.Insert(item);
+  }
+  other.tree_ = std::move(rest);
+}
+
+// lookup
+
+template <typename T, typename Compare, size_t NodeBytes, typename Allocator>
+bool btree_set<T, Compare, NodeBytes, Allocator>::contains(const T& key) const {
+  return tree_.Find(key) != tree_.End();
+}
+
+template <typename T, typename Compare, size_t NodeBytes, typename Allocator>
+typename btree_set<T, Compare, NodeBytes, Allocator>::iterator
+btree_set<T, Compare, NodeBytes, Allocator>::find(const T& key) const {
+  return tree_.Find(key);
+}
+
+template <typename T, typename Compare, size_t NodeBytes, typename Allocator>
+template <typename K, typename, typename>
+bool btree_set<T, Compare, NodeBytes, Allocator>::contains(const K& key) const {
+  return tree_.Find(key) != tree_.End();
+}
+
+template <typename T, typename Compare, size_t NodeBytes, typename Allocator>
+template <typename K, typename, typename>
+typename btree_set<T, Compare, NodeBytes, Allocator>::iterator
+btree_set<T, Compare, NodeBytes, Allocator>::find(const K& key) const {
+  return tree_.Find(key);
+}
+
+template <typename T, typename Compare, size_t NodeBytes, typename Allocator>
+typename btree_set<T, Compare, NodeBytes, Allocator>::iterator
+btree_set<T, Compare, NodeBytes, Allocator>::lower_bound(const T& key) const {
+  return tree_.LowerBound(key);
+}
+
+template <typename T, typename Compare, size_t NodeBytes, typename Allocator>
+typename btree_set<T, Compare, NodeBytes, Allocator>::iterator
+btree_set<T, Compare, NodeBytes, Allocator>::upper_bound(const T& key) const {
+  return tree_.UpperBound(key);
+}
+
+template <typename T, typename Compare, size_t NodeBytes, typename Allocator>
+std::pair<typename btree_set<T, Compare, NodeBytes, Allocator>::iterator,
+          typename btree_set<T, Compare, NodeBytes, Allocator>::iterator>
+btree_set<T, Compare, NodeBytes, Allocator>::equal_range(const T& key) const {
+  return std::make_pair(lower_bound(key), upper_bound(key));
+}
+
+template <typename T, typename Compare, size_t NodeBytes, typename Allocator>
+RangeView<typename btree_set<T, Compare, NodeBytes, Allocator>::iterator>
+btree_set<T, Compare, NodeBytes, Allocator>::range(
+    const T& first, const T& last) const {
+  return RangeView<iterator>(lower_bound(first), lower_bound(last));
+}
+
+// observers
+
+template <typename T, typename Compare, size_t NodeBytes, typename Allocator>
+typename btree_set<T, Compare, NodeBytes, Allocator>::key_compare
+btree_set<T, Compare, NodeBytes, Allocator>::key_comp() const {
+  return tree_.GetCompare();
+}
+
+template <typename T, typename Compare, size_t NodeBytes, typename Allocator>
+const typename btree_set<T, Compare, NodeBytes, Allocator>::tree_type&
+btree_set<T, Compare, NodeBytes, Allocator>::get_tree() const {
+  return tree_;
+}
+
+template <typename T, typename Compare, size_t NodeBytes, typename Allocator>
+container_stats btree_set<T, Compare, NodeBytes, Allocator>::stats() const {
+  return tree_.GetStats();
+}
+
+}  // namespace s21
+
+#endif
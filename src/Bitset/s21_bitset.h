@@ -0,0 +1,302 @@
+#ifndef S21_CONTAINERS_BITSET_H
+#define S21_CONTAINERS_BITSET_H
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+
+#if defined(__AVX2__) || defined(__BMI2__)
+#include <immintrin.h>
+#endif
+
+#include "../Array/s21_array.hpp"
+#include "../Set/s21_set.hpp"
+#include "../Stats/s21_stats.h"
+
+namespace s21 {
+namespace bitset_detail {
+// Bits are kept in 64-bit words, bit i in word i / 64 at position i % 64.
+// Bits past the size in the last word are always zero, so whole words can be
+// counted and scanned without masking
+using word_t = uint64_t;
+
+constexpr size_t kWordBits = 64;
+
+constexpr size_t WordCount(size_t bits) {
+  return (bits + kWordBits - 1) / kWordBits;
+}
+
+// Mask of the bits of the last word that are below the size
+constexpr word_t TailMask(size_t bits) {
+  return bits % kWordBits ? (word_t(1) << (bits % kWordBits)) - 1 : ~word_t(0);
+}
+
+// popcnt where the target has it, the bit-slicing count otherwise rather
+// than the table lookup the compiler calls into
+inline unsigned Popcount(word_t word) {
+#if defined(__POPCNT__)
+  return static_cast<unsigned>(__builtin_popcountll(word));
+#else
+  word = word - ((word >> 1) & 0x5555555555555555ull);
+  word = (word & 0x3333333333333333ull) + ((word >> 2) & 0x3333333333333333ull);
+  word = (word + (word >> 4)) & 0x0F0F0F0F0F0F0F0Full;
+  return static_cast<unsigned>((word * 0x0101010101010101ull) >> 56);
+#endif
+}
+
+inline unsigned TrailingZeros(word_t word) {
+  return static_cast<unsigned>(__builtin_ctzll(word));
+}
+
+// Position of the set bit of word with k set bits below it; k must be less
+// than Popcount(word). One pdep with BMI2, a byte then bit walk otherwise
+inline unsigned SelectInWord(word_t word, unsigned k) {
+#if defined(__BMI2__)
+  return TrailingZeros(_pdep_u64(word_t(1) << k, word));
+#else
+  unsigned base = 0;
+  for (unsigned in_byte = Popcount(word & 0xFF); k >= in_byte;
+       in_byte = Popcount(word & 0xFF)) {
+    k -= in_byte;
+    word >>= 8;
+    base += 8;
+  }
+  for (; k > 0; --k) word &= word - 1;
+  return base + TrailingZeros(word);
+#endif
+}
+
+enum class BitOp { kAnd, kOr, kXor, kAndNot };
+
+// dst[i] = dst[i] op src[i] for count words, four at a time with AVX2
+template <BitOp Op>
+void Combine(word_t* dst, const word_t* src, size_t count) {
+  size_t i = 0;
+#if defined(__AVX2__)
+  for (; i + 4 <= count; i += 4) {
+    __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(dst + i));
+    __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+    __m256i result;
+    if (Op == BitOp::kAnd) {
+      result = _mm256_and_si256(a, b);
+    } else if (Op == BitOp::kOr) {
+      result = _mm256_or_si256(a, b);
+    } else if (Op == BitOp::kXor) {
+      result = _mm256_xor_si256(a, b);
+    } else {
+      result = _mm256_andnot_si256(b, a);
+    }
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), result);
+  }
+#endif
+  for (; i < count; ++i) {
+    if (Op == BitOp::kAnd) {
+      dst[i] &= src[i];
+    } else if (Op == BitOp::kOr) {
+      dst[i] |= src[i];
+    } else if (Op == BitOp::kXor) {
+      dst[i] ^= src[i];
+    } else {
+      dst[i] &= ~src[i];
+    }
+  }
+}
+
+inline size_t Count(const word_t* words, size_t count) {
+  size_t total = 0;
+  for (size_t i = 0; i < count; ++i) total += Popcount(words[i]);
+  return total;
+}
+
+// First set bit at or after pos among count words, or count * kWordBits
+inline size_t FindFrom(const word_t* words, size_t count, size_t pos) {
+  size_t index = pos / kWordBits;
+  if (index >= count) return count * kWordBits;
+  word_t word = words[index] & (~word_t(0) << (pos % kWordBits));
+  while (word == 0) {
+    if (++index == count) return count * kWordBits;
+    word = words[index];
+  }
+  return index * kWordBits + TrailingZeros(word);
+}
+
+// Set bits in [0, pos)
+inline size_t Rank(const word_t* words, size_t pos) {
+  size_t index = pos / kWordBits;
+  size_t total = Count(words, index);
+  if (pos % kWordBits) {
+    total += Popcount(words[index] & ((word_t(1) << (pos % kWordBits)) - 1));
+  }
+  return total;
+}
+
+// Position of the set bit with k set bits before it, or count * kWordBits
+inline size_t Select(const word_t* words, size_t count, size_t k) {
+  for (size_t index = 0; index < count; ++index) {
+    size_t ones = Popcount(words[index]);
+    if (k < ones) {
+      return index * kWordBits +
+             SelectInWord(words[index], static_cast<unsigned>(k));
+    }
+    k -= ones;
+  }
+  return count * kWordBits;
+}
+
+// Calls visit(pos) for every set bit in ascending order
+template <typename F>
+void ForEach(const word_t* words, size_t count, F visit) {
+  for (size_t index = 0; index < count; ++index) {
+    for (word_t word = words[index]; word != 0; word &= word - 1) {
+      visit(index * kWordBits + TrailingZeros(word));
+    }
+  }
+}
+
+// Forward iterator over the positions of the set bits, as set::assign_sorted
+// takes them
+class OnesIterator {
+ public:
+  using value_type = size_t;
+  using reference = size_t;
+  using pointer = const size_t*;
+  using difference_type = std::ptrdiff_t;
+  using iterator_category = std::forward_iterator_tag;
+
+  OnesIterator(const word_t* words, size_t count, size_t pos)
+      : words_(words), count_(count), pos_(FindFrom(words, count, pos)) {}
+
+  size_t operator*() const { return pos_; }
+  OnesIterator& operator++() {
+    pos_ = FindFrom(words_, count_, pos_ + 1);
+    return *this;
+  }
+  OnesIterator operator++(int) {
+    OnesIterator temp = *this;
+    ++*this;
+    return temp;
+  }
+  bool operator==(const OnesIterator& other) const {
+    return pos_ == other.pos_;
+  }
+  bool operator!=(const OnesIterator& other) const {
+    return pos_ != other.pos_;
+  }
+
+ private:
+  const word_t* words_;
+  size_t count_;
+  size_t pos_;
+};
+
+template <typename Key>
+void CheckKeyType() {
+  static_assert(std::is_integral<Key>::value && std::is_unsigned<Key>::value,
+                "bit positions convert to unsigned integer keys only");
+}
+}  // namespace bitset_detail
+
+// Fixed set of N bits in the inline words of an S21Array, as compact as a
+// membership set of ids below N can be: N / 8 bytes against about 48 per
+// element of s21::set<uint32_t>. Bulk operations work a word, or four with
+// AVX2, at a time; count, rank and select use popcnt where the target has
+// it, select also pdep with BMI2.
+//
+// Lookups return npos when no bit qualifies. rank and select scan the words,
+// O(N / 64); dynamic_bitset can index them for large sizes.
+template <size_t N>
+class bitset {
+ public:
+  // member type
+  using size_type = size_t;
+  using word_type = bitset_detail::word_t;
+
+  static constexpr size_type npos = static_cast<size_type>(-1);
+  static constexpr size_type kWords =
+      N > 0 ? bitset_detail::WordCount(N) : 1;
+
+  // functions
+  bitset() noexcept;
+  // The bits of the keys; std::out_of_range on a key not below N
+  template <typename Key, typename Compare>
+  explicit bitset(const s21::set<Key, Compare>& keys);
+  bitset(const bitset& other) = default;
+  bitset& operator=(const bitset& other) noexcept;
+  ~bitset() = default;
+
+  // element access
+  // Unchecked
+  bool operator[](size_type pos) const;
+  // std::out_of_range on a position not below N
+  bool test(size_type pos) const;
+  bool all() const;
+  bool any() const;
+  bool none() const;
+  size_type count() const;
+  static constexpr size_type size() noexcept { return N; }
+  const word_type* data() const noexcept;
+
+  // modifiers, the positional ones check pos as test does
+  bitset& set() noexcept;
+  bitset& set(size_type pos, bool value = true);
+  bitset& reset() noexcept;
+  bitset& reset(size_type pos);
+  bitset& flip() noexcept;
+  bitset& flip(size_type pos);
+  bitset& operator&=(const bitset& other) noexcept;
+  bitset& operator|=(const bitset& other) noexcept;
+  bitset& operator^=(const bitset& other) noexcept;
+  // Clears the bits set in other, *this & ~other
+  bitset& and_not(const bitset& other) noexcept;
+  bitset operator~() const noexcept;
+  bool operator==(const bitset& other) const;
+  bool operator!=(const bitset& other) const;
+
+  // lookup
+  size_type find_first() const;
+  // First set bit after pos
+  size_type find_next(size_type pos) const;
+  // Set bits before pos, pos up to N
+  size_type rank(size_type pos) const;
+  // Position of the set bit with k set bits before it
+  size_type select(size_type k) const;
+  // Calls visit(pos) for every set bit in ascending order
+  template <typename F>
+  void for_each(F visit) const;
+  // The positions of the set bits as keys, built in O(n)
+  template <typename Key = uint32_t>
+  s21::set<Key> to_set() const;
+
+  // The storage is inline so there is nothing to count
+  container_stats stats() const;
+
+ private:
+  S21Array<word_type, kWords> words_;
+
+  word_type* Words() noexcept { return words_.data(); }
+  const word_type* Words() const noexcept { return words_.data(); }
+  void CheckPos(size_type pos) const;
+  size_type Found(size_type pos) const { return pos < N ? pos : npos; }
+};
+
+template <size_t N>
+bitset<N> operator&(bitset<N> left, const bitset<N>& right) noexcept {
+  return left &= right;
+}
+
+template <size_t N>
+bitset<N> operator|(bitset<N> left, const bitset<N>& right) noexcept {
+  return left |= right;
+}
+
+template <size_t N>
+bitset<N> operator^(bitset<N> left, const bitset<N>& right) noexcept {
+  return left ^= right;
+}
+}  // namespace s21
+
+#include "s21_bitset.tpp"
+
+#endif
@@ -0,0 +1,217 @@
+#ifndef S21_CONTAINERS_BITSET_TPP
+#define S21_CONTAINERS_BITSET_TPP
+
+namespace s21 {
+
+// functions
+
+template <size_t N>
+bitset<N>::bitset() noexcept {
+  words_.fill(0);
+}
+
+template <size_t N>
+template <typename Key, typename Compare>
+bitset<N>::bitset(const s21::set<Key, Compare>& keys) : bitset() {
+  bitset_detail::CheckKeyType<Key>();
+  keys.for_each([this](const Key& key) { set(static_cast<size_type>(key)); });
+}
+
+// S21Array only assigns from a non-const array
+template <size_t N>
+bitset<N>& bitset<N>::operator=(const bitset& other) noexcept {
+  for (size_type i = 0; i < kWords; ++i) Words()[i] = other.Words()[i];
+  return *this;
+}
+
+// element access
+
+template <size_t N>
+bool bitset<N>::operator[](size_type pos) const {
+  return (Words()[pos / bitset_detail::kWordBits] >>
+          (pos % bitset_detail::kWordBits)) &
+         1;
+}
+
+template <size_t N>
+bool bitset<N>::test(size_type pos) const {
+  CheckPos(pos);
+  return (*this)[pos];
+}
+
+template <size_t N>
+bool bitset<N>::all() const {
+  return count() == N;
+}
+
+template <size_t N>
+bool bitset<N>::any() const {
+  for (size_type i = 0; i < kWords; ++i) {
+    if (Words()[i] != 0) return true;
+  }
+  return false;
+}
+
+template <size_t N>
+bool bitset<N>::none() const {
+  return !any();
+}
+
+template <size_t N>
+typename bitset<N>::size_type bitset<N>::count() const {
+  return bitset_detail::Count(Words(), kWords);
+}
+
+template <size_t N>
+const typename bitset<N>::word_type* bitset<N>::data() const noexcept {
+  return Words();
+}
+
+// modifiers
+
+template <size_t N>
+bitset<N>& bitset<N>::set() noexcept {
+  if (N == 0) return *this;
+  words_.fill(~word_type(0));
+  Words()[kWords - 1] &= bitset_detail::TailMask(N);
+  return *this;
+}
+
+template <size_t N>
+bitset<N>& bitset<N>::set(size_type pos, bool value) {
+  CheckPos(pos);
+  word_type bit = word_type(1) << (pos % bitset_detail::kWordBits);
+  word_type& word = Words()[pos / bitset_detail::kWordBits];
+  word = value ? word | bit : word & ~bit;
+  return *this;
+}
+
+template <size_t N>
+bitset<N>& bitset<N>::reset() noexcept {
+  words_.fill(0);
+  return *this;
+}
+
+template <size_t N>
+bitset<N>& bitset<N>::reset(size_type pos) {
+  return set(pos, false);
+}
+
+template <size_t N>
+bitset<N>& bitset<N>::flip() noexcept {
+  if (N == 0) return *this;
+  for (size_type i = 0; i < kWords; ++i) Words()[i] = ~Words()[i];
+  Words()[kWords - 1] &= bitset_detail::TailMask(N);
+  return *this;
+}
+
+template <size_t N>
+bitset<N>& bitset<N>::flip(size_type pos) {
+  CheckPos(pos);
+  word_type bit = word_type(1) << (pos % bitset_detail::kWordBits);
+  Words()[pos / bitset_detail::kWordBits] ^= bit;
+  return *this;
+}
+
+template <size_t N>
+bitset<N>& bitset<N>::operator&=(const bitset& other) noexcept {
+  bitset_detail::Combine<bitset_detail::BitOp::kAnd>(Words(), other.Words(),
+                                                     kWords);
+  return *this;
+}
+
+template <size_t N>
+bitset<N>& bitset<N>::operator|=(const bitset& other) noexcept {
+  bitset_detail::Combine<bitset_detail::BitOp::kOr>(Words(), other.Words(),
+                                                    kWords);
+  return *this;
+}
+
+template <size_t N>
+bitset<N>& bitset<N>::operator^=(const bitset& other) noexcept {
+  bitset_detail::Combine<bitset_detail::BitOp::kXor>(Words(), other.Words(),
+                                                     kWords);
+  return *this;
+}
+
+template <size_t N>
+bitset<N>& bitset<N>::and_not(const bitset& other) noexcept {
+  bitset_detail::Combine<bitset_detail::BitOp::kAndNot>(Words(),
+                                                        other.Words(), kWords);
+  return *this;
+}
+
+template <size_t N>
+bitset<N> bitset<N>::operator~() const noexcept {
+  bitset result(*this);
+  return result.flip();
+}
+
+template <size_t N>
+bool bitset<N>::operator==(const bitset& other) const {
+  for (size_type i = 0; i < kWords; ++i) {
+    if (Words()[i] != other.Words()[i]) return false;
+  }
+  return true;
+}
+
+template <size_t N>
+bool bitset<N>::operator!=(const bitset& other) const {
+  return !(*this == other);
+}
+
+// lookup
+
+template <size_t N>
+typename bitset<N>::size_type bitset<N>::find_first() const {
+  return Found(bitset_detail::FindFrom(Words(), kWords, 0));
+}
+
+template <size_t N>
+typename bitset<N>::size_type bitset<N>::find_next(size_type pos) const {
+  if (pos + 1 >= N) return npos;
+  return Found(bitset_detail::FindFrom(Words(), kWords, pos + 1));
+}
+
+template <size_t N>
+typename bitset<N>::size_type bitset<N>::rank(size_type pos) const {
+  if (pos > N) throw std::out_of_range("Index out of range");
+  return bitset_detail::Rank(Words(), pos);
+}
+
+template <size_t N>
+typename bitset<N>::size_type bitset<N>::select(size_type k) const {
+  return Found(bitset_detail::Select(Words(), kWords, k));
+}
+
+template <size_t N>
+template <typename F>
+void bitset<N>::for_each(F visit) const {
+  bitset_detail::ForEach(Words(), kWords, visit);
+}
+
+template <size_t N>
+template <typename Key>
+s21::set<Key> bitset<N>::to_set() const {
+  bitset_detail::CheckKeyType<Key>();
+  s21::set<Key> keys;
+  keys.assign_sorted(bitset_detail::OnesIterator(Words(), kWords, 0),
+                     bitset_detail::OnesIterator(Words(), kWords, N));
+  return keys;
+}
+
+template <size_t N>
+container_stats bitset<N>::stats() const {
+  return container_stats();
+}
+
+// helpers
+
+template <size_t N>
+void bitset<N>::CheckPos(size_type pos) const {
+  if (pos >= N) throw std::out_of_range("Index out of range");
+}
+
+}  // namespace s21
+
+#endif
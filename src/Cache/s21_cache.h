@@ -0,0 +1,355 @@
+#ifndef S21_CONTAINERS_CACHE_H
+#define S21_CONTAINERS_CACHE_H
+
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <memory_resource>
+#include <utility>
+
+#include "../HashTable/s21_hash_table.h"
+#include "../NodePool/s21_node_pool.h"
+
+namespace s21 {
+// Lookup and eviction counters of a cache, always collected
+struct cache_counters {
+  size_t hits = 0;
+  size_t misses = 0;
+  size_t insertions = 0;
+  size_t evictions = 0;
+
+  double hit_ratio() const {
+    size_t lookups = hits + misses;
+    return lookups ? static_cast<double>(hits) / lookups : 0.0;
+  }
+};
+
+// Weight of an entry against a cache's memory budget: the size of its key
+// and value objects. Types owning heap memory need a weigher that counts it
+template <typename Key, typename T>
+struct cache_weigher {
+  size_t operator()(const Key&, const T&) const {
+    return sizeof(Key) + sizeof(T);
+  }
+};
+
+namespace cache_detail {
+// Intrusive list of entries linked by their prev and next members, the most
+// recently used at the head
+template <typename Entry>
+struct EntryList {
+  Entry* head = nullptr;
+  Entry* tail = nullptr;
+
+  bool Empty() const { return head == nullptr; }
+
+  void PushFront(Entry* entry) {
+    entry->prev = nullptr;
+    entry->next = head;
+    if (head != nullptr) {
+      head->prev = entry;
+    } else {
+      tail = entry;
+    }
+    head = entry;
+  }
+
+  void Remove(Entry* entry) {
+    if (entry->prev != nullptr) {
+      entry->prev->next = entry->next;
+    } else {
+      head = entry->next;
+    }
+    if (entry->next != nullptr) {
+      entry->next->prev = entry->prev;
+    } else {
+      tail = entry->prev;
+    }
+  }
+};
+
+// The index hashes entry pointers by the key stored in the entry
+template <typename Entry>
+struct EntryKey {
+  using key_type = typename Entry::key_type;
+  const key_type& operator()(const Entry* entry) const {
+    return entry->value.first;
+  }
+};
+}  // namespace cache_detail
+
+// Bounded key-value cache evicting the least recently used entry. Each entry
+// is a single pool node carrying both the value and its recency links, found
+// through an open-addressing index of entry pointers: get and put are O(1)
+// expected, with no allocation once the pool has grown to the capacity.
+//
+// The cache holds at most capacity entries whose charges, the weigher's
+// result plus kEntryOverhead, add up to at most memory_budget bytes; an
+// entry heavier than the whole budget is kept alone. Pointers returned by
+// get stay valid until the entry is evicted or erased.
+//
+// Entries and index slots come from Allocator, rebound to each. Moving a
+// cache to one whose allocator is unequal and does not propagate moves the
+// entries one at a time into storage of its own.
+template <typename Key, typename T, typename Hash = std::hash<Key>,
+          typename KeyEqual = std::equal_to<Key>,
+          typename Weigher = cache_weigher<Key, T>,
+          typename Allocator = std::allocator<std::pair<const Key, T>>>
+class lru_cache {
+  using alloc_traits = std::allocator_traits<Allocator>;
+  static constexpr bool kNothrowMoveAssign =
+      alloc_traits::propagate_on_container_move_assignment::value ||
+      alloc_traits::is_always_equal::value;
+
+ public:
+  // member type
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<const Key, T>;
+  using hasher = Hash;
+  using key_equal = KeyEqual;
+  using weigher = Weigher;
+  using size_type = size_t;
+  using allocator_type = Allocator;
+
+  static constexpr size_type kUnbounded =
+      std::numeric_limits<size_type>::max();
+
+  // functions, throw std::invalid_argument for a zero capacity
+  explicit lru_cache(size_type capacity, size_type memory_budget = kUnbounded,
+                     const Hash& hash = Hash(),
+                     const KeyEqual& equal = KeyEqual(),
+                     const Weigher& weigh = Weigher(),
+                     const Allocator& alloc = Allocator());
+  lru_cache(size_type capacity, const Allocator& alloc);
+  lru_cache(const lru_cache&) = delete;
+  lru_cache(lru_cache&& other) noexcept;
+  lru_cache& operator=(const lru_cache&) = delete;
+  lru_cache& operator=(lru_cache&& other) noexcept(kNothrowMoveAssign);
+  ~lru_cache();
+  allocator_type get_allocator() const;
+
+  // lookup
+  // Value of key, made the most recently used; null on a miss. Counted
+  mapped_type* get(const Key& key);
+  // Value of key without touching its recency or the counters
+  const mapped_type* peek(const Key& key) const;
+  bool contains(const Key& key) const;
+
+  // modifiers
+  // Inserts or assigns the value and makes it the most recently used,
+  // evicting as needed; returns true when the key was inserted
+  bool put(const Key& key, const T& value);
+  bool put(const Key& key, T&& value);
+  size_type erase(const Key& key);
+  void clear();
+  // The allocators must be equal unless they propagate on swap
+  void swap(lru_cache& other) noexcept;
+
+  // capacity
+  bool empty() const;
+  size_type size() const;
+  size_type capacity() const;
+  size_type memory_budget() const;
+  // Sum of the charges of the entries
+  size_type memory_usage() const;
+
+  // counters
+  cache_counters counters() const;
+  void reset_counters();
+
+ private:
+  struct Entry {
+    using key_type = Key;
+
+    template <typename V>
+    Entry(const Key& key, V&& mapped, size_type weight)
+        : value(key, std::forward<V>(mapped)), charge(weight) {}
+
+    value_type value;
+    size_type charge;
+    Entry* prev;
+    Entry* next;
+  };
+
+ public:
+  // Bytes charged per entry besides the weigher's result: the links and
+  // the index slot
+  static constexpr size_type kEntryOverhead =
+      sizeof(Entry) - sizeof(value_type) + sizeof(Entry*) + 1;
+
+ private:
+  using index_allocator = typename alloc_traits::template rebind_alloc<Entry*>;
+
+  HashTable<Entry*, Hash, KeyEqual, cache_detail::EntryKey<Entry>,
+            index_allocator>
+      index_;
+  NodePool<Entry, Allocator> pool_;
+  cache_detail::EntryList<Entry> recency_;
+  size_type capacity_;
+  size_type budget_;
+  size_type usage_;
+  Weigher weigh_;
+  cache_counters counters_;
+
+  template <typename V>
+  bool Put(const Key& key, V&& value);
+  size_type Charge(const Key& key, const T& value) const;
+  void Shrink(size_type size_limit, size_type budget_limit, Entry* keep);
+  void Remove(Entry* entry);
+  void DestroyEntries();
+  void MoveEntries(lru_cache& other);
+};
+
+// Bounded key-value cache evicting the least frequently used entry, the
+// least recently used among those with the lowest count. Entries with the
+// same access count share a bucket, and buckets are kept in ascending
+// order of count, so an access moves its entry to the next bucket and
+// eviction takes the tail of the first one: every operation is O(1)
+// expected. Capacity, memory budget, counters and the allocator work as in
+// lru_cache.
+template <typename Key, typename T, typename Hash = std::hash<Key>,
+          typename KeyEqual = std::equal_to<Key>,
+          typename Weigher = cache_weigher<Key, T>,
+          typename Allocator = std::allocator<std::pair<const Key, T>>>
+class lfu_cache {
+  using alloc_traits = std::allocator_traits<Allocator>;
+  static constexpr bool kNothrowMoveAssign =
+      alloc_traits::propagate_on_container_move_assignment::value ||
+      alloc_traits::is_always_equal::value;
+
+ public:
+  // member type
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<const Key, T>;
+  using hasher = Hash;
+  using key_equal = KeyEqual;
+  using weigher = Weigher;
+  using size_type = size_t;
+  using allocator_type = Allocator;
+
+  static constexpr size_type kUnbounded =
+      std::numeric_limits<size_type>::max();
+
+  // functions, throw std::invalid_argument for a zero capacity
+  explicit lfu_cache(size_type capacity, size_type memory_budget = kUnbounded,
+                     const Hash& hash = Hash(),
+                     const KeyEqual& equal = KeyEqual(),
+                     const Weigher& weigh = Weigher(),
+                     const Allocator& alloc = Allocator());
+  lfu_cache(size_type capacity, const Allocator& alloc);
+  lfu_cache(const lfu_cache&) = delete;
+  lfu_cache(lfu_cache&& other) noexcept;
+  lfu_cache& operator=(const lfu_cache&) = delete;
+  lfu_cache& operator=(lfu_cache&& other) noexcept(kNothrowMoveAssign);
+  ~lfu_cache();
+  allocator_type get_allocator() const;
+
+  // lookup
+  // Value of key, its access count incremented; null on a miss. Counted
+  mapped_type* get(const Key& key);
+  const mapped_type* peek(const Key& key) const;
+  bool contains(const Key& key) const;
+  // Accesses of key since it was inserted, zero if it is absent
+  size_type frequency(const Key& key) const;
+
+  // modifiers
+  // Inserts with a count of one, or assigns and counts an access
+  bool put(const Key& key, const T& value);
+  bool put(const Key& key, T&& value);
+  size_type erase(const Key& key);
+  void clear();
+  void swap(lfu_cache& other) noexcept;
+
+  // capacity
+  bool empty() const;
+  size_type size() const;
+  size_type capacity() const;
+  size_type memory_budget() const;
+  size_type memory_usage() const;
+
+  // counters
+  cache_counters counters() const;
+  void reset_counters();
+
+ private:
+  struct Bucket;
+
+  struct Entry {
+    using key_type = Key;
+
+    template <typename V>
+    Entry(const Key& key, V&& mapped, size_type weight)
+        : value(key, std::forward<V>(mapped)), charge(weight) {}
+
+    value_type value;
+    size_type charge;
+    Entry* prev;
+    Entry* next;
+    Bucket* bucket;
+  };
+
+  struct Bucket {
+    explicit Bucket(size_type count) : frequency(count) {}
+
+    size_type frequency;
+    cache_detail::EntryList<Entry> entries;
+    Bucket* prev = nullptr;
+    Bucket* next = nullptr;
+  };
+
+ public:
+  static constexpr size_type kEntryOverhead =
+      sizeof(Entry) - sizeof(value_type) + sizeof(Entry*) + 1;
+
+ private:
+  using index_allocator = typename alloc_traits::template rebind_alloc<Entry*>;
+
+  HashTable<Entry*, Hash, KeyEqual, cache_detail::EntryKey<Entry>,
+            index_allocator>
+      index_;
+  NodePool<Entry, Allocator> pool_;
+  NodePool<Bucket, Allocator> buckets_pool_;
+  Bucket* lowest_;  // first bucket, the least frequently used entries
+  size_type capacity_;
+  size_type budget_;
+  size_type usage_;
+  Weigher weigh_;
+  cache_counters counters_;
+
+  template <typename V>
+  bool Put(const Key& key, V&& value);
+  size_type Charge(const Key& key, const T& value) const;
+  void Touch(Entry* entry);
+  // Links entry at the head of the bucket with count frequency following
+  // after, creating it if needed; after == nullptr stands for the front
+  void Place(Entry* entry, Bucket* after, size_type frequency);
+  void Unlink(Entry* entry);
+  Entry* Victim(Entry* keep) const;
+  void Shrink(size_type size_limit, size_type budget_limit, Entry* keep);
+  void Remove(Entry* entry);
+  void DestroyEntries();
+  void MoveEntries(lfu_cache& other);
+};
+
+namespace pmr {
+template <typename Key, typename T, typename Hash = std::hash<Key>,
+          typename KeyEqual = std::equal_to<Key>,
+          typename Weigher = cache_weigher<Key, T>>
+using lru_cache =
+    s21::lru_cache<Key, T, Hash, KeyEqual, Weigher,
+                   std::pmr::polymorphic_allocator<std::pair<const Key, T>>>;
+template <typename Key, typename T, typename Hash = std::hash<Key>,
+          typename KeyEqual = std::equal_to<Key>,
+          typename Weigher = cache_weigher<Key, T>>
+using lfu_cache =
+    s21::lfu_cache<Key, T, Hash, KeyEqual, Weigher,
+                   std::pmr::polymorphic_allocator<std::pair<const Key, T>>>;
+}  // namespace pmr
+}  // namespace s21
+
+#include "s21_cache.tpp"
+
+#endif
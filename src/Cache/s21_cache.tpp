@@ -0,0 +1,739 @@
+#ifndef S21_CONTAINERS_CACHE_TPP
+#define S21_CONTAINERS_CACHE_TPP
+
+#include <stdexcept>
+#include <utility>
+
+namespace s21 {
+
+// lru_cache
+
+// functions
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Weigher, typename Allocator>
+lru_cache<Key, T, Hash, KeyEqual, Weigher, Allocator>::lru_cache(
+    size_type capacity, size_type memory_budget, const Hash& hash,
+    const KeyEqual& equal, const Weigher& weigh, const Allocator& alloc)
+    : index_(0, hash, equal, index_allocator(alloc)),
+      pool_(alloc),
+      capacity_(capacity),
+      budget_(memory_budget),
+      usage_(0),
+      weigh_(weigh) {
+  if (capacity == 0) throw std::invalid_argument("Cache capacity is zero");
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Weigher, typename Allocator>
+lru_cache<Key, T, Hash, KeyEqual, Weigher, Allocator>::lru_cache(
+    size_type capacity, const Allocator& alloc)
+    : lru_cache(capacity, kUnbounded, Hash(), KeyEqual(), Weigher(), alloc) {}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Weigher, typename Allocator>
+lru_cache<Key, T, Hash, KeyEqual, Weigher, Allocator>::lru_cache(
+    lru_cache&& other) noexcept
+    : index_(std::move(other.index_)),
+      pool_(std::move(other.pool_)),
+      recency_(other.recency_),
+      capacity_(other.capacity_),
+      budget_(other.budget_),
+      usage_(other.usage_),
+      weigh_(std::move(other.weigh_)),
+      counters_(other.counters_) {
+  other.recency_ = cache_detail::EntryList<Entry>();
+  other.usage_ = 0;
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Weigher, typename Allocator>
+lru_cache<Key, T, Hash, KeyEqual, Weigher, Allocator>&
+lru_cache<Key, T, Hash, KeyEqual, Weigher, Allocator>::operator=(
+    lru_cache&& other) noexcept(kNothrowMoveAssign) {
+  if (this != &other) {
+    clear();
+    if (kNothrowMoveAssign || get_allocator() == other.get_allocator()) {
+      index_ = std::move(other.index_);
+      pool_ = std::move(other.pool_);
+      recency_ = std::exchange(other.recency_, {});
+      usage_ = std::exchange(other.usage_, 0);
+    } else {
+      MoveEntries(other);
+    }
+    capacity_ = other.capacity_;
+    budget_ = other.budget_;
+    weigh_ = other.weigh_;
+    counters_ = other.counters_;
+  }
+  return *this;
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Weigher, typename Allocator>
+lru_cache<Key, T, Hash, KeyEqual, Weigher, Allocator>::~lru_cache() {
+  DestroyEntries();
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Weigher, typename Allocator>
+typename lru_cache<Key, T, Hash, KeyEqual, Weigher, Allocator>::allocator_type
+lru_cache<Key, T, Hash, KeyEqual, Weigher, Allocator>::get_allocator() const {
+  return pool_.GetAllocator();
+}
+
+// lookup
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Weigher, typename Allocator>
+typename lru_cache<Key, T, Hash, KeyEqual, Weigher, Allocator>::mapped_type*
+lru_cache<Key, T, Hash, KeyEqual, Weigher, Allocator>::get(const Key& key) {
+  auto it = index_.Find(key);
+  if (it == index_.End()) {
+    ++counters_.misses;
+    return nullptr;
+  }
+  ++counters_.hits;
+  Entry* entry = *it;
+  if (recency_.head != entry) {
+    recency_.Remove(entry);
+    recency_.PushFront(entry);
+  }
+  return &entry->value.second;
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Weigher, typename Allocator>
+const typename lru_cache<Key, T, Hash, KeyEqual, Weigher,
+                         Allocator>::mapped_type*
+lru_cache<Key, T, Hash, KeyEqual, Weigher, Allocator>::peek(
+    const Key& key) const {
+  auto it = index_.Find(key);
+  return it != index_.End() ? &(*it)->value.second : nullptr;
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Weigher, typename Allocator>
+bool lru_cache<Key, T, Hash, KeyEqual, Weigher, Allocator>::contains(
+    const Key& key) const {
+  return index_.Find(key) != index_.End();
+}
+
+// modifiers
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Weigher, typename Allocator>
+bool lru_cache<Key, T, Hash, KeyEqual, Weigher, Allocator>::put(
+    const Key& key, const T& value) {
+  return Put(key, value);
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Weigher, typename Allocator>
+bool lru_cache<Key, T, Hash, KeyEqual, Weigher, Allocator>::put(
+    const Key& key, T&& value) {
+  return Put(key, std::move(value));
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Weigher, typename Allocator>
+typename lru_cache<Key, T, Hash, KeyEqual, Weigher, Allocator>::size_type
+lru_cache<Key, T, Hash, KeyEqual, Weigher, Allocator>::erase(const Key& key) {
+  auto it = index_.Find(key);
+  if (it == index_.End()) return 0;
+  Remove(*it);
+  return 1;
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Weigher, typename Allocator>
+void lru_cache<Key, T, Hash, KeyEqual, Weigher, Allocator>::clear() {
+  DestroyEntries();
+  index_.Clear();
+  pool_.Release();
+  recency_ = cache_detail::EntryList<Entry>();
+  usage_ = 0;
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Weigher, typename Allocator>
+void lru_cache<Key, T, Hash, KeyEqual, Weigher, Allocator>::swap(
+    lru_cache& other) noexcept {
+  using std::swap;
+  index_.Swap(other.index_);
+  pool_.Swap(other.pool_);
+  swap(recency_, other.recency_);
+  swap(capacity_, other.capacity_);
+  swap(budget_, other.budget_);
+  swap(usage_, other.usage_);
+  swap(weigh_, other.weigh_);
+  swap(counters_, other.counters_);
+}
+
+// capacity
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Weigher, typename Allocator>
+bool lru_cache<Key, T, Hash, KeyEqual, Weigher, Allocator>::empty() const {
+  return index_.Size() == 0;
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Weigher, typename Allocator>
+typename lru_cache<Key, T, Hash, KeyEqual, Weigher, Allocator>::size_type
+lru_cache<Key, T, Hash, KeyEqual, Weigher, Allocator>::size() const {
+  return index_.Size();
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Weigher, typename Allocator>
+typename lru_cache<Key, T, Hash, KeyEqual, Weigher, Allocator>::size_type
+lru_cache<Key, T, Hash, KeyEqual, Weigher, Allocator>::capacity() const {
+  return capacity_;
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Weigher, typename Allocator>
+typename lru_cache<Key, T, Hash, KeyEqual, Weigher, Allocator>::size_type
+lru_cache<Key, T, Hash, KeyEqual, Weigher, Allocator>::memory_budget() const {
+  return budget_;
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Weigher, typename Allocator>
+typename lru_cache<Key, T, Hash, KeyEqual, Weigher, Allocator>::size_type
+lru_cache<Key, T, Hash, KeyEqual, Weigher, Allocator>::memory_usage() const {
+  return usage_;
+}
+
+// counters
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Weigher, typename Allocator>
+cache_counters
+lru_cache<Key, T, Hash, KeyEqual, Weigher, Allocator>::counters() const {
+  return counters_;
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Weigher, typename Allocator>
+void lru_cache<Key, T, Hash, KeyEqual, Weigher, Allocator>::reset_counters() {
+  counters_ = cache_counters();
+}
+
+// helpers
+
+// Room is made before a new entry is created, so the index never holds more
+// than capacity entries; an assigned entry is kept while others are evicted
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Weigher, typename Allocator>
+template <typename V>
+bool lru_cache<Key, T, Hash, KeyEqual, Weigher, Allocator>::Put(
+    const Key& key, V&& value) {
+  size_type charge = Charge(key, value);
+  auto it = index_.Find(key);
+  if (it != index_.End()) {
+    Entry* entry = *it;
+    entry->value.second = std::forward<V>(value);
+    usage_ = usage_ - entry->charge + charge;
+    entry->charge = charge;
+    if (recency_.head != entry) {
+      recency_.Remove(entry);
+      recency_.PushFront(entry);
+    }
+    Shrink(capacity_, budget_, entry);
+    return false;
+  }
+  Shrink(capacity_ - 1, charge < budget_ ? budget_ - charge : 0, nullptr);
+  Entry* entry = pool_.Create(key, std::forward<V>(value), charge);
+  try {
+    index_.TryEmplace(key, entry);
+  } catch (...) {
+    pool_.Destroy(entry);
+    throw;
+  }
+  recency_.PushFront(entry);
+  usage_ += charge;
+  ++counters_.insertions;
+  return true;
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Weigher, typename Allocator>
+typename lru_cache<Key, T, Hash, KeyEqual, Weigher, Allocator>::size_type
+lru_cache<Key, T, Hash, KeyEqual, Weigher, Allocator>::Charge(
+    const Key& key, const T& value) const {
+  return weigh_(key, value) + kEntryOverhead;
+}
+
+// Evicts from the least recently used end until both limits hold, sparing
+// keep, which is at the head
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Weigher, typename Allocator>
+void lru_cache<Key, T, Hash, KeyEqual, Weigher, Allocator>::Shrink(
+    size_type size_limit, size_type budget_limit, Entry* keep) {
+  while ((index_.Size() > size_limit || usage_ > budget_limit) &&
+         recency_.tail != nullptr && recency_.tail != keep) {
+    Remove(recency_.tail);
+    ++counters_.evictions;
+  }
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Weigher, typename Allocator>
+void lru_cache<Key, T, Hash, KeyEqual, Weigher, Allocator>::Remove(
+    Entry* entry) {
+  index_.EraseKey(entry->value.first);
+  recency_.Remove(entry);
+  usage_ -= entry->charge;
+  pool_.Destroy(entry);
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Weigher, typename Allocator>
+void lru_cache<Key, T, Hash, KeyEqual, Weigher, Allocator>::DestroyEntries() {
+  for (Entry* entry = recency_.head; entry != nullptr;) {
+    Entry* next = entry->next;
+    pool_.Destroy(entry);
+    entry = next;
+  }
+}
+
+// This cache is empty. The least recently used entries go first, so the
+// order carries over; other is cleared at the end, or keeps what was not
+// moved yet if a move throws
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Weigher, typename Allocator>
+void lru_cache<Key, T, Hash, KeyEqual, Weigher, Allocator>::MoveEntries(
+    lru_cache& other) {
+  for (Entry* entry = other.recency_.tail; entry != nullptr;
+       entry = entry->prev) {
+    Entry* moved = pool_.Create(entry->value.first,
+                                std::move(entry->value.second), entry->charge);
+    try {
+      index_.TryEmplace(moved->value.first, moved);
+    } catch (...) {
+      pool_.Destroy(moved);
+      throw;
+    }
+    recency_.PushFront(moved);
+    usage_ += moved->charge;
+  }
+  other.clear();
+}
+
+// lfu_cache
+
+// functions
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Weigher, typename Allocator>
+lfu_cache<Key, T, Hash, KeyEqual, Weigher, Allocator>::lfu_cache(
+    size_type capacity, size_type memory_budget, const Hash& hash,
+    const KeyEqual& equal, const Weigher& weigh, const Allocator& alloc)
+    : index_(0, hash, equal, index_allocator(alloc)),
+      pool_(alloc),
+      buckets_pool_(alloc),
+      lowest_(nullptr),
+      capacity_(capacity),
+      budget_(memory_budget),
+      usage_(0),
+      weigh_(weigh) {
+  if (capacity == 0) throw std::invalid_argument("Cache capacity is zero");
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Weigher, typename Allocator>
+lfu_cache<Key, T, Hash, KeyEqual, Weigher, Allocator>::lfu_cache(
+    size_type capacity, const Allocator& alloc)
+    : lfu_cache(capacity, kUnbounded, Hash(), KeyEqual(), Weigher(), alloc) {}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Weigher, typename Allocator>
+lfu_cache<Key, T, Hash, KeyEqual, Weigher, Allocator>::lfu_cache(
+    lfu_cache&& other) noexcept
+    : index_(std::move(other.index_)),
+      pool_(std::move(other.pool_)),
+      buckets_pool_(std::move(other.buckets_pool_)),
+      lowest_(other.lowest_),
+      capacity_(other.capacity_),
+      budget_(other.budget_),
+      usage_(other.usage_),
+      weigh_(std::move(other.weigh_)),
+      counters_(other.counters_) {
+  other.lowest_ = nullptr;
+  other.usage_ = 0;
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Weigher, typename Allocator>
+lfu_cache<Key, T, Hash, KeyEqual, Weigher, Allocator>&
+lfu_cache<Key, T, Hash, KeyEqual, Weigher, Allocator>::operator=(
+    lfu_cache&& other) noexcept(kNothrowMoveAssign) {
+  if (this != &other) {
+    clear();
+    if (kNothrowMoveAssign || get_allocator() == other.get_allocator()) {
+      index_ = std::move(other.index_);
+      pool_ = std::move(other.pool_);
+      buckets_pool_ = std::move(other.buckets_pool_);
+      lowest_ = std::exchange(other.lowest_, nullptr);
+      usage_ = std::exchange(other.usage_, 0);
+    } else {
+      MoveEntries(other);
+    }
+    capacity_ = other.capacity_;
+    budget_ = other.budget_;
+    weigh_ = other.weigh_;
+    counters_ = other.counters_;
+  }
+  return *this;
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Weigher, typename Allocator>
+lfu_cache<Key, T, Hash, KeyEqual, Weigher, Allocator>::~lfu_cache() {
+  DestroyEntries();
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Weigher, typename Allocator>
+typename lfu_cache<Key, T, Hash, KeyEqual, Weigher, Allocator>::allocator_type
+lfu_cache<Key, T, Hash, KeyEqual, Weigher, Allocator>::get_allocator() const {
+  return pool_.GetAllocator();
+}
+
+// lookup
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Weigher, typename Allocator>
+typename lfu_cache<Key, T, Hash, KeyEqual, Weigher, Allocator>::mapped_type*
+lfu_cache<Key, T, Hash, KeyEqual, Weigher, Allocator>::get(const Key& key) {
+  auto it = index_.Find(key);
+  if (it == index_.End()) {
+    ++counters_.misses;
+    return nullptr;
+  }
+  ++counters_.hits;
+  Entry* entry = *it;
+  Touch(entry);
+  return &entry->value.second;
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Weigher, typename Allocator>
+const typename lfu_cache<Key, T, Hash, KeyEqual, Weigher,
+                         Allocator>::mapped_type*
+lfu_cache<Key, T, Hash, KeyEqual, Weigher, Allocator>::peek(
+    const Key& key) const {
+  auto it = index_.Find(key);
+  return it != index_.End() ? &(*it)->value.second : nullptr;
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Weigher, typename Allocator>
+bool lfu_cache<Key, T, Hash, KeyEqual, Weigher, Allocator>::contains(
+    const Key& key) const {
+  return index_.Find(key) != index_.End();
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Weigher, typename Allocator>
+typename lfu_cache<Key, T, Hash, KeyEqual, Weigher, Allocator>::size_type
+lfu_cache<Key, T, Hash, KeyEqual, Weigher, Allocator>::frequency(
+    const Key& key) const {
+  auto it = index_.Find(key);
+  return it != index_.End() ? (*it)->bucket->frequency : 0;
+}
+
+// modifiers
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Weigher, typename Allocator>
+bool lfu_cache<Key, T, Hash, KeyEqual, Weigher, Allocator>::put(
+    const Key& key, const T& value) {
+  return Put(key, value);
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Weigher, typename Allocator>
+bool lfu_cache<Key, T, Hash, KeyEqual, Weigher, Allocator>::put(
+    const Key& key, T&& value) {
+  return Put(key, std::move(value));
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Weigher, typename Allocator>
+typename lfu_cache<Key, T, Hash, KeyEqual, Weigher, Allocator>::size_type
+lfu_cache<Key, T, Hash, KeyEqual, Weigher, Allocator>::erase(const Key& key) {
+  auto it = index_.Find(key);
+  if (it == index_.End()) return 0;
+  Remove(*it);
+  return 1;
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Weigher, typename Allocator>
+void lfu_cache<Key, T, Hash, KeyEqual, Weigher, Allocator>::clear() {
+  DestroyEntries();
+  index_.Clear();
+  pool_.Release();
+  buckets_pool_.Release();
+  lowest_ = nullptr;
+  usage_ = 0;
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Weigher, typename Allocator>
+void lfu_cache<Key, T, Hash, KeyEqual, Weigher, Allocator>::swap(
+    lfu_cache& other) noexcept {
+  using std::swap;
+  index_.Swap(other.index_);
+  pool_.Swap(other.pool_);
+  buckets_pool_.Swap(other.buckets_pool_);
+  swap(lowest_, other.lowest_);
+  swap(capacity_, other.capacity_);
+  swap(budget_, other.budget_);
+  swap(usage_, other.usage_);
+  swap(weigh_, other.weigh_);
+  swap(counters_, other.counters_);
+}
+
+// capacity
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Weigher, typename Allocator>
+bool lfu_cache<Key, T, Hash, KeyEqual, Weigher, Allocator>::empty() const {
+  return index_.Size() == 0;
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Weigher, typename Allocator>
+typename lfu_cache<Key, T, Hash, KeyEqual, Weigher, Allocator>::size_type
+lfu_cache<Key, T, Hash, KeyEqual, Weigher, Allocator>::size() const {
+  return index_.Size();
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Weigher, typename Allocator>
+typename lfu_cache<Key, T, Hash, KeyEqual, Weigher, Allocator>::size_type
+lfu_cache<Key, T, Hash, KeyEqual, Weigher, Allocator>::capacity() const {
+  return capacity_;
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Weigher, typename Allocator>
+typename lfu_cache<Key, T, Hash, KeyEqual, Weigher, Allocator>::size_type
+lfu_cache<Key, T, Hash, KeyEqual, Weigher, Allocator>::memory_budget() const {
+  return budget_;
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Weigher, typename Allocator>
+typename lfu_cache<Key, T, Hash, KeyEqual, Weigher, Allocator>::size_type
+lfu_cache<Key, T, Hash, KeyEqual, Weigher, Allocator>::memory_usage() const {
+  return usage_;
+}
+
+// counters
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Weigher, typename Allocator>
+cache_counters
+lfu_cache<Key, T, Hash, KeyEqual, Weigher, Allocator>::counters() const {
+  return counters_;
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Weigher, typename Allocator>
+void lfu_cache<Key, T, Hash, KeyEqual, Weigher, Allocator>::reset_counters() {
+  counters_ = cache_counters();
+}
+
+// helpers
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Weigher, typename Allocator>
+template <typename V>
+bool lfu_cache<Key, T, Hash, KeyEqual, Weigher, Allocator>::Put(
+    const Key& key, V&& value) {
+  size_type charge = Charge(key, value);
+  auto it = index_.Find(key);
+  if (it != index_.End()) {
+    Entry* entry = *it;
+    entry->value.second = std::forward<V>(value);
+    usage_ = usage_ - entry->charge + charge;
+    entry->charge = charge;
+    Touch(entry);
+    Shrink(capacity_, budget_, entry);
+    return false;
+  }
+  Shrink(capacity_ - 1, charge < budget_ ? budget_ - charge : 0, nullptr);
+  Entry* entry = pool_.Create(key, std::forward<V>(value), charge);
+  try {
+    index_.TryEmplace(key, entry);
+    Place(entry, nullptr, 1);
+  } catch (...) {
+    index_.EraseKey(key);
+    pool_.Destroy(entry);
+    throw;
+  }
+  usage_ += charge;
+  ++counters_.insertions;
+  return true;
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Weigher, typename Allocator>
+typename lfu_cache<Key, T, Hash, KeyEqual, Weigher, Allocator>::size_type
+lfu_cache<Key, T, Hash, KeyEqual, Weigher, Allocator>::Charge(
+    const Key& key, const T& value) const {
+  return weigh_(key, value) + kEntryOverhead;
+}
+
+// Moves entry to the bucket of the next count. The new bucket is linked
+// before the old one can be freed, so a failed allocation changes nothing
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Weigher, typename Allocator>
+void lfu_cache<Key, T, Hash, KeyEqual, Weigher, Allocator>::Touch(
+    Entry* entry) {
+  Bucket* bucket = entry->bucket;
+  bucket->entries.Remove(entry);
+  try {
+    Place(entry, bucket, bucket->frequency + 1);
+  } catch (...) {
+    bucket->entries.PushFront(entry);
+    throw;
+  }
+  if (bucket->entries.Empty()) {
+    entry->bucket->prev = bucket->prev;
+    if (bucket->prev != nullptr) {
+      bucket->prev->next = entry->bucket;
+    } else {
+      lowest_ = entry->bucket;
+    }
+    buckets_pool_.Destroy(bucket);
+  }
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Weigher, typename Allocator>
+void lfu_cache<Key, T, Hash, KeyEqual, Weigher, Allocator>::Place(
+    Entry* entry, Bucket* after, size_type frequency) {
+  Bucket* next = after != nullptr ? after->next : lowest_;
+  Bucket* bucket = next;
+  if (next == nullptr || next->frequency != frequency) {
+    bucket = buckets_pool_.Create(frequency);
+    bucket->prev = after;
+    bucket->next = next;
+    if (next != nullptr) next->prev = bucket;
+    if (after != nullptr) {
+      after->next = bucket;
+    } else {
+      lowest_ = bucket;
+    }
+  }
+  bucket->entries.PushFront(entry);
+  entry->bucket = bucket;
+}
+
+// Unlinks entry from its bucket and frees the bucket once it is empty
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Weigher, typename Allocator>
+void lfu_cache<Key, T, Hash, KeyEqual, Weigher, Allocator>::Unlink(
+    Entry* entry) {
+  Bucket* bucket = entry->bucket;
+  bucket->entries.Remove(entry);
+  if (!bucket->entries.Empty()) return;
+  if (bucket->prev != nullptr) {
+    bucket->prev->next = bucket->next;
+  } else {
+    lowest_ = bucket->next;
+  }
+  if (bucket->next != nullptr) bucket->next->prev = bucket->prev;
+  buckets_pool_.Destroy(bucket);
+}
+
+// Least recently used entry of the lowest count other than keep. keep was
+// just placed at the head of its bucket, so it is only ever the tail of a
+// bucket it has to itself
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Weigher, typename Allocator>
+typename lfu_cache<Key, T, Hash, KeyEqual, Weigher, Allocator>::Entry*
+lfu_cache<Key, T, Hash, KeyEqual, Weigher, Allocator>::Victim(
+    Entry* keep) const {
+  for (Bucket* bucket = lowest_; bucket != nullptr; bucket = bucket->next) {
+    if (bucket->entries.tail != keep) return bucket->entries.tail;
+  }
+  return nullptr;
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Weigher, typename Allocator>
+void lfu_cache<Key, T, Hash, KeyEqual, Weigher, Allocator>::Shrink(
+    size_type size_limit, size_type budget_limit, Entry* keep) {
+  while (index_.Size() > size_limit || usage_ > budget_limit) {
+    Entry* victim = Victim(keep);
+    if (victim == nullptr) return;
+    Remove(victim);
+    ++counters_.evictions;
+  }
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Weigher, typename Allocator>
+void lfu_cache<Key, T, Hash, KeyEqual, Weigher, Allocator>::Remove(
+    Entry* entry) {
+  index_.EraseKey(entry->value.first);
+  Unlink(entry);
+  usage_ -= entry->charge;
+  pool_.Destroy(entry);
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Weigher, typename Allocator>
+void lfu_cache<Key, T, Hash, KeyEqual, Weigher, Allocator>::DestroyEntries() {
+  while (lowest_ != nullptr) {
+    Bucket* bucket = lowest_;
+    for (Entry* entry = bucket->entries.head; entry != nullptr;) {
+      Entry* next = entry->next;
+      pool_.Destroy(entry);
+      entry = next;
+    }
+    lowest_ = bucket->next;
+    buckets_pool_.Destroy(bucket);
+  }
+}
+
+// As in lru_cache. Buckets are rebuilt in the same order with the same
+// counts: the entries of one bucket of other are placed after the last
+// bucket made for the previous one
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Weigher, typename Allocator>
+void lfu_cache<Key, T, Hash, KeyEqual, Weigher, Allocator>::MoveEntries(
+    lfu_cache& other) {
+  Bucket* last = nullptr;
+  for (Bucket* bucket = other.lowest_; bucket != nullptr;
+       bucket = bucket->next) {
+    Bucket* after = last;
+    for (Entry* entry = bucket->entries.tail; entry != nullptr;
+         entry = entry->prev) {
+      Entry* moved = pool_.Create(
+          entry->value.first, std::move(entry->value.second), entry->charge);
+      try {
+        index_.TryEmplace(moved->value.first, moved);
+        Place(moved, after, bucket->frequency);
+      } catch (...) {
+        index_.EraseKey(moved->value.first);
+        pool_.Destroy(moved);
+        throw;
+      }
+      usage_ += moved->charge;
+      last = moved->bucket;
+    }
+  }
+  other.clear();
+}
+
+}  // namespace s21
+
+#endif
@@ -0,0 +1,175 @@
+#ifndef S21_CONTAINERS_COMPACT_AVL_TREE_H
+#define S21_CONTAINERS_COMPACT_AVL_TREE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include "../KeyOfValue/s21_key_of_value.h"
+#include "../PathIterator/s21_path_iterator.h"
+#include "../RangeView/s21_range_view.h"
+#include "../Stats/s21_stats.h"
+
+namespace s21 {
+// Node policies of CompactAVLTree. Subtree sizes cost a word per node and
+// are only kept when order statistics are asked for
+struct avl_basic_policy {
+  static constexpr bool order_statistics = false;
+};
+
+struct avl_order_statistics_policy {
+  static constexpr bool order_statistics = true;
+};
+
+namespace compact_avl_detail {
+template <bool OrderStatistics>
+struct SubtreeSize {
+  size_t size = 1;
+};
+
+template <>
+struct SubtreeSize<false> {};
+}  // namespace compact_avl_detail
+
+// AVL tree with a compact node: two child pointers and the element, the
+// balance factor packed into the low bits of the left pointer, the subtree
+// size only under avl_order_statistics_policy. For set<int> a node takes 24
+// bytes instead of the 40 of AVLTree's Node. Without parent pointers the
+// updates recurse from the root and iterators carry the path to their node
+// (see PathIterator), so any insertion or erasure invalidates iterators.
+// Nodes come one at a time from Allocator rebound to the node type.
+template <typename T, typename Compare = std::less<T>,
+          typename KeyOfValue = IdentityKey<T>,
+          typename Policy = avl_basic_policy,
+          typename Allocator = std::allocator<T>>
+class CompactAVLTree {
+ private:
+  // The balance factor, height(right) - height(left), is stored plus one in
+  // the two low bits of the left pointer; nodes are at least 4-aligned
+  static constexpr uintptr_t kBalanceMask = 3;
+
+  struct Node : compact_avl_detail::SubtreeSize<Policy::order_statistics> {
+    explicit Node(const T& item) : value(item) {}
+
+    Node* Left() const { return reinterpret_cast<Node*>(bits & ~kBalanceMask); }
+    void SetLeft(Node* node) {
+      bits = reinterpret_cast<uintptr_t>(node) | (bits & kBalanceMask);
+    }
+    int Balance() const { return static_cast<int>(bits & kBalanceMask) - 1; }
+    void SetBalance(int balance) {
+      bits = (bits & ~kBalanceMask) | static_cast<uintptr_t>(balance + 1);
+    }
+
+    uintptr_t bits = 1;  // left child | (balance + 1), initially none and 0
+    Node* right = nullptr;
+    T value;
+  };
+  static_assert(alignof(Node) > kBalanceMask, "no room for balance bits");
+
+  using alloc_traits = std::allocator_traits<Allocator>;
+  using node_allocator = typename alloc_traits::template rebind_alloc<Node>;
+  using node_traits = std::allocator_traits<node_allocator>;
+  static constexpr bool kNothrowMoveAssign =
+      alloc_traits::propagate_on_container_move_assignment::value ||
+      alloc_traits::is_always_equal::value;
+
+ public:
+  using key_type = typename KeyOfValue::key_type;
+  using key_compare = Compare;
+  using allocator_type = Allocator;
+  using size_type = size_t;
+  using iterator = PathIterator<Node, T, false>;
+  using const_iterator = PathIterator<Node, T, true>;
+
+  static constexpr bool kOrderStatistics = Policy::order_statistics;
+  // Bytes of one node, the memory cost of an element
+  static constexpr size_type kNodeBytes = sizeof(Node);
+
+  explicit CompactAVLTree(const Compare& comp = Compare(),
+                          const Allocator& alloc = Allocator());
+  CompactAVLTree(const CompactAVLTree& other);
+  CompactAVLTree(const CompactAVLTree& other, const Allocator& alloc);
+  CompactAVLTree(CompactAVLTree&& other) noexcept;
+  // Takes over the nodes of other if the allocators are equal and copies
+  // them otherwise
+  CompactAVLTree(CompactAVLTree&& other, const Allocator& alloc);
+  ~CompactAVLTree();
+  CompactAVLTree& operator=(const CompactAVLTree& other);
+  CompactAVLTree& operator=(CompactAVLTree&& other) noexcept(
+      kNothrowMoveAssign);
+
+  iterator Begin();
+  iterator End();
+  const_iterator Begin() const;
+  const_iterator End() const;
+
+  size_type Size() const;
+  std::pair<iterator, bool> Insert(const T& value);
+  template <typename K>
+  size_type Erase(const K& key);
+  void Erase(const_iterator pos);
+  void Clear();
+  void Swap(CompactAVLTree& other) noexcept;
+
+  template <typename K>
+  iterator Find(const K& key) const;
+  template <typename K>
+  iterator LowerBound(const K& key) const;
+  template <typename K>
+  iterator UpperBound(const K& key) const;
+
+  // Order statistics, only under avl_order_statistics_policy: the element
+  // at position index in sorted order, and the number of keys below key
+  iterator Select(size_type index) const;
+  template <typename K>
+  size_type Rank(const K& key) const;
+
+  const Compare& GetCompare() const;
+  allocator_type GetAllocator() const;
+  size_type MemoryUsage() const;
+  int Height() const;
+  container_stats GetStats() const;
+
+ private:
+  Node* root_;
+  size_type size_;
+  Compare comp_;
+  Allocator allocator_;
+  S21_STATS_MEMBER
+
+  template <typename A, typename B>
+  bool Less(const A& lhs, const B& rhs) const;
+  const key_type& KeyOf(const Node* node) const;
+  template <typename K>
+  iterator LowerBound(const K& key, bool upper) const;
+
+  Node* InsertAt(Node* node, const T& value, Node* candidate, Node*& result,
+                 bool& grew);
+  template <typename K>
+  Node* EraseAt(Node* node, const K& key, bool& removed, bool& shrank);
+  Node* DetachMin(Node* node, Node*& min, bool& shrank);
+  Node* GrewLeft(Node* node, bool& grew);
+  Node* GrewRight(Node* node, bool& grew);
+  Node* ShrankLeft(Node* node, bool& shrank);
+  Node* ShrankRight(Node* node, bool& shrank);
+  Node* FixLeftHeavy(Node* node, bool& shorter);
+  Node* FixRightHeavy(Node* node, bool& shorter);
+  Node* RotateLeft(Node* node);
+  Node* RotateRight(Node* node);
+  static size_type SizeOf(const Node* node);
+  static void Recount(Node* node);
+
+  Node* NewNode(const T& value);
+  void DeleteNode(Node* node);
+  void DeleteSubtree(Node* node);
+  Node* CloneSubtree(const Node* node);
+  void Adopt(CompactAVLTree& other);
+};
+}  // namespace s21
+
+#include "s21_compact_avl_tree.tpp"
+
+#endif
@@ -0,0 +1,709 @@
+#ifndef S21_CONTAINERS_COMPACT_AVL_TREE_TPP
+#define S21_CONTAINERS_COMPACT_AVL_TREE_TPP
+
+namespace s21 {
+
+// functions
+
+template <typename T, typename Compare, typename KeyOfValue, typename Policy,
+          typename Allocator>
+CompactAVLTree<T, Compare, KeyOfValue, Policy, Allocator>::CompactAVLTree(
+    const Compare& comp, const Allocator& alloc)
+    : root_(nullptr), size_(0), comp_(comp), allocator_(alloc) {}
+
+template <typename T, typename Compare, typename KeyOfValue, typename Policy,
+          typename Allocator>
+CompactAVLTree<T, Compare, KeyOfValue, Policy, Allocator>::CompactAVLTree(
+    const CompactAVLTree& other)
+    : CompactAVLTree(other, alloc_traits::select_on_container_copy_construction(
+                                other.allocator_)) {}
+
+template <typename T, typename Compare, typename KeyOfValue, typename Policy,
+          typename Allocator>
+CompactAVLTree<T, Compare, KeyOfValue, Policy, Allocator>::CompactAVLTree(
+    const CompactAVLTree& other, const Allocator& alloc)
+    : CompactAVLTree(other.comp_, alloc) {
+  root_ = CloneSubtree(other.root_);
+  size_ = other.size_;
+}
+
+template <typename T, typename Compare, typename KeyOfValue, typename Policy,
+          typename Allocator>
+CompactAVLTree<T, Compare, KeyOfValue, Policy, Allocator>::CompactAVLTree(
+    CompactAVLTree&& other) noexcept
+    : root_(std::exchange(other.root_, nullptr)),
+      size_(std::exchange(other.size_, 0)),
+      comp_(other.comp_),
+      allocator_(std::move(other.allocator_)) {}
+
+template <typename T, typename Compare, typename KeyOfValue, typename Policy,
+          typename Allocator>
+CompactAVLTree<T, Compare, KeyOfValue, Policy, Allocator>::CompactAVLTree(
+    CompactAVLTree&& other, const Allocator& alloc)
+    : CompactAVLTree(other.comp_, alloc) {
+  if (allocator_ == other.allocator_) {
+    Adopt(other);
+  } else {
+    root_ = CloneSubtree(other.root_);
+    size_ = other.size_;
+  }
+}
+
+template <typename T, typename Compare, typename KeyOfValue, typename Policy,
+          typename Allocator>
+CompactAVLTree<T, Compare, KeyOfValue, Policy, Allocator>::~CompactAVLTree() {
+  Clear();
+}
+
+// A throwing copy leaves this tree as it was, since the clone is made first.
+// It is made with other's allocator only when that one propagates
+template <typename T, typename Compare, typename KeyOfValue, typename Policy,
+          typename Allocator>
+CompactAVLTree<T, Compare, KeyOfValue, Policy, Allocator>&
+CompactAVLTree<T, Compare, KeyOfValue, Policy, Allocator>::operator=(
+    const CompactAVLTree& other) {
+  if (this != &other) {
+    if constexpr (alloc_traits::propagate_on_container_copy_assignment::
+                      value) {
+      CompactAVLTree tmp(other, other.allocator_);
+      Clear();
+      allocator_ = other.allocator_;
+      Adopt(tmp);
+    } else {
+      CompactAVLTree tmp(other, allocator_);
+      Clear();
+      Adopt(tmp);
+    }
+  }
+  return *this;
+}
+
+// Takes the nodes over unless they belong to an unequal allocator that does
+// not propagate, which only other can free; those are cloned
+template <typename T, typename Compare, typename KeyOfValue, typename Policy,
+          typename Allocator>
+CompactAVLTree<T, Compare, KeyOfValue, Policy, Allocator>&
+CompactAVLTree<T, Compare, KeyOfValue, Policy, Allocator>::operator=(
+    CompactAVLTree&& other) noexcept(kNothrowMoveAssign) {
+  if (this != &other) {
+    if constexpr (alloc_traits::propagate_on_container_move_assignment::
+                      value) {
+      Clear();
+      allocator_ = std::move(other.allocator_);
+      Adopt(other);
+    } else if (allocator_ == other.allocator_) {
+      Clear();
+      Adopt(other);
+    } else {
+      CompactAVLTree tmp(other, allocator_);
+      Clear();
+      Adopt(tmp);
+    }
+  }
+  return *this;
+}
+
+// iterators
+
+template <typename T, typename Compare, typename KeyOfValue, typename Policy,
+          typename Allocator>
+typename CompactAVLTree<T, Compare, KeyOfValue, Policy, Allocator>::iterator
+CompactAVLTree<T, Compare, KeyOfValue, Policy, Allocator>::Begin() {
+  iterator it(root_);
+  it.PushLeftmost(root_);
+  return it;
+}
+
+template <typename T, typename Compare, typename KeyOfValue, typename Policy,
+          typename Allocator>
+typename CompactAVLTree<T, Compare, KeyOfValue, Policy, Allocator>::iterator
+CompactAVLTree<T, Compare, KeyOfValue, Policy, Allocator>::End() {
+  return iterator(root_);
+}
+
+template <typename T, typename Compare, typename KeyOfValue, typename Policy,
+          typename Allocator>
+typename CompactAVLTree<T, Compare, KeyOfValue, Policy,
+                        Allocator>::const_iterator
+CompactAVLTree<T, Compare, KeyOfValue, Policy, Allocator>::Begin() const {
+  const_iterator it(root_);
+  it.PushLeftmost(root_);
+  return it;
+}
+
+template <typename T, typename Compare, typename KeyOfValue, typename Policy,
+          typename Allocator>
+typename CompactAVLTree<T, Compare, KeyOfValue, Policy,
+                        Allocator>::const_iterator
+CompactAVLTree<T, Compare, KeyOfValue, Policy, Allocator>::End() const {
+  return const_iterator(root_);
+}
+
+// capacity
+
+template <typename T, typename Compare, typename KeyOfValue, typename Policy,
+          typename Allocator>
+typename CompactAVLTree<T, Compare, KeyOfValue, Policy, Allocator>::size_type
+CompactAVLTree<T, Compare, KeyOfValue, Policy, Allocator>::Size() const {
+  return size_;
+}
+
+// modifiers
+
+// Inserts value unless an element with an equivalent key exists. The
+// iterator comes from a second descent: rotations on the way back up
+// reshape the path to the element
+template <typename T, typename Compare, typename KeyOfValue, typename Policy,
+          typename Allocator>
+std::pair<typename CompactAVLTree<T, Compare, KeyOfValue, Policy,
+                                  Allocator>::iterator,
+          bool>
+CompactAVLTree<T, Compare, KeyOfValue, Policy, Allocator>::Insert(
+    const T& value) {
+  S21_STATS(Lookup());
+  const size_type before = size_;
+  Node* result = nullptr;
+  bool grew = false;
+  root_ = InsertAt(root_, value, nullptr, result, grew);
+  return std::make_pair(LowerBound(KeyOf(result)), size_ != before);
+}
+
+template <typename T, typename Compare, typename KeyOfValue, typename Policy,
+          typename Allocator>
+template <typename K>
+typename CompactAVLTree<T, Compare, KeyOfValue, Policy, Allocator>::size_type
+CompactAVLTree<T, Compare, KeyOfValue, Policy, Allocator>::Erase(const K& key) {
+  S21_STATS(Lookup());
+  bool removed = false;
+  bool shrank = false;
+  root_ = EraseAt(root_, key, removed, shrank);
+  return removed ? 1 : 0;
+}
+
+// Without parent pointers the element is erased by its key
+template <typename T, typename Compare, typename KeyOfValue, typename Policy,
+          typename Allocator>
+void CompactAVLTree<T, Compare, KeyOfValue, Policy, Allocator>::Erase(
+    const_iterator pos) {
+  Erase(KeyOfValue()(*pos));
+}
+
+template <typename T, typename Compare, typename KeyOfValue, typename Policy,
+          typename Allocator>
+void CompactAVLTree<T, Compare, KeyOfValue, Policy, Allocator>::Clear() {
+  DeleteSubtree(root_);
+  root_ = nullptr;
+  size_ = 0;
+}
+
+template <typename T, typename Compare, typename KeyOfValue, typename Policy,
+          typename Allocator>
+void CompactAVLTree<T, Compare, KeyOfValue, Policy, Allocator>::Swap(
+    CompactAVLTree& other) noexcept {
+  std::swap(root_, other.root_);
+  std::swap(size_, other.size_);
+  std::swap(comp_, other.comp_);
+  if constexpr (alloc_traits::propagate_on_container_swap::value) {
+    using std::swap;
+    swap(allocator_, other.allocator_);
+  }
+}
+
+// lookup
+
+template <typename T, typename Compare, typename KeyOfValue, typename Policy,
+          typename Allocator>
+template <typename K>
+typename CompactAVLTree<T, Compare, KeyOfValue, Policy, Allocator>::iterator
+CompactAVLTree<T, Compare, KeyOfValue, Policy, Allocator>::Find(
+    const K& key) const {
+  iterator it = LowerBound(key, false);
+  if (it.Depth() > 0 && Less(key, KeyOf(it.Top()))) it.Truncate(0);
+  return it;
+}
+
+template <typename T, typename Compare, typename KeyOfValue, typename Policy,
+          typename Allocator>
+template <typename K>
+typename CompactAVLTree<T, Compare, KeyOfValue, Policy, Allocator>::iterator
+CompactAVLTree<T, Compare, KeyOfValue, Policy, Allocator>::LowerBound(
+    const K& key) const {
+  return LowerBound(key, false);
+}
+
+template <typename T, typename Compare, typename KeyOfValue, typename Policy,
+          typename Allocator>
+template <typename K>
+typename CompactAVLTree<T, Compare, KeyOfValue, Policy, Allocator>::iterator
+CompactAVLTree<T, Compare, KeyOfValue, Policy, Allocator>::UpperBound(
+    const K& key) const {
+  return LowerBound(key, true);
+}
+
+template <typename T, typename Compare, typename KeyOfValue, typename Policy,
+          typename Allocator>
+typename CompactAVLTree<T, Compare, KeyOfValue, Policy, Allocator>::iterator
+CompactAVLTree<T, Compare, KeyOfValue, Policy, Allocator>::Select(
+    size_type index) const {
+  static_assert(kOrderStatistics, "Select needs avl_order_statistics_policy");
+  iterator it(root_);
+  if (index >= size_) return it;
+  Node* node = root_;
+  for (;;) {
+    it.Push(node);
+    size_type left = SizeOf(node->Left());
+    if (index == left) break;
+    if (index < left) {
+      node = node->Left();
+    } else {
+      index -= left + 1;
+      node = node->right;
+    }
+  }
+  return it;
+}
+
+template <typename T, typename Compare, typename KeyOfValue, typename Policy,
+          typename Allocator>
+template <typename K>
+typename CompactAVLTree<T, Compare, KeyOfValue, Policy, Allocator>::size_type
+CompactAVLTree<T, Compare, KeyOfValue, Policy, Allocator>::Rank(
+    const K& key) const {
+  static_assert(kOrderStatistics, "Rank needs avl_order_statistics_policy");
+  size_type rank = 0;
+  for (const Node* node = root_; node != nullptr;) {
+    if (Less(KeyOf(node), key)) {
+      rank += SizeOf(node->Left()) + 1;
+      node = node->right;
+    } else {
+      node = node->Left();
+    }
+  }
+  return rank;
+}
+
+template <typename T, typename Compare, typename KeyOfValue, typename Policy,
+          typename Allocator>
+const Compare&
+CompactAVLTree<T, Compare, KeyOfValue, Policy, Allocator>::GetCompare() const {
+  return comp_;
+}
+
+template <typename T, typename Compare, typename KeyOfValue, typename Policy,
+          typename Allocator>
+typename CompactAVLTree<T, Compare, KeyOfValue, Policy,
+                        Allocator>::allocator_type
+CompactAVLTree<T, Compare, KeyOfValue, Policy, Allocator>::GetAllocator(
+    ) const {
+  return allocator_;
+}
+
+template <typename T, typename Compare, typename KeyOfValue, typename Policy,
+          typename Allocator>
+typename CompactAVLTree<T, Compare, KeyOfValue, Policy, Allocator>::size_type
+CompactAVLTree<T, Compare, KeyOfValue, Policy, Allocator>::MemoryUsage() const {
+  return size_ * sizeof(Node);
+}
+
+// Follows the taller child, the balance factor tells which one it is
+template <typename T, typename Compare, typename KeyOfValue, typename Policy,
+          typename Allocator>
+int CompactAVLTree<T, Compare, KeyOfValue, Policy, Allocator>::Height() const {
+  int height = 0;
+  for (const Node* node = root_; node != nullptr; ++height) {
+    node = node->Balance() < 0 ? node->Left() : node->right;
+  }
+  return height;
+}
+
+template <typename T, typename Compare, typename KeyOfValue, typename Policy,
+          typename Allocator>
+container_stats
+CompactAVLTree<T, Compare, KeyOfValue, Policy, Allocator>::GetStats() const {
+  return S21_STATS_GET();
+}
+
+// helpers
+
+template <typename T, typename Compare, typename KeyOfValue, typename Policy,
+          typename Allocator>
+template <typename A, typename B>
+bool CompactAVLTree<T, Compare, KeyOfValue, Policy, Allocator>::Less(
+    const A& lhs, const B& rhs) const {
+  S21_STATS(Comparison());
+  return comp_(lhs, rhs);
+}
+
+template <typename T, typename Compare, typename KeyOfValue, typename Policy,
+          typename Allocator>
+const typename CompactAVLTree<T, Compare, KeyOfValue, Policy,
+                              Allocator>::key_type&
+CompactAVLTree<T, Compare, KeyOfValue, Policy, Allocator>::KeyOf(
+    const Node* node) const {
+  return KeyOfValue()(node->value);
+}
+
+// One Compare call per level; the path is cut back to the last node the
+// descent turned left at, the first element not less than (or, for upper,
+// greater than) key
+template <typename T, typename Compare, typename KeyOfValue, typename Policy,
+          typename Allocator>
+template <typename K>
+typename CompactAVLTree<T, Compare, KeyOfValue, Policy, Allocator>::iterator
+CompactAVLTree<T, Compare, KeyOfValue, Policy, Allocator>::LowerBound(
+    const K& key, bool upper) const {
+  S21_STATS(Lookup());
+  iterator it(root_);
+  int depth = 0;
+  for (Node* node = root_; node != nullptr;) {
+    S21_STATS(NodeVisit());
+    it.Push(node);
+    if (upper ? Less(key, KeyOf(node)) : !Less(KeyOf(node), key)) {
+      depth = it.Depth();
+      node = node->Left();
+    } else {
+      node = node->right;
+    }
+  }
+  it.Truncate(depth);
+  return it;
+}
+
+// Recursive insertion with one Compare call per level: candidate is the last
+// node the descent went right at, the only one that may equal value. grew
+// reports whether the height of the subtree increased
+template <typename T, typename Compare, typename KeyOfValue, typename Policy,
+          typename Allocator>
+typename CompactAVLTree<T, Compare, KeyOfValue, Policy, Allocator>::Node*
+CompactAVLTree<T, Compare, KeyOfValue, Policy, Allocator>::InsertAt(
+    Node* node, const T& value, Node* candidate, Node*& result, bool& grew) {
+  if (node == nullptr) {
+    const key_type& key = KeyOfValue()(value);
+    if (candidate != nullptr && !Less(KeyOf(candidate), key)) {
+      result = candidate;
+      grew = false;
+      return nullptr;
+    }
+    result = NewNode(value);
+    ++size_;
+    grew = true;
+    return result;
+  }
+
+  S21_STATS(NodeVisit());
+  if (Less(KeyOfValue()(value), KeyOf(node))) {
+    node->SetLeft(InsertAt(node->Left(), value, candidate, result, grew));
+    if (grew) node = GrewLeft(node, grew);
+  } else {
+    node->right = InsertAt(node->right, value, node, result, grew);
+    if (grew) node = GrewRight(node, grew);
+  }
+  Recount(node);
+  return node;
+}
+
+// Recursive erasure; shrank reports whether the height of the subtree
+// decreased. A node with two children is replaced by the minimum of its
+// right subtree, which takes over its left link and balance
+template <typename T, typename Compare, typename KeyOfValue, typename Policy,
+          typename Allocator>
+template <typename K>
+typename CompactAVLTree<T, Compare, KeyOfValue, Policy, Allocator>::Node*
+CompactAVLTree<T, Compare, KeyOfValue, Policy, Allocator>::EraseAt(
+    Node* node, const K& key, bool& removed, bool& shrank) {
+  if (node == nullptr) return nullptr;
+
+  S21_STATS(NodeVisit());
+  if (Less(key, KeyOf(node))) {
+    node->SetLeft(EraseAt(node->Left(), key, removed, shrank));
+    if (shrank) node = ShrankLeft(node, shrank);
+  } else if (Less(KeyOf(node), key)) {
+    node->right = EraseAt(node->right, key, removed, shrank);
+    if (shrank) node = ShrankRight(node, shrank);
+  } else {
+    removed = true;
+    shrank = true;
+    Node* replacement = nullptr;
+    if (node->Left() == nullptr) {
+      replacement = node->right;
+    } else if (node->right == nullptr) {
+      replacement = node->Left();
+    } else {
+      Node* right = DetachMin(node->right, replacement, shrank);
+      replacement->bits = node->bits;
+      replacement->right = right;
+      if (shrank) replacement = ShrankRight(replacement, shrank);
+      Recount(replacement);
+    }
+    DeleteNode(node);
+    --size_;
+    return replacement;
+  }
+  Recount(node);
+  return node;
+}
+
+template <typename T, typename Compare, typename KeyOfValue, typename Policy,
+          typename Allocator>
+typename CompactAVLTree<T, Compare, KeyOfValue, Policy, Allocator>::Node*
+CompactAVLTree<T, Compare, KeyOfValue, Policy, Allocator>::DetachMin(
+    Node* node, Node*& min, bool& shrank) {
+  if (node->Left() == nullptr) {
+    min = node;
+    shrank = true;
+    return node->right;
+  }
+  node->SetLeft(DetachMin(node->Left(), min, shrank));
+  if (shrank) node = ShrankLeft(node, shrank);
+  Recount(node);
+  return node;
+}
+
+// The left subtree got one level taller; grew stays set while the height
+// of node grows too
+template <typename T, typename Compare, typename KeyOfValue, typename Policy,
+          typename Allocator>
+typename CompactAVLTree<T, Compare, KeyOfValue, Policy, Allocator>::Node*
+CompactAVLTree<T, Compare, KeyOfValue, Policy, Allocator>::GrewLeft(
+    Node* node, bool& grew) {
+  if (node->Balance() > 0) {
+    node->SetBalance(0);
+    grew = false;
+  } else if (node->Balance() == 0) {
+    node->SetBalance(-1);
+  } else {
+    bool shorter = false;
+    node = FixLeftHeavy(node, shorter);
+    grew = false;
+  }
+  return node;
+}
+
+template <typename T, typename Compare, typename KeyOfValue, typename Policy,
+          typename Allocator>
+typename CompactAVLTree<T, Compare, KeyOfValue, Policy, Allocator>::Node*
+CompactAVLTree<T, Compare, KeyOfValue, Policy, Allocator>::GrewRight(
+    Node* node, bool& grew) {
+  if (node->Balance() < 0) {
+    node->SetBalance(0);
+    grew = false;
+  } else if (node->Balance() == 0) {
+    node->SetBalance(1);
+  } else {
+    bool shorter = false;
+    node = FixRightHeavy(node, shorter);
+    grew = false;
+  }
+  return node;
+}
+
+// The left subtree got one level shorter; shrank stays set while the height
+// of node decreases too
+template <typename T, typename Compare, typename KeyOfValue, typename Policy,
+          typename Allocator>
+typename CompactAVLTree<T, Compare, KeyOfValue, Policy, Allocator>::Node*
+CompactAVLTree<T, Compare, KeyOfValue, Policy, Allocator>::ShrankLeft(
+    Node* node, bool& shrank) {
+  if (node->Balance() < 0) {
+    node->SetBalance(0);
+  } else if (node->Balance() == 0) {
+    node->SetBalance(1);
+    shrank = false;
+  } else {
+    node = FixRightHeavy(node, shrank);
+  }
+  return node;
+}
+
+template <typename T, typename Compare, typename KeyOfValue, typename Policy,
+          typename Allocator>
+typename CompactAVLTree<T, Compare, KeyOfValue, Policy, Allocator>::Node*
+CompactAVLTree<T, Compare, KeyOfValue, Policy, Allocator>::ShrankRight(
+    Node* node, bool& shrank) {
+  if (node->Balance() > 0) {
+    node->SetBalance(0);
+  } else if (node->Balance() == 0) {
+    node->SetBalance(-1);
+    shrank = false;
+  } else {
+    node = FixLeftHeavy(node, shrank);
+  }
+  return node;
+}
+
+// Rotates a node whose left subtree is two levels taller than the right one;
+// shorter reports whether the rotated subtree lost a level (always after an
+// insertion, not when the left child was balanced, which only erasure does)
+template <typename T, typename Compare, typename KeyOfValue, typename Policy,
+          typename Allocator>
+typename CompactAVLTree<T, Compare, KeyOfValue, Policy, Allocator>::Node*
+CompactAVLTree<T, Compare, KeyOfValue, Policy, Allocator>::FixLeftHeavy(
+    Node* node, bool& shorter) {
+  Node* left = node->Left();
+  const int balance = left->Balance();
+  if (balance <= 0) {
+    node = RotateRight(node);
+    node->SetBalance(balance == 0 ? 1 : 0);
+    node->right->SetBalance(balance == 0 ? -1 : 0);
+    shorter = balance != 0;
+    return node;
+  }
+  const int inner = left->right->Balance();
+  node->SetLeft(RotateLeft(left));
+  node = RotateRight(node);
+  node->Left()->SetBalance(inner > 0 ? -1 : 0);
+  node->right->SetBalance(inner < 0 ? 1 : 0);
+  node->SetBalance(0);
+  shorter = true;
+  return node;
+}
+
+template <typename T, typename Compare, typename KeyOfValue, typename Policy,
+          typename Allocator>
+typename CompactAVLTree<T, Compare, KeyOfValue, Policy, Allocator>::Node*
+CompactAVLTree<T, Compare, KeyOfValue, Policy, Allocator>::FixRightHeavy(
+    Node* node, bool& shorter) {
+  Node* right = node->right;
+  const int balance = right->Balance();
+  if (balance >= 0) {
+    node = RotateLeft(node);
+    node->SetBalance(balance == 0 ? -1 : 0);
+    node->Left()->SetBalance(balance == 0 ? 1 : 0);
+    shorter = balance != 0;
+    return node;
+  }
+  const int inner = right->Left()->Balance();
+  node->right = RotateRight(right);
+  node = RotateLeft(node);
+  node->Left()->SetBalance(inner > 0 ? -1 : 0);
+  node->right->SetBalance(inner < 0 ? 1 : 0);
+  node->SetBalance(0);
+  shorter = true;
+  return node;
+}
+
+// Rotations only relink; the callers set the balance factors
+template <typename T, typename Compare, typename KeyOfValue, typename Policy,
+          typename Allocator>
+typename CompactAVLTree<T, Compare, KeyOfValue, Policy, Allocator>::Node*
+CompactAVLTree<T, Compare, KeyOfValue, Policy, Allocator>::RotateLeft(
+    Node* node) {
+  S21_STATS(Rotation());
+  Node* right = node->right;
+  node->right = right->Left();
+  right->SetLeft(node);
+  Recount(node);
+  Recount(right);
+  return right;
+}
+
+template <typename T, typename Compare, typename KeyOfValue, typename Policy,
+          typename Allocator>
+typename CompactAVLTree<T, Compare, KeyOfValue, Policy, Allocator>::Node*
+CompactAVLTree<T, Compare, KeyOfValue, Policy, Allocator>::RotateRight(
+    Node* node) {
+  S21_STATS(Rotation());
+  Node* left = node->Left();
+  node->SetLeft(left->right);
+  left->right = node;
+  Recount(node);
+  Recount(left);
+  return left;
+}
+
+template <typename T, typename Compare, typename KeyOfValue, typename Policy,
+          typename Allocator>
+typename CompactAVLTree<T, Compare, KeyOfValue, Policy, Allocator>::size_type
+CompactAVLTree<T, Compare, KeyOfValue, Policy, Allocator>::SizeOf(
+    const Node* node) {
+  if constexpr (kOrderStatistics) {
+    return node != nullptr ? node->size : 0;
+  } else {
+    (void)node;
+    return 0;
+  }
+}
+
+template <typename T, typename Compare, typename KeyOfValue, typename Policy,
+          typename Allocator>
+void CompactAVLTree<T, Compare, KeyOfValue, Policy, Allocator>::Recount(
+    Node* node) {
+  if constexpr (kOrderStatistics) {
+    node->size = SizeOf(node->Left()) + SizeOf(node->right) + 1;
+  } else {
+    (void)node;
+  }
+}
+
+template <typename T, typename Compare, typename KeyOfValue, typename Policy,
+          typename Allocator>
+typename CompactAVLTree<T, Compare, KeyOfValue, Policy, Allocator>::Node*
+CompactAVLTree<T, Compare, KeyOfValue, Policy, Allocator>::NewNode(
+    const T& value) {
+  node_allocator alloc(allocator_);
+  Node* node = node_traits::allocate(alloc, 1);
+  try {
+    node_traits::construct(alloc, node, value);
+  } catch (...) {
+    node_traits::deallocate(alloc, node, 1);
+    throw;
+  }
+  S21_STATS(Allocation(sizeof(Node)));
+  return node;
+}
+
+template <typename T, typename Compare, typename KeyOfValue, typename Policy,
+          typename Allocator>
+void CompactAVLTree<T, Compare, KeyOfValue, Policy, Allocator>::DeleteNode(
+    Node* node) {
+  node_allocator alloc(allocator_);
+  node_traits::destroy(alloc, node);
+  node_traits::deallocate(alloc, node, 1);
+  S21_STATS(Deallocation());
+}
+
+template <typename T, typename Compare, typename KeyOfValue, typename Policy,
+          typename Allocator>
+void CompactAVLTree<T, Compare, KeyOfValue, Policy, Allocator>::DeleteSubtree(
+    Node* node) {
+  while (node != nullptr) {
+    DeleteSubtree(node->Left());
+    Node* right = node->right;
+    DeleteNode(node);
+    node = right;
+  }
+}
+
+// Copies node by node, keeping the shape and the balance factors
+template <typename T, typename Compare, typename KeyOfValue, typename Policy,
+          typename Allocator>
+typename CompactAVLTree<T, Compare, KeyOfValue, Policy, Allocator>::Node*
+CompactAVLTree<T, Compare, KeyOfValue, Policy, Allocator>::CloneSubtree(
+    const Node* node) {
+  if (node == nullptr) return nullptr;
+  Node* copy = NewNode(node->value);
+  try {
+    copy->SetLeft(CloneSubtree(node->Left()));
+    copy->right = CloneSubtree(node->right);
+  } catch (...) {
+    DeleteSubtree(copy);
+    throw;
+  }
+  copy->SetBalance(node->Balance());
+  Recount(copy);
+  return copy;
+}
+
+// Takes over the nodes of other, which is left empty
+template <typename T, typename Compare, typename KeyOfValue, typename Policy,
+          typename Allocator>
+void CompactAVLTree<T, Compare, KeyOfValue, Policy, Allocator>::Adopt(
+    CompactAVLTree& other) {
+  root_ = std::exchange(other.root_, nullptr);
+  size_ = std::exchange(other.size_, 0);
+  comp_ = other.comp_;
+}
+
+}  // namespace s21
+
+#endif
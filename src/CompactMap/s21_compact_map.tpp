@@ -0,0 +1,317 @@
+#ifndef S21_CONTAINERS_COMPACT_MAP_TPP
+#define S21_CONTAINERS_COMPACT_MAP_TPP
+
+#include <utility>
+
+namespace s21 {
+
+// functions
+
+template <typename Key, typename T, typename Compare, typename Policy,
+          typename Allocator>
+compact_map<Key, T, Compare, Policy, Allocator>::compact_map() : tree_() {}
+
+template <typename Key, typename T, typename Compare, typename Policy,
+          typename Allocator>
+compact_map<Key, T, Compare, Policy, Allocator>::compact_map(
+    const Compare& comp, const Allocator& alloc)
+    : tree_(comp, alloc) {}
+
+template <typename Key, typename T, typename Compare, typename Policy,
+          typename Allocator>
+compact_map<Key, T, Compare, Policy, Allocator>::compact_map(
+    const Allocator& alloc)
+    : tree_(Compare(), alloc) {}
+
+template <typename Key, typename T, typename Compare, typename Policy,
+          typename Allocator>
+compact_map<Key, T, Compare, Policy, Allocator>::compact_map(
+    std::initializer_list<value_type> const& items, const Allocator& alloc)
+    : tree_(Compare(), alloc) {
+  for (const auto& item : items) insert(item);
+}
+
+template <typename Key, typename T, typename Compare, typename Policy,
+          typename Allocator>
+compact_map<Key, T, Compare, Policy, Allocator>::compact_map(
+    const compact_map& other, const Allocator& alloc)
+    : tree_(other.tree_, alloc) {}
+
+template <typename Key, typename T, typename Compare, typename Policy,
+          typename Allocator>
+compact_map<Key, T, Compare, Policy, Allocator>::compact_map(
+    compact_map&& other, const Allocator& alloc)
+    : tree_(std::move(other.tree_), alloc) {}
+
+template <typename Key, typename T, typename Compare, typename Policy,
+          typename Allocator>
+typename compact_map<Key, T, Compare, Policy, Allocator>::allocator_type
+compact_map<Key, T, Compare, Policy, Allocator>::get_allocator() const {
+  return tree_.GetAllocator();
+}
+
+// element access
+
+template <typename Key, typename T, typename Compare, typename Policy,
+          typename Allocator>
+typename compact_map<Key, T, Compare, Policy, Allocator>::mapped_type&
+compact_map<Key, T, Compare, Policy, Allocator>::at(const Key& key) {
+  iterator it = tree_.Find(key);
+  if (it == tree_.End()) throw std::invalid_argument("This key doesn't exist");
+  return it->second;
+}
+
+template <typename Key, typename T, typename Compare, typename Policy,
+          typename Allocator>
+const typename compact_map<Key, T, Compare, Policy, Allocator>::mapped_type&
+compact_map<Key, T, Compare, Policy, Allocator>::at(const Key& key) const {
+  const_iterator it = tree_.Find(key);
+  if (it == tree_.End()) throw std::invalid_argument("This key doesn't exist");
+  return it->second;
+}
+
+template <typename Key, typename T, typename Compare, typename Policy,
+          typename Allocator>
+typename compact_map<Key, T, Compare, Policy, Allocator>::mapped_type&
+compact_map<Key, T, Compare, Policy, Allocator>::operator[](const Key& key) {
+  iterator it = tree_.Find(key);
+  if (it == tree_.End()) it = tree_.Insert(value_type(key, T())).first;
+  return it->second;
+}
+
+// iterators
+
+template <typename Key, typename T, typename Compare, typename Policy,
+          typename Allocator>
+typename compact_map<Key, T, Compare, Policy, Allocator>::iterator
+compact_map<Key, T, Compare, Policy, Allocator>::begin() {
+  return tree_.Begin();
+}
+
+template <typename Key, typename T, typename Compare, typename Policy,
+          typename Allocator>
+typename compact_map<Key, T, Compare, Policy, Allocator>::iterator
+compact_map<Key, T, Compare, Policy, Allocator>::end() {
+  return tree_.End();
+}
+
+template <typename Key, typename T, typename Compare, typename Policy,
+          typename Allocator>
+typename compact_map<Key, T, Compare, Policy, Allocator>::const_iterator
+compact_map<Key, T, Compare, Policy, Allocator>::begin() const {
+  return tree_.Begin();
+}
+
+template <typename Key, typename T, typename Compare, typename Policy,
+          typename Allocator>
+typename compact_map<Key, T, Compare, Policy, Allocator>::const_iterator
+compact_map<Key, T, Compare, Policy, Allocator>::end() const {
+  return tree_.End();
+}
+
+// capacity
+
+template <typename Key, typename T, typename Compare, typename Policy,
+          typename Allocator>
+bool compact_map<Key, T, Compare, Policy, Allocator>::empty() const {
+  return tree_.Size() == 0;
+}
+
+template <typename Key, typename T, typename Compare, typename Policy,
+          typename Allocator>
+typename compact_map<Key, T, Compare, Policy, Allocator>::size_type
+compact_map<Key, T, Compare, Policy, Allocator>::size() const {
+  return tree_.Size();
+}
+
+template <typename Key, typename T, typename Compare, typename Policy,
+          typename Allocator>
+typename compact_map<Key, T, Compare, Policy, Allocator>::size_type
+compact_map<Key, T, Compare, Policy, Allocator>::max_size() const {
+  return std::numeric_limits<size_type>::max() / sizeof(value_type);
+}
+
+// modifiers
+
+template <typename Key, typename T, typename Compare, typename Policy,
+          typename Allocator>
+void compact_map<Key, T, Compare, Policy, Allocator>::clear() {
+  tree_.Clear();
+}
+
+template <typename Key, typename T, typename Compare, typename Policy,
+          typename Allocator>
+std::pair<typename compact_map<Key, T, Compare, Policy, Allocator>::iterator,
+          bool>
+compact_map<Key, T, Compare, Policy, Allocator>::insert(
+    const value_type& value) {
+  return tree_.Insert(value);
+}
+
+template <typename Key, typename T, typename Compare, typename Policy,
+          typename Allocator>
+std::pair<typename compact_map<Key, T, Compare, Policy, Allocator>::iterator,
+          bool>
+compact_map<Key, T, Compare, Policy, Allocator>::insert(
+    const Key& key, const T& obj) {
+  return tree_.Insert(value_type(key, obj));
+}
+
+template <typename Key, typename T, typename Compare, typename Policy,
+          typename Allocator>
+std::pair<typename compact_map<Key, T, Compare, Policy, Allocator>::iterator,
+          bool>
+compact_map<Key, T, Compare, Policy, Allocator>::insert_or_assign(
+    const Key& key, const T& obj) {
+  auto result = tree_.Insert(value_type(key, obj));
+  if (!result.second) result.first->second = obj;
+  return result;
+}
+
+template <typename Key, typename T, typename Compare, typename Policy,
+          typename Allocator>
+void compact_map<Key, T, Compare, Policy, Allocator>::erase(
+    const_iterator pos) {
+  tree_.Erase(pos);
+}
+
+template <typename Key, typename T, typename Compare, typename Policy,
+          typename Allocator>
+typename compact_map<Key, T, Compare, Policy, Allocator>::size_type
+compact_map<Key, T, Compare, Policy, Allocator>::erase(const Key& key) {
+  return tree_.Erase(key);
+}
+
+template <typename Key, typename T, typename Compare, typename Policy,
+          typename Allocator>
+void compact_map<Key, T, Compare, Policy, Allocator>::swap(
+    compact_map& other) noexcept {
+  tree_.Swap(other.tree_);
+}
+
+// Moves the keys missing here, duplicates stay in other. Erasing from the
+// tree invalidates iterators, so the leftovers are collected in a new tree
+template <typename Key, typename T, typename Compare, typename Policy,
+          typename Allocator>
+void compact_map<Key, T, Compare, Policy, Allocator>::merge(
+    compact_map& other) {
+  if (this == &other) return;
+  tree_type rest(other.tree_.GetCompare(), other.tree_.GetAllocator());
+  for (const auto& item : other) {
+    if (!tree_.Insert(item).second) rest.Insert(item);
+  }
+  other.tree_ = std::move(rest);
+}
+
+// lookup
+
+template <typename Key, typename T, typename Compare, typename Policy,
+          typename Allocator>
+bool compact_map<Key, T, Compare, Policy, Allocator>::contains(
+    const Key& key) const {
+  return tree_.Find(key) != tree_.End();
+}
+
+template <typename Key, typename T, typename Compare, typename Policy,
+          typename Allocator>
+typename compact_map<Key, T, Compare, Policy, Allocator>::iterator
+compact_map<Key, T, Compare, Policy, Allocator>::find(const Key& key) {
+  return tree_.Find(key);
+}
+
+template <typename Key, typename T, typename Compare, typename Policy,
+          typename Allocator>
+typename compact_map<Key, T, Compare, Policy, Allocator>::const_iterator
+compact_map<Key, T, Compare, Policy, Allocator>::find(const Key& key) const {
+  return tree_.Find(key);
+}
+
+template <typename Key, typename T, typename Compare, typename Policy,
+          typename Allocator>
+template <typename K, typename, typename>
+bool compact_map<Key, T, Compare, Policy, Allocator>::contains(
+    const K& key) const {
+  return tree_.Find(key) != tree_.End();
+}
+
+template <typename Key, typename T, typename Compare, typename Policy,
+          typename Allocator>
+template <typename K, typename, typename>
+typename compact_map<Key, T, Compare, Policy, Allocator>::iterator
+compact_map<Key, T, Compare, Policy, Allocator>::find(const K& key) {
+  return tree_.Find(key);
+}
+
+template <typename Key, typename T, typename Compare, typename Policy,
+          typename Allocator>
+typename compact_map<Key, T, Compare, Policy, Allocator>::iterator
+compact_map<Key, T, Compare, Policy, Allocator>::lower_bound(const Key& key) {
+  return tree_.LowerBound(key);
+}
+
+template <typename Key, typename T, typename Compare, typename Policy,
+          typename Allocator>
+typename compact_map<Key, T, Compare, Policy, Allocator>::iterator
+compact_map<Key, T, Compare, Policy, Allocator>::upper_bound(const Key& key) {
+  return tree_.UpperBound(key);
+}
+
+template <typename Key, typename T, typename Compare, typename Policy,
+          typename Allocator>
+std::pair<typename compact_map<Key, T, Compare, Policy, Allocator>::iterator,
+          typename compact_map<Key, T, Compare, Policy, Allocator>::iterator>
+compact_map<Key, T, Compare, Policy, Allocator>::equal_range(const Key& key) {
+  return std::make_pair(lower_bound(key), upper_bound(key));
+}
+
+template <typename Key, typename T, typename Compare, typename Policy,
+          typename Allocator>
+RangeView<typename compact_map<Key, T, Compare, Policy, Allocator>::iterator>
+compact_map<Key, T, Compare, Policy, Allocator>::range(
+    const Key& first, const Key& last) {
+  return RangeView<iterator>(lower_bound(first), lower_bound(last));
+}
+
+// order statistics
+
+template <typename Key, typename T, typename Compare, typename Policy,
+          typename Allocator>
+typename compact_map<Key, T, Compare, Policy, Allocator>::iterator
+compact_map<Key, T, Compare, Policy, Allocator>::find_by_order(
+    size_type index) {
+  return tree_.Select(index);
+}
+
+template <typename Key, typename T, typename Compare, typename Policy,
+          typename Allocator>
+typename compact_map<Key, T, Compare, Policy, Allocator>::size_type
+compact_map<Key, T, Compare, Policy, Allocator>::order_of_key(
+    const Key& key) const {
+  return tree_.Rank(key);
+}
+
+// observers
+
+template <typename Key, typename T, typename Compare, typename Policy,
+          typename Allocator>
+typename compact_map<Key, T, Compare, Policy, Allocator>::key_compare
+compact_map<Key, T, Compare, Policy, Allocator>::key_comp() const {
+  return tree_.GetCompare();
+}
+
+template <typename Key, typename T, typename Compare, typename Policy,
+          typename Allocator>
+const typename compact_map<Key, T, Compare, Policy, Allocator>::tree_type&
+compact_map<Key, T, Compare, Policy, Allocator>::get_tree() const {
+  return tree_;
+}
+
+template <typename Key, typename T, typename Compare, typename Policy,
+          typename Allocator>
+container_stats compact_map<Key, T, Compare, Policy, Allocator>::stats() const {
+  return tree_.GetStats();
+}
+
+}  // namespace s21
+
+#endif
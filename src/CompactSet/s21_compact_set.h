@@ -0,0 +1,108 @@
+#ifndef S21_CONTAINERS_COMPACT_SET_H
+#define S21_CONTAINERS_COMPACT_SET_H
+
+#include <initializer_list>
+#include <limits>
+#include <memory>
+#include <memory_resource>
+
+#include "../CompactAVLTree/s21_compact_avl_tree.h"
+
+namespace s21 {
+// Ordered set on the compact AVL tree (see CompactAVLTree) with the
+// interface of s21::set. Policy avl_order_statistics_policy adds
+// find_by_order and order_of_key. Any insertion or erasure invalidates
+// iterators; elements stay where they are, so references remain valid
+template <typename T, typename Compare = std::less<T>,
+          typename Policy = avl_basic_policy,
+          typename Allocator = std::allocator<T>>
+class compact_set {
+ public:
+  // member type
+  using key_type = T;
+  using value_type = T;
+  using key_compare = Compare;
+  using reference = const T&;
+  using const_reference = const T&;
+  using tree_type =
+      CompactAVLTree<T, Compare, IdentityKey<T>, Policy, Allocator>;
+  using iterator = typename tree_type::const_iterator;
+  using const_iterator = typename tree_type::const_iterator;
+  using size_type = size_t;
+  using allocator_type = Allocator;
+
+  // functions
+  compact_set();
+  explicit compact_set(const Compare& comp,
+                       const Allocator& alloc = Allocator());
+  explicit compact_set(const Allocator& alloc);
+  compact_set(std::initializer_list<value_type> const& items,
+              const Allocator& alloc = Allocator());
+  compact_set(const compact_set& other) = default;
+  compact_set(compact_set&& other) noexcept = default;
+  compact_set(const compact_set& other, const Allocator& alloc);
+  compact_set(compact_set&& other, const Allocator& alloc);
+  ~compact_set() = default;
+  compact_set& operator=(const compact_set& other) = default;
+  compact_set& operator=(compact_set&& other) = default;
+  allocator_type get_allocator() const;
+
+  // iterators
+  iterator begin() const;
+  iterator end() const;
+
+  // capacity
+  bool empty() const;
+  size_type size() const;
+  size_type max_size() const;
+
+  // modifiers
+  void clear();
+  std::pair<iterator, bool> insert(const value_type& value);
+  void erase(iterator pos);
+  size_type erase(const T& key);
+  void swap(compact_set& other) noexcept;
+  void merge(compact_set& other);
+
+  // lookup
+  bool contains(const T& key) const;
+  iterator find(const T& key) const;
+  // Heterogeneous lookup, only with a comparator that has is_transparent
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  bool contains(const K& key) const;
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  iterator find(const K& key) const;
+  iterator lower_bound(const T& key) const;
+  iterator upper_bound(const T& key) const;
+  std::pair<iterator, iterator> equal_range(const T& key) const;
+  // Elements with keys in [first, last)
+  RangeView<iterator> range(const T& first, const T& last) const;
+
+  // order statistics, only under avl_order_statistics_policy
+  iterator find_by_order(size_type index) const;
+  size_type order_of_key(const T& key) const;
+
+  // observers
+  key_compare key_comp() const;
+  const tree_type& get_tree() const;
+
+  // instrumentation, zeros unless built with S21_CONTAINERS_STATS
+  container_stats stats() const;
+
+ private:
+  tree_type tree_;
+};
+
+namespace pmr {
+template <typename T, typename Compare = std::less<T>,
+          typename Policy = avl_basic_policy>
+using compact_set =
+    s21::compact_set<T, Compare, Policy, std::pmr::polymorphic_allocator<T>>;
+}  // namespace pmr
+}  // namespace s21
+
+#include "s21_compact_set.tpp"
+
+#endif
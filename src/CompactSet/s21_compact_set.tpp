@@ -0,0 +1,209 @@
+#ifndef S21_CONTAINERS_COMPACT_SET_TPP
+#define S21_CONTAINERS_COMPACT_SET_TPP
+
+#include <utility>
+
+namespace s21 {
+
+// functions
+
+template <typename T, typename Compare, typename Policy, typename Allocator>
+compact_set<T, Compare, Policy, Allocator>::compact_set() : tree_() {}
+
+template <typename T, typename Compare, typename Policy, typename Allocator>
+compact_set<T, Compare, Policy, Allocator>::compact_set(
+    const Compare& comp, const Allocator& alloc)
+    : tree_(comp, alloc) {}
+
+template <typename T, typename Compare, typename Policy, typename Allocator>
+compact_set<T, Compare, Policy, Allocator>::compact_set(const Allocator& alloc)
+    : tree_(Compare(), alloc) {}
+
+template <typename T, typename Compare, typename Policy, typename Allocator>
+compact_set<T, Compare, Policy, Allocator>::compact_set(
+    std::initializer_list<value_type> const& items, const Allocator& alloc)
+    : tree_(Compare(), alloc) {
+  for (const auto& item : items) insert(item);
+}
+
+template <typename T, typename Compare, typename Policy, typename Allocator>
+compact_set<T, Compare, Policy, Allocator>::compact_set(
+    const compact_set& other, const Allocator& alloc)
+    : tree_(other.tree_, alloc) {}
+
+template <typename T, typename Compare, typename Policy, typename Allocator>
+compact_set<T, Compare, Policy, Allocator>::compact_set(
+    compact_set&& other, const Allocator& alloc)
+    : tree_(std::move(other.tree_), alloc) {}
+
+template <typename T, typename Compare, typename Policy, typename Allocator>
+typename compact_set<T, Compare, Policy, Allocator>::allocator_type
+compact_set<T, Compare, Policy, Allocator>::get_allocator() const {
+  return tree_.GetAllocator();
+}
+
+// iterators
+
+template <typename T, typename Compare, typename Policy, typename Allocator>
+typename compact_set<T, Compare, Policy, Allocator>::iterator
+compact_set<T, Compare, Policy, Allocator>::begin() const {
+  return tree_.Begin();
+}
+
+template <typename T, typename Compare, typename Policy, typename Allocator>
+typename compact_set<T, Compare, Policy, Allocator>::iterator
+compact_set<T, Compare, Policy, Allocator>::end() const {
+  return tree_.End();
+}
+
+// capacity
+
+template <typename T, typename Compare, typename Policy, typename Allocator>
+bool compact_set<T, Compare, Policy, Allocator>::empty() const {
+  return tree_.Size() == 0;
+}
+
+template <typename T, typename Compare, typename Policy, typename Allocator>
+typename compact_set<T, Compare, Policy, Allocator>::size_type
+compact_set<T, Compare, Policy, Allocator>::size() const {
+  return tree_.Size();
+}
+
+template <typename T, typename Compare, typename Policy, typename Allocator>
+typename compact_set<T, Compare, Policy, Allocator>::size_type
+compact_set<T, Compare, Policy, Allocator>::max_size() const {
+  return std::numeric_limits<size_type>::max() / sizeof(value_type);
+}
+
+// modifiers
+
+template <typename T, typename Compare, typename Policy, typename Allocator>
+void compact_set<T, Compare, Policy, Allocator>::clear() {
+  tree_.Clear();
+}
+
+template <typename T, typename Compare, typename Policy, typename Allocator>
+std::pair<typename compact_set<T, Compare, Policy, Allocator>::iterator, bool>
+compact_set<T, Compare, Policy, Allocator>::insert(const value_type& value) {
+  auto result = tree_.Insert(value);
+  return std::make_pair(iterator(result.first), result.second);
+}
+
+template <typename T, typename Compare, typename Policy, typename Allocator>
+void compact_set<T, Compare, Policy, Allocator>::erase(iterator pos) {
+  tree_.Erase(pos);
+}
+
+template <typename T, typename Compare, typename Policy, typename Allocator>
+typename compact_set<T, Compare, Policy, Allocator>::size_type
+compact_set<T, Compare, Policy, Allocator>::erase(const T& key) {
+  return tree_.Erase(key);
+}
+
+template <typename T, typename Compare, typename Policy, typename Allocator>
+void compact_set<T, Compare, Policy, Allocator>::swap(
+    compact_set& other) noexcept {
+  tree_.Swap(other.tree_);
+}
+
+// Moves the keys missing here, duplicates stay in other. Erasing from the
+// tree invalidates iterators, so the leftovers are collected in a new tree
+template <typename T, typename Compare, typename Policy, typename Allocator>
+void compact_set<T, Compare, Policy, Allocator>::merge(compact_set& other) {
+  if (this == &other) return;
+  tree_type rest(other.tree_.GetCompare(), other.tree_.GetAllocator());
+  for (const auto& item : other) {
+    if (!tree_.Insert(item).second) rest.Insert(item);
+  }
+  other.tree_ = std::move(rest);
+}
+
+// lookup
+
+template <typename T, typename Compare, typename Policy, typename Allocator>
+bool compact_set<T, Compare, Policy, Allocator>::contains(const T& key) const {
+  return tree_.Find(key) != tree_.End();
+}
+
+template <typename T, typename Compare, typename Policy, typename Allocator>
+typename compact_set<T, Compare, Policy, Allocator>::iterator
+compact_set<T, Compare, Policy, Allocator>::find(const T& key) const {
+  return tree_.Find(key);
+}
+
+template <typename T, typename Compare, typename Policy, typename Allocator>
+template <typename K, typename, typename>
+bool compact_set<T, Compare, Policy, Allocator>::contains(const K& key) const {
+  return tree_.Find(key) != tree_.End();
+}
+
+template <typename T, typename Compare, typename Policy, typename Allocator>
+template <typename K, typename, typename>
+typename compact_set<T, Compare, Policy, Allocator>::iterator
+compact_set<T, Compare, Policy, Allocator>::find(const K& key) const {
+  return tree_.Find(key);
+}
+
+template <typename T, typename Compare, typename Policy, typename Allocator>
+typename compact_set<T, Compare, Policy, Allocator>::iterator
+compact_set<T, Compare, Policy, Allocator>::lower_bound(const T& key) const {
+  return tree_.LowerBound(key);
+}
+
+template <typename T, typename Compare, typename Policy, typename Allocator>
+typename compact_set<T, Compare, Policy, Allocator>::iterator
+compact_set<T, Compare, Policy, Allocator>::upper_bound(const T& key) const {
+  return tree_.UpperBound(key);
+}
+
+template <typename T, typename Compare, typename Policy, typename Allocator>
+std::pair<typename compact_set<T, Compare, Policy, Allocator>::iterator,
+          typename compact_set<T, Compare, Policy, Allocator>::iterator>
+compact_set<T, Compare, Policy, Allocator>::equal_range(const T& key) const {
+  return std::make_pair(lower_bound(key), upper_bound(key));
+}
+
+template <typename T, typename Compare, typename Policy, typename Allocator>
+RangeView<typename compact_set<T, Compare, Policy, Allocator>::iterator>
+compact_set<T, Compare, Policy, Allocator>::range(
+    const T& first, const T& last) const {
+  return RangeView<iterator>(lower_bound(first), lower_bound(last));
+}
+
+// order statistics
+
+template <typename T, typename Compare, typename Policy, typename Allocator>
+typename compact_set<T, Compare, Policy, Allocator>::iterator
+compact_set<T, Compare, Policy, Allocator>::find_by_order(
+    size_type index) const {
+  return tree_.Select(index);
+}
+
+template <typename T, typename Compare, typename Policy, typename Allocator>
+typename compact_set<T, Compare, Policy, Allocator>::size_type
+compact_set<T, Compare, Policy, Allocator>::order_of_key(const T& key) const {
+  return tree_.Rank(key);
+}
+
+// observers
+
+template <typename T, typename Compare, typename Policy, typename Allocator>
+typename compact_set<T, Compare, Policy, Allocator>::key_compare
+compact_set<T, Compare, Policy, Allocator>::key_comp() const {
+  return tree_.GetCompare();
+}
+
+template <typename T, typename Compare, typename Policy, typename Allocator>
+const typename compact_set<T, Compare, Policy, Allocator>::tree_type&
+compact_set<T, Compare, Policy, Allocator>::get_tree() const {
+  return tree_;
+}
+
+template <typename T, typename Compare, typename Policy, typename Allocator>
+container_stats compact_set<T, Compare, Policy, Allocator>::stats() const {
+  return tree_.GetStats();
+}
+
+}  // namespace s21
+
+#endif
@@ -0,0 +1,123 @@
+#ifndef S21_CONTAINERS_CONCURRENT_MAP_H
+#define S21_CONTAINERS_CONCURRENT_MAP_H
+
+#include <atomic>
+#include <initializer_list>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <optional>
+
+#include "../EpochDomain/s21_epoch_domain.h"
+#include "../PersistentMap/s21_persistent_map.h"
+
+namespace s21 {
+// Read-mostly ordered map with lock-free readers. The contents are an
+// immutable persistent_map version behind an atomic pointer: a reader pins
+// the epoch, loads the pointer and searches the version without taking a
+// lock or writing shared memory. Writers are serialized by a mutex; each
+// copies the current version in O(1), applies its update by path copying
+// and publishes the result, then retires the replaced version to the epoch
+// domain, which frees it once no reader can still be inside it.
+//
+// Lookups return copies, since an element may be replaced as soon as the
+// call returns; snapshot() gives a consistent view to iterate over.
+//
+// Versions and their nodes come from Allocator. A node is freed by whoever
+// drops its last version, a writer or the owner of a snapshot on any
+// thread, so the allocator must be safe to use from several threads at
+// once: std::allocator is, and for pmr a synchronized_pool_resource or
+// new_delete_resource, but not an unsynchronized or monotonic resource.
+template <typename Key, typename T, typename Compare = std::less<Key>,
+          typename Allocator = std::allocator<std::pair<const Key, T>>>
+class concurrent_map {
+ public:
+  // member type
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<const Key, T>;
+  using key_compare = Compare;
+  using size_type = size_t;
+  using allocator_type = Allocator;
+  using snapshot_type = persistent_map<Key, T, Compare, Allocator>;
+
+  // functions
+  concurrent_map();
+  explicit concurrent_map(const Compare& comp,
+                          const Allocator& alloc = Allocator());
+  explicit concurrent_map(const Allocator& alloc);
+  concurrent_map(std::initializer_list<value_type> const& items,
+                 const Allocator& alloc = Allocator());
+  concurrent_map(const concurrent_map&) = delete;
+  concurrent_map& operator=(const concurrent_map&) = delete;
+  // No thread may use the map while it is destroyed
+  ~concurrent_map();
+  allocator_type get_allocator() const;
+
+  // Consistent read-only version of the current contents, in O(1)
+  snapshot_type snapshot() const;
+
+  // capacity
+  bool empty() const;
+  size_type size() const;
+
+  // modifiers, serialized among writers
+  bool insert(const value_type& value);
+  bool insert(const Key& key, const T& obj);
+  // Returns true when the key was inserted, false when it was assigned
+  bool insert_or_assign(const Key& key, const T& obj);
+  size_type erase(const Key& key);
+  void clear();
+
+  // lookup, lock-free
+  bool contains(const Key& key) const;
+  std::optional<mapped_type> find(const Key& key) const;
+  // First element whose key is not less than key
+  std::optional<value_type> lower_bound(const Key& key) const;
+
+  // observers
+  key_compare key_comp() const;
+
+ private:
+  struct Version {
+    // Shares the nodes of contents, whatever the allocator would select
+    // for a plain copy
+    explicit Version(const snapshot_type& contents)
+        : map(contents, contents.get_allocator()) {}
+
+    snapshot_type map;
+    epoch_domain::epoch_type retired = 0;
+    Version* next = nullptr;
+  };
+
+  using version_allocator = typename std::allocator_traits<
+      Allocator>::template rebind_alloc<Version>;
+  using version_traits = std::allocator_traits<version_allocator>;
+
+  // Only writers and the owner touch it, under writer_ or alone
+  version_allocator allocator_;
+  std::atomic<Version*> current_;
+  epoch_domain& domain_;
+  // Guards the writers and the list of retired versions, oldest first
+  std::mutex writer_;
+  Version* retired_head_;
+  Version* retired_tail_;
+
+  template <typename Update>
+  bool Publish(Update update);
+  void Retire(Version* version);
+  void Reclaim();
+  Version* NewVersion(const snapshot_type& contents);
+  void DeleteVersion(Version* version);
+};
+
+namespace pmr {
+template <typename Key, typename T, typename Compare = std::less<Key>>
+using concurrent_map = s21::concurrent_map<
+    Key, T, Compare, std::pmr::polymorphic_allocator<std::pair<const Key, T>>>;
+}  // namespace pmr
+}  // namespace s21
+
+#include "s21_concurrent_map.tpp"
+
+#endif
@@ -0,0 +1,232 @@
+#ifndef S21_CONTAINERS_CONCURRENT_MAP_TPP
+#define S21_CONTAINERS_CONCURRENT_MAP_TPP
+
+namespace s21 {
+
+// functions
+
+template <typename Key, typename T, typename Compare, typename Allocator>
+concurrent_map<Key, T, Compare, Allocator>::concurrent_map()
+    : concurrent_map(Compare()) {}
+
+template <typename Key, typename T, typename Compare, typename Allocator>
+concurrent_map<Key, T, Compare, Allocator>::concurrent_map(
+    const Compare& comp, const Allocator& alloc)
+    : allocator_(alloc),
+      current_(NewVersion(snapshot_type(comp, alloc))),
+      domain_(epoch_domain::instance()),
+      retired_head_(nullptr),
+      retired_tail_(nullptr) {}
+
+template <typename Key, typename T, typename Compare, typename Allocator>
+concurrent_map<Key, T, Compare, Allocator>::concurrent_map(
+    const Allocator& alloc)
+    : concurrent_map(Compare(), alloc) {}
+
+template <typename Key, typename T, typename Compare, typename Allocator>
+concurrent_map<Key, T, Compare, Allocator>::concurrent_map(
+    std::initializer_list<value_type> const& items, const Allocator& alloc)
+    : concurrent_map(Compare(), alloc) {
+  Version* version = current_.load(std::memory_order_relaxed);
+  for (const auto& item : items) version->map.insert(item);
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator>
+concurrent_map<Key, T, Compare, Allocator>::~concurrent_map() {
+  while (retired_head_ != nullptr) {
+    Version* next = retired_head_->next;
+    DeleteVersion(retired_head_);
+    retired_head_ = next;
+  }
+  DeleteVersion(current_.load(std::memory_order_relaxed));
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator>
+typename concurrent_map<Key, T, Compare, Allocator>::allocator_type
+concurrent_map<Key, T, Compare, Allocator>::get_allocator() const {
+  return allocator_type(allocator_);
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator>
+typename concurrent_map<Key, T, Compare, Allocator>::snapshot_type
+concurrent_map<Key, T, Compare, Allocator>::snapshot() const {
+  epoch_guard guard(domain_);
+  return current_.load()->map.snapshot();
+}
+
+// capacity
+
+template <typename Key, typename T, typename Compare, typename Allocator>
+bool concurrent_map<Key, T, Compare, Allocator>::empty() const {
+  return size() == 0;
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator>
+typename concurrent_map<Key, T, Compare, Allocator>::size_type
+concurrent_map<Key, T, Compare, Allocator>::size() const {
+  epoch_guard guard(domain_);
+  return current_.load()->map.size();
+}
+
+// modifiers
+
+template <typename Key, typename T, typename Compare, typename Allocator>
+bool concurrent_map<Key, T, Compare, Allocator>::insert(
+    const value_type& value) {
+  return Publish(
+      [&value](snapshot_type& map) { return map.insert(value).second; });
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator>
+bool concurrent_map<Key, T, Compare, Allocator>::insert(
+    const Key& key, const T& obj) {
+  return insert(value_type(key, obj));
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator>
+bool concurrent_map<Key, T, Compare, Allocator>::insert_or_assign(
+    const Key& key, const T& obj) {
+  bool inserted = false;
+  Publish([&](snapshot_type& map) {
+    inserted = map.insert_or_assign(key, obj).second;
+    return true;
+  });
+  return inserted;
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator>
+typename concurrent_map<Key, T, Compare, Allocator>::size_type
+concurrent_map<Key, T, Compare, Allocator>::erase(const Key& key) {
+  return Publish([&key](snapshot_type& map) { return map.erase(key) != 0; })
+             ? 1
+             : 0;
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator>
+void concurrent_map<Key, T, Compare, Allocator>::clear() {
+  Publish([](snapshot_type& map) {
+    if (map.empty()) return false;
+    map.clear();
+    return true;
+  });
+}
+
+// lookup
+
+template <typename Key, typename T, typename Compare, typename Allocator>
+bool concurrent_map<Key, T, Compare, Allocator>::contains(
+    const Key& key) const {
+  epoch_guard guard(domain_);
+  return current_.load()->map.contains(key);
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator>
+std::optional<typename concurrent_map<Key, T, Compare, Allocator>::mapped_type>
+concurrent_map<Key, T, Compare, Allocator>::find(const Key& key) const {
+  epoch_guard guard(domain_);
+  const snapshot_type& map = current_.load()->map;
+  auto it = map.find(key);
+  if (it == map.end()) return std::nullopt;
+  return it->second;
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator>
+std::optional<typename concurrent_map<Key, T, Compare, Allocator>::value_type>
+concurrent_map<Key, T, Compare, Allocator>::lower_bound(const Key& key) const {
+  epoch_guard guard(domain_);
+  const snapshot_type& map = current_.load()->map;
+  auto it = map.lower_bound(key);
+  if (it == map.end()) return std::nullopt;
+  return *it;
+}
+
+// observers
+
+template <typename Key, typename T, typename Compare, typename Allocator>
+typename concurrent_map<Key, T, Compare, Allocator>::key_compare
+concurrent_map<Key, T, Compare, Allocator>::key_comp() const {
+  return current_.load(std::memory_order_relaxed)->map.key_comp();
+}
+
+// helpers
+
+// Applies update to a copy of the current version and publishes the copy if
+// update reports a change. The copy shares every node with the published
+// version, so the update copies its path instead of touching nodes readers
+// may be traversing. If update throws, the copy still holds only references
+// to those nodes (see PersistentAVLTree) and dropping it frees none of them
+template <typename Key, typename T, typename Compare, typename Allocator>
+template <typename Update>
+bool concurrent_map<Key, T, Compare, Allocator>::Publish(Update update) {
+  std::lock_guard<std::mutex> lock(writer_);
+  Version* current = current_.load(std::memory_order_relaxed);
+  Version* next = NewVersion(current->map);
+  bool changed = false;
+  try {
+    changed = update(next->map);
+  } catch (...) {
+    DeleteVersion(next);
+    throw;
+  }
+  if (!changed) {
+    DeleteVersion(next);
+    return false;
+  }
+  current_.store(next);
+  Retire(current);
+  Reclaim();
+  return true;
+}
+
+// The retire epoch is read after the new version is published: a reader
+// pinned later can only find the new one
+template <typename Key, typename T, typename Compare, typename Allocator>
+void concurrent_map<Key, T, Compare, Allocator>::Retire(Version* version) {
+  version->retired = domain_.epoch();
+  if (retired_tail_ != nullptr) {
+    retired_tail_->next = version;
+  } else {
+    retired_head_ = version;
+  }
+  retired_tail_ = version;
+}
+
+// Frees the retired versions no reader can reach any more. Freeing a version
+// releases its root and with it the nodes no later version shares
+template <typename Key, typename T, typename Compare, typename Allocator>
+void concurrent_map<Key, T, Compare, Allocator>::Reclaim() {
+  if (retired_head_ == nullptr) return;
+  epoch_domain::epoch_type now = domain_.try_advance();
+  while (retired_head_ != nullptr &&
+         epoch_domain::is_safe(retired_head_->retired, now)) {
+    Version* next = retired_head_->next;
+    DeleteVersion(retired_head_);
+    retired_head_ = next;
+  }
+  if (retired_head_ == nullptr) retired_tail_ = nullptr;
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator>
+typename concurrent_map<Key, T, Compare, Allocator>::Version*
+concurrent_map<Key, T, Compare, Allocator>::NewVersion(
+    const snapshot_type& contents) {
+  Version* version = version_traits::allocate(allocator_, 1);
+  try {
+    version_traits::construct(allocator_, version, contents);
+  } catch (...) {
+    version_traits::deallocate(allocator_, version, 1);
+    throw;
+  }
+  return version;
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator>
+void concurrent_map<Key, T, Compare, Allocator>::DeleteVersion(
+    Version* version) {
+  version_traits::destroy(allocator_, version);
+  version_traits::deallocate(allocator_, version, 1);
+}
+
+}  // namespace s21
+
+#endif
@@ -0,0 +1,220 @@
+#ifndef S21_CONTAINERS_DEQUE_H
+#define S21_CONTAINERS_DEQUE_H
+
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <memory_resource>
+#include <stdexcept>
+
+#include "../Stats/s21_stats.h"
+
+namespace s21 {
+// Double-ended queue stored as a map of fixed-size blocks. Elements never
+// move once constructed: growing at either end only allocates a new block or
+// reallocates the (small) array of block pointers. A block is allocated
+// exactly while it holds at least one element. Both the blocks and the map
+// come from Allocator, rebound to T* for the latter.
+template <typename T, typename Allocator = std::allocator<T>>
+class deque {
+  using alloc_traits = std::allocator_traits<Allocator>;
+  using map_allocator = typename alloc_traits::template rebind_alloc<T*>;
+  using map_traits = std::allocator_traits<map_allocator>;
+
+  static constexpr bool kNothrowMoveAssign =
+      alloc_traits::propagate_on_container_move_assignment::value ||
+      alloc_traits::is_always_equal::value;
+
+ public:
+  template <bool IsConst>
+  class DequeIterator;
+
+  // member type
+  using value_type = T;
+  using reference = T&;
+  using const_reference = const T&;
+  using iterator = DequeIterator<false>;
+  using const_iterator = DequeIterator<true>;
+  using size_type = size_t;
+  using difference_type = std::ptrdiff_t;
+  using allocator_type = Allocator;
+
+  // functions
+  deque();
+  explicit deque(const Allocator& alloc);
+  explicit deque(size_type n, const Allocator& alloc = Allocator());
+  deque(std::initializer_list<value_type> const& items,
+        const Allocator& alloc = Allocator());
+  deque(const deque& other);
+  deque(deque&& other) noexcept;
+  deque(const deque& other, const Allocator& alloc);
+  deque(deque&& other, const Allocator& alloc);
+  ~deque();
+  deque& operator=(const deque& other);
+  deque& operator=(deque&& other) noexcept(kNothrowMoveAssign);
+  allocator_type get_allocator() const;
+
+  // element access
+  reference at(size_type pos);
+  const_reference at(size_type pos) const;
+  reference operator[](size_type pos);
+  const_reference operator[](size_type pos) const;
+  reference front();
+  const_reference front() const;
+  reference back();
+  const_reference back() const;
+
+  // iterators
+  iterator begin();
+  iterator end();
+  const_iterator begin() const;
+  const_iterator end() const;
+  const_iterator cbegin() const;
+  const_iterator cend() const;
+
+  // capacity
+  bool empty() const;
+  size_type size() const;
+  size_type max_size() const;
+
+  // modifiers
+  void clear();
+  void push_back(const_reference value);
+  void push_back(value_type&& value);
+  void push_front(const_reference value);
+  void push_front(value_type&& value);
+  template <typename... Args>
+  reference emplace_back(Args&&... args);
+  template <typename... Args>
+  reference emplace_front(Args&&... args);
+  void pop_back();
+  void pop_front();
+  void swap(deque& other) noexcept;
+
+  // instrumentation, zeros unless built with S21_CONTAINERS_STATS
+  container_stats stats() const;
+
+ private:
+  static constexpr size_type BlockSizeFor(size_type bytes) {
+    size_type size = 16;
+    while (size * 2 * sizeof(T) <= bytes) size *= 2;
+    return size;
+  }
+
+  static constexpr size_type kBlockSize = BlockSizeFor(4096);
+  static constexpr size_type kMinMapSize = 8;
+
+  T** map_;
+  size_type map_size_;
+  size_type start_;
+  size_type size_;
+  Allocator allocator_;
+  S21_STATS_MEMBER
+
+  T* Element(size_type position) const;
+  T* Prepare(size_type position);
+  void Release(size_type position);
+  void GrowMap();
+  void Reset();
+  void Adopt(deque& other);
+};
+
+template <typename T, typename Allocator>
+template <bool IsConst>
+class deque<T, Allocator>::DequeIterator {
+ public:
+  // member type
+  using value_type = T;
+  using reference = typename std::conditional<IsConst, const T&, T&>::type;
+  using pointer = typename std::conditional<IsConst, const T*, T*>::type;
+  using difference_type = std::ptrdiff_t;
+  using iterator_category = std::random_access_iterator_tag;
+  using container_pointer =
+      typename std::conditional<IsConst, const deque*, deque*>::type;
+
+  // constructor
+  DequeIterator() : deque_(nullptr), index_(0) {}
+  DequeIterator(container_pointer owner, size_type index)
+      : deque_(owner), index_(index) {}
+  operator DequeIterator<true>() const {
+    return DequeIterator<true>(deque_, index_);
+  }
+
+  // operators
+  reference operator*() const { return *deque_->Element(Position()); }
+  pointer operator->() const { return deque_->Element(Position()); }
+  reference operator[](difference_type n) const { return *(*this + n); }
+
+  DequeIterator& operator++() {
+    ++index_;
+    return *this;
+  }
+  DequeIterator operator++(int) {
+    DequeIterator temp = *this;
+    ++index_;
+    return temp;
+  }
+  DequeIterator& operator--() {
+    --index_;
+    return *this;
+  }
+  DequeIterator operator--(int) {
+    DequeIterator temp = *this;
+    --index_;
+    return temp;
+  }
+  DequeIterator& operator+=(difference_type n) {
+    index_ += n;
+    return *this;
+  }
+  DequeIterator& operator-=(difference_type n) {
+    index_ -= n;
+    return *this;
+  }
+  DequeIterator operator+(difference_type n) const {
+    return DequeIterator(deque_, index_ + n);
+  }
+  DequeIterator operator-(difference_type n) const {
+    return DequeIterator(deque_, index_ - n);
+  }
+  difference_type operator-(const DequeIterator& other) const {
+    return static_cast<difference_type>(index_) -
+           static_cast<difference_type>(other.index_);
+  }
+
+  bool operator==(const DequeIterator& other) const {
+    return index_ == other.index_;
+  }
+  bool operator!=(const DequeIterator& other) const {
+    return index_ != other.index_;
+  }
+  bool operator<(const DequeIterator& other) const {
+    return index_ < other.index_;
+  }
+  bool operator>(const DequeIterator& other) const {
+    return index_ > other.index_;
+  }
+  bool operator<=(const DequeIterator& other) const {
+    return index_ <= other.index_;
+  }
+  bool operator>=(const DequeIterator& other) const {
+    return index_ >= other.index_;
+  }
+
+ private:
+  container_pointer deque_;
+  size_type index_;
+
+  size_type Position() const { return deque_->start_ + index_; }
+};
+
+namespace pmr {
+template <typename T>
+using deque = s21::deque<T, std::pmr::polymorphic_allocator<T>>;
+}  // namespace pmr
+}  // namespace s21
+
+#include "s21_deque.tpp"
+
+#endif
@@ -0,0 +1,444 @@
+#ifndef S21_CONTAINERS_DEQUE_TPP
+#define S21_CONTAINERS_DEQUE_TPP
+
+#include <algorithm>
+#include <utility>
+
+namespace s21 {
+
+// functions
+
+// Default constructor, no memory is allocated until the first push
+template <typename T, typename Allocator>
+deque<T, Allocator>::deque() : deque(Allocator()) {}
+
+// Empty deque whose blocks and map will come from alloc
+template <typename T, typename Allocator>
+deque<T, Allocator>::deque(const Allocator& alloc)
+    : map_(nullptr), map_size_(0), start_(0), size_(0), allocator_(alloc) {}
+
+// Constructor that creates a deque with n value-initialized elements
+template <typename T, typename Allocator>
+deque<T, Allocator>::deque(size_type n, const Allocator& alloc)
+    : deque(alloc) {
+  for (size_type i = 0; i < n; ++i) {
+    emplace_back();
+  }
+}
+
+// Constructor that creates a deque from an initializer list
+template <typename T, typename Allocator>
+deque<T, Allocator>::deque(std::initializer_list<value_type> const& items,
+                           const Allocator& alloc)
+    : deque(alloc) {
+  for (const auto& item : items) {
+    push_back(item);
+  }
+}
+
+// Copy constructor, with the allocator select_on_container_copy_construction
+// gives
+template <typename T, typename Allocator>
+deque<T, Allocator>::deque(const deque& other)
+    : deque(other, alloc_traits::select_on_container_copy_construction(
+                       other.allocator_)) {}
+
+// Move constructor, steals the block map together with its allocator and
+// leaves the source empty
+template <typename T, typename Allocator>
+deque<T, Allocator>::deque(deque&& other) noexcept
+    : deque(Allocator(std::move(other.allocator_))) {
+  Adopt(other);
+}
+
+template <typename T, typename Allocator>
+deque<T, Allocator>::deque(const deque& other, const Allocator& alloc)
+    : deque(alloc) {
+  for (size_type i = 0; i < other.size_; ++i) {
+    push_back(*other.Element(other.start_ + i));
+  }
+}
+
+// Steals the block map if alloc equals the source's allocator, moves the
+// elements one by one otherwise
+template <typename T, typename Allocator>
+deque<T, Allocator>::deque(deque&& other, const Allocator& alloc)
+    : deque(alloc) {
+  if (allocator_ == other.allocator_) {
+    Adopt(other);
+  } else {
+    for (size_type i = 0; i < other.size_; ++i) {
+      push_back(std::move(*other.Element(other.start_ + i)));
+    }
+  }
+}
+
+// Destructor, destroys the elements and releases the blocks and the map
+template <typename T, typename Allocator>
+deque<T, Allocator>::~deque() {
+  Reset();
+}
+
+// Copy assignment operator. The copy is built aside with the allocator this
+// deque ends up with: its own, or other's under
+// propagate_on_container_copy_assignment
+template <typename T, typename Allocator>
+deque<T, Allocator>& deque<T, Allocator>::operator=(const deque& other) {
+  if (this != &other) {
+    if constexpr (alloc_traits::propagate_on_container_copy_assignment::
+                      value) {
+      deque tmp(other, other.allocator_);
+      Reset();
+      allocator_ = other.allocator_;
+      Adopt(tmp);
+    } else {
+      deque tmp(other, allocator_);
+      Reset();
+      Adopt(tmp);
+    }
+  }
+  return *this;
+}
+
+// Move assignment operator. The map is stolen when the allocator propagates
+// or the two are equal; otherwise the elements are moved into blocks from
+// this deque's allocator
+template <typename T, typename Allocator>
+deque<T, Allocator>& deque<T, Allocator>::operator=(deque&& other) noexcept(
+    kNothrowMoveAssign) {
+  if (this != &other) {
+    if constexpr (alloc_traits::propagate_on_container_move_assignment::
+                      value) {
+      Reset();
+      allocator_ = std::move(other.allocator_);
+      Adopt(other);
+    } else if (allocator_ == other.allocator_) {
+      Reset();
+      Adopt(other);
+    } else {
+      deque tmp(std::move(other), allocator_);
+      Reset();
+      Adopt(tmp);
+    }
+  }
+  return *this;
+}
+
+template <typename T, typename Allocator>
+typename deque<T, Allocator>::allocator_type
+deque<T, Allocator>::get_allocator() const {
+  return allocator_;
+}
+
+// element access
+
+// Returns a reference to the element at pos with bounds checking
+template <typename T, typename Allocator>
+typename deque<T, Allocator>::reference deque<T, Allocator>::at(size_type pos) {
+  if (pos >= size_) throw std::out_of_range("Index out of range");
+  return *Element(start_ + pos);
+}
+
+template <typename T, typename Allocator>
+typename deque<T, Allocator>::const_reference deque<T, Allocator>::at(
+    size_type pos) const {
+  if (pos >= size_) throw std::out_of_range("Index out of range");
+  return *Element(start_ + pos);
+}
+
+// Returns a reference to the element at pos
+template <typename T, typename Allocator>
+typename deque<T, Allocator>::reference deque<T, Allocator>::operator[](
+    size_type pos) {
+  return at(pos);
+}
+
+template <typename T, typename Allocator>
+typename deque<T, Allocator>::const_reference deque<T, Allocator>::operator[](
+    size_type pos) const {
+  return at(pos);
+}
+
+// Returns a reference to the first element
+template <typename T, typename Allocator>
+typename deque<T, Allocator>::reference deque<T, Allocator>::front() {
+  if (empty()) throw std::out_of_range("Deque is empty");
+  return *Element(start_);
+}
+
+template <typename T, typename Allocator>
+typename deque<T, Allocator>::const_reference
+deque<T, Allocator>::front() const {
+  if (empty()) throw std::out_of_range("Deque is empty");
+  return *Element(start_);
+}
+
+// Returns a reference to the last element
+template <typename T, typename Allocator>
+typename deque<T, Allocator>::reference deque<T, Allocator>::back() {
+  if (empty()) throw std::out_of_range("Deque is empty");
+  return *Element(start_ + size_ - 1);
+}
+
+template <typename T, typename Allocator>
+typename deque<T, Allocator>::const_reference
+deque<T, Allocator>::back() const {
+  if (empty()) throw std::out_of_range("Deque is empty");
+  return *Element(start_ + size_ - 1);
+}
+
+// iterators
+
+// Returns an iterator pointing to the first element
+template <typename T, typename Allocator>
+typename deque<T, Allocator>::iterator deque<T, Allocator>::begin() {
+  return iterator(this, 0);
+}
+
+// Returns an iterator pointing past the last element
+template <typename T, typename Allocator>
+typename deque<T, Allocator>::iterator deque<T, Allocator>::end() {
+  return iterator(this, size_);
+}
+
+template <typename T, typename Allocator>
+typename deque<T, Allocator>::const_iterator
+deque<T, Allocator>::begin() const {
+  return const_iterator(this, 0);
+}
+
+template <typename T, typename Allocator>
+typename deque<T, Allocator>::const_iterator deque<T, Allocator>::end() const {
+  return const_iterator(this, size_);
+}
+
+template <typename T, typename Allocator>
+typename deque<T, Allocator>::const_iterator
+deque<T, Allocator>::cbegin() const {
+  return begin();
+}
+
+template <typename T, typename Allocator>
+typename deque<T, Allocator>::const_iterator deque<T, Allocator>::cend() const {
+  return end();
+}
+
+// capacity
+
+// Returns true if the deque is empty
+template <typename T, typename Allocator>
+bool deque<T, Allocator>::empty() const {
+  return size_ == 0;
+}
+
+// Returns the number of elements
+template <typename T, typename Allocator>
+typename deque<T, Allocator>::size_type deque<T, Allocator>::size() const {
+  return size_;
+}
+
+// Returns the maximum number of elements the deque can hold
+template <typename T, typename Allocator>
+typename deque<T, Allocator>::size_type deque<T, Allocator>::max_size() const {
+  return std::numeric_limits<size_type>::max() / sizeof(value_type) / 2;
+}
+
+// modifiers
+
+// Destroys all elements and releases their blocks; the map is kept
+template <typename T, typename Allocator>
+void deque<T, Allocator>::clear() {
+  while (size_ > 0) {
+    pop_back();
+  }
+  start_ = (map_size_ / 2) * kBlockSize;
+}
+
+// Adds a copy of value to the end
+template <typename T, typename Allocator>
+void deque<T, Allocator>::push_back(const_reference value) {
+  emplace_back(value);
+}
+
+// Adds value to the end by moving it
+template <typename T, typename Allocator>
+void deque<T, Allocator>::push_back(value_type&& value) {
+  emplace_back(std::move(value));
+}
+
+// Adds a copy of value to the beginning
+template <typename T, typename Allocator>
+void deque<T, Allocator>::push_front(const_reference value) {
+  emplace_front(value);
+}
+
+// Adds value to the beginning by moving it
+template <typename T, typename Allocator>
+void deque<T, Allocator>::push_front(value_type&& value) {
+  emplace_front(std::move(value));
+}
+
+// Constructs a new element in place at the end
+template <typename T, typename Allocator>
+template <typename... Args>
+typename deque<T, Allocator>::reference deque<T, Allocator>::emplace_back(
+    Args&&... args) {
+  if (start_ + size_ == map_size_ * kBlockSize) GrowMap();
+  size_type position = start_ + size_;
+  T* slot = Prepare(position);
+  try {
+    alloc_traits::construct(allocator_, slot, std::forward<Args>(args)...);
+  } catch (...) {
+    if (size_ == 0 || position % kBlockSize == 0) Release(position);
+    throw;
+  }
+  ++size_;
+  return *slot;
+}
+
+// Constructs a new element in place at the beginning
+template <typename T, typename Allocator>
+template <typename... Args>
+typename deque<T, Allocator>::reference deque<T, Allocator>::emplace_front(
+    Args&&... args) {
+  if (start_ == 0) GrowMap();
+  size_type position = start_ - 1;
+  T* slot = Prepare(position);
+  try {
+    alloc_traits::construct(allocator_, slot, std::forward<Args>(args)...);
+  } catch (...) {
+    if (size_ == 0 || position % kBlockSize == kBlockSize - 1) {
+      Release(position);
+    }
+    throw;
+  }
+  start_ = position;
+  ++size_;
+  return *slot;
+}
+
+// Removes the last element, its block is released once it becomes empty
+template <typename T, typename Allocator>
+void deque<T, Allocator>::pop_back() {
+  if (empty()) throw std::out_of_range("Deque is empty");
+  size_type position = start_ + size_ - 1;
+  alloc_traits::destroy(allocator_, Element(position));
+  if (size_ == 1 || position % kBlockSize == 0) Release(position);
+  --size_;
+}
+
+// Removes the first element, its block is released once it becomes empty
+template <typename T, typename Allocator>
+void deque<T, Allocator>::pop_front() {
+  if (empty()) throw std::out_of_range("Deque is empty");
+  alloc_traits::destroy(allocator_, Element(start_));
+  if (size_ == 1 || start_ % kBlockSize == kBlockSize - 1) Release(start_);
+  ++start_;
+  --size_;
+}
+
+// Swaps the contents of the deque with another deque. The allocators are
+// swapped only under propagate_on_container_swap, otherwise they must be
+// equal, as for the standard containers
+template <typename T, typename Allocator>
+void deque<T, Allocator>::swap(deque& other) noexcept {
+  std::swap(map_, other.map_);
+  std::swap(map_size_, other.map_size_);
+  std::swap(start_, other.start_);
+  std::swap(size_, other.size_);
+  if constexpr (alloc_traits::propagate_on_container_swap::value) {
+    using std::swap;
+    swap(allocator_, other.allocator_);
+  }
+}
+
+// helpers
+
+// Returns the slot of an absolute position; its block must exist
+template <typename T, typename Allocator>
+T* deque<T, Allocator>::Element(size_type position) const {
+  return map_[position / kBlockSize] + position % kBlockSize;
+}
+
+// Returns the slot of an absolute position, allocating its block if needed
+template <typename T, typename Allocator>
+T* deque<T, Allocator>::Prepare(size_type position) {
+  T*& block = map_[position / kBlockSize];
+  if (block == nullptr) {
+    block = alloc_traits::allocate(allocator_, kBlockSize);
+    S21_STATS(Allocation(kBlockSize * sizeof(T)));
+  }
+  return block + position % kBlockSize;
+}
+
+// Frees the block that holds an absolute position
+template <typename T, typename Allocator>
+void deque<T, Allocator>::Release(size_type position) {
+  T*& block = map_[position / kBlockSize];
+  alloc_traits::deallocate(allocator_, block, kBlockSize);
+  S21_STATS(Deallocation());
+  block = nullptr;
+}
+
+// Reallocates the map so that the used blocks sit in the middle with free
+// entries on both sides. Only block pointers are copied, elements stay put
+template <typename T, typename Allocator>
+void deque<T, Allocator>::GrowMap() {
+  size_type first_block = start_ / kBlockSize;
+  size_type used_blocks =
+      size_ ? (start_ + size_ - 1) / kBlockSize - first_block + 1 : 0;
+  size_type new_size = (used_blocks + 2) * 2;
+  if (new_size < kMinMapSize) new_size = kMinMapSize;
+
+  map_allocator map_alloc(allocator_);
+  T** new_map = map_traits::allocate(map_alloc, new_size);
+  std::fill(new_map, new_map + new_size, nullptr);
+  S21_STATS(Allocation(new_size * sizeof(T*)));
+  size_type new_first = (new_size - used_blocks) / 2;
+  for (size_type i = 0; i < used_blocks; ++i) {
+    new_map[new_first + i] = map_[first_block + i];
+  }
+  size_type offset = size_ ? start_ % kBlockSize : kBlockSize / 2;
+
+  if (map_ != nullptr) {
+    map_traits::deallocate(map_alloc, map_, map_size_);
+    S21_STATS(Deallocation());
+    S21_STATS(Reallocation());
+  }
+  map_ = new_map;
+  map_size_ = new_size;
+  start_ = new_first * kBlockSize + offset;
+}
+
+// Destroys the elements and returns the blocks and the map to the allocator
+template <typename T, typename Allocator>
+void deque<T, Allocator>::Reset() {
+  clear();
+  if (map_ != nullptr) {
+    map_allocator map_alloc(allocator_);
+    map_traits::deallocate(map_alloc, map_, map_size_);
+    S21_STATS(Deallocation());
+    map_ = nullptr;
+    map_size_ = 0;
+    start_ = 0;
+  }
+}
+
+// Takes over the map of other; the allocators must be equal
+template <typename T, typename Allocator>
+void deque<T, Allocator>::Adopt(deque& other) {
+  map_ = std::exchange(other.map_, nullptr);
+  map_size_ = std::exchange(other.map_size_, 0);
+  start_ = std::exchange(other.start_, 0);
+  size_ = std::exchange(other.size_, 0);
+}
+
+// Counters of the instrumentation mode, zeros when it is disabled
+template <typename T, typename Allocator>
+container_stats deque<T, Allocator>::stats() const {
+  return S21_STATS_GET();
+}
+
+}  // namespace s21
+
+#endif
@@ -0,0 +1,131 @@
+#ifndef S21_CONTAINERS_DYNAMIC_BITSET_H
+#define S21_CONTAINERS_DYNAMIC_BITSET_H
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+
+#include "../Bitset/s21_bitset.h"
+#include "../Vector/s21_vector.hpp"
+
+namespace s21 {
+// Growable bitset in an s21::vector of words, the word operations of bitset
+// on a size chosen at run time. As a membership set of ids it costs one bit
+// per possible id, an eighth of a byte against about 48 bytes per element of
+// s21::set<uint32_t>, and intersecting two of them is a pass over words.
+//
+// The bulk operations treat the shorter operand as padded with zeros, as the
+// sets of ids they stand for: &= and and_not keep the size, |= and ^= grow
+// to the longer one.
+//
+// rank and select scan the words until build_rank_index() records the set
+// bits before every 512-bit block: then rank is O(1) and select a binary
+// search over the blocks, for an eighth more memory. Any change drops the
+// index; it is rebuilt only on request, so const calls never write.
+class dynamic_bitset {
+ public:
+  // member type
+  using size_type = size_t;
+  using word_type = bitset_detail::word_t;
+
+  static constexpr size_type npos = static_cast<size_type>(-1);
+
+  // functions
+  dynamic_bitset();
+  explicit dynamic_bitset(size_type bits, bool value = false);
+  // The bits of the keys, sized to the largest key plus one
+  template <typename Key, typename Compare>
+  explicit dynamic_bitset(const s21::set<Key, Compare>& keys);
+  dynamic_bitset(const dynamic_bitset& other) = default;
+  dynamic_bitset(dynamic_bitset&& other) noexcept;
+  dynamic_bitset& operator=(const dynamic_bitset& other) = default;
+  dynamic_bitset& operator=(dynamic_bitset&& other) noexcept;
+  ~dynamic_bitset() = default;
+
+  // element access
+  // Unchecked
+  bool operator[](size_type pos) const;
+  // std::out_of_range on a position not below size()
+  bool test(size_type pos) const;
+  bool all() const;
+  bool any() const;
+  bool none() const;
+  size_type count() const;
+  const word_type* data() const;
+
+  // capacity
+  bool empty() const;
+  size_type size() const;
+  size_type num_words() const;
+  void reserve(size_type bits);
+  // Bytes of the words and of the rank index
+  size_type memory_usage() const;
+
+  // modifiers, the positional ones check pos as test does
+  // New bits take value
+  void resize(size_type bits, bool value = false);
+  void push_back(bool value);
+  void clear();
+  dynamic_bitset& set();
+  dynamic_bitset& set(size_type pos, bool value = true);
+  dynamic_bitset& reset();
+  dynamic_bitset& reset(size_type pos);
+  dynamic_bitset& flip();
+  dynamic_bitset& flip(size_type pos);
+  dynamic_bitset& operator&=(const dynamic_bitset& other);
+  dynamic_bitset& operator|=(const dynamic_bitset& other);
+  dynamic_bitset& operator^=(const dynamic_bitset& other);
+  // Clears the bits set in other, *this & ~other
+  dynamic_bitset& and_not(const dynamic_bitset& other);
+  dynamic_bitset operator~() const;
+  void swap(dynamic_bitset& other) noexcept;
+  // Equal sizes and bits
+  bool operator==(const dynamic_bitset& other) const;
+  bool operator!=(const dynamic_bitset& other) const;
+
+  // lookup
+  size_type find_first() const;
+  // First set bit after pos
+  size_type find_next(size_type pos) const;
+  // Set bits before pos, pos up to size(); std::out_of_range past it
+  size_type rank(size_type pos) const;
+  // Position of the set bit with k set bits before it
+  size_type select(size_type k) const;
+  void build_rank_index();
+  bool has_rank_index() const;
+  // Calls visit(pos) for every set bit in ascending order
+  template <typename F>
+  void for_each(F visit) const;
+  // The positions of the set bits as keys, built in O(n)
+  template <typename Key = uint32_t>
+  s21::set<Key> to_set() const;
+
+  // Counters of the S21_CONTAINERS_STATS mode of the word vector
+  container_stats stats() const;
+
+ private:
+  static constexpr size_type kBlockWords = 8;
+
+  s21::vector<word_type> words_;
+  size_type size_;
+  // Set bits before each block of kBlockWords words and in total; empty
+  // while there is no index
+  s21::vector<size_type> ranks_;
+
+  word_type* Words() { return words_.begin(); }
+  const word_type* Words() const { return words_.begin(); }
+  void CheckPos(size_type pos) const;
+  void Changed() { ranks_.clear(); }
+  void Trim();
+  template <bitset_detail::BitOp Op>
+  void Combine(const dynamic_bitset& other);
+};
+
+dynamic_bitset operator&(dynamic_bitset left, const dynamic_bitset& right);
+dynamic_bitset operator|(dynamic_bitset left, const dynamic_bitset& right);
+dynamic_bitset operator^(dynamic_bitset left, const dynamic_bitset& right);
+}  // namespace s21
+
+#include "s21_dynamic_bitset.tpp"
+
+#endif
@@ -0,0 +1,357 @@
+#ifndef S21_CONTAINERS_DYNAMIC_BITSET_TPP
+#define S21_CONTAINERS_DYNAMIC_BITSET_TPP
+
+#include <algorithm>
+#include <utility>
+
+namespace s21 {
+
+// functions
+
+inline dynamic_bitset::dynamic_bitset() : words_(), size_(0), ranks_() {}
+
+inline dynamic_bitset::dynamic_bitset(size_type bits, bool value)
+    : dynamic_bitset() {
+  resize(bits, value);
+}
+
+// Keys come in ascending order, so the words grow as they go
+template <typename Key, typename Compare>
+dynamic_bitset::dynamic_bitset(const s21::set<Key, Compare>& keys)
+    : dynamic_bitset() {
+  bitset_detail::CheckKeyType<Key>();
+  keys.for_each([this](const Key& key) {
+    size_type pos = static_cast<size_type>(key);
+    while (words_.size() <= pos / bitset_detail::kWordBits) {
+      words_.push_back(0);
+    }
+    Words()[pos / bitset_detail::kWordBits] |=
+        word_type(1) << (pos % bitset_detail::kWordBits);
+    size_ = pos + 1;
+  });
+}
+
+inline dynamic_bitset::dynamic_bitset(dynamic_bitset&& other) noexcept
+    : words_(std::move(other.words_)),
+      size_(other.size_),
+      ranks_(std::move(other.ranks_)) {
+  other.size_ = 0;
+}
+
+inline dynamic_bitset& dynamic_bitset::operator=(
+    dynamic_bitset&& other) noexcept {
+  if (this != &other) {
+    words_ = std::move(other.words_);
+    ranks_ = std::move(other.ranks_);
+    size_ = other.size_;
+    other.size_ = 0;
+  }
+  return *this;
+}
+
+// element access
+
+inline bool dynamic_bitset::operator[](size_type pos) const {
+  return (Words()[pos / bitset_detail::kWordBits] >>
+          (pos % bitset_detail::kWordBits)) &
+         1;
+}
+
+inline bool dynamic_bitset::test(size_type pos) const {
+  CheckPos(pos);
+  return (*this)[pos];
+}
+
+inline bool dynamic_bitset::all() const { return count() == size_; }
+
+inline bool dynamic_bitset::any() const {
+  for (size_type i = 0; i < words_.size(); ++i) {
+    if (Words()[i] != 0) return true;
+  }
+  return false;
+}
+
+inline bool dynamic_bitset::none() const { return !any(); }
+
+inline dynamic_bitset::size_type dynamic_bitset::count() const {
+  if (!ranks_.empty()) return ranks_[ranks_.size() - 1];
+  return bitset_detail::Count(Words(), words_.size());
+}
+
+inline const dynamic_bitset::word_type* dynamic_bitset::data() const {
+  return Words();
+}
+
+// capacity
+
+inline bool dynamic_bitset::empty() const { return size_ == 0; }
+
+inline dynamic_bitset::size_type dynamic_bitset::size() const {
+  return size_;
+}
+
+inline dynamic_bitset::size_type dynamic_bitset::num_words() const {
+  return words_.size();
+}
+
+inline void dynamic_bitset::reserve(size_type bits) {
+  words_.reserve(bitset_detail::WordCount(bits));
+}
+
+inline dynamic_bitset::size_type dynamic_bitset::memory_usage() const {
+  return words_.capacity() * sizeof(word_type) +
+         ranks_.capacity() * sizeof(size_type);
+}
+
+// modifiers
+
+inline void dynamic_bitset::resize(size_type bits, bool value) {
+  Changed();
+  const word_type fill = value ? ~word_type(0) : 0;
+  if (value && bits > size_ && size_ % bitset_detail::kWordBits) {
+    Words()[words_.size() - 1] |= ~bitset_detail::TailMask(size_);
+  }
+  const size_type count = bitset_detail::WordCount(bits);
+  words_.reserve(count);
+  while (words_.size() < count) words_.push_back(fill);
+  while (words_.size() > count) words_.pop_back();
+  size_ = bits;
+  Trim();
+}
+
+inline void dynamic_bitset::push_back(bool value) {
+  Changed();
+  if (size_ % bitset_detail::kWordBits == 0) words_.push_back(0);
+  if (value) {
+    Words()[size_ / bitset_detail::kWordBits] |=
+        word_type(1) << (size_ % bitset_detail::kWordBits);
+  }
+  ++size_;
+}
+
+inline void dynamic_bitset::clear() {
+  Changed();
+  words_.clear();
+  size_ = 0;
+}
+
+inline dynamic_bitset& dynamic_bitset::set() {
+  Changed();
+  for (size_type i = 0; i < words_.size(); ++i) Words()[i] = ~word_type(0);
+  Trim();
+  return *this;
+}
+
+inline dynamic_bitset& dynamic_bitset::set(size_type pos, bool value) {
+  CheckPos(pos);
+  Changed();
+  word_type bit = word_type(1) << (pos % bitset_detail::kWordBits);
+  word_type& word = Words()[pos / bitset_detail::kWordBits];
+  word = value ? word | bit : word & ~bit;
+  return *this;
+}
+
+inline dynamic_bitset& dynamic_bitset::reset() {
+  Changed();
+  for (size_type i = 0; i < words_.size(); ++i) Words()[i] = 0;
+  return *this;
+}
+
+inline dynamic_bitset& dynamic_bitset::reset(size_type pos) {
+  return set(pos, false);
+}
+
+inline dynamic_bitset& dynamic_bitset::flip() {
+  Changed();
+  for (size_type i = 0; i < words_.size(); ++i) Words()[i] = ~Words()[i];
+  Trim();
+  return *this;
+}
+
+inline dynamic_bitset& dynamic_bitset::flip(size_type pos) {
+  CheckPos(pos);
+  Changed();
+  word_type bit = word_type(1) << (pos % bitset_detail::kWordBits);
+  Words()[pos / bitset_detail::kWordBits] ^= bit;
+  return *this;
+}
+
+inline dynamic_bitset& dynamic_bitset::operator&=(
+    const dynamic_bitset& other) {
+  Combine<bitset_detail::BitOp::kAnd>(other);
+  return *this;
+}
+
+inline dynamic_bitset& dynamic_bitset::operator|=(
+    const dynamic_bitset& other) {
+  Combine<bitset_detail::BitOp::kOr>(other);
+  return *this;
+}
+
+inline dynamic_bitset& dynamic_bitset::operator^=(
+    const dynamic_bitset& other) {
+  Combine<bitset_detail::BitOp::kXor>(other);
+  return *this;
+}
+
+inline dynamic_bitset& dynamic_bitset::and_not(const dynamic_bitset& other) {
+  Combine<bitset_detail::BitOp::kAndNot>(other);
+  return *this;
+}
+
+inline dynamic_bitset dynamic_bitset::operator~() const {
+  dynamic_bitset result(*this);
+  return result.flip();
+}
+
+inline void dynamic_bitset::swap(dynamic_bitset& other) noexcept {
+  words_.swap(other.words_);
+  ranks_.swap(other.ranks_);
+  std::swap(size_, other.size_);
+}
+
+inline bool dynamic_bitset::operator==(const dynamic_bitset& other) const {
+  if (size_ != other.size_) return false;
+  for (size_type i = 0; i < words_.size(); ++i) {
+    if (Words()[i] != other.Words()[i]) return false;
+  }
+  return true;
+}
+
+inline bool dynamic_bitset::operator!=(const dynamic_bitset& other) const {
+  return !(*this == other);
+}
+
+// lookup
+
+inline dynamic_bitset::size_type dynamic_bitset::find_first() const {
+  size_type pos = bitset_detail::FindFrom(Words(), words_.size(), 0);
+  return pos < size_ ? pos : npos;
+}
+
+inline dynamic_bitset::size_type dynamic_bitset::find_next(
+    size_type pos) const {
+  if (pos + 1 >= size_) return npos;
+  pos = bitset_detail::FindFrom(Words(), words_.size(), pos + 1);
+  return pos < size_ ? pos : npos;
+}
+
+inline dynamic_bitset::size_type dynamic_bitset::rank(size_type pos) const {
+  if (pos > size_) throw std::out_of_range("Index out of range");
+  if (ranks_.empty()) return bitset_detail::Rank(Words(), pos);
+  size_type word = pos / bitset_detail::kWordBits;
+  size_type block = word / kBlockWords;
+  size_type total = ranks_[block];
+  for (size_type i = block * kBlockWords; i < word; ++i) {
+    total += bitset_detail::Popcount(Words()[i]);
+  }
+  if (pos % bitset_detail::kWordBits) {
+    total += bitset_detail::Popcount(
+        Words()[word] & ~(~word_type(0) << (pos % bitset_detail::kWordBits)));
+  }
+  return total;
+}
+
+// With the index: the last block with at most k set bits before it holds
+// the bit, then its words are scanned
+inline dynamic_bitset::size_type dynamic_bitset::select(size_type k) const {
+  if (ranks_.empty()) {
+    size_type pos = bitset_detail::Select(Words(), words_.size(), k);
+    return pos < size_ ? pos : npos;
+  }
+  if (k >= count()) return npos;
+  const size_type* ranks = ranks_.begin();
+  size_type low = 0;
+  size_type high = ranks_.size() - 1;
+  while (high - low > 1) {
+    size_type middle = low + (high - low) / 2;
+    if (ranks[middle] <= k) {
+      low = middle;
+    } else {
+      high = middle;
+    }
+  }
+  size_type first = low * kBlockWords;
+  size_type last = std::min(first + kBlockWords, words_.size());
+  return first * bitset_detail::kWordBits +
+         bitset_detail::Select(Words() + first, last - first, k - ranks[low]);
+}
+
+inline void dynamic_bitset::build_rank_index() {
+  ranks_.clear();
+  const size_type blocks = (words_.size() + kBlockWords - 1) / kBlockWords;
+  ranks_.reserve(blocks + 1);
+  size_type total = 0;
+  for (size_type block = 0; block < blocks; ++block) {
+    ranks_.push_back(total);
+    size_type first = block * kBlockWords;
+    size_type last = std::min(first + kBlockWords, words_.size());
+    total += bitset_detail::Count(Words() + first, last - first);
+  }
+  ranks_.push_back(total);
+}
+
+inline bool dynamic_bitset::has_rank_index() const { return !ranks_.empty(); }
+
+template <typename F>
+void dynamic_bitset::for_each(F visit) const {
+  bitset_detail::ForEach(Words(), words_.size(), visit);
+}
+
+template <typename Key>
+s21::set<Key> dynamic_bitset::to_set() const {
+  bitset_detail::CheckKeyType<Key>();
+  s21::set<Key> keys;
+  keys.assign_sorted(
+      bitset_detail::OnesIterator(Words(), words_.size(), 0),
+      bitset_detail::OnesIterator(Words(), words_.size(), size_));
+  return keys;
+}
+
+inline container_stats dynamic_bitset::stats() const { return words_.stats(); }
+
+// helpers
+
+inline void dynamic_bitset::CheckPos(size_type pos) const {
+  if (pos >= size_) throw std::out_of_range("Index out of range");
+}
+
+// Clears the bits of the last word past the size
+inline void dynamic_bitset::Trim() {
+  if (size_ % bitset_detail::kWordBits) {
+    Words()[words_.size() - 1] &= bitset_detail::TailMask(size_);
+  }
+}
+
+template <bitset_detail::BitOp Op>
+void dynamic_bitset::Combine(const dynamic_bitset& other) {
+  using bitset_detail::BitOp;
+  Changed();
+  const bool grows = Op == BitOp::kOr || Op == BitOp::kXor;
+  if (grows && other.size_ > size_) resize(other.size_);
+  size_type common = std::min(words_.size(), other.words_.size());
+  bitset_detail::Combine<Op>(Words(), other.Words(), common);
+  if (Op == BitOp::kAnd) {
+    for (size_type i = common; i < words_.size(); ++i) Words()[i] = 0;
+  }
+  Trim();
+}
+
+inline dynamic_bitset operator&(dynamic_bitset left,
+                                const dynamic_bitset& right) {
+  return left &= right;
+}
+
+inline dynamic_bitset operator|(dynamic_bitset left,
+                                const dynamic_bitset& right) {
+  return left |= right;
+}
+
+inline dynamic_bitset operator^(dynamic_bitset left,
+                                const dynamic_bitset& right) {
+  return left ^= right;
+}
+
+}  // namespace s21
+
+#endif
@@ -0,0 +1,77 @@
+#ifndef S21_CONTAINERS_EPOCH_DOMAIN_H
+#define S21_CONTAINERS_EPOCH_DOMAIN_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace s21 {
+// Epoch-based reclamation. Readers pin the current epoch for the duration of
+// a lock-free traversal; a writer that unlinks an object records the epoch it
+// was retired in and frees it once the global epoch is two steps further.
+// The epoch only advances when every pinned thread has observed its current
+// value, so by then no reader can still hold a pointer to the object.
+//
+// There is one process-wide domain; every thread that pins it gets a record
+// of its own, reused by later threads once it exits.
+class epoch_domain {
+ public:
+  using epoch_type = uint64_t;
+
+  static epoch_domain& instance();
+
+  epoch_domain(const epoch_domain&) = delete;
+  epoch_domain& operator=(const epoch_domain&) = delete;
+
+  // Pinning nests: only the outermost pin and unpin touch the record
+  void pin();
+  void unpin();
+
+  epoch_type epoch() const;
+  // Advances the epoch when no pinned thread lags behind it and returns the
+  // epoch in force afterwards
+  epoch_type try_advance();
+  // Whether an object retired in retired can be freed in epoch now
+  static bool is_safe(epoch_type retired, epoch_type now);
+
+ private:
+  static constexpr size_t kCacheLine = 64;
+
+  // epoch is zero while the thread is not pinned
+  struct alignas(kCacheLine) Record {
+    std::atomic<epoch_type> epoch{0};
+    std::atomic<bool> in_use{true};
+    unsigned depth = 0;
+    Record* next = nullptr;
+  };
+
+  // Returns the record of the calling thread to the domain when it exits
+  struct ThreadRecord {
+    Record* record = nullptr;
+    ~ThreadRecord();
+  };
+
+  alignas(kCacheLine) std::atomic<epoch_type> epoch_;
+  std::atomic<Record*> records_;
+
+  epoch_domain();
+  Record* LocalRecord();
+  Record* Acquire();
+};
+
+// Keeps the calling thread pinned for the lifetime of the guard
+class epoch_guard {
+ public:
+  explicit epoch_guard(epoch_domain& domain = epoch_domain::instance());
+  epoch_guard(const epoch_guard&) = delete;
+  epoch_guard& operator=(const epoch_guard&) = delete;
+  ~epoch_guard();
+
+ private:
+  epoch_domain& domain_;
+};
+}  // namespace s21
+
+#include "s21_epoch_domain.tpp"
+
+#endif
@@ -0,0 +1,102 @@
+#ifndef S21_CONTAINERS_EPOCH_DOMAIN_TPP
+#define S21_CONTAINERS_EPOCH_DOMAIN_TPP
+
+namespace s21 {
+
+// Every access to an epoch is sequentially consistent: a reader's pin is
+// ordered before its loads of shared pointers, and a writer's unlinking
+// before its reading of the retire epoch, in a single total order
+
+// functions
+
+inline epoch_domain::epoch_domain() : epoch_(1), records_(nullptr) {}
+
+// Never destroyed: threads may still exit, and hand back their records,
+// while static objects are being torn down
+inline epoch_domain& epoch_domain::instance() {
+  static epoch_domain* domain = new epoch_domain();
+  return *domain;
+}
+
+inline void epoch_domain::pin() {
+  Record* record = LocalRecord();
+  if (record->depth++ != 0) return;
+  // Re-read until the pinned epoch is current, so a stale pin cannot hold
+  // back the next advance
+  epoch_type epoch = epoch_.load();
+  for (;;) {
+    record->epoch.store(epoch);
+    epoch_type current = epoch_.load();
+    if (current == epoch) break;
+    epoch = current;
+  }
+}
+
+inline void epoch_domain::unpin() {
+  Record* record = LocalRecord();
+  if (--record->depth == 0) record->epoch.store(0, std::memory_order_release);
+}
+
+inline epoch_domain::epoch_type epoch_domain::epoch() const {
+  return epoch_.load();
+}
+
+inline epoch_domain::epoch_type epoch_domain::try_advance() {
+  epoch_type current = epoch_.load();
+  for (Record* record = records_.load(std::memory_order_acquire);
+       record != nullptr; record = record->next) {
+    epoch_type pinned = record->epoch.load();
+    if (pinned != 0 && pinned != current) return current;
+  }
+  epoch_.compare_exchange_strong(current, current + 1);
+  return epoch_.load();
+}
+
+inline bool epoch_domain::is_safe(epoch_type retired, epoch_type now) {
+  return retired + 2 <= now;
+}
+
+// helpers
+
+inline epoch_domain::ThreadRecord::~ThreadRecord() {
+  if (record != nullptr) record->in_use.store(false, std::memory_order_release);
+}
+
+inline epoch_domain::Record* epoch_domain::LocalRecord() {
+  static thread_local ThreadRecord local;
+  if (local.record == nullptr) local.record = Acquire();
+  return local.record;
+}
+
+// Reuses the record of an exited thread or links a new one; records are
+// never unlinked, so the list can be walked without a lock
+inline epoch_domain::Record* epoch_domain::Acquire() {
+  for (Record* record = records_.load(std::memory_order_acquire);
+       record != nullptr; record = record->next) {
+    bool in_use = false;
+    if (!record->in_use.load(std::memory_order_relaxed) &&
+        record->in_use.compare_exchange_strong(in_use, true,
+                                               std::memory_order_acquire)) {
+      return record;
+    }
+  }
+  Record* record = new Record();
+  record->next = records_.load(std::memory_order_relaxed);
+  while (!records_.compare_exchange_weak(record->next, record,
+                                         std::memory_order_release,
+                                         std::memory_order_relaxed)) {
+  }
+  return record;
+}
+
+// epoch_guard
+
+inline epoch_guard::epoch_guard(epoch_domain& domain) : domain_(domain) {
+  domain_.pin();
+}
+
+inline epoch_guard::~epoch_guard() { domain_.unpin(); }
+
+}  // namespace s21
+
+#endif
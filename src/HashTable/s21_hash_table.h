@@ -0,0 +1,283 @@
+#ifndef S21_CONTAINERS_HASH_TABLE_H
+#define S21_CONTAINERS_HASH_TABLE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include "../KeyOfValue/s21_key_of_value.h"
+#include "../Stats/s21_stats.h"
+
+namespace s21 {
+namespace hash_detail {
+// One control byte per slot: 0..127 marks a full slot and holds the low
+// seven bits of its hash (H2), negative values mark free slots
+using ctrl_t = signed char;
+
+constexpr ctrl_t kEmpty = -128;
+constexpr ctrl_t kDeleted = -2;
+
+// Slots probed at once; the control array repeats its first kGroupWidth
+// bytes after the last slot so that a group can start at any slot
+constexpr size_t kGroupWidth = 16;
+
+inline bool IsFull(ctrl_t ctrl) { return ctrl >= 0; }
+
+inline unsigned TrailingZeros(uint32_t mask) { return __builtin_ctz(mask); }
+
+// Leading zeros of a group mask, i.e. counted from bit kGroupWidth - 1
+inline unsigned LeadingZeros(uint32_t mask) {
+  return __builtin_clz(mask) - (32 - kGroupWidth);
+}
+
+// kGroupWidth control bytes and bit masks of the slots that match a
+// predicate, bit i standing for slot pos + i. Uses SSE2 where available
+class Group {
+ public:
+#if defined(__SSE2__)
+  explicit Group(const ctrl_t* pos)
+      : ctrl_(_mm_loadu_si128(reinterpret_cast<const __m128i*>(pos))) {}
+
+  uint32_t Match(ctrl_t h2) const {
+    return _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(h2), ctrl_));
+  }
+  uint32_t MatchEmpty() const { return Match(kEmpty); }
+  uint32_t MatchFree() const { return _mm_movemask_epi8(ctrl_); }
+#else
+  explicit Group(const ctrl_t* pos) { std::memcpy(ctrl_, pos, kGroupWidth); }
+
+  uint32_t Match(ctrl_t h2) const {
+    uint32_t mask = 0;
+    for (size_t i = 0; i < kGroupWidth; ++i) {
+      if (ctrl_[i] == h2) mask |= uint32_t(1) << i;
+    }
+    return mask;
+  }
+  uint32_t MatchEmpty() const { return Match(kEmpty); }
+  uint32_t MatchFree() const {
+    uint32_t mask = 0;
+    for (size_t i = 0; i < kGroupWidth; ++i) {
+      if (!IsFull(ctrl_[i])) mask |= uint32_t(1) << i;
+    }
+    return mask;
+  }
+#endif
+  uint32_t MatchFull() const {
+    return ~MatchFree() & ((uint32_t(1) << kGroupWidth) - 1);
+  }
+
+ private:
+#if defined(__SSE2__)
+  __m128i ctrl_;
+#else
+  ctrl_t ctrl_[kGroupWidth];
+#endif
+};
+
+// Spreads the bits of a user hash: std::hash of an integer is the identity,
+// which would leave H2 and the low bits of H1 all but constant
+inline size_t Mix(size_t hash) {
+  uint64_t mixed = static_cast<uint64_t>(hash) * 0x9E3779B97F4A7C15ull;
+  return static_cast<size_t>(mixed ^ (mixed >> 32));
+}
+
+// Lookups with a key type other than key_type need both functors to accept it
+template <typename Hash, typename KeyEqual, typename = void>
+struct IsTransparent : std::false_type {};
+
+template <typename Hash, typename KeyEqual>
+struct IsTransparent<Hash, KeyEqual,
+                     std::void_t<typename Hash::is_transparent,
+                                 typename KeyEqual::is_transparent>>
+    : std::true_type {};
+
+template <typename Hash, typename KeyEqual>
+using EnableIfTransparent =
+    std::enable_if_t<IsTransparent<Hash, KeyEqual>::value>;
+}  // namespace hash_detail
+
+template <typename T, bool IsConst>
+class HashIterator;
+
+// Open-addressing hash table in the SwissTable layout: a power-of-two array
+// of slots plus one control byte per slot. A lookup hashes the key once,
+// compares H2 against a whole group of control bytes and only calls KeyEqual
+// on the (few) matches; the probe ends at the first group with an empty slot.
+// Shared core of unordered_set and unordered_map, the same way AVLTree backs
+// set and map. The slots come from Allocator and the control bytes from the
+// same allocator rebound to ctrl_t.
+template <typename T, typename Hash, typename KeyEqual,
+          typename KeyOfValue = IdentityKey<T>,
+          typename Allocator = std::allocator<T>>
+class HashTable {
+  using alloc_traits = std::allocator_traits<Allocator>;
+  using ctrl_allocator =
+      typename alloc_traits::template rebind_alloc<hash_detail::ctrl_t>;
+  using ctrl_traits = std::allocator_traits<ctrl_allocator>;
+  using hash_allocator = typename alloc_traits::template rebind_alloc<size_t>;
+  using hash_traits = std::allocator_traits<hash_allocator>;
+
+  static constexpr bool kNothrowMoveAssign =
+      alloc_traits::propagate_on_container_move_assignment::value ||
+      alloc_traits::is_always_equal::value;
+
+ public:
+  using key_type = typename KeyOfValue::key_type;
+  using size_type = size_t;
+  using iterator = HashIterator<T, false>;
+  using const_iterator = HashIterator<T, true>;
+  using allocator_type = Allocator;
+
+  static constexpr float kDefaultMaxLoadFactor = 0.875f;
+
+  explicit HashTable(size_type bucket_count = 0, const Hash& hash = Hash(),
+                     const KeyEqual& equal = KeyEqual(),
+                     const Allocator& alloc = Allocator());
+  HashTable(const HashTable& other);
+  HashTable(HashTable&& other) noexcept;
+  HashTable(const HashTable& other, const Allocator& alloc);
+  HashTable(HashTable&& other, const Allocator& alloc);
+  ~HashTable();
+  HashTable& operator=(const HashTable& other);
+  HashTable& operator=(HashTable&& other) noexcept(kNothrowMoveAssign);
+
+  iterator Begin();
+  iterator End();
+  const_iterator Begin() const;
+  const_iterator End() const;
+
+  size_type Size() const;
+  size_type Capacity() const;
+  float LoadFactor() const;
+  float MaxLoadFactor() const;
+  void SetMaxLoadFactor(float max_load_factor);
+  void Reserve(size_type count);
+  void Rehash(size_type bucket_count);
+
+  // Constructs an element from args unless an element with key is present
+  template <typename K, typename... Args>
+  std::pair<iterator, bool> TryEmplace(const K& key, Args&&... args);
+  template <typename K>
+  iterator Find(const K& key);
+  template <typename K>
+  const_iterator Find(const K& key) const;
+  template <typename K>
+  size_type EraseKey(const K& key);
+  void Erase(const_iterator pos);
+  void Clear();
+  void Swap(HashTable& other) noexcept;
+
+  const Hash& GetHash() const;
+  const KeyEqual& GetKeyEqual() const;
+  Allocator GetAllocator() const;
+  container_stats GetStats() const;
+
+ private:
+  using ctrl_t = hash_detail::ctrl_t;
+
+  ctrl_t* ctrl_;
+  T* slots_;
+  size_type capacity_;
+  size_type size_;
+  size_type growth_left_;
+  float max_load_factor_;
+  Hash hash_;
+  KeyEqual equal_;
+  Allocator allocator_;
+  S21_STATS_MEMBER
+
+  template <typename K>
+  size_t HashOf(const K& key) const;
+  const key_type& KeyOf(const T& value) const;
+  template <typename K>
+  size_type FindIndex(const K& key, size_t hash) const;
+  size_type FindFreeSlot(size_t hash) const;
+  void SetCtrl(size_type index, ctrl_t value);
+  void EraseAt(size_type index);
+
+  size_type CapacityFor(size_type count) const;
+  size_type GrowthFor(size_type capacity) const;
+  void Resize(size_type capacity);
+  template <typename Emplace>
+  void Resize(size_type capacity, Emplace emplace);
+  void Release();
+  void Adopt(HashTable& other);
+  template <typename... Args>
+  size_type Place(size_t hash, Args&&... args);
+};
+
+// Forward iterator over the full slots; skips free slots a group at a time
+template <typename T, bool IsConst>
+class HashIterator {
+ public:
+  using value_type = T;
+  using reference = typename std::conditional<IsConst, const T&, T&>::type;
+  using pointer = typename std::conditional<IsConst, const T*, T*>::type;
+  using difference_type = std::ptrdiff_t;
+  using iterator_category = std::forward_iterator_tag;
+
+  HashIterator() : ctrl_(nullptr), slot_(nullptr), end_(nullptr) {}
+  HashIterator(const hash_detail::ctrl_t* ctrl, pointer slot,
+               const hash_detail::ctrl_t* end)
+      : ctrl_(ctrl), slot_(slot), end_(end) {
+    SkipFree();
+  }
+  operator HashIterator<T, true>() const {
+    return HashIterator<T, true>(ctrl_, slot_, end_);
+  }
+
+  reference operator*() const { return *slot_; }
+  pointer operator->() const { return slot_; }
+
+  HashIterator& operator++() {
+    ++ctrl_;
+    ++slot_;
+    SkipFree();
+    return *this;
+  }
+  HashIterator operator++(int) {
+    HashIterator temp = *this;
+    ++*this;
+    return temp;
+  }
+
+  bool operator==(const HashIterator& other) const {
+    return ctrl_ == other.ctrl_;
+  }
+  bool operator!=(const HashIterator& other) const {
+    return ctrl_ != other.ctrl_;
+  }
+
+  const hash_detail::ctrl_t* GetCtrl() const { return ctrl_; }
+
+ private:
+  const hash_detail::ctrl_t* ctrl_;
+  pointer slot_;
+  const hash_detail::ctrl_t* end_;
+
+  void SkipFree() {
+    while (ctrl_ != end_ && !hash_detail::IsFull(*ctrl_)) {
+      uint32_t full = hash_detail::Group(ctrl_).MatchFull();
+      size_t shift =
+          full ? hash_detail::TrailingZeros(full) : hash_detail::kGroupWidth;
+      size_t left = static_cast<size_t>(end_ - ctrl_);
+      if (shift > left) shift = left;
+      ctrl_ += shift;
+      slot_ += shift;
+    }
+  }
+};
+}  // namespace s21
+
+#include "s21_hash_table.tpp"
+
+#endif
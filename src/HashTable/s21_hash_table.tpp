@@ -0,0 +1,634 @@
+#ifndef S21_CONTAINERS_HASH_TABLE_TPP
+#define S21_CONTAINERS_HASH_TABLE_TPP
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace s21 {
+
+// functions
+
+// No memory is allocated until the first insertion unless bucket_count > 0
+template <typename T, typename Hash, typename KeyEqual, typename KeyOfValue,
+          typename Allocator>
+HashTable<T, Hash, KeyEqual, KeyOfValue, Allocator>::HashTable(
+    size_type bucket_count, const Hash& hash, const KeyEqual& equal,
+    const Allocator& alloc)
+    : ctrl_(nullptr),
+      slots_(nullptr),
+      capacity_(0),
+      size_(0),
+      growth_left_(0),
+      max_load_factor_(kDefaultMaxLoadFactor),
+      hash_(hash),
+      equal_(equal),
+      allocator_(alloc) {
+  if (bucket_count > 0) Rehash(bucket_count);
+}
+
+// Copy constructor, with the allocator select_on_container_copy_construction
+// gives
+template <typename T, typename Hash, typename KeyEqual, typename KeyOfValue,
+          typename Allocator>
+HashTable<T, Hash, KeyEqual, KeyOfValue, Allocator>::HashTable(
+    const HashTable& other)
+    : HashTable(other, alloc_traits::select_on_container_copy_construction(
+                           other.allocator_)) {}
+
+// Move constructor, steals the arrays together with the allocator and leaves
+// the source empty
+template <typename T, typename Hash, typename KeyEqual, typename KeyOfValue,
+          typename Allocator>
+HashTable<T, Hash, KeyEqual, KeyOfValue, Allocator>::HashTable(
+    HashTable&& other) noexcept
+    : HashTable(0, other.hash_, other.equal_,
+                Allocator(std::move(other.allocator_))) {
+  Adopt(other);
+}
+
+// Copies other into arrays from alloc, sized for the elements of other rather
+// than its capacity. Once the delegated constructor has run, the destructor
+// frees whatever was copied if a copy throws
+template <typename T, typename Hash, typename KeyEqual, typename KeyOfValue,
+          typename Allocator>
+HashTable<T, Hash, KeyEqual, KeyOfValue, Allocator>::HashTable(
+    const HashTable& other, const Allocator& alloc)
+    : HashTable(0, other.hash_, other.equal_, alloc) {
+  max_load_factor_ = other.max_load_factor_;
+  Reserve(other.size_);
+  for (const_iterator it = other.Begin(); it != other.End(); ++it) {
+    Place(HashOf(KeyOf(*it)), *it);
+  }
+}
+
+// Steals the arrays if alloc equals the source's allocator, moves the
+// elements one by one into arrays from alloc otherwise
+template <typename T, typename Hash, typename KeyEqual, typename KeyOfValue,
+          typename Allocator>
+HashTable<T, Hash, KeyEqual, KeyOfValue, Allocator>::HashTable(
+    HashTable&& other, const Allocator& alloc)
+    : HashTable(0, other.hash_, other.equal_, alloc) {
+  if (allocator_ == other.allocator_) {
+    Adopt(other);
+  } else {
+    max_load_factor_ = other.max_load_factor_;
+    Reserve(other.size_);
+    for (iterator it = other.Begin(); it != other.End(); ++it) {
+      Place(HashOf(KeyOf(*it)), std::move(*it));
+    }
+  }
+}
+
+template <typename T, typename Hash, typename KeyEqual, typename KeyOfValue,
+          typename Allocator>
+HashTable<T, Hash, KeyEqual, KeyOfValue, Allocator>::~HashTable() {
+  Release();
+}
+
+// The copy is built aside with the allocator this table ends up with: its
+// own, or other's under propagate_on_container_copy_assignment
+template <typename T, typename Hash, typename KeyEqual, typename KeyOfValue,
+          typename Allocator>
+HashTable<T, Hash, KeyEqual, KeyOfValue, Allocator>&
+HashTable<T, Hash, KeyEqual, KeyOfValue, Allocator>::operator=(
+    const HashTable& other) {
+  if (this != &other) {
+    if constexpr (alloc_traits::propagate_on_container_copy_assignment::
+                      value) {
+      HashTable tmp(other, other.allocator_);
+      Release();
+      allocator_ = other.allocator_;
+      Adopt(tmp);
+    } else {
+      HashTable tmp(other, allocator_);
+      Release();
+      Adopt(tmp);
+    }
+  }
+  return *this;
+}
+
+// The arrays are stolen when the allocator propagates or the two are equal;
+// otherwise the elements are moved into arrays from this table's allocator
+template <typename T, typename Hash, typename KeyEqual, typename KeyOfValue,
+          typename Allocator>
+HashTable<T, Hash, KeyEqual, KeyOfValue, Allocator>&
+HashTable<T, Hash, KeyEqual, KeyOfValue, Allocator>::operator=(
+    HashTable&& other) noexcept(kNothrowMoveAssign) {
+  if (this != &other) {
+    if constexpr (alloc_traits::propagate_on_container_move_assignment::
+                      value) {
+      Release();
+      allocator_ = std::move(other.allocator_);
+      Adopt(other);
+    } else if (allocator_ == other.allocator_) {
+      Release();
+      Adopt(other);
+    } else {
+      HashTable tmp(std::move(other), allocator_);
+      Release();
+      Adopt(tmp);
+    }
+  }
+  return *this;
+}
+
+// iterators
+
+template <typename T, typename Hash, typename KeyEqual, typename KeyOfValue,
+          typename Allocator>
+typename HashTable<T, Hash, KeyEqual, KeyOfValue, Allocator>::iterator
+HashTable<T, Hash, KeyEqual, KeyOfValue, Allocator>::Begin() {
+  return iterator(ctrl_, slots_, ctrl_ + capacity_);
+}
+
+template <typename T, typename Hash, typename KeyEqual, typename KeyOfValue,
+          typename Allocator>
+typename HashTable<T, Hash, KeyEqual, KeyOfValue, Allocator>::iterator
+HashTable<T, Hash, KeyEqual, KeyOfValue, Allocator>::End() {
+  return iterator(ctrl_ + capacity_, slots_ + capacity_, ctrl_ + capacity_);
+}
+
+template <typename T, typename Hash, typename KeyEqual, typename KeyOfValue,
+          typename Allocator>
+typename HashTable<T, Hash, KeyEqual, KeyOfValue, Allocator>::const_iterator
+HashTable<T, Hash, KeyEqual, KeyOfValue, Allocator>::Begin() const {
+  return const_iterator(ctrl_, slots_, ctrl_ + capacity_);
+}
+
+template <typename T, typename Hash, typename KeyEqual, typename KeyOfValue,
+          typename Allocator>
+typename HashTable<T, Hash, KeyEqual, KeyOfValue, Allocator>::const_iterator
+HashTable<T, Hash, KeyEqual, KeyOfValue, Allocator>::End() const {
+  return const_iterator(ctrl_ + capacity_, slots_ + capacity_,
+                        ctrl_ + capacity_);
+}
+
+// capacity
+
+template <typename T, typename Hash, typename KeyEqual, typename KeyOfValue,
+          typename Allocator>
+typename HashTable<T, Hash, KeyEqual, KeyOfValue, Allocator>::size_type
+HashTable<T, Hash, KeyEqual, KeyOfValue, Allocator>::Size() const {
+  return size_;
+}
+
+// Number of slots, the bucket_count() of the containers
+template <typename T, typename Hash, typename KeyEqual, typename KeyOfValue,
+          typename Allocator>
+typename HashTable<T, Hash, KeyEqual, KeyOfValue, Allocator>::size_type
+HashTable<T, Hash, KeyEqual, KeyOfValue, Allocator>::Capacity() const {
+  return capacity_;
+}
+
+template <typename T, typename Hash, typename KeyEqual, typename KeyOfValue,
+          typename Allocator>
+float HashTable<T, Hash, KeyEqual, KeyOfValue, Allocator>::LoadFactor() const {
+  return capacity_ ? static_cast<float>(size_) / capacity_ : 0.0f;
+}
+
+template <typename T, typename Hash, typename KeyEqual, typename KeyOfValue,
+          typename Allocator>
+float
+HashTable<T, Hash, KeyEqual, KeyOfValue, Allocator>::MaxLoadFactor() const {
+  return max_load_factor_;
+}
+
+// Open addressing needs a free slot to end every probe, so the limit is at
+// most 1; the table is rehashed if it no longer fits
+template <typename T, typename Hash, typename KeyEqual, typename KeyOfValue,
+          typename Allocator>
+void HashTable<T, Hash, KeyEqual, KeyOfValue, Allocator>::SetMaxLoadFactor(
+    float max_load_factor) {
+  if (!(max_load_factor > 0.0f && max_load_factor <= 1.0f)) {
+    throw std::invalid_argument("Max load factor must be in (0, 1]");
+  }
+  max_load_factor_ = max_load_factor;
+  if (capacity_ > 0) Resize(std::max(capacity_, CapacityFor(size_)));
+}
+
+// Makes room for count elements without a rehash
+template <typename T, typename Hash, typename KeyEqual, typename KeyOfValue,
+          typename Allocator>
+void HashTable<T, Hash, KeyEqual, KeyOfValue, Allocator>::Reserve(
+    size_type count) {
+  size_type capacity = CapacityFor(count);
+  if (capacity > capacity_) Resize(capacity);
+}
+
+// Rebuilds the table with at least bucket_count slots (rounded up to a power
+// of two) and enough for the current elements; also clears the tombstones
+template <typename T, typename Hash, typename KeyEqual, typename KeyOfValue,
+          typename Allocator>
+void HashTable<T, Hash, KeyEqual, KeyOfValue, Allocator>::Rehash(
+    size_type bucket_count) {
+  size_type capacity = CapacityFor(size_);
+  if (bucket_count > 0) {
+    size_type requested = hash_detail::kGroupWidth;
+    while (requested < bucket_count) requested *= 2;
+    capacity = std::max(capacity, requested);
+  }
+  Resize(capacity);
+}
+
+// modifiers
+
+template <typename T, typename Hash, typename KeyEqual, typename KeyOfValue,
+          typename Allocator>
+template <typename K, typename... Args>
+std::pair<
+    typename HashTable<T, Hash, KeyEqual, KeyOfValue, Allocator>::iterator,
+    bool>
+HashTable<T, Hash, KeyEqual, KeyOfValue, Allocator>::TryEmplace(
+    const K& key, Args&&... args) {
+  size_t hash = HashOf(key);
+  size_type index = FindIndex(key, hash);
+  if (index != capacity_) {
+    return std::make_pair(
+        iterator(ctrl_ + index, slots_ + index, ctrl_ + capacity_), false);
+  }
+
+  if (growth_left_ == 0) {
+    // Mostly tombstones: rebuild in place instead of doubling. The element
+    // is built in the new table before the others move: args may refer to
+    // one of them
+    bool in_place = capacity_ > 0 && size_ * 2 <= GrowthFor(capacity_);
+    Resize(in_place ? capacity_
+                    : std::max(CapacityFor(size_ + 1), capacity_ * 2),
+           [&](HashTable& fresh) {
+             index = fresh.Place(hash, std::forward<Args>(args)...);
+           });
+    return std::make_pair(
+        iterator(ctrl_ + index, slots_ + index, ctrl_ + capacity_), true);
+  }
+  index = FindFreeSlot(hash);
+  alloc_traits::construct(allocator_, slots_ + index,
+                          std::forward<Args>(args)...);
+  if (ctrl_[index] == hash_detail::kEmpty) --growth_left_;
+  SetCtrl(index, static_cast<ctrl_t>(hash & 0x7f));
+  ++size_;
+
+  return std::make_pair(
+      iterator(ctrl_ + index, slots_ + index, ctrl_ + capacity_), true);
+}
+
+template <typename T, typename Hash, typename KeyEqual, typename KeyOfValue,
+          typename Allocator>
+template <typename K>
+typename HashTable<T, Hash, KeyEqual, KeyOfValue, Allocator>::iterator
+HashTable<T, Hash, KeyEqual, KeyOfValue, Allocator>::Find(const K& key) {
+  size_type index = FindIndex(key, HashOf(key));
+  return iterator(ctrl_ + index, slots_ + index, ctrl_ + capacity_);
+}
+
+template <typename T, typename Hash, typename KeyEqual, typename KeyOfValue,
+          typename Allocator>
+template <typename K>
+typename HashTable<T, Hash, KeyEqual, KeyOfValue, Allocator>::const_iterator
+HashTable<T, Hash, KeyEqual, KeyOfValue, Allocator>::Find(const K& key) const {
+  size_type index = FindIndex(key, HashOf(key));
+  return const_iterator(ctrl_ + index, slots_ + index, ctrl_ + capacity_);
+}
+
+// Removes the element with key, returns the number of removed elements
+template <typename T, typename Hash, typename KeyEqual, typename KeyOfValue,
+          typename Allocator>
+template <typename K>
+typename HashTable<T, Hash, KeyEqual, KeyOfValue, Allocator>::size_type
+HashTable<T, Hash, KeyEqual, KeyOfValue, Allocator>::EraseKey(const K& key) {
+  size_type index = FindIndex(key, HashOf(key));
+  if (index == capacity_) return 0;
+  EraseAt(index);
+  return 1;
+}
+
+template <typename T, typename Hash, typename KeyEqual, typename KeyOfValue,
+          typename Allocator>
+void HashTable<T, Hash, KeyEqual, KeyOfValue, Allocator>::Erase(
+    const_iterator pos) {
+  EraseAt(static_cast<size_type>(pos.GetCtrl() - ctrl_));
+}
+
+// Destroys the elements, the slots are kept
+template <typename T, typename Hash, typename KeyEqual, typename KeyOfValue,
+          typename Allocator>
+void HashTable<T, Hash, KeyEqual, KeyOfValue, Allocator>::Clear() {
+  for (size_type i = 0; i < capacity_; ++i) {
+    if (hash_detail::IsFull(ctrl_[i])) {
+      alloc_traits::destroy(allocator_, slots_ + i);
+    }
+  }
+  if (capacity_ > 0) {
+    std::memset(ctrl_, hash_detail::kEmpty,
+                capacity_ + hash_detail::kGroupWidth);
+  }
+  size_ = 0;
+  growth_left_ = GrowthFor(capacity_);
+}
+
+template <typename T, typename Hash, typename KeyEqual, typename KeyOfValue,
+          typename Allocator>
+void HashTable<T, Hash, KeyEqual, KeyOfValue, Allocator>::Swap(
+    HashTable& other) noexcept {
+  std::swap(ctrl_, other.ctrl_);
+  std::swap(slots_, other.slots_);
+  std::swap(capacity_, other.capacity_);
+  std::swap(size_, other.size_);
+  std::swap(growth_left_, other.growth_left_);
+  std::swap(max_load_factor_, other.max_load_factor_);
+  std::swap(hash_, other.hash_);
+  std::swap(equal_, other.equal_);
+  if constexpr (alloc_traits::propagate_on_container_swap::value) {
+    using std::swap;
+    swap(allocator_, other.allocator_);
+  }
+}
+
+template <typename T, typename Hash, typename KeyEqual, typename KeyOfValue,
+          typename Allocator>
+const Hash&
+HashTable<T, Hash, KeyEqual, KeyOfValue, Allocator>::GetHash() const {
+  return hash_;
+}
+
+template <typename T, typename Hash, typename KeyEqual, typename KeyOfValue,
+          typename Allocator>
+const KeyEqual&
+HashTable<T, Hash, KeyEqual, KeyOfValue, Allocator>::GetKeyEqual() const {
+  return equal_;
+}
+
+template <typename T, typename Hash, typename KeyEqual, typename KeyOfValue,
+          typename Allocator>
+Allocator
+HashTable<T, Hash, KeyEqual, KeyOfValue, Allocator>::GetAllocator() const {
+  return allocator_;
+}
+
+// Counters of the instrumentation mode: comparisons are KeyEqual calls,
+// node visits are probed groups
+template <typename T, typename Hash, typename KeyEqual, typename KeyOfValue,
+          typename Allocator>
+container_stats
+HashTable<T, Hash, KeyEqual, KeyOfValue, Allocator>::GetStats() const {
+  return S21_STATS_GET();
+}
+
+// helpers
+
+template <typename T, typename Hash, typename KeyEqual, typename KeyOfValue,
+          typename Allocator>
+template <typename K>
+size_t HashTable<T, Hash, KeyEqual, KeyOfValue, Allocator>::HashOf(
+    const K& key) const {
+  return hash_detail::Mix(hash_(key));
+}
+
+template <typename T, typename Hash, typename KeyEqual, typename KeyOfValue,
+          typename Allocator>
+const typename HashTable<T, Hash, KeyEqual, KeyOfValue, Allocator>::key_type&
+HashTable<T, Hash, KeyEqual, KeyOfValue, Allocator>::KeyOf(
+    const T& value) const {
+  return KeyOfValue()(value);
+}
+
+// Slot of the element with key, capacity_ if there is none. The high bits
+// of the hash pick the first group (H1), the low seven are matched against
+// the control bytes (H2); groups follow a triangular sequence that visits
+// every group of a power-of-two table
+template <typename T, typename Hash, typename KeyEqual, typename KeyOfValue,
+          typename Allocator>
+template <typename K>
+typename HashTable<T, Hash, KeyEqual, KeyOfValue, Allocator>::size_type
+HashTable<T, Hash, KeyEqual, KeyOfValue, Allocator>::FindIndex(
+    const K& key, size_t hash) const {
+  if (capacity_ == 0) return capacity_;
+  S21_STATS(Lookup());
+  const size_type mask = capacity_ - 1;
+  const ctrl_t h2 = static_cast<ctrl_t>(hash & 0x7f);
+  size_type pos = (hash >> 7) & mask;
+
+  for (size_type step = hash_detail::kGroupWidth;;
+       step += hash_detail::kGroupWidth) {
+    S21_STATS(NodeVisit());
+    hash_detail::Group group(ctrl_ + pos);
+    for (uint32_t match = group.Match(h2); match != 0; match &= match - 1) {
+      size_type index = (pos + hash_detail::TrailingZeros(match)) & mask;
+      S21_STATS(Comparison());
+      if (equal_(key, KeyOf(slots_[index]))) return index;
+    }
+    if (group.MatchEmpty() != 0) return capacity_;
+    pos = (pos + step) & mask;
+  }
+}
+
+// First empty or deleted slot on the probe sequence of hash
+template <typename T, typename Hash, typename KeyEqual, typename KeyOfValue,
+          typename Allocator>
+typename HashTable<T, Hash, KeyEqual, KeyOfValue, Allocator>::size_type
+HashTable<T, Hash, KeyEqual, KeyOfValue, Allocator>::FindFreeSlot(
+    size_t hash) const {
+  const size_type mask = capacity_ - 1;
+  size_type pos = (hash >> 7) & mask;
+
+  for (size_type step = hash_detail::kGroupWidth;;
+       step += hash_detail::kGroupWidth) {
+    uint32_t free = hash_detail::Group(ctrl_ + pos).MatchFree();
+    if (free != 0) return (pos + hash_detail::TrailingZeros(free)) & mask;
+    pos = (pos + step) & mask;
+  }
+}
+
+// Writes a control byte and its copy past the end of the array
+template <typename T, typename Hash, typename KeyEqual, typename KeyOfValue,
+          typename Allocator>
+void HashTable<T, Hash, KeyEqual, KeyOfValue, Allocator>::SetCtrl(
+    size_type index, ctrl_t value) {
+  ctrl_[index] = value;
+  if (index < hash_detail::kGroupWidth) ctrl_[capacity_ + index] = value;
+}
+
+// A freed slot may become empty again only if no probe could have passed
+// over it, i.e. it never sat inside a group without an empty slot; otherwise
+// it is marked deleted so that later probes keep going
+template <typename T, typename Hash, typename KeyEqual, typename KeyOfValue,
+          typename Allocator>
+void HashTable<T, Hash, KeyEqual, KeyOfValue, Allocator>::EraseAt(
+    size_type index) {
+  alloc_traits::destroy(allocator_, slots_ + index);
+  --size_;
+
+  const size_type before = (index - hash_detail::kGroupWidth) & (capacity_ - 1);
+  uint32_t empty_after = hash_detail::Group(ctrl_ + index).MatchEmpty();
+  uint32_t empty_before = hash_detail::Group(ctrl_ + before).MatchEmpty();
+  bool never_full = empty_before != 0 && empty_after != 0 &&
+                    hash_detail::TrailingZeros(empty_after) +
+                            hash_detail::LeadingZeros(empty_before) <
+                        hash_detail::kGroupWidth;
+
+  SetCtrl(index, never_full ? hash_detail::kEmpty : hash_detail::kDeleted);
+  if (never_full) ++growth_left_;
+}
+
+// Smallest power-of-two capacity that holds count elements
+template <typename T, typename Hash, typename KeyEqual, typename KeyOfValue,
+          typename Allocator>
+typename HashTable<T, Hash, KeyEqual, KeyOfValue, Allocator>::size_type
+HashTable<T, Hash, KeyEqual, KeyOfValue, Allocator>::CapacityFor(
+    size_type count) const {
+  if (count == 0) return 0;
+  size_type capacity = hash_detail::kGroupWidth;
+  while (GrowthFor(capacity) < count) capacity *= 2;
+  return capacity;
+}
+
+// Elements a table of capacity slots takes before it grows; one slot always
+// stays empty so that every probe terminates
+template <typename T, typename Hash, typename KeyEqual, typename KeyOfValue,
+          typename Allocator>
+typename HashTable<T, Hash, KeyEqual, KeyOfValue, Allocator>::size_type
+HashTable<T, Hash, KeyEqual, KeyOfValue, Allocator>::GrowthFor(
+    size_type capacity) const {
+  if (capacity == 0) return 0;
+  size_type growth = static_cast<size_type>(capacity * max_load_factor_);
+  return std::min(growth, capacity - 1);
+}
+
+template <typename T, typename Hash, typename KeyEqual, typename KeyOfValue,
+          typename Allocator>
+void HashTable<T, Hash, KeyEqual, KeyOfValue, Allocator>::Resize(
+    size_type capacity) {
+  if (capacity == 0) {
+    Release();
+    return;
+  }
+  Resize(capacity, [](HashTable&) {});
+}
+
+// Moves every element into a fresh table of capacity slots, after emplace
+// has had the empty table to insert into. The elements go into a separate
+// table first, which frees whatever it holds if a copy throws; this table is
+// changed only once all of them are in, and elements whose move may throw
+// are copied, as std::vector does. A Hash that may throw is called for every
+// element before the first one moves, so that it cannot leave moved-from
+// elements behind either
+template <typename T, typename Hash, typename KeyEqual, typename KeyOfValue,
+          typename Allocator>
+template <typename Emplace>
+void HashTable<T, Hash, KeyEqual, KeyOfValue, Allocator>::Resize(
+    size_type capacity, Emplace emplace) {
+  HashTable fresh(0, hash_, equal_, allocator_);
+  fresh.max_load_factor_ = max_load_factor_;
+  fresh.slots_ = alloc_traits::allocate(allocator_, capacity);
+  try {
+    ctrl_allocator ctrl_alloc(allocator_);
+    fresh.ctrl_ = ctrl_traits::allocate(ctrl_alloc,
+                                        capacity + hash_detail::kGroupWidth);
+  } catch (...) {
+    alloc_traits::deallocate(allocator_, fresh.slots_, capacity);
+    throw;
+  }
+  std::memset(fresh.ctrl_, hash_detail::kEmpty,
+              capacity + hash_detail::kGroupWidth);
+  fresh.capacity_ = capacity;
+  fresh.growth_left_ = fresh.GrowthFor(capacity);
+
+  emplace(fresh);
+  if constexpr (std::is_nothrow_invocable_v<const Hash&, const key_type&>) {
+    for (size_type i = 0; i < capacity_; ++i) {
+      if (!hash_detail::IsFull(ctrl_[i])) continue;
+      fresh.Place(HashOf(KeyOf(slots_[i])), std::move_if_noexcept(slots_[i]));
+    }
+  } else if (size_ > 0) {
+    hash_allocator hash_alloc(allocator_);
+    size_t* hashes = hash_traits::allocate(hash_alloc, size_);
+    try {
+      size_type count = 0;
+      for (size_type i = 0; i < capacity_; ++i) {
+        if (hash_detail::IsFull(ctrl_[i])) {
+          hashes[count++] = HashOf(KeyOf(slots_[i]));
+        }
+      }
+      count = 0;
+      for (size_type i = 0; i < capacity_; ++i) {
+        if (!hash_detail::IsFull(ctrl_[i])) continue;
+        fresh.Place(hashes[count++], std::move_if_noexcept(slots_[i]));
+      }
+    } catch (...) {
+      hash_traits::deallocate(hash_alloc, hashes, size_);
+      throw;
+    }
+    hash_traits::deallocate(hash_alloc, hashes, size_);
+  }
+  S21_STATS(Allocation(capacity + hash_detail::kGroupWidth));
+  S21_STATS(Allocation(capacity * sizeof(T)));
+  if (ctrl_ != nullptr) S21_STATS(Reallocation());
+
+  Release();
+  ctrl_ = std::exchange(fresh.ctrl_, nullptr);
+  slots_ = std::exchange(fresh.slots_, nullptr);
+  capacity_ = std::exchange(fresh.capacity_, 0);
+  size_ = std::exchange(fresh.size_, 0);
+  growth_left_ = GrowthFor(capacity_) - size_;
+}
+
+// Destroys the elements and frees both arrays
+template <typename T, typename Hash, typename KeyEqual, typename KeyOfValue,
+          typename Allocator>
+void HashTable<T, Hash, KeyEqual, KeyOfValue, Allocator>::Release() {
+  if (ctrl_ == nullptr) return;
+  for (size_type i = 0; i < capacity_; ++i) {
+    if (hash_detail::IsFull(ctrl_[i])) {
+      alloc_traits::destroy(allocator_, slots_ + i);
+    }
+  }
+  ctrl_allocator ctrl_alloc(allocator_);
+  ctrl_traits::deallocate(ctrl_alloc, ctrl_,
+                          capacity_ + hash_detail::kGroupWidth);
+  alloc_traits::deallocate(allocator_, slots_, capacity_);
+  S21_STATS(Deallocation());
+  S21_STATS(Deallocation());
+
+  ctrl_ = nullptr;
+  slots_ = nullptr;
+  capacity_ = 0;
+  size_ = 0;
+  growth_left_ = 0;
+}
+
+// Takes over the arrays and the settings of other; the allocators must be
+// equal
+template <typename T, typename Hash, typename KeyEqual, typename KeyOfValue,
+          typename Allocator>
+void HashTable<T, Hash, KeyEqual, KeyOfValue, Allocator>::Adopt(
+    HashTable& other) {
+  ctrl_ = std::exchange(other.ctrl_, nullptr);
+  slots_ = std::exchange(other.slots_, nullptr);
+  capacity_ = std::exchange(other.capacity_, 0);
+  size_ = std::exchange(other.size_, 0);
+  growth_left_ = std::exchange(other.growth_left_, 0);
+  max_load_factor_ = other.max_load_factor_;
+  hash_ = other.hash_;
+  equal_ = other.equal_;
+}
+
+// Constructs an element known to be absent into the first free slot of its
+// probe sequence and returns the slot; the caller has reserved room for it
+template <typename T, typename Hash, typename KeyEqual, typename KeyOfValue,
+          typename Allocator>
+template <typename... Args>
+typename HashTable<T, Hash, KeyEqual, KeyOfValue, Allocator>::size_type
+HashTable<T, Hash, KeyEqual, KeyOfValue, Allocator>::Place(size_t hash,
+                                                           Args&&... args) {
+  size_type index = FindFreeSlot(hash);
+  alloc_traits::construct(allocator_, slots_ + index,
+                          std::forward<Args>(args)...);
+  SetCtrl(index, static_cast<ctrl_t>(hash & 0x7f));
+  ++size_;
+  --growth_left_;
+  return index;
+}
+
+}  // namespace s21
+
+#endif
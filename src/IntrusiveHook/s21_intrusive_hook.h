@@ -0,0 +1,64 @@
+#ifndef S21_CONTAINERS_INTRUSIVE_HOOK_H
+#define S21_CONTAINERS_INTRUSIVE_HOOK_H
+
+namespace s21 {
+// How intrusive containers treat the hooks of their elements:
+// - safe: inserting an element that is already linked throws
+//   std::invalid_argument, and erasing, clearing or destroying the container
+//   resets the hooks, so is_linked() can always be trusted;
+// - normal: neither check nor reset, hooks of removed elements keep stale
+//   links and is_linked() is meaningless.
+enum class link_mode { normal, safe };
+
+template <typename T>
+class list_hook;
+template <typename T>
+class set_hook;
+template <typename T, list_hook<T> T::*Hook, link_mode Mode>
+class intrusive_list;
+template <typename T, set_hook<T> T::*Hook, typename Compare, link_mode Mode>
+class intrusive_set;
+
+// Links of an object in an intrusive_list, embedded as a member of the
+// object. A linked hook points to its neighbours in a ring; a copied object
+// gets a fresh unlinked hook rather than its source's links
+template <typename T>
+class list_hook {
+ public:
+  list_hook() = default;
+  list_hook(const list_hook&) {}
+  list_hook& operator=(const list_hook&) { return *this; }
+
+  bool is_linked() const { return next_ != nullptr; }
+
+ private:
+  template <typename U, list_hook<U> U::*, link_mode>
+  friend class intrusive_list;
+
+  T* prev_ = nullptr;
+  T* next_ = nullptr;
+};
+
+// Links of an object in an intrusive_set, an AVL tree node embedded in the
+// object. Height zero marks an unlinked hook
+template <typename T>
+class set_hook {
+ public:
+  set_hook() = default;
+  set_hook(const set_hook&) {}
+  set_hook& operator=(const set_hook&) { return *this; }
+
+  bool is_linked() const { return height_ != 0; }
+
+ private:
+  template <typename U, set_hook<U> U::*, typename, link_mode>
+  friend class intrusive_set;
+
+  T* left_ = nullptr;
+  T* right_ = nullptr;
+  T* parent_ = nullptr;
+  int height_ = 0;
+};
+}  // namespace s21
+
+#endif
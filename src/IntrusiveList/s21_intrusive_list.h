@@ -0,0 +1,149 @@
+#ifndef S21_CONTAINERS_INTRUSIVE_LIST_H
+#define S21_CONTAINERS_INTRUSIVE_LIST_H
+
+#include <cstddef>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+
+#include "../IntrusiveHook/s21_intrusive_hook.h"
+
+namespace s21 {
+// Doubly linked list of objects owned elsewhere, e.g. in an arena. The links
+// live in a list_hook member of the object, named by Hook, so inserting and
+// erasing never allocate and never copy an element. An object with several
+// hooks can be in as many lists at once.
+//
+// Elements must stay alive and in place while linked. Linked elements form
+// a ring through their hooks, which keeps every hook of a linked element
+// non-null and lets the list start anywhere.
+template <typename T, list_hook<T> T::*Hook, link_mode Mode = link_mode::safe>
+class intrusive_list {
+ public:
+  template <bool IsConst>
+  class ListIterator;
+
+  // member type
+  using value_type = T;
+  using reference = T&;
+  using const_reference = const T&;
+  using iterator = ListIterator<false>;
+  using const_iterator = ListIterator<true>;
+  using size_type = size_t;
+
+  // functions
+  intrusive_list();
+  intrusive_list(const intrusive_list&) = delete;
+  intrusive_list(intrusive_list&& other) noexcept;
+  intrusive_list& operator=(const intrusive_list&) = delete;
+  intrusive_list& operator=(intrusive_list&& other) noexcept;
+  // Unlinks the elements in safe mode; they are never destroyed
+  ~intrusive_list();
+
+  // element access, std::out_of_range on an empty list
+  reference front();
+  const_reference front() const;
+  reference back();
+  const_reference back() const;
+
+  // iterators
+  iterator begin();
+  iterator end();
+  const_iterator begin() const;
+  const_iterator end() const;
+  // Iterator to a linked element, in O(1)
+  iterator iterator_to(reference value);
+  const_iterator iterator_to(const_reference value) const;
+
+  // capacity
+  bool empty() const;
+  size_type size() const;
+
+  // modifiers, all O(1) but clear
+  void push_front(reference value);
+  void push_back(reference value);
+  void pop_front();
+  void pop_back();
+  // Links value before pos and returns an iterator to it
+  iterator insert(iterator pos, reference value);
+  // Unlinks the element at pos and returns the iterator after it
+  iterator erase(iterator pos);
+  void clear();
+  void swap(intrusive_list& other) noexcept;
+
+ private:
+  T* head_;
+  size_type size_;
+
+  static list_hook<T>& HookOf(const T* value) {
+    return const_cast<T*>(value)->*Hook;
+  }
+  void LinkBefore(T* next, T* value);
+  void Unlink(T* value);
+};
+
+template <typename T, list_hook<T> T::*Hook, link_mode Mode>
+template <bool IsConst>
+class intrusive_list<T, Hook, Mode>::ListIterator {
+ public:
+  // member type
+  using value_type = T;
+  using reference = typename std::conditional<IsConst, const T&, T&>::type;
+  using pointer = typename std::conditional<IsConst, const T*, T*>::type;
+  using difference_type = std::ptrdiff_t;
+  using iterator_category = std::bidirectional_iterator_tag;
+  using container_pointer =
+      typename std::conditional<IsConst, const intrusive_list*,
+                                intrusive_list*>::type;
+
+  // constructor
+  ListIterator() : list_(nullptr), node_(nullptr) {}
+  ListIterator(container_pointer owner, T* node) : list_(owner), node_(node) {}
+  operator ListIterator<true>() const {
+    return ListIterator<true>(list_, node_);
+  }
+
+  // operators
+  reference operator*() const { return *node_; }
+  pointer operator->() const { return node_; }
+
+  // The element after the last is end(), a null node; end() steps back to
+  // the last element
+  ListIterator& operator++() {
+    node_ = HookOf(node_).next_;
+    if (node_ == list_->head_) node_ = nullptr;
+    return *this;
+  }
+  ListIterator operator++(int) {
+    ListIterator temp = *this;
+    ++*this;
+    return temp;
+  }
+  ListIterator& operator--() {
+    node_ = HookOf(node_ != nullptr ? node_ : list_->head_).prev_;
+    return *this;
+  }
+  ListIterator operator--(int) {
+    ListIterator temp = *this;
+    --*this;
+    return temp;
+  }
+
+  bool operator==(const ListIterator& other) const {
+    return node_ == other.node_;
+  }
+  bool operator!=(const ListIterator& other) const {
+    return node_ != other.node_;
+  }
+
+  T* GetNode() const { return node_; }
+
+ private:
+  container_pointer list_;
+  T* node_;
+};
+}  // namespace s21
+
+#include "s21_intrusive_list.tpp"
+
+#endif
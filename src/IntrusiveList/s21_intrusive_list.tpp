@@ -0,0 +1,214 @@
+#ifndef S21_CONTAINERS_INTRUSIVE_LIST_TPP
+#define S21_CONTAINERS_INTRUSIVE_LIST_TPP
+
+#include <utility>
+
+namespace s21 {
+
+// functions
+
+template <typename T, list_hook<T> T::*Hook, link_mode Mode>
+intrusive_list<T, Hook, Mode>::intrusive_list() : head_(nullptr), size_(0) {}
+
+template <typename T, list_hook<T> T::*Hook, link_mode Mode>
+intrusive_list<T, Hook, Mode>::intrusive_list(intrusive_list&& other) noexcept
+    : intrusive_list() {
+  swap(other);
+}
+
+template <typename T, list_hook<T> T::*Hook, link_mode Mode>
+intrusive_list<T, Hook, Mode>& intrusive_list<T, Hook, Mode>::operator=(
+    intrusive_list&& other) noexcept {
+  if (this != &other) {
+    clear();
+    swap(other);
+  }
+  return *this;
+}
+
+template <typename T, list_hook<T> T::*Hook, link_mode Mode>
+intrusive_list<T, Hook, Mode>::~intrusive_list() {
+  if (Mode == link_mode::safe) clear();
+}
+
+// element access
+
+template <typename T, list_hook<T> T::*Hook, link_mode Mode>
+typename intrusive_list<T, Hook, Mode>::reference
+intrusive_list<T, Hook, Mode>::front() {
+  if (empty()) throw std::out_of_range("List is empty");
+  return *head_;
+}
+
+template <typename T, list_hook<T> T::*Hook, link_mode Mode>
+typename intrusive_list<T, Hook, Mode>::const_reference
+intrusive_list<T, Hook, Mode>::front() const {
+  if (empty()) throw std::out_of_range("List is empty");
+  return *head_;
+}
+
+template <typename T, list_hook<T> T::*Hook, link_mode Mode>
+typename intrusive_list<T, Hook, Mode>::reference
+intrusive_list<T, Hook, Mode>::back() {
+  if (empty()) throw std::out_of_range("List is empty");
+  return *HookOf(head_).prev_;
+}
+
+template <typename T, list_hook<T> T::*Hook, link_mode Mode>
+typename intrusive_list<T, Hook, Mode>::const_reference
+intrusive_list<T, Hook, Mode>::back() const {
+  if (empty()) throw std::out_of_range("List is empty");
+  return *HookOf(head_).prev_;
+}
+
+// iterators
+
+template <typename T, list_hook<T> T::*Hook, link_mode Mode>
+typename intrusive_list<T, Hook, Mode>::iterator
+intrusive_list<T, Hook, Mode>::begin() {
+  return iterator(this, head_);
+}
+
+template <typename T, list_hook<T> T::*Hook, link_mode Mode>
+typename intrusive_list<T, Hook, Mode>::iterator
+intrusive_list<T, Hook, Mode>::end() {
+  return iterator(this, nullptr);
+}
+
+template <typename T, list_hook<T> T::*Hook, link_mode Mode>
+typename intrusive_list<T, Hook, Mode>::const_iterator
+intrusive_list<T, Hook, Mode>::begin() const {
+  return const_iterator(this, head_);
+}
+
+template <typename T, list_hook<T> T::*Hook, link_mode Mode>
+typename intrusive_list<T, Hook, Mode>::const_iterator
+intrusive_list<T, Hook, Mode>::end() const {
+  return const_iterator(this, nullptr);
+}
+
+template <typename T, list_hook<T> T::*Hook, link_mode Mode>
+typename intrusive_list<T, Hook, Mode>::iterator
+intrusive_list<T, Hook, Mode>::iterator_to(reference value) {
+  return iterator(this, &value);
+}
+
+template <typename T, list_hook<T> T::*Hook, link_mode Mode>
+typename intrusive_list<T, Hook, Mode>::const_iterator
+intrusive_list<T, Hook, Mode>::iterator_to(const_reference value) const {
+  return const_iterator(this, const_cast<T*>(&value));
+}
+
+// capacity
+
+template <typename T, list_hook<T> T::*Hook, link_mode Mode>
+bool intrusive_list<T, Hook, Mode>::empty() const {
+  return size_ == 0;
+}
+
+template <typename T, list_hook<T> T::*Hook, link_mode Mode>
+typename intrusive_list<T, Hook, Mode>::size_type
+intrusive_list<T, Hook, Mode>::size() const {
+  return size_;
+}
+
+// modifiers
+
+template <typename T, list_hook<T> T::*Hook, link_mode Mode>
+void intrusive_list<T, Hook, Mode>::push_front(reference value) {
+  LinkBefore(head_, &value);
+  head_ = &value;
+}
+
+template <typename T, list_hook<T> T::*Hook, link_mode Mode>
+void intrusive_list<T, Hook, Mode>::push_back(reference value) {
+  LinkBefore(head_, &value);
+}
+
+template <typename T, list_hook<T> T::*Hook, link_mode Mode>
+void intrusive_list<T, Hook, Mode>::pop_front() {
+  if (empty()) throw std::out_of_range("List is empty");
+  Unlink(head_);
+}
+
+template <typename T, list_hook<T> T::*Hook, link_mode Mode>
+void intrusive_list<T, Hook, Mode>::pop_back() {
+  if (empty()) throw std::out_of_range("List is empty");
+  Unlink(HookOf(head_).prev_);
+}
+
+template <typename T, list_hook<T> T::*Hook, link_mode Mode>
+typename intrusive_list<T, Hook, Mode>::iterator
+intrusive_list<T, Hook, Mode>::insert(iterator pos, reference value) {
+  LinkBefore(pos.GetNode() != nullptr ? pos.GetNode() : head_, &value);
+  if (pos.GetNode() == head_) head_ = &value;
+  return iterator(this, &value);
+}
+
+template <typename T, list_hook<T> T::*Hook, link_mode Mode>
+typename intrusive_list<T, Hook, Mode>::iterator
+intrusive_list<T, Hook, Mode>::erase(iterator pos) {
+  iterator next = pos;
+  ++next;
+  Unlink(pos.GetNode());
+  return next;
+}
+
+template <typename T, list_hook<T> T::*Hook, link_mode Mode>
+void intrusive_list<T, Hook, Mode>::clear() {
+  if (Mode == link_mode::safe) {
+    for (size_type i = 0; i < size_; ++i) {
+      T* next = HookOf(head_).next_;
+      HookOf(head_).prev_ = HookOf(head_).next_ = nullptr;
+      head_ = next;
+    }
+  }
+  head_ = nullptr;
+  size_ = 0;
+}
+
+template <typename T, list_hook<T> T::*Hook, link_mode Mode>
+void intrusive_list<T, Hook, Mode>::swap(intrusive_list& other) noexcept {
+  std::swap(head_, other.head_);
+  std::swap(size_, other.size_);
+}
+
+// helpers
+
+// Links value before next in the ring, at the back when next is the head;
+// a null next starts the ring
+template <typename T, list_hook<T> T::*Hook, link_mode Mode>
+void intrusive_list<T, Hook, Mode>::LinkBefore(T* next, T* value) {
+  list_hook<T>& hook = HookOf(value);
+  if (Mode == link_mode::safe && hook.is_linked()) {
+    throw std::invalid_argument("Element is already linked");
+  }
+  if (next == nullptr) {
+    hook.prev_ = hook.next_ = value;
+    head_ = value;
+  } else {
+    T* prev = HookOf(next).prev_;
+    hook.prev_ = prev;
+    hook.next_ = next;
+    HookOf(prev).next_ = value;
+    HookOf(next).prev_ = value;
+  }
+  ++size_;
+}
+
+template <typename T, list_hook<T> T::*Hook, link_mode Mode>
+void intrusive_list<T, Hook, Mode>::Unlink(T* value) {
+  list_hook<T>& hook = HookOf(value);
+  if (--size_ == 0) {
+    head_ = nullptr;
+  } else {
+    HookOf(hook.prev_).next_ = hook.next_;
+    HookOf(hook.next_).prev_ = hook.prev_;
+    if (head_ == value) head_ = hook.next_;
+  }
+  if (Mode == link_mode::safe) hook.prev_ = hook.next_ = nullptr;
+}
+
+}  // namespace s21
+
+#endif
@@ -0,0 +1,186 @@
+#ifndef S21_CONTAINERS_INTRUSIVE_SET_H
+#define S21_CONTAINERS_INTRUSIVE_SET_H
+
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "../IntrusiveHook/s21_intrusive_hook.h"
+#include "../Prefetch/s21_prefetch.h"
+
+namespace s21 {
+// Ordered set of objects owned elsewhere, with unique keys: an AVL tree
+// whose nodes are set_hook members of the objects, named by Hook. Inserting
+// and erasing relink hooks and never allocate or copy an element, so an
+// arena of objects can be indexed in place, by several sets at once through
+// several hooks.
+//
+// Elements are ordered by Compare on the whole object. Lookups are
+// templates: any key Compare accepts against T on either side can be
+// searched for. An element's key must not change while it is linked.
+template <typename T, set_hook<T> T::*Hook, typename Compare = std::less<T>,
+          link_mode Mode = link_mode::safe>
+class intrusive_set {
+ public:
+  template <bool IsConst>
+  class SetIterator;
+
+  // member type
+  using key_type = T;
+  using value_type = T;
+  using reference = T&;
+  using const_reference = const T&;
+  using key_compare = Compare;
+  using iterator = SetIterator<false>;
+  using const_iterator = SetIterator<true>;
+  using size_type = size_t;
+
+  // functions
+  intrusive_set();
+  explicit intrusive_set(const Compare& comp);
+  intrusive_set(const intrusive_set&) = delete;
+  intrusive_set(intrusive_set&& other) noexcept;
+  intrusive_set& operator=(const intrusive_set&) = delete;
+  intrusive_set& operator=(intrusive_set&& other) noexcept;
+  // Unlinks the elements in safe mode; they are never destroyed
+  ~intrusive_set();
+
+  // iterators
+  iterator begin();
+  iterator end();
+  const_iterator begin() const;
+  const_iterator end() const;
+  // Iterator to a linked element, in O(1)
+  iterator iterator_to(reference value);
+  const_iterator iterator_to(const_reference value) const;
+
+  // capacity
+  bool empty() const;
+  size_type size() const;
+
+  // modifiers
+  // Links value unless an equivalent element is linked; returns the
+  // iterator to the element with its key and whether value was linked
+  std::pair<iterator, bool> insert(reference value);
+  // Unlinks the element at pos and returns the iterator after it
+  iterator erase(iterator pos);
+  template <typename K>
+  size_type erase(const K& key);
+  // O(n) in safe mode, which resets every hook, O(1) otherwise
+  void clear();
+  void swap(intrusive_set& other) noexcept;
+
+  // lookup, one descent each
+  template <typename K>
+  bool contains(const K& key) const;
+  template <typename K>
+  iterator find(const K& key);
+  template <typename K>
+  const_iterator find(const K& key) const;
+  template <typename K>
+  iterator lower_bound(const K& key);
+  template <typename K>
+  iterator upper_bound(const K& key);
+
+  // observers
+  key_compare key_comp() const;
+  // Height of the tree, at most 1.44 log2(n + 2)
+  int height() const;
+
+ private:
+  T* root_;
+  size_type size_;
+  Compare comp_;
+
+  static set_hook<T>& HookOf(const T* value) {
+    return const_cast<T*>(value)->*Hook;
+  }
+  static int Height(const T* node) {
+    return node != nullptr ? HookOf(node).height_ : 0;
+  }
+  static T* First(T* node);
+  static T* Last(T* node);
+  static T* Next(T* node);
+  static T* Prev(T* node);
+
+  template <typename K>
+  T* Find(const K& key) const;
+  template <typename K>
+  T* LowerBound(const K& key) const;
+  template <typename K>
+  T* UpperBound(const K& key) const;
+
+  void UpdateHeight(T* node);
+  void ReplaceChild(T* parent, T* child, T* replacement);
+  T* RotateLeft(T* node);
+  T* RotateRight(T* node);
+  T* Balance(T* node);
+  void Rebalance(T* node);
+  void Unlink(T* node);
+  static void ResetHook(set_hook<T>& hook);
+};
+
+template <typename T, set_hook<T> T::*Hook, typename Compare, link_mode Mode>
+template <bool IsConst>
+class intrusive_set<T, Hook, Compare, Mode>::SetIterator {
+ public:
+  // member type
+  using value_type = T;
+  using reference = typename std::conditional<IsConst, const T&, T&>::type;
+  using pointer = typename std::conditional<IsConst, const T*, T*>::type;
+  using difference_type = std::ptrdiff_t;
+  using iterator_category = std::bidirectional_iterator_tag;
+  using container_pointer =
+      typename std::conditional<IsConst, const intrusive_set*,
+                                intrusive_set*>::type;
+
+  // constructor
+  SetIterator() : set_(nullptr), node_(nullptr) {}
+  SetIterator(container_pointer owner, T* node) : set_(owner), node_(node) {}
+  operator SetIterator<true>() const { return SetIterator<true>(set_, node_); }
+
+  // operators
+  reference operator*() const { return *node_; }
+  pointer operator->() const { return node_; }
+
+  // end() is a null node, which steps back to the last element
+  SetIterator& operator++() {
+    node_ = Next(node_);
+    return *this;
+  }
+  SetIterator operator++(int) {
+    SetIterator temp = *this;
+    node_ = Next(node_);
+    return temp;
+  }
+  SetIterator& operator--() {
+    node_ = node_ != nullptr ? Prev(node_) : Last(set_->root_);
+    return *this;
+  }
+  SetIterator operator--(int) {
+    SetIterator temp = *this;
+    --*this;
+    return temp;
+  }
+
+  bool operator==(const SetIterator& other) const {
+    return node_ == other.node_;
+  }
+  bool operator!=(const SetIterator& other) const {
+    return node_ != other.node_;
+  }
+
+  T* GetNode() const { return node_; }
+
+ private:
+  container_pointer set_;
+  T* node_;
+};
+}  // namespace s21
+
+#include "s21_intrusive_set.tpp"
+
+#endif
@@ -0,0 +1,422 @@
+#ifndef S21_CONTAINERS_INTRUSIVE_SET_TPP
+#define S21_CONTAINERS_INTRUSIVE_SET_TPP
+
+#include <utility>
+
+namespace s21 {
+
+// functions
+
+template <typename T, set_hook<T> T::*Hook, typename Compare, link_mode Mode>
+intrusive_set<T, Hook, Compare, Mode>::intrusive_set()
+    : intrusive_set(Compare()) {}
+
+template <typename T, set_hook<T> T::*Hook, typename Compare, link_mode Mode>
+intrusive_set<T, Hook, Compare, Mode>::intrusive_set(const Compare& comp)
+    : root_(nullptr), size_(0), comp_(comp) {}
+
+template <typename T, set_hook<T> T::*Hook, typename Compare, link_mode Mode>
+intrusive_set<T, Hook, Compare, Mode>::intrusive_set(
+    intrusive_set&& other) noexcept
+    : intrusive_set(other.comp_) {
+  swap(other);
+}
+
+template <typename T, set_hook<T> T::*Hook, typename Compare, link_mode Mode>
+intrusive_set<T, Hook, Compare, Mode>&
+intrusive_set<T, Hook, Compare, Mode>::operator=(
+    intrusive_set&& other) noexcept {
+  if (this != &other) {
+    clear();
+    swap(other);
+  }
+  return *this;
+}
+
+template <typename T, set_hook<T> T::*Hook, typename Compare, link_mode Mode>
+intrusive_set<T, Hook, Compare, Mode>::~intrusive_set() {
+  if (Mode == link_mode::safe) clear();
+}
+
+// iterators
+
+template <typename T, set_hook<T> T::*Hook, typename Compare, link_mode Mode>
+typename intrusive_set<T, Hook, Compare, Mode>::iterator
+intrusive_set<T, Hook, Compare, Mode>::begin() {
+  return iterator(this, First(root_));
+}
+
+template <typename T, set_hook<T> T::*Hook, typename Compare, link_mode Mode>
+typename intrusive_set<T, Hook, Compare, Mode>::iterator
+intrusive_set<T, Hook, Compare, Mode>::end() {
+  return iterator(this, nullptr);
+}
+
+template <typename T, set_hook<T> T::*Hook, typename Compare, link_mode Mode>
+typename intrusive_set<T, Hook, Compare, Mode>::const_iterator
+intrusive_set<T, Hook, Compare, Mode>::begin() const {
+  return const_iterator(this, First(root_));
+}
+
+template <typename T, set_hook<T> T::*Hook, typename Compare, link_mode Mode>
+typename intrusive_set<T, Hook, Compare, Mode>::const_iterator
+intrusive_set<T, Hook, Compare, Mode>::end() const {
+  return const_iterator(this, nullptr);
+}
+
+template <typename T, set_hook<T> T::*Hook, typename Compare, link_mode Mode>
+typename intrusive_set<T, Hook, Compare, Mode>::iterator
+intrusive_set<T, Hook, Compare, Mode>::iterator_to(reference value) {
+  return iterator(this, &value);
+}
+
+template <typename T, set_hook<T> T::*Hook, typename Compare, link_mode Mode>
+typename intrusive_set<T, Hook, Compare, Mode>::const_iterator
+intrusive_set<T, Hook, Compare, Mode>::iterator_to(
+    const_reference value) const {
+  return const_iterator(this, const_cast<T*>(&value));
+}
+
+// capacity
+
+template <typename T, set_hook<T> T::*Hook, typename Compare, link_mode Mode>
+bool intrusive_set<T, Hook, Compare, Mode>::empty() const {
+  return size_ == 0;
+}
+
+template <typename T, set_hook<T> T::*Hook, typename Compare, link_mode Mode>
+typename intrusive_set<T, Hook, Compare, Mode>::size_type
+intrusive_set<T, Hook, Compare, Mode>::size() const {
+  return size_;
+}
+
+// modifiers
+
+template <typename T, set_hook<T> T::*Hook, typename Compare, link_mode Mode>
+std::pair<typename intrusive_set<T, Hook, Compare, Mode>::iterator, bool>
+intrusive_set<T, Hook, Compare, Mode>::insert(reference value) {
+  set_hook<T>& hook = HookOf(&value);
+  if (Mode == link_mode::safe && hook.is_linked()) {
+    throw std::invalid_argument("Element is already linked");
+  }
+  T* parent = nullptr;
+  T** link = &root_;
+  while (*link != nullptr) {
+    parent = *link;
+    if (comp_(value, *parent)) {
+      link = &HookOf(parent).left_;
+    } else if (comp_(*parent, value)) {
+      link = &HookOf(parent).right_;
+    } else {
+      return std::make_pair(iterator(this, parent), false);
+    }
+  }
+  hook.left_ = hook.right_ = nullptr;
+  hook.parent_ = parent;
+  hook.height_ = 1;
+  *link = &value;
+  ++size_;
+  Rebalance(parent);
+  return std::make_pair(iterator(this, &value), true);
+}
+
+template <typename T, set_hook<T> T::*Hook, typename Compare, link_mode Mode>
+typename intrusive_set<T, Hook, Compare, Mode>::iterator
+intrusive_set<T, Hook, Compare, Mode>::erase(iterator pos) {
+  T* node = pos.GetNode();
+  iterator next(this, Next(node));
+  Unlink(node);
+  return next;
+}
+
+template <typename T, set_hook<T> T::*Hook, typename Compare, link_mode Mode>
+template <typename K>
+typename intrusive_set<T, Hook, Compare, Mode>::size_type
+intrusive_set<T, Hook, Compare, Mode>::erase(const K& key) {
+  T* node = Find(key);
+  if (node == nullptr) return 0;
+  Unlink(node);
+  return 1;
+}
+
+// Resets the hooks in preorder, reading both children before the reset, so
+// every element is touched once; the stack holds pending right subtrees
+template <typename T, set_hook<T> T::*Hook, typename Compare, link_mode Mode>
+void intrusive_set<T, Hook, Compare, Mode>::clear() {
+  if (Mode == link_mode::safe) {
+    // An AVL tree of n nodes is at most 1.44 log2(n) high
+    T* pending[128];
+    int depth = 0;
+    T* node = root_;
+    while (node != nullptr || depth > 0) {
+      if (node == nullptr) node = pending[--depth];
+      set_hook<T>& hook = HookOf(node);
+      if (hook.right_ != nullptr) {
+        S21_PREFETCH(hook.right_);
+        pending[depth++] = hook.right_;
+      }
+      node = hook.left_;
+      ResetHook(hook);
+    }
+  }
+  root_ = nullptr;
+  size_ = 0;
+}
+
+template <typename T, set_hook<T> T::*Hook, typename Compare, link_mode Mode>
+void intrusive_set<T, Hook, Compare, Mode>::swap(
+    intrusive_set& other) noexcept {
+  std::swap(root_, other.root_);
+  std::swap(size_, other.size_);
+  std::swap(comp_, other.comp_);
+}
+
+// lookup
+
+template <typename T, set_hook<T> T::*Hook, typename Compare, link_mode Mode>
+template <typename K>
+bool intrusive_set<T, Hook, Compare, Mode>::contains(const K& key) const {
+  return Find(key) != nullptr;
+}
+
+template <typename T, set_hook<T> T::*Hook, typename Compare, link_mode Mode>
+template <typename K>
+typename intrusive_set<T, Hook, Compare, Mode>::iterator
+intrusive_set<T, Hook, Compare, Mode>::find(const K& key) {
+  return iterator(this, Find(key));
+}
+
+template <typename T, set_hook<T> T::*Hook, typename Compare, link_mode Mode>
+template <typename K>
+typename intrusive_set<T, Hook, Compare, Mode>::const_iterator
+intrusive_set<T, Hook, Compare, Mode>::find(const K& key) const {
+  return const_iterator(this, Find(key));
+}
+
+template <typename T, set_hook<T> T::*Hook, typename Compare, link_mode Mode>
+template <typename K>
+typename intrusive_set<T, Hook, Compare, Mode>::iterator
+intrusive_set<T, Hook, Compare, Mode>::lower_bound(const K& key) {
+  return iterator(this, LowerBound(key));
+}
+
+template <typename T, set_hook<T> T::*Hook, typename Compare, link_mode Mode>
+template <typename K>
+typename intrusive_set<T, Hook, Compare, Mode>::iterator
+intrusive_set<T, Hook, Compare, Mode>::upper_bound(const K& key) {
+  return iterator(this, UpperBound(key));
+}
+
+// observers
+
+template <typename T, set_hook<T> T::*Hook, typename Compare, link_mode Mode>
+typename intrusive_set<T, Hook, Compare, Mode>::key_compare
+intrusive_set<T, Hook, Compare, Mode>::key_comp() const {
+  return comp_;
+}
+
+template <typename T, set_hook<T> T::*Hook, typename Compare, link_mode Mode>
+int intrusive_set<T, Hook, Compare, Mode>::height() const {
+  return Height(root_);
+}
+
+// helpers
+
+template <typename T, set_hook<T> T::*Hook, typename Compare, link_mode Mode>
+T* intrusive_set<T, Hook, Compare, Mode>::First(T* node) {
+  if (node != nullptr) {
+    while (HookOf(node).left_ != nullptr) node = HookOf(node).left_;
+  }
+  return node;
+}
+
+template <typename T, set_hook<T> T::*Hook, typename Compare, link_mode Mode>
+T* intrusive_set<T, Hook, Compare, Mode>::Last(T* node) {
+  if (node != nullptr) {
+    while (HookOf(node).right_ != nullptr) node = HookOf(node).right_;
+  }
+  return node;
+}
+
+template <typename T, set_hook<T> T::*Hook, typename Compare, link_mode Mode>
+T* intrusive_set<T, Hook, Compare, Mode>::Next(T* node) {
+  if (HookOf(node).right_ != nullptr) return First(HookOf(node).right_);
+  T* parent = HookOf(node).parent_;
+  while (parent != nullptr && node == HookOf(parent).right_) {
+    node = parent;
+    parent = HookOf(parent).parent_;
+  }
+  return parent;
+}
+
+template <typename T, set_hook<T> T::*Hook, typename Compare, link_mode Mode>
+T* intrusive_set<T, Hook, Compare, Mode>::Prev(T* node) {
+  if (HookOf(node).left_ != nullptr) return Last(HookOf(node).left_);
+  T* parent = HookOf(node).parent_;
+  while (parent != nullptr && node == HookOf(parent).left_) {
+    node = parent;
+    parent = HookOf(parent).parent_;
+  }
+  return parent;
+}
+
+template <typename T, set_hook<T> T::*Hook, typename Compare, link_mode Mode>
+template <typename K>
+T* intrusive_set<T, Hook, Compare, Mode>::Find(const K& key) const {
+  T* node = LowerBound(key);
+  return node != nullptr && !comp_(key, *node) ? node : nullptr;
+}
+
+template <typename T, set_hook<T> T::*Hook, typename Compare, link_mode Mode>
+template <typename K>
+T* intrusive_set<T, Hook, Compare, Mode>::LowerBound(const K& key) const {
+  T* result = nullptr;
+  for (T* node = root_; node != nullptr;) {
+    if (comp_(*node, key)) {
+      node = HookOf(node).right_;
+    } else {
+      result = node;
+      node = HookOf(node).left_;
+    }
+  }
+  return result;
+}
+
+template <typename T, set_hook<T> T::*Hook, typename Compare, link_mode Mode>
+template <typename K>
+T* intrusive_set<T, Hook, Compare, Mode>::UpperBound(const K& key) const {
+  T* result = nullptr;
+  for (T* node = root_; node != nullptr;) {
+    if (comp_(key, *node)) {
+      result = node;
+      node = HookOf(node).left_;
+    } else {
+      node = HookOf(node).right_;
+    }
+  }
+  return result;
+}
+
+template <typename T, set_hook<T> T::*Hook, typename Compare, link_mode Mode>
+void intrusive_set<T, Hook, Compare, Mode>::UpdateHeight(T* node) {
+  set_hook<T>& hook = HookOf(node);
+  int left = Height(hook.left_);
+  int right = Height(hook.right_);
+  hook.height_ = (left > right ? left : right) + 1;
+}
+
+// Puts replacement, which may be null, where child hung below parent
+template <typename T, set_hook<T> T::*Hook, typename Compare, link_mode Mode>
+void intrusive_set<T, Hook, Compare, Mode>::ReplaceChild(T* parent, T* child,
+                                                          T* replacement) {
+  if (parent == nullptr) {
+    root_ = replacement;
+  } else if (HookOf(parent).left_ == child) {
+    HookOf(parent).left_ = replacement;
+  } else {
+    HookOf(parent).right_ = replacement;
+  }
+  if (replacement != nullptr) HookOf(replacement).parent_ = parent;
+}
+
+template <typename T, set_hook<T> T::*Hook, typename Compare, link_mode Mode>
+T* intrusive_set<T, Hook, Compare, Mode>::RotateLeft(T* node) {
+  set_hook<T>& hook = HookOf(node);
+  T* pivot = hook.right_;
+  set_hook<T>& pivot_hook = HookOf(pivot);
+  ReplaceChild(hook.parent_, node, pivot);
+  hook.right_ = pivot_hook.left_;
+  if (hook.right_ != nullptr) HookOf(hook.right_).parent_ = node;
+  pivot_hook.left_ = node;
+  hook.parent_ = pivot;
+  UpdateHeight(node);
+  UpdateHeight(pivot);
+  return pivot;
+}
+
+template <typename T, set_hook<T> T::*Hook, typename Compare, link_mode Mode>
+T* intrusive_set<T, Hook, Compare, Mode>::RotateRight(T* node) {
+  set_hook<T>& hook = HookOf(node);
+  T* pivot = hook.left_;
+  set_hook<T>& pivot_hook = HookOf(pivot);
+  ReplaceChild(hook.parent_, node, pivot);
+  hook.left_ = pivot_hook.right_;
+  if (hook.left_ != nullptr) HookOf(hook.left_).parent_ = node;
+  pivot_hook.right_ = node;
+  hook.parent_ = pivot;
+  UpdateHeight(node);
+  UpdateHeight(pivot);
+  return pivot;
+}
+
+// Restores the AVL balance at node, returns the root of its subtree
+template <typename T, set_hook<T> T::*Hook, typename Compare, link_mode Mode>
+T* intrusive_set<T, Hook, Compare, Mode>::Balance(T* node) {
+  set_hook<T>& hook = HookOf(node);
+  int balance = Height(hook.left_) - Height(hook.right_);
+  if (balance > 1) {
+    set_hook<T>& left = HookOf(hook.left_);
+    if (Height(left.left_) < Height(left.right_)) RotateLeft(hook.left_);
+    return RotateRight(node);
+  }
+  if (balance < -1) {
+    set_hook<T>& right = HookOf(hook.right_);
+    if (Height(right.right_) < Height(right.left_)) RotateRight(hook.right_);
+    return RotateLeft(node);
+  }
+  UpdateHeight(node);
+  return node;
+}
+
+// Walks up from node, rebalancing, until a subtree keeps its height and
+// balance: nothing above it can have changed
+template <typename T, set_hook<T> T::*Hook, typename Compare, link_mode Mode>
+void intrusive_set<T, Hook, Compare, Mode>::Rebalance(T* node) {
+  while (node != nullptr) {
+    int height = HookOf(node).height_;
+    T* root = Balance(node);
+    if (root == node && HookOf(node).height_ == height) return;
+    node = HookOf(root).parent_;
+  }
+}
+
+// Removes node, relinking its in-order successor into its place when it
+// has two children; elements never move, only hooks change
+template <typename T, set_hook<T> T::*Hook, typename Compare, link_mode Mode>
+void intrusive_set<T, Hook, Compare, Mode>::Unlink(T* node) {
+  set_hook<T>& hook = HookOf(node);
+  T* rebalance_from;
+  if (hook.left_ != nullptr && hook.right_ != nullptr) {
+    T* successor = First(hook.right_);
+    set_hook<T>& successor_hook = HookOf(successor);
+    if (successor_hook.parent_ != node) {
+      rebalance_from = successor_hook.parent_;
+      ReplaceChild(rebalance_from, successor, successor_hook.right_);
+      successor_hook.right_ = hook.right_;
+      HookOf(hook.right_).parent_ = successor;
+    } else {
+      rebalance_from = successor;
+    }
+    successor_hook.left_ = hook.left_;
+    HookOf(hook.left_).parent_ = successor;
+    successor_hook.height_ = hook.height_;
+    ReplaceChild(hook.parent_, node, successor);
+  } else {
+    rebalance_from = hook.parent_;
+    ReplaceChild(hook.parent_, node,
+                 hook.left_ != nullptr ? hook.left_ : hook.right_);
+  }
+  --size_;
+  if (Mode == link_mode::safe) ResetHook(hook);
+  Rebalance(rebalance_from);
+}
+
+template <typename T, set_hook<T> T::*Hook, typename Compare, link_mode Mode>
+void intrusive_set<T, Hook, Compare, Mode>::ResetHook(set_hook<T>& hook) {
+  hook.left_ = hook.right_ = hook.parent_ = nullptr;
+  hook.height_ = 0;
+}
+
+}  // namespace s21
+
+#endif
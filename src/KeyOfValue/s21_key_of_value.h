@@ -0,0 +1,23 @@
+#ifndef S21_CONTAINERS_KEY_OF_VALUE_H
+#define S21_CONTAINERS_KEY_OF_VALUE_H
+
+#include <type_traits>
+
+namespace s21 {
+// Key extractors: the part of a stored element a container is ordered or
+// hashed by. A set stores bare keys, a map stores pairs keyed by their first
+// member
+template <typename T>
+struct IdentityKey {
+  using key_type = T;
+  const T& operator()(const T& value) const { return value; }
+};
+
+template <typename Pair>
+struct PairFirstKey {
+  using key_type = typename std::remove_const<typename Pair::first_type>::type;
+  const key_type& operator()(const Pair& value) const { return value.first; }
+};
+}  // namespace s21
+
+#endif
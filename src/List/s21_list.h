@@ -3,9 +3,17 @@
 
 #include <iostream>
 #include <limits>
+#include <memory>
+#include <memory_resource>
+#include <utility>
+
+#include "../Stats/s21_stats.h"
 
 namespace s21 {
-template <typename T>
+// Nodes are allocated through Allocator rebound to the node type, so a
+// std::pmr::polymorphic_allocator puts the whole list, elements' own
+// allocations included, into one memory resource
+template <typename T, typename Allocator = std::allocator<T>>
 class list {
  public:
   // member type
@@ -17,16 +25,25 @@ class list {
   class ListConstIterator;
   using const_iterator = ListConstIterator;
   using size_type = size_t;
+  using allocator_type = Allocator;
 
   // functions
   list();
-  list(size_type n);
-  list(std::initializer_list<value_type> const& items);
+  explicit list(const Allocator& alloc);
+  list(size_type n, const Allocator& alloc = Allocator());
+  list(std::initializer_list<value_type> const& items,
+       const Allocator& alloc = Allocator());
   list(const list& l);
+  list(const list& l, const Allocator& alloc);
   list(list&& l);
+  // Takes over the nodes of l when the allocators are equal and moves its
+  // elements one by one otherwise
+  list(list&& l, const Allocator& alloc);
   ~list();
   list& operator=(list&& l);
 
+  allocator_type get_allocator() const;
+
   // element access
   const_reference front();
   const_reference back();
@@ -65,21 +82,40 @@ class list {
   template <typename... Args>
   void insert_many_front(Args&&... args);
 
+  // instrumentation, zeros unless built with S21_CONTAINERS_STATS
+  container_stats stats() const;
+
  private:
+  // Only data_ is constructed through the allocator, so it gets the
+  // allocator itself when it is allocator-aware
   struct Node {
     value_type data_;
     Node* prev_;
     Node* next_;
-    Node(const_reference value)
-        : data_(value), prev_(nullptr), next_(nullptr) {}
   };
+  using node_allocator =
+      typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+  using node_traits = std::allocator_traits<node_allocator>;
+
+  node_allocator allocator_;
   Node* front_;
   Node* back_;
   size_type size_;
+  S21_STATS_MEMBER
+
+  template <typename... Args>
+  Node* NewNode(Args&&... args);
+  void DeleteNode(Node* node);
+  void LinkBack(Node* node);
+  // Takes over the nodes of other, leaving it empty
+  void Adopt(list& other);
+  // Moves the elements of other to the end one by one, for unequal
+  // allocators
+  void MoveElements(list& other);
 };
 
-template <typename T>
-class list<T>::ListIterator {
+template <typename T, typename Allocator>
+class list<T, Allocator>::ListIterator {
  public:
   // member type
   using value_type = T;
@@ -89,7 +125,7 @@ class list<T>::ListIterator {
   using iterator_category = std::forward_iterator_tag;
 
   // constructor
-  ListIterator(typename list<T>::Node* node) : node_(node) {}
+  ListIterator(Node* node) : node_(node) {}
 
   // operators
   reference operator*() const { return node_->data_; }
@@ -111,14 +147,14 @@ class list<T>::ListIterator {
 
   bool operator!=(const ListIterator& other) const { return !(*this == other); }
 
-  typename list<T>::Node* getNode() { return node_; }
+  Node* getNode() { return node_; }
 
  private:
-  typename list<T>::Node* node_;
+  Node* node_;
 };
 
-template <typename T>
-class list<T>::ListConstIterator {
+template <typename T, typename Allocator>
+class list<T, Allocator>::ListConstIterator {
  public:
   // member type
   using value_type = T;
@@ -128,7 +164,7 @@ class list<T>::ListConstIterator {
   using iterator_category = std::forward_iterator_tag;
 
   // constructor
-  ListConstIterator(const typename list<T>::Node* node) : node_(node) {}
+  ListConstIterator(const Node* node) : node_(node) {}
 
   // operators
   reference operator*() const { return node_->data_; }
@@ -152,11 +188,16 @@ class list<T>::ListConstIterator {
     return !(*this == other);
   }
 
-  const typename list<T>::Node* cgetNode() { return node_; }
+  const Node* cgetNode() { return node_; }
 
  private:
-  const typename list<T>::Node* node_;
+  const Node* node_;
 };
+
+namespace pmr {
+template <typename T>
+using list = s21::list<T, std::pmr::polymorphic_allocator<T>>;
+}  // namespace pmr
 };  // namespace s21
 
 #include "s21_list.tpp"
@@ -6,83 +6,112 @@ namespace s21 {
 // functions
 
 // Default constructor, initializes an empty list
-template <typename T>
-list<T>::list() : front_(nullptr), back_(nullptr), size_(0) {}
+template <typename T, typename Allocator>
+list<T, Allocator>::list() : list(Allocator()) {}
+
+// Constructor that creates an empty list allocating through alloc
+template <typename T, typename Allocator>
+list<T, Allocator>::list(const Allocator &alloc)
+    : allocator_(alloc), front_(nullptr), back_(nullptr), size_(0) {}
 
 // Constructor that creates a list with n elements, initialized with the default
 // value of T
-template <typename T>
-list<T>::list(size_type n) : front_(nullptr), back_(nullptr), size_(0) {
+template <typename T, typename Allocator>
+list<T, Allocator>::list(size_type n, const Allocator &alloc) : list(alloc) {
   for (size_type i = 0; i < n; ++i) {
-    push_back(T());
+    LinkBack(NewNode());
   }
 }
 
 // Constructor that creates a list from an initializer list
-template <typename T>
-list<T>::list(std::initializer_list<value_type> const &items)
-    : front_(nullptr), back_(nullptr), size_(0) {
+template <typename T, typename Allocator>
+list<T, Allocator>::list(std::initializer_list<value_type> const &items,
+                         const Allocator &alloc)
+    : list(alloc) {
   for (const auto &item : items) {
     push_back(item);
   }
 }
 
 // Copy constructor, creates a new list by copying elements from another list
-template <typename T>
-list<T>::list(const list &l) : front_(nullptr), back_(nullptr), size_(0) {
+template <typename T, typename Allocator>
+list<T, Allocator>::list(const list &l)
+    : list(l,
+           node_traits::select_on_container_copy_construction(l.allocator_)) {}
+
+// Copy constructor that allocates the copy through alloc
+template <typename T, typename Allocator>
+list<T, Allocator>::list(const list &l, const Allocator &alloc) : list(alloc) {
   for (auto it = l.cbegin(); it != l.cend(); ++it) {
     push_back(*it);
   }
 }
 
 // Move constructor, transfers ownership of elements from one list to another
-template <typename T>
-list<T>::list(list &&l) : front_(l.front_), back_(l.back_), size_(l.size_) {
-  l.front_ = nullptr;
-  l.back_ = nullptr;
-  l.size_ = 0;
+template <typename T, typename Allocator>
+list<T, Allocator>::list(list &&l)
+    : allocator_(std::move(l.allocator_)),
+      front_(nullptr),
+      back_(nullptr),
+      size_(0) {
+  Adopt(l);
 }
 
-// Destructor, deallocates memory used by the list
-template <typename T>
-list<T>::~list() {
-  while (front_ != nullptr) {
-    Node *temp = front_;
-    front_ = front_->next_;
-    delete temp;
+// Move constructor with an allocator, falls back to moving the elements when
+// the nodes of l cannot be freed through alloc
+template <typename T, typename Allocator>
+list<T, Allocator>::list(list &&l, const Allocator &alloc) : list(alloc) {
+  if (allocator_ == l.allocator_) {
+    Adopt(l);
+  } else {
+    MoveElements(l);
   }
-  back_ = nullptr;
-  size_ = 0;
+}
+
+// Destructor, deallocates memory used by the list
+template <typename T, typename Allocator>
+list<T, Allocator>::~list() {
+  clear();
 }
 
 // Move assignment operator, transfers ownership of elements from one list to
-// another
-template <typename T>
-typename list<T>::list &list<T>::operator=(list &&l) {
+// another. The allocator follows the nodes only if it propagates on move
+// assignment; otherwise unequal allocators mean moving element by element
+template <typename T, typename Allocator>
+list<T, Allocator> &list<T, Allocator>::operator=(list &&l) {
   if (this != &l) {
     clear();
-    front_ = l.front_;
-    back_ = l.back_;
-    size_ = l.size_;
-    l.front_ = nullptr;
-    l.back_ = nullptr;
-    l.size_ = 0;
+    if constexpr (node_traits::propagate_on_container_move_assignment::value) {
+      allocator_ = std::move(l.allocator_);
+      Adopt(l);
+    } else if (allocator_ == l.allocator_) {
+      Adopt(l);
+    } else {
+      MoveElements(l);
+    }
   }
   return *this;
 }
 
+// Returns a copy of the allocator of the elements
+template <typename T, typename Allocator>
+typename list<T, Allocator>::allocator_type list<T, Allocator>::get_allocator()
+    const {
+  return allocator_type(allocator_);
+}
+
 // element access
 
 // Returns a reference to the first element in the list (const version)
-template <typename T>
-typename list<T>::const_reference list<T>::front() {
+template <typename T, typename Allocator>
+typename list<T, Allocator>::const_reference list<T, Allocator>::front() {
   if (empty()) throw std::out_of_range("List is empty");
   return front_->data_;
 }
 
 // Returns a reference to the last element in the list (const version)
-template <typename T>
-typename list<T>::const_reference list<T>::back() {
+template <typename T, typename Allocator>
+typename list<T, Allocator>::const_reference list<T, Allocator>::back() {
   if (empty()) throw std::out_of_range("List is empty");
   return back_->data_;
 }
@@ -90,69 +119,69 @@ typename list<T>::const_reference list<T>::back() {
 // iterators
 
 // Returns an iterator pointing to the first element in the list
-template <typename T>
-typename list<T>::iterator list<T>::begin() {
+template <typename T, typename Allocator>
+typename list<T, Allocator>::iterator list<T, Allocator>::begin() {
   return iterator(front_);
 }
 
 // Returns a const iterator pointing to the first element in the list
-template <typename T>
-typename list<T>::const_iterator list<T>::cbegin() const {
+template <typename T, typename Allocator>
+typename list<T, Allocator>::const_iterator list<T, Allocator>::cbegin() const {
   return const_iterator(front_);
 }
 
 // Returns an iterator pointing to the element after the last element in the
 // list
-template <typename T>
-typename list<T>::iterator list<T>::end() {
-  return iterator(back_->next_);
+template <typename T, typename Allocator>
+typename list<T, Allocator>::iterator list<T, Allocator>::end() {
+  return iterator(nullptr);
 }
 
 // Returns a const iterator pointing to the element after the last element in
 // the list
-template <typename T>
-typename list<T>::const_iterator list<T>::cend() const {
-  return const_iterator(back_->next_);
+template <typename T, typename Allocator>
+typename list<T, Allocator>::const_iterator list<T, Allocator>::cend() const {
+  return const_iterator(nullptr);
 }
 // capacity
 
 // Returns true if the list is empty, false otherwise
-template <typename T>
-bool list<T>::empty() {
+template <typename T, typename Allocator>
+bool list<T, Allocator>::empty() {
   return size_ == 0;
 }
 
 // Returns the number of elements in the list
-template <typename T>
-typename list<T>::size_type list<T>::size() {
+template <typename T, typename Allocator>
+typename list<T, Allocator>::size_type list<T, Allocator>::size() {
   return size_;
 }
 
 // Returns the maximum number of elements the list can hold
-template <typename T>
-typename list<T>::size_type list<T>::max_size() {
-  return std::numeric_limits<size_type>::max() / sizeof(value_type);
+template <typename T, typename Allocator>
+typename list<T, Allocator>::size_type list<T, Allocator>::max_size() {
+  return node_traits::max_size(allocator_);
 }
 
 // modifiers
 
 // Removes all elements from the list
-template <typename T>
-void list<T>::clear() {
+template <typename T, typename Allocator>
+void list<T, Allocator>::clear() {
   while (front_ != nullptr) {
     Node *temp = front_;
     front_ = front_->next_;
-    delete temp;
+    DeleteNode(temp);
   }
   back_ = nullptr;
   size_ = 0;
 }
 
 // Inserts a new element before the position specified by the iterator
-template <typename T>
-typename list<T>::iterator list<T>::insert(iterator pos,
-                                           const_reference value) {
-  Node *node = new Node(value);
+template <typename T, typename Allocator>
+typename list<T, Allocator>::iterator list<T, Allocator>::insert(
+    iterator pos, const_reference value) {
+  Node *node = NewNode(value);
   if (pos == begin()) {
     // If inserting at the beginning of the list
     node->next_ = front_;
@@ -180,8 +209,8 @@ typename list<T>::iterator list<T>::insert(iterator pos,
   return iterator(node);
 }
 // Removes the element at the position specified by the iterator
-template <typename T>
-void list<T>::erase(iterator pos) {
+template <typename T, typename Allocator>
+void list<T, Allocator>::erase(iterator pos) {
   Node *node = pos.getNode();
   if (node == nullptr) {
     throw std::out_of_range("Iterator is out of range");
@@ -201,28 +230,19 @@ void list<T>::erase(iterator pos) {
     node->prev_->next_ = node->next_;
     node->next_->prev_ = node->prev_;
   }
-  delete node;
+  DeleteNode(node);
   --size_;
 }
 
 // Adds a new element to the end of the list
-template <typename T>
-void list<T>::push_back(const_reference value) {
-  Node *node = new Node(value);
-  if (empty()) {
-    front_ = node;
-    back_ = node;
-  } else {
-    node->prev_ = back_;
-    back_->next_ = node;
-    back_ = node;
-  }
-  ++size_;
+template <typename T, typename Allocator>
+void list<T, Allocator>::push_back(const_reference value) {
+  LinkBack(NewNode(value));
 }
 
 // Removes the last element from the list
-template <typename T>
-void list<T>::pop_back() {
+template <typename T, typename Allocator>
+void list<T, Allocator>::pop_back() {
   if (empty()) {
     throw std::out_of_range("List is empty");
   }
@@ -232,15 +252,15 @@ void list<T>::pop_back() {
     Node *temp = back_;
     back_ = back_->prev_;
     back_->next_ = nullptr;
-    delete temp;
+    DeleteNode(temp);
     --size_;
   }
 }
 
 // Adds a new element to the beginning of the list
-template <typename T>
-void list<T>::push_front(const_reference value) {
-  Node *node = new Node(value);
+template <typename T, typename Allocator>
+void list<T, Allocator>::push_front(const_reference value) {
+  Node *node = NewNode(value);
   if (empty()) {
     front_ = node;
     back_ = node;
@@ -253,8 +273,8 @@ void list<T>::push_front(const_reference value) {
 }
 
 // Removes the first element from the list
-template <typename T>
-void list<T>::pop_front() {
+template <typename T, typename Allocator>
+void list<T, Allocator>::pop_front() {
   if (empty()) {
     throw std::out_of_range("List is empty");
   }
@@ -265,9 +285,13 @@ void list<T>::pop_front() {
   }
 }
 
-// Swaps the contents of the list with another list
-template <typename T>
-void list<T>::swap(list &other) {
+// Swaps the contents of the list with another list. Unless the allocator
+// propagates on swap, the two allocators must be equal
+template <typename T, typename Allocator>
+void list<T, Allocator>::swap(list &other) {
+  if constexpr (node_traits::propagate_on_container_swap::value) {
+    std::swap(allocator_, other.allocator_);
+  }
   std::swap(front_, other.front_);
   std::swap(back_, other.back_);
   std::swap(size_, other.size_);
@@ -275,8 +299,8 @@ void list<T>::swap(list &other) {
 
 // Merges the contents of another list into the current list, preserving the
 // sorting order
-template <typename T>
-void list<T>::merge(list &other) {
+template <typename T, typename Allocator>
+void list<T, Allocator>::merge(list &other) {
   if (this != &other) {
     sort();
     other.sort();
@@ -296,8 +320,8 @@ void list<T>::merge(list &other) {
 
 // Inserts the elements of another list before the specified position in the
 // current list
-template <typename T>
-void list<T>::splice(iterator pos, list &other) {
+template <typename T, typename Allocator>
+void list<T, Allocator>::splice(iterator pos, list &other) {
   if (this != &other) {
     for (auto it = other.begin(); it != other.end(); ++it) {
       insert(pos, *it);
@@ -307,8 +331,8 @@ void list<T>::splice(iterator pos, list &other) {
 }
 
 // Reverses the order of elements in the list
-template <typename T>
-void list<T>::reverse() {
+template <typename T, typename Allocator>
+void list<T, Allocator>::reverse() {
   if (size_ > 1) {
     Node *left = front_;
     Node *right = back_;
@@ -321,8 +345,8 @@ void list<T>::reverse() {
 }
 
 // Removes consecutive duplicate elements from the list
-template <typename T>
-void list<T>::unique() {
+template <typename T, typename Allocator>
+void list<T, Allocator>::unique() {
   if (size_ > 1) {
     Node *current = front_->next_;
     Node *prev = front_;
@@ -340,8 +364,8 @@ void list<T>::unique() {
 }
 
 // Sorts the elements in the list in ascending order
-template <typename T>
-void list<T>::sort() {
+template <typename T, typename Allocator>
+void list<T, Allocator>::sort() {
   if (size_ > 1) {
     bool swapped;
     Node *current;
@@ -362,10 +386,10 @@ void list<T>::sort() {
 }
 
 // Inserts multiple elements before the specified position in the list
-template <typename T>
+template <typename T, typename Allocator>
 template <typename... Args>
-typename list<T>::iterator list<T>::insert_many(const_iterator pos,
-                                                Args &&...args) {
+typename list<T, Allocator>::iterator list<T, Allocator>::insert_many(
+    const_iterator pos, Args &&...args) {
   iterator it(const_cast<Node *>(pos.cgetNode()));
   for (const auto &arg : {args...}) {
     insert(it, arg);
@@ -374,19 +398,85 @@ typename list<T>::iterator list<T>::insert_many(const_iterator pos,
 }
 
 // Inserts multiple elements at the end of the list
-template <typename T>
+template <typename T, typename Allocator>
 template <typename... Args>
-void list<T>::insert_many_back(Args &&...args) {
+void list<T, Allocator>::insert_many_back(Args &&...args) {
   insert_many(cend(), args...);
 }
 
 // Inserts multiple elements at the beginning of the list
-template <typename T>
+template <typename T, typename Allocator>
 template <typename... Args>
-void list<T>::insert_many_front(Args &&...args) {
+void list<T, Allocator>::insert_many_front(Args &&...args) {
   insert_many(cbegin(), args...);
 }
 
+// Counters of the instrumentation mode, zeros when it is disabled
+template <typename T, typename Allocator>
+container_stats list<T, Allocator>::stats() const {
+  return S21_STATS_GET();
+}
+
+// helpers
+
+// Allocates a node and constructs its element from args
+template <typename T, typename Allocator>
+template <typename... Args>
+typename list<T, Allocator>::Node *list<T, Allocator>::NewNode(
+    Args &&...args) {
+  Node *node = node_traits::allocate(allocator_, 1);
+  try {
+    node_traits::construct(allocator_, std::addressof(node->data_),
+                           std::forward<Args>(args)...);
+  } catch (...) {
+    node_traits::deallocate(allocator_, node, 1);
+    throw;
+  }
+  node->prev_ = nullptr;
+  node->next_ = nullptr;
+  S21_STATS(Allocation(sizeof(Node)));
+  return node;
+}
+
+template <typename T, typename Allocator>
+void list<T, Allocator>::DeleteNode(Node *node) {
+  node_traits::destroy(allocator_, std::addressof(node->data_));
+  node_traits::deallocate(allocator_, node, 1);
+  S21_STATS(Deallocation());
+}
+
+// Appends an unlinked node
+template <typename T, typename Allocator>
+void list<T, Allocator>::LinkBack(Node *node) {
+  if (empty()) {
+    front_ = node;
+    back_ = node;
+  } else {
+    node->prev_ = back_;
+    back_->next_ = node;
+    back_ = node;
+  }
+  ++size_;
+}
+
+template <typename T, typename Allocator>
+void list<T, Allocator>::Adopt(list &other) {
+  front_ = other.front_;
+  back_ = other.back_;
+  size_ = other.size_;
+  other.front_ = nullptr;
+  other.back_ = nullptr;
+  other.size_ = 0;
+}
+
+template <typename T, typename Allocator>
+void list<T, Allocator>::MoveElements(list &other) {
+  for (Node *node = other.front_; node != nullptr; node = node->next_) {
+    LinkBack(NewNode(std::move(node->data_)));
+  }
+  other.clear();
+}
+
 };  // namespace s21
 
 #endif
@@ -1,90 +1,106 @@
 #include "s21_map.hpp"
 
 #include <algorithm>
+#include <iterator>
+#include <stdexcept>
 
 namespace s21 {
 
-template <typename T, typename V>
-map<T, V>::map() : tree_() {}
+template <typename T, typename V, typename Compare, typename Allocator>
+map<T, V, Compare, Allocator>::map() : tree_() {}
 
-template <typename T, typename V>
-map<T, V>::map(
-    std::initializer_list<typename map<T, V>::value_type> const& items) {
+template <typename T, typename V, typename Compare, typename Allocator>
+map<T, V, Compare, Allocator>::map(const Compare& comp,
+                                   const Allocator& alloc)
+    : tree_(comp, alloc) {}
+
+template <typename T, typename V, typename Compare, typename Allocator>
+map<T, V, Compare, Allocator>::map(const Allocator& alloc)
+    : tree_(Compare(), alloc) {}
+
+template <typename T, typename V, typename Compare, typename Allocator>
+map<T, V, Compare, Allocator>::map(
+    std::initializer_list<value_type> const& items, const Allocator& alloc)
+    : tree_(Compare(), alloc) {
   for (auto i = items.begin(); i != items.end(); i++) {
     this->insert(*i);
   }
 }
 
-template <typename T, typename V>
-map<T, V>::map(const map& m) : tree_(m.get_tree()) {}
+template <typename T, typename V, typename Compare, typename Allocator>
+map<T, V, Compare, Allocator>::map(const map& m) : tree_(m.get_tree()) {}
 
-template <typename T, typename V>
-map<T, V> map<T, V>::operator=(map<T, V>&& m) {
-  if (this != &m) {
-    tree_ = std::move(m.tree_);
-  }
+template <typename T, typename V, typename Compare, typename Allocator>
+map<T, V, Compare, Allocator>::map(const map& m, const Allocator& alloc)
+    : tree_(m.tree_, alloc) {}
+
+template <typename T, typename V, typename Compare, typename Allocator>
+map<T, V, Compare, Allocator>::map(map&& m, const Allocator& alloc)
+    : tree_(std::move(m.tree_), alloc) {}
 
+template <typename T, typename V, typename Compare, typename Allocator>
+map<T, V, Compare, Allocator>& map<T, V, Compare, Allocator>::operator=(
+    const map& m) {
+  tree_ = m.tree_;
   return *this;
 }
 
-template <typename T, typename V>
-std::pair<typename map<T, V>::iterator, bool> map<T, V>::insert(
-    const value_type& value) {
-  std::pair<typename map<T, V>::iterator, bool> result;
-
-  if (check_duplicates(value)) {
-    auto res = this->tree_.Search(value);
-    return std::make_pair(iterator(res), false);
+template <typename T, typename V, typename Compare, typename Allocator>
+map<T, V, Compare, Allocator>& map<T, V, Compare, Allocator>::operator=(
+    map&& m) {
+  if (this != &m) {
+    tree_ = std::move(m.tree_);
   }
 
-  this->tree_.Insert(value);
-  auto res = this->tree_.Search(value);
-
-  if (this->tree_.GetInserted()) {
-    result = std::make_pair(iterator(res), true);
-  } else {
-    result = std::make_pair(iterator(res), false);
-  }
+  return *this;
+}
 
-  return result;
+template <typename T, typename V, typename Compare, typename Allocator>
+std::pair<typename map<T, V, Compare, Allocator>::iterator, bool>
+map<T, V, Compare, Allocator>::insert(const value_type& value) {
+  auto result = tree_.Insert(value);
+  return std::make_pair(iterator(result.first), result.second);
 }
 
-template <typename T, typename V>
-std::pair<typename map<T, V>::iterator, bool> map<T, V>::insert(
+template <typename T, typename V, typename Compare, typename Allocator>
+std::pair<typename map<T, V, Compare, Allocator>::iterator, bool>
+map<T, V, Compare, Allocator>::insert(
     const key_type& key, const mapped_type& obj) {
-  return insert(std::pair<key_type, mapped_type>(key, obj));
+  return insert(value_type(key, obj));
 }
 
-template <typename T, typename V>
-std::pair<typename map<T, V>::iterator, bool> map<T, V>::insert_or_assign(
+template <typename T, typename V, typename Compare, typename Allocator>
+std::pair<typename map<T, V, Compare, Allocator>::iterator, bool>
+map<T, V, Compare, Allocator>::insert_or_assign(
     const key_type& key, const mapped_type& obj) {
-  if (this->empty()) {
-    return insert(std::make_pair(key, obj));
-  } else {
-    iterator i = this->begin();
-
-    for (; i != this->end(); i++) {
-      if (i->first == key) {
-        i->second = obj;
-        return std::make_pair(i, false);
-      }
-    }
-    return insert(std::make_pair(key, obj));
-  }
+  auto result = tree_.Insert(value_type(key, obj));
+  if (!result.second) result.first->key.second = obj;
+  return std::make_pair(iterator(result.first), result.second);
 }
 
-template <typename T, typename V>
-typename map<T, V>::mapped_type& map<T, V>::at(const T& key) {
-  return operatorHelper(key, 0);
+template <typename T, typename V, typename Compare, typename Allocator>
+typename map<T, V, Compare, Allocator>::mapped_type&
+map<T, V, Compare, Allocator>::at(const T& key) {
+  Node<value_type, V>* node = tree_.Search(key);
+  if (node == nullptr) {
+    throw std::invalid_argument("This key doesn't exist");
+  }
+  return node->key.second;
 }
 
-template <typename T, typename V>
-typename map<T, V>::mapped_type& map<T, V>::operator[](const T& key) {
-  return operatorHelper(key, 1);
+template <typename T, typename V, typename Compare, typename Allocator>
+typename map<T, V, Compare, Allocator>::mapped_type&
+map<T, V, Compare, Allocator>::operator[](const T& key) {
+  Node<value_type, V>* node = tree_.Search(key);
+  if (node == nullptr) {
+    node = tree_.Insert(value_type(key, mapped_type())).first;
+  }
+  return node->key.second;
 }
 
-template <typename T, typename V>
-typename map<T, V>::iterator map<T, V>::begin() {
+template <typename T, typename V, typename Compare, typename Allocator>
+typename map<T, V, Compare, Allocator>::iterator
+map<T, V, Compare, Allocator>::begin() {
   Node<value_type, V>* node = tree_.GetRoot();
 
   if (node == nullptr) return iterator(nullptr);
@@ -96,13 +112,14 @@ typename map<T, V>::iterator map<T, V>::begin() {
   return iterator(node);
 }
 
-template <typename T, typename V>
-typename map<T, V>::iterator map<T, V>::end() {
+template <typename T, typename V, typename Compare, typename Allocator>
+typename map<T, V, Compare, Allocator>::iterator
+map<T, V, Compare, Allocator>::end() {
   return iterator(nullptr, tree_.GetRoot());
 }
 
-template <typename T, typename V>
-bool map<T, V>::empty() {
+template <typename T, typename V, typename Compare, typename Allocator>
+bool map<T, V, Compare, Allocator>::empty() {
   if (this->tree_.GetRoot() == nullptr) {
     return true;
   }
@@ -114,8 +131,9 @@ bool map<T, V>::empty() {
   return false;
 }
 
-template <typename T, typename V>
-typename map<T, V>::size_type map<T, V>::size() {
+template <typename T, typename V, typename Compare, typename Allocator>
+typename map<T, V, Compare, Allocator>::size_type
+map<T, V, Compare, Allocator>::size() {
   if (this->tree_.GetRoot() == nullptr) {
     return 0;
   }
@@ -123,88 +141,146 @@ typename map<T, V>::size_type map<T, V>::size() {
   return tree_.GetRoot()->size_;
 }
 
-template <typename T, typename V>
-typename map<T, V>::size_type map<T, V>::max_size() {
-  return allocator.max_size() / 10;
+template <typename T, typename V, typename Compare, typename Allocator>
+typename map<T, V, Compare, Allocator>::size_type
+map<T, V, Compare, Allocator>::max_size() {
+  return std::allocator_traits<Allocator>::max_size(tree_.GetAllocator()) /
+         10;
 }
 
-template <typename T, typename V>
-void map<T, V>::clear() {
-  if (this->get_tree().GetRoot()) {
-    for (iterator i = this->begin(); i != this->end(); i++) {
-      this->erase();
-    }
-  }
+template <typename T, typename V, typename Compare, typename Allocator>
+void map<T, V, Compare, Allocator>::shrink_to_fit() {
+  tree_.ShrinkToFit();
+}
+
+template <typename T, typename V, typename Compare, typename Allocator>
+void map<T, V, Compare, Allocator>::clear() {
+  tree_.Clear();
 }
 
-template <typename T, typename V>
-void map<T, V>::erase(typename map<T, V>::iterator pos) {
+template <typename T, typename V, typename Compare, typename Allocator>
+void map<T, V, Compare, Allocator>::erase(iterator pos) {
   if (pos != nullptr) {
-    this->tree_.Remove(*pos);
+    this->tree_.Erase(pos.GetNode());
   }
 }
 
-template <typename T, typename V>
-void map<T, V>::swap(map& other) {
+template <typename T, typename V, typename Compare, typename Allocator>
+void map<T, V, Compare, Allocator>::swap(map& other) {
   tree_.Swap(other.tree_);
 }
 
-template <typename T, typename V>
-void map<T, V>::merge(map& other) {
-  std::pair<typename map<T, V>::iterator, bool> result;
+// Moves the elements whose keys are missing here, duplicates stay in other
+template <typename T, typename V, typename Compare, typename Allocator>
+void map<T, V, Compare, Allocator>::merge(map& other) {
+  if (this == &other) return;
   iterator iter = other.begin();
 
   while (iter != other.end()) {
-    result = this->insert(*iter);
-    if (result.second) other.erase(iter);
-    iter++;
+    iterator current = iter++;
+    if (this->insert(*current).second) other.erase(current);
   }
 }
 
-template <typename T, typename V>
-bool map<T, V>::contains(const T& key) {
-  for (iterator i = this->begin(); i != this->end(); i++) {
-    if (i->first == key) return true;
-  }
+template <typename T, typename V, typename Compare, typename Allocator>
+template <typename ForwardIt>
+void map<T, V, Compare, Allocator>::assign_sorted(
+    ForwardIt first, ForwardIt last) {
+  tree_.AssignSorted(static_cast<size_t>(std::distance(first, last)),
+                     [&first]() -> decltype(auto) { return *first++; });
+}
 
-  return false;
+template <typename T, typename V, typename Compare, typename Allocator>
+bool map<T, V, Compare, Allocator>::contains(const T& key) {
+  return tree_.Search(key) != nullptr;
 }
 
-template <typename T, typename V>
-typename map<T, V>::mapped_type& map<T, V>::operatorHelper(const T& key,
-                                                           int flag) {
-  iterator i = this->begin();
-  if (i != nullptr) {
-    for (; i != this->end(); i++) {
-      if (i->first == key) {
-        return i->second;
-      }
-    }
-    if (flag) {
-      auto res = insert(value_type(key, mapped_type()));
-      return res.first->second;
-    } else {
-      throw std::invalid_argument("This key doesn't exist");
-    }
-  }
-  static mapped_type default_value;
-  return default_value;
+template <typename T, typename V, typename Compare, typename Allocator>
+template <typename K, typename, typename>
+bool map<T, V, Compare, Allocator>::contains(const K& key) {
+  return tree_.Search(key) != nullptr;
 }
 
-template <typename T, typename V>
-const AVLTree<typename map<T, V>::value_type, V>& map<T, V>::get_tree() const {
-  return tree_;
+template <typename T, typename V, typename Compare, typename Allocator>
+typename map<T, V, Compare, Allocator>::iterator
+map<T, V, Compare, Allocator>::find(const T& key) {
+  return IteratorFor(tree_.Search(key));
 }
 
-template <typename T, typename V>
-bool map<T, V>::check_duplicates(const value_type& value) {
-  auto i = this->begin();
+template <typename T, typename V, typename Compare, typename Allocator>
+template <typename K, typename, typename>
+typename map<T, V, Compare, Allocator>::iterator
+map<T, V, Compare, Allocator>::find(const K& key) {
+  return IteratorFor(tree_.Search(key));
+}
 
-  for (; i != this->end(); i++) {
-    if (i->first == value.first) return true;
-  }
+template <typename T, typename V, typename Compare, typename Allocator>
+typename map<T, V, Compare, Allocator>::iterator
+map<T, V, Compare, Allocator>::lower_bound(const T& key) {
+  return IteratorFor(tree_.LowerBound(key));
+}
 
-  return false;
+template <typename T, typename V, typename Compare, typename Allocator>
+typename map<T, V, Compare, Allocator>::iterator
+map<T, V, Compare, Allocator>::upper_bound(const T& key) {
+  return IteratorFor(tree_.UpperBound(key));
+}
+
+template <typename T, typename V, typename Compare, typename Allocator>
+std::pair<typename map<T, V, Compare, Allocator>::iterator,
+          typename map<T, V, Compare, Allocator>::iterator>
+map<T, V, Compare, Allocator>::equal_range(const T& key) {
+  auto nodes = tree_.EqualRange(key);
+  return std::make_pair(IteratorFor(nodes.first), IteratorFor(nodes.second));
+}
+
+template <typename T, typename V, typename Compare, typename Allocator>
+RangeView<typename map<T, V, Compare, Allocator>::iterator>
+map<T, V, Compare, Allocator>::range(const T& first, const T& last) {
+  return RangeView<iterator>(lower_bound(first), lower_bound(last));
+}
+
+template <typename T, typename V, typename Compare, typename Allocator>
+template <typename F>
+void map<T, V, Compare, Allocator>::for_each(F visit) const {
+  tree_.ForEach(visit);
+}
+
+template <typename T, typename V, typename Compare, typename Allocator>
+template <typename F>
+void map<T, V, Compare, Allocator>::visit_range(
+    const T& first, const T& last, F visit) const {
+  tree_.VisitRange(first, last, visit);
+}
+
+// Null stands for end(), which also carries the root for operator--
+template <typename T, typename V, typename Compare, typename Allocator>
+typename map<T, V, Compare, Allocator>::iterator
+map<T, V, Compare, Allocator>::IteratorFor(Node<value_type, V>* node) {
+  return node != nullptr ? iterator(node) : end();
+}
+
+template <typename T, typename V, typename Compare, typename Allocator>
+typename map<T, V, Compare, Allocator>::key_compare
+map<T, V, Compare, Allocator>::key_comp() const {
+  return tree_.GetCompare();
+}
+
+template <typename T, typename V, typename Compare, typename Allocator>
+typename map<T, V, Compare, Allocator>::allocator_type
+map<T, V, Compare, Allocator>::get_allocator() const {
+  return tree_.GetAllocator();
+}
+
+template <typename T, typename V, typename Compare, typename Allocator>
+const typename map<T, V, Compare, Allocator>::tree_type&
+map<T, V, Compare, Allocator>::get_tree() const {
+  return tree_;
+}
+
+template <typename T, typename V, typename Compare, typename Allocator>
+container_stats map<T, V, Compare, Allocator>::stats() const {
+  return tree_.GetStats();
 }
 
 };  // namespace s21
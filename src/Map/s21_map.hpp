@@ -4,24 +4,34 @@
 #include "../AVLTree/AVLTree.hpp"
 
 namespace s21 {
-template <typename T, typename V>
+template <typename T, typename V, typename Compare = std::less<T>,
+          typename Allocator = std::allocator<std::pair<const T, V>>>
 class map {
  public:
   using key_type = T;
   using mapped_type = V;
   using value_type = std::pair<const key_type, mapped_type>;
+  using key_compare = Compare;
   using iterator = Iterator<value_type, V>;
   using const_iterator = ConstIterator<value_type, V>;
   using default_value = mapped_type &;
   using size_type = size_t;
-  using Allocator = std::allocator<T>;
+  using allocator_type = Allocator;
+  using tree_type = AVLTree<value_type, V, Compare, PairFirstKey<value_type>,
+                            Allocator>;
 
   map();
-  map(std::initializer_list<value_type> const &items);
+  explicit map(const Compare &comp, const Allocator &alloc = Allocator());
+  explicit map(const Allocator &alloc);
+  map(std::initializer_list<value_type> const &items,
+      const Allocator &alloc = Allocator());
   map(const map &m);
+  map(const map &m, const Allocator &alloc);
   map(map &&m) = default;
+  map(map &&m, const Allocator &alloc);
   ~map(){};
-  map<T, V> operator=(map &&m);
+  map &operator=(const map &m);
+  map &operator=(map &&m);
 
   mapped_type &at(const T &key);
   mapped_type &operator[](const T &key);
@@ -32,6 +42,8 @@ class map {
   bool empty();
   size_type size();
   size_type max_size();
+  // Frees the node memory that erasures left unused; iterators stay valid
+  void shrink_to_fit();
 
   void clear();
   std::pair<iterator, bool> insert(const value_type &value);
@@ -41,17 +53,51 @@ class map {
   void erase(iterator pos);
   void swap(map &other);
   void merge(map &other);
+  // Replaces the contents by a range whose keys are strictly ascending, in
+  // O(n) without rebalancing; std::invalid_argument if they are not
+  template <typename ForwardIt>
+  void assign_sorted(ForwardIt first, ForwardIt last);
 
   bool contains(const T &key);
-  const AVLTree<value_type, V> &get_tree() const;
+  iterator find(const T &key);
+  // Heterogeneous lookup, only with a comparator that has is_transparent
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  bool contains(const K &key);
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  iterator find(const K &key);
+
+  // Range lookups, each a single descent of the tree
+  iterator lower_bound(const T &key);
+  iterator upper_bound(const T &key);
+  std::pair<iterator, iterator> equal_range(const T &key);
+  // Elements with keys in [first, last)
+  RangeView<iterator> range(const T &first, const T &last);
+  // Scans calling visit(element) in key order, for all elements or those
+  // with keys in [first, last). They walk the tree with a stack and
+  // prefetching instead of climbing parent pointers like the iterators
+  template <typename F>
+  void for_each(F visit) const;
+  template <typename F>
+  void visit_range(const T &first, const T &last, F visit) const;
+
+  key_compare key_comp() const;
+  allocator_type get_allocator() const;
+  const tree_type &get_tree() const;
+  container_stats stats() const;
 
  private:
-  AVLTree<value_type, V> tree_;
-  Allocator allocator;
+  tree_type tree_;
 
-  mapped_type &operatorHelper(const T &key, int flag);
-  bool check_duplicates(const value_type &value);
+  iterator IteratorFor(Node<value_type, V> *node);
 };
+
+namespace pmr {
+template <typename T, typename V, typename Compare = std::less<T>>
+using map = s21::map<
+    T, V, Compare, std::pmr::polymorphic_allocator<std::pair<const T, V>>>;
+}  // namespace pmr
 }  // namespace s21
 
 #endif  // S21_MAP_H
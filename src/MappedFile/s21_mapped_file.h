@@ -0,0 +1,36 @@
+#ifndef S21_CONTAINERS_MAPPED_FILE_H
+#define S21_CONTAINERS_MAPPED_FILE_H
+
+#include <cstddef>
+#include <string>
+
+namespace s21 {
+// Read-only memory mapping of a whole file (POSIX mmap), unmapped by the
+// destructor. Pages are loaded on first access, so opening is O(1) in the
+// size of the file
+class mapped_file {
+ public:
+  using size_type = size_t;
+
+  // Throws std::runtime_error if the file cannot be opened or mapped
+  explicit mapped_file(const std::string& path);
+  mapped_file(const mapped_file&) = delete;
+  mapped_file& operator=(const mapped_file&) = delete;
+  mapped_file(mapped_file&& other) noexcept;
+  mapped_file& operator=(mapped_file&& other) noexcept;
+  ~mapped_file();
+
+  const unsigned char* data() const;
+  size_type size() const;
+
+ private:
+  const unsigned char* data_;
+  size_type size_;
+
+  void Unmap();
+};
+}  // namespace s21
+
+#include "s21_mapped_file.tpp"
+
+#endif
@@ -0,0 +1,69 @@
+#ifndef S21_CONTAINERS_MAPPED_FILE_TPP
+#define S21_CONTAINERS_MAPPED_FILE_TPP
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <stdexcept>
+#include <utility>
+
+namespace s21 {
+
+// functions
+
+inline mapped_file::mapped_file(const std::string& path)
+    : data_(nullptr), size_(0) {
+  int fd = ::open(path.c_str(), O_RDONLY);
+  if (fd < 0) throw std::runtime_error("Cannot open " + path);
+  struct stat info;
+  if (::fstat(fd, &info) != 0) {
+    ::close(fd);
+    throw std::runtime_error("Cannot read the size of " + path);
+  }
+  size_ = static_cast<size_type>(info.st_size);
+  if (size_ != 0) {
+    void* address = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (address == MAP_FAILED) {
+      ::close(fd);
+      throw std::runtime_error("Cannot map " + path);
+    }
+    data_ = static_cast<const unsigned char*>(address);
+  }
+  // The mapping stays valid without the descriptor
+  ::close(fd);
+}
+
+inline mapped_file::mapped_file(mapped_file&& other) noexcept
+    : data_(std::exchange(other.data_, nullptr)),
+      size_(std::exchange(other.size_, 0)) {}
+
+inline mapped_file& mapped_file::operator=(mapped_file&& other) noexcept {
+  if (this != &other) {
+    Unmap();
+    data_ = std::exchange(other.data_, nullptr);
+    size_ = std::exchange(other.size_, 0);
+  }
+  return *this;
+}
+
+inline mapped_file::~mapped_file() { Unmap(); }
+
+inline const unsigned char* mapped_file::data() const { return data_; }
+
+inline mapped_file::size_type mapped_file::size() const { return size_; }
+
+// helpers
+
+inline void mapped_file::Unmap() {
+  if (data_ != nullptr) {
+    ::munmap(const_cast<unsigned char*>(data_), size_);
+    data_ = nullptr;
+    size_ = 0;
+  }
+}
+
+}  // namespace s21
+
+#endif
@@ -0,0 +1,76 @@
+#ifndef S21_CONTAINERS_MPMC_QUEUE_H
+#define S21_CONTAINERS_MPMC_QUEUE_H
+
+#include <atomic>
+#include <cstddef>
+#include <type_traits>
+
+namespace s21 {
+// Bounded lock-free multi-producer/multi-consumer queue. Every cell carries a
+// sequence number that tells producers and consumers whose turn it is, so a
+// thread only contends on the enqueue or dequeue counter it advances.
+template <typename T>
+class mpmc_queue {
+ public:
+  // member type
+  using value_type = T;
+  using reference = T&;
+  using const_reference = const T&;
+  using size_type = size_t;
+
+  // functions
+  explicit mpmc_queue(size_type capacity);
+  mpmc_queue(const mpmc_queue&) = delete;
+  mpmc_queue& operator=(const mpmc_queue&) = delete;
+  ~mpmc_queue();
+
+  // capacity
+  bool empty() const;
+  size_type size() const;
+  size_type capacity() const;
+
+  // producer side
+  bool try_push(const_reference value);
+  bool try_push(value_type&& value);
+  template <typename... Args>
+  bool try_emplace(Args&&... args);
+  // Spin with std::this_thread::yield while the queue is full, keeping the
+  // core busy; meant for consumers that keep up, otherwise poll try_push
+  void push(const_reference value);
+  void push(value_type&& value);
+  template <typename InputIt>
+  size_type try_push_many(InputIt first, InputIt last);
+
+  // consumer side; if moving an element out throws, that element is lost
+  // but the queue stays usable
+  bool try_pop(reference value);
+  // Spins like push while the queue is empty
+  void pop(reference value);
+  template <typename OutputIt>
+  size_type try_pop_many(OutputIt out, size_type max_count);
+
+ private:
+  static constexpr size_type kCacheLine = 64;
+
+  using Storage = typename std::aligned_storage<sizeof(T), alignof(T)>::type;
+
+  struct Cell {
+    std::atomic<size_type> sequence;
+    Storage storage;
+  };
+
+  alignas(kCacheLine) std::atomic<size_type> enqueue_pos_;
+  alignas(kCacheLine) std::atomic<size_type> dequeue_pos_;
+  alignas(kCacheLine) Cell* cells_;
+  size_type mask_;
+
+  Cell* Claim(std::atomic<size_type>& position, size_type turn);
+  template <typename F>
+  bool Take(F take);
+  static T* Value(Cell* cell);
+};
+}  // namespace s21
+
+#include "s21_mpmc_queue.tpp"
+
+#endif
@@ -0,0 +1,206 @@
+#ifndef S21_CONTAINERS_MPMC_QUEUE_TPP
+#define S21_CONTAINERS_MPMC_QUEUE_TPP
+
+#include <new>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+
+namespace s21 {
+
+// functions
+
+// Creates a queue for at least capacity elements, rounded up to a power of two.
+// Cell i starts with sequence i: free for the producer of lap zero
+template <typename T>
+mpmc_queue<T>::mpmc_queue(size_type capacity)
+    : enqueue_pos_(0), dequeue_pos_(0) {
+  if (capacity < 2) capacity = 2;
+  size_type cells = 1;
+  while (cells < capacity) cells <<= 1;
+  cells_ = new Cell[cells];
+  mask_ = cells - 1;
+  for (size_type i = 0; i < cells; ++i) {
+    cells_[i].sequence.store(i, std::memory_order_relaxed);
+  }
+}
+
+// Destructor, destroys the elements that were never popped
+template <typename T>
+mpmc_queue<T>::~mpmc_queue() {
+  size_type tail = enqueue_pos_.load(std::memory_order_relaxed);
+  for (size_type i = dequeue_pos_.load(std::memory_order_relaxed); i != tail;
+       ++i) {
+    Value(&cells_[i & mask_])->~T();
+  }
+  delete[] cells_;
+}
+
+// capacity
+
+// Returns true if the queue looked empty at the moment of the call
+template <typename T>
+bool mpmc_queue<T>::empty() const {
+  return size() == 0;
+}
+
+// Returns the approximate number of elements at the moment of the call
+template <typename T>
+typename mpmc_queue<T>::size_type mpmc_queue<T>::size() const {
+  size_type head = dequeue_pos_.load(std::memory_order_acquire);
+  size_type tail = enqueue_pos_.load(std::memory_order_acquire);
+  return tail > head ? tail - head : 0;
+}
+
+// Returns the number of cells
+template <typename T>
+typename mpmc_queue<T>::size_type mpmc_queue<T>::capacity() const {
+  return mask_ + 1;
+}
+
+// producer side
+
+// Appends a copy of value, returns false if the queue is full
+template <typename T>
+bool mpmc_queue<T>::try_push(const_reference value) {
+  return try_emplace(value);
+}
+
+// Appends value by moving it, returns false if the queue is full
+template <typename T>
+bool mpmc_queue<T>::try_push(value_type&& value) {
+  return try_emplace(std::move(value));
+}
+
+// Constructs a new element in place, returns false if the queue is full.
+// A claimed cell has to be published, so a constructor that may throw runs
+// before the claim and the element is then moved into the cell
+template <typename T>
+template <typename... Args>
+bool mpmc_queue<T>::try_emplace(Args&&... args) {
+  if constexpr (std::is_nothrow_constructible<T, Args&&...>::value) {
+    Cell* cell = Claim(enqueue_pos_, 0);
+    if (cell == nullptr) return false;
+    size_type position = cell->sequence.load(std::memory_order_relaxed);
+    new (&cell->storage) T(std::forward<Args>(args)...);
+    cell->sequence.store(position + 1, std::memory_order_release);
+    return true;
+  } else {
+    static_assert(std::is_nothrow_move_constructible<T>::value,
+                  "mpmc_queue needs a nothrow move constructor to emplace "
+                  "with a constructor that may throw");
+    T value(std::forward<Args>(args)...);
+    return try_emplace(std::move(value));
+  }
+}
+
+// Appends a copy of value, spinning while the queue is full
+template <typename T>
+void mpmc_queue<T>::push(const_reference value) {
+  while (!try_emplace(value)) std::this_thread::yield();
+}
+
+// Appends value by moving it, spinning while the queue is full
+template <typename T>
+void mpmc_queue<T>::push(value_type&& value) {
+  while (!try_emplace(std::move(value))) std::this_thread::yield();
+}
+
+// Appends elements of [first, last) until the queue is full, returns the
+// number of elements pushed
+template <typename T>
+template <typename InputIt>
+typename mpmc_queue<T>::size_type mpmc_queue<T>::try_push_many(InputIt first,
+                                                               InputIt last) {
+  size_type pushed = 0;
+  for (; first != last && try_emplace(*first); ++first) ++pushed;
+  return pushed;
+}
+
+// consumer side
+
+// Moves the oldest element into value, returns false if the queue is empty
+template <typename T>
+bool mpmc_queue<T>::try_pop(reference value) {
+  return Take([&value](T&& item) { value = std::move(item); });
+}
+
+// Moves the oldest element into value, spinning while the queue is empty
+template <typename T>
+void mpmc_queue<T>::pop(reference value) {
+  while (!try_pop(value)) std::this_thread::yield();
+}
+
+// Moves up to max_count elements to out, returns the number of elements
+// popped
+template <typename T>
+template <typename OutputIt>
+typename mpmc_queue<T>::size_type mpmc_queue<T>::try_pop_many(
+    OutputIt out, size_type max_count) {
+  size_type popped = 0;
+  while (popped < max_count &&
+         Take([&out](T&& item) { *out++ = std::move(item); })) {
+    ++popped;
+  }
+  return popped;
+}
+
+// helpers
+
+// Advances position past the next cell whose sequence equals position + turn
+// (turn is 0 for producers and 1 for consumers). Returns nullptr when the cell
+// still belongs to the previous lap, i.e. the queue is full or empty
+template <typename T>
+typename mpmc_queue<T>::Cell* mpmc_queue<T>::Claim(
+    std::atomic<size_type>& position, size_type turn) {
+  size_type pos = position.load(std::memory_order_relaxed);
+  for (;;) {
+    Cell* cell = &cells_[pos & mask_];
+    size_type sequence = cell->sequence.load(std::memory_order_acquire);
+    std::ptrdiff_t diff = static_cast<std::ptrdiff_t>(sequence) -
+                          static_cast<std::ptrdiff_t>(pos + turn);
+    if (diff == 0) {
+      if (position.compare_exchange_weak(pos, pos + 1,
+                                         std::memory_order_relaxed)) {
+        return cell;
+      }
+    } else if (diff < 0) {
+      return nullptr;
+    } else {
+      pos = position.load(std::memory_order_relaxed);
+    }
+  }
+}
+
+// Claims the oldest element, hands it to take as an rvalue and frees its
+// cell, returns false if the queue is empty. The claim cannot be undone, so
+// if take throws the element is dropped and its cell is still released for
+// the next lap, otherwise every later consumer would wait on it forever
+template <typename T>
+template <typename F>
+bool mpmc_queue<T>::Take(F take) {
+  Cell* cell = Claim(dequeue_pos_, 1);
+  if (cell == nullptr) return false;
+  size_type position = cell->sequence.load(std::memory_order_relaxed) - 1;
+  T* slot = Value(cell);
+  try {
+    take(std::move(*slot));
+  } catch (...) {
+    slot->~T();
+    cell->sequence.store(position + mask_ + 1, std::memory_order_release);
+    throw;
+  }
+  slot->~T();
+  cell->sequence.store(position + mask_ + 1, std::memory_order_release);
+  return true;
+}
+
+// Returns the element stored in a cell
+template <typename T>
+T* mpmc_queue<T>::Value(Cell* cell) {
+  return std::launder(reinterpret_cast<T*>(&cell->storage));
+}
+
+}  // namespace s21
+
+#endif
@@ -0,0 +1,213 @@
+#include "s21_multimap.hpp"
+
+namespace s21 {
+
+template <typename T, typename V, typename Compare, typename Allocator>
+multimap<T, V, Compare, Allocator>::multimap() : tree_() {}
+
+template <typename T, typename V, typename Compare, typename Allocator>
+multimap<T, V, Compare, Allocator>::multimap(const Compare& comp,
+                                             const Allocator& alloc)
+    : tree_(comp, alloc) {}
+
+template <typename T, typename V, typename Compare, typename Allocator>
+multimap<T, V, Compare, Allocator>::multimap(const Allocator& alloc)
+    : tree_(Compare(), alloc) {}
+
+template <typename T, typename V, typename Compare, typename Allocator>
+multimap<T, V, Compare, Allocator>::multimap(
+    std::initializer_list<value_type> const& items, const Allocator& alloc)
+    : tree_(Compare(), alloc) {
+  for (auto i = items.begin(); i != items.end(); i++) {
+    insert(*i);
+  }
+}
+
+template <typename T, typename V, typename Compare, typename Allocator>
+multimap<T, V, Compare, Allocator>::multimap(const multimap& m)
+    : tree_(m.get_tree()) {}
+
+template <typename T, typename V, typename Compare, typename Allocator>
+multimap<T, V, Compare, Allocator>::multimap(const multimap& m,
+                                             const Allocator& alloc)
+    : tree_(m.tree_, alloc) {}
+
+template <typename T, typename V, typename Compare, typename Allocator>
+multimap<T, V, Compare, Allocator>::multimap(multimap&& m,
+                                             const Allocator& alloc)
+    : tree_(std::move(m.tree_), alloc) {}
+
+template <typename T, typename V, typename Compare, typename Allocator>
+multimap<T, V, Compare, Allocator>&
+multimap<T, V, Compare, Allocator>::operator=(multimap&& m) {
+  if (this != &m) {
+    tree_ = std::move(m.tree_);
+  }
+
+  return *this;
+}
+
+// Always inserts; the new element goes after its equivalents
+template <typename T, typename V, typename Compare, typename Allocator>
+typename multimap<T, V, Compare, Allocator>::iterator
+multimap<T, V, Compare, Allocator>::insert(const value_type& value) {
+  return iterator(tree_.InsertEqual(value));
+}
+
+template <typename T, typename V, typename Compare, typename Allocator>
+typename multimap<T, V, Compare, Allocator>::iterator
+multimap<T, V, Compare, Allocator>::insert(
+    const key_type& key, const mapped_type& obj) {
+  return insert(value_type(key, obj));
+}
+
+template <typename T, typename V, typename Compare, typename Allocator>
+typename multimap<T, V, Compare, Allocator>::iterator
+multimap<T, V, Compare, Allocator>::begin() {
+  Node<value_type, V>* node = tree_.GetRoot();
+  if (node == nullptr) return iterator(nullptr);
+
+  while (node->left != nullptr) {
+    node = node->left;
+  }
+
+  return iterator(node);
+}
+
+template <typename T, typename V, typename Compare, typename Allocator>
+typename multimap<T, V, Compare, Allocator>::iterator
+multimap<T, V, Compare, Allocator>::end() {
+  return iterator(nullptr, tree_.GetRoot());
+}
+
+template <typename T, typename V, typename Compare, typename Allocator>
+bool multimap<T, V, Compare, Allocator>::empty() {
+  return tree_.GetRoot() == nullptr;
+}
+
+template <typename T, typename V, typename Compare, typename Allocator>
+typename multimap<T, V, Compare, Allocator>::size_type
+multimap<T, V, Compare, Allocator>::size() {
+  return tree_.GetRoot() ? tree_.GetRoot()->size_ : 0;
+}
+
+template <typename T, typename V, typename Compare, typename Allocator>
+typename multimap<T, V, Compare, Allocator>::size_type
+multimap<T, V, Compare, Allocator>::max_size() {
+  return std::allocator_traits<Allocator>::max_size(tree_.GetAllocator()) /
+         10;
+}
+
+template <typename T, typename V, typename Compare, typename Allocator>
+void multimap<T, V, Compare, Allocator>::shrink_to_fit() {
+  tree_.ShrinkToFit();
+}
+
+template <typename T, typename V, typename Compare, typename Allocator>
+void multimap<T, V, Compare, Allocator>::clear() {
+  tree_.Clear();
+}
+
+template <typename T, typename V, typename Compare, typename Allocator>
+void multimap<T, V, Compare, Allocator>::erase(iterator pos) {
+  if (pos != nullptr) {
+    tree_.Erase(pos.GetNode());
+  }
+}
+
+// Removes every element with a key equivalent to key, returns their number
+template <typename T, typename V, typename Compare, typename Allocator>
+typename multimap<T, V, Compare, Allocator>::size_type
+multimap<T, V, Compare, Allocator>::erase(const T& key) {
+  return tree_.RemoveAll(key);
+}
+
+template <typename T, typename V, typename Compare, typename Allocator>
+void multimap<T, V, Compare, Allocator>::swap(multimap& other) {
+  tree_.Swap(other.tree_);
+}
+
+// Every element of other is moved here, equal keys included
+template <typename T, typename V, typename Compare, typename Allocator>
+void multimap<T, V, Compare, Allocator>::merge(multimap& other) {
+  if (this == &other) return;
+  for (iterator iter = other.begin(); iter != other.end(); ++iter) {
+    insert(*iter);
+  }
+  other.clear();
+}
+
+template <typename T, typename V, typename Compare, typename Allocator>
+typename multimap<T, V, Compare, Allocator>::size_type
+multimap<T, V, Compare, Allocator>::count(const T& key) {
+  return tree_.Count(key);
+}
+
+template <typename T, typename V, typename Compare, typename Allocator>
+bool multimap<T, V, Compare, Allocator>::contains(const T& key) {
+  return tree_.Search(key) != nullptr;
+}
+
+// Returns the first of the equivalent elements
+template <typename T, typename V, typename Compare, typename Allocator>
+typename multimap<T, V, Compare, Allocator>::iterator
+multimap<T, V, Compare, Allocator>::find(const T& key) {
+  return IteratorFor(tree_.Search(key));
+}
+
+template <typename T, typename V, typename Compare, typename Allocator>
+typename multimap<T, V, Compare, Allocator>::iterator
+multimap<T, V, Compare, Allocator>::lower_bound(const T& key) {
+  return IteratorFor(tree_.LowerBound(key));
+}
+
+template <typename T, typename V, typename Compare, typename Allocator>
+typename multimap<T, V, Compare, Allocator>::iterator
+multimap<T, V, Compare, Allocator>::upper_bound(const T& key) {
+  return IteratorFor(tree_.UpperBound(key));
+}
+
+template <typename T, typename V, typename Compare, typename Allocator>
+std::pair<typename multimap<T, V, Compare, Allocator>::iterator,
+          typename multimap<T, V, Compare, Allocator>::iterator>
+multimap<T, V, Compare, Allocator>::equal_range(const T& key) {
+  auto nodes = tree_.EqualRange(key);
+  return std::make_pair(IteratorFor(nodes.first), IteratorFor(nodes.second));
+}
+
+template <typename T, typename V, typename Compare, typename Allocator>
+RangeView<typename multimap<T, V, Compare, Allocator>::iterator>
+multimap<T, V, Compare, Allocator>::range(const T& first, const T& last) {
+  return RangeView<iterator>(lower_bound(first), lower_bound(last));
+}
+
+template <typename T, typename V, typename Compare, typename Allocator>
+typename multimap<T, V, Compare, Allocator>::iterator
+multimap<T, V, Compare, Allocator>::IteratorFor(Node<value_type, V>* node) {
+  return node != nullptr ? iterator(node) : end();
+}
+
+template <typename T, typename V, typename Compare, typename Allocator>
+typename multimap<T, V, Compare, Allocator>::key_compare
+multimap<T, V, Compare, Allocator>::key_comp() const {
+  return tree_.GetCompare();
+}
+
+template <typename T, typename V, typename Compare, typename Allocator>
+typename multimap<T, V, Compare, Allocator>::allocator_type
+multimap<T, V, Compare, Allocator>::get_allocator() const {
+  return tree_.GetAllocator();
+}
+
+template <typename T, typename V, typename Compare, typename Allocator>
+const typename multimap<T, V, Compare, Allocator>::tree_type&
+multimap<T, V, Compare, Allocator>::get_tree() const {
+  return tree_;
+}
+
+template <typename T, typename V, typename Compare, typename Allocator>
+container_stats multimap<T, V, Compare, Allocator>::stats() const {
+  return tree_.GetStats();
+}
+
+}  // namespace s21
@@ -0,0 +1,80 @@
+#ifndef S21_MULTIMAP_H
+#define S21_MULTIMAP_H
+
+#include "../AVLTree/AVLTree.cpp"
+
+namespace s21 {
+// Ordered key-value container that admits equivalent keys, on the same AVL
+// core as map. Values with equal keys keep their insertion order
+template <typename T, typename V, typename Compare = std::less<T>,
+          typename Allocator = std::allocator<std::pair<const T, V>>>
+class multimap {
+ public:
+  using key_type = T;
+  using mapped_type = V;
+  using value_type = std::pair<const key_type, mapped_type>;
+  using key_compare = Compare;
+  using iterator = Iterator<value_type, V>;
+  using const_iterator = ConstIterator<value_type, V>;
+  using size_type = size_t;
+  using allocator_type = Allocator;
+  using tree_type = AVLTree<value_type, V, Compare, PairFirstKey<value_type>,
+                            Allocator>;
+
+  multimap();
+  explicit multimap(const Compare &comp, const Allocator &alloc = Allocator());
+  explicit multimap(const Allocator &alloc);
+  multimap(std::initializer_list<value_type> const &items,
+           const Allocator &alloc = Allocator());
+  multimap(const multimap &m);
+  multimap(const multimap &m, const Allocator &alloc);
+  multimap(multimap &&m) = default;
+  multimap(multimap &&m, const Allocator &alloc);
+  ~multimap(){};
+  multimap &operator=(multimap &&m);
+
+  iterator begin();
+  iterator end();
+
+  bool empty();
+  size_type size();
+  size_type max_size();
+  // Frees the node memory that erasures left unused; iterators stay valid
+  void shrink_to_fit();
+
+  void clear();
+  iterator insert(const value_type &value);
+  iterator insert(const key_type &key, const mapped_type &obj);
+  void erase(iterator pos);
+  size_type erase(const T &key);
+  void swap(multimap &other);
+  void merge(multimap &other);
+
+  size_type count(const T &key);
+  bool contains(const T &key);
+  iterator find(const T &key);
+  iterator lower_bound(const T &key);
+  iterator upper_bound(const T &key);
+  std::pair<iterator, iterator> equal_range(const T &key);
+  // Elements with keys in [first, last)
+  RangeView<iterator> range(const T &first, const T &last);
+
+  key_compare key_comp() const;
+  allocator_type get_allocator() const;
+  const tree_type &get_tree() const;
+  container_stats stats() const;
+
+ private:
+  tree_type tree_;
+
+  iterator IteratorFor(Node<value_type, V> *node);
+};
+
+namespace pmr {
+template <typename T, typename V, typename Compare = std::less<T>>
+using multimap = s21::multimap<
+    T, V, Compare, std::pmr::polymorphic_allocator<std::pair<const T, V>>>;
+}  // namespace pmr
+}  // namespace s21
+
+#endif  // S21_MULTIMAP_H
@@ -0,0 +1,207 @@
+#include "s21_multiset.hpp"
+
+namespace s21 {
+template <typename T, typename Compare, typename Allocator>
+multiset<T, Compare, Allocator>::multiset() : tree_() {}
+
+template <typename T, typename Compare, typename Allocator>
+multiset<T, Compare, Allocator>::multiset(const Compare& comp,
+                                          const Allocator& alloc)
+    : tree_(comp, alloc) {}
+
+template <typename T, typename Compare, typename Allocator>
+multiset<T, Compare, Allocator>::multiset(const Allocator& alloc)
+    : tree_(Compare(), alloc) {}
+
+template <typename T, typename Compare, typename Allocator>
+multiset<T, Compare, Allocator>::multiset(
+    std::initializer_list<value_type> const& items, const Allocator& alloc)
+    : tree_(Compare(), alloc) {
+  for (auto i = items.begin(); i != items.end(); i++) {
+    insert(*i);
+  }
+}
+
+template <typename T, typename Compare, typename Allocator>
+multiset<T, Compare, Allocator>::multiset(const multiset& s)
+    : tree_(s.get_tree()) {}
+
+template <typename T, typename Compare, typename Allocator>
+multiset<T, Compare, Allocator>::multiset(const multiset& s,
+                                          const Allocator& alloc)
+    : tree_(s.tree_, alloc) {}
+
+template <typename T, typename Compare, typename Allocator>
+multiset<T, Compare, Allocator>::multiset(multiset&& s, const Allocator& alloc)
+    : tree_(std::move(s.tree_), alloc) {}
+
+template <typename T, typename Compare, typename Allocator>
+multiset<T, Compare, Allocator>& multiset<T, Compare, Allocator>::operator=(
+    multiset&& s) {
+  if (this != &s) {
+    tree_ = std::move(s.tree_);
+  }
+
+  return *this;
+}
+
+template <typename T, typename Compare, typename Allocator>
+typename multiset<T, Compare, Allocator>::iterator
+multiset<T, Compare, Allocator>::begin() {
+  Node<T, T>* node = tree_.GetRoot();
+
+  if (node == nullptr) {
+    return iterator(nullptr);
+  }
+
+  while (node->left != nullptr) {
+    node = node->left;
+  }
+
+  return iterator(node);
+}
+
+template <typename T, typename Compare, typename Allocator>
+typename multiset<T, Compare, Allocator>::iterator
+multiset<T, Compare, Allocator>::end() {
+  return iterator(nullptr, tree_.GetRoot());
+}
+
+template <typename T, typename Compare, typename Allocator>
+bool multiset<T, Compare, Allocator>::empty() {
+  return tree_.GetRoot() == nullptr;
+}
+
+template <typename T, typename Compare, typename Allocator>
+typename multiset<T, Compare, Allocator>::size_type
+multiset<T, Compare, Allocator>::size() {
+  return tree_.GetRoot() ? tree_.GetRoot()->size_ : 0;
+}
+
+template <typename T, typename Compare, typename Allocator>
+typename multiset<T, Compare, Allocator>::size_type
+multiset<T, Compare, Allocator>::max_size() {
+  return std::allocator_traits<Allocator>::max_size(tree_.GetAllocator()) /
+         10;
+}
+
+template <typename T, typename Compare, typename Allocator>
+void multiset<T, Compare, Allocator>::shrink_to_fit() {
+  tree_.ShrinkToFit();
+}
+
+template <typename T, typename Compare, typename Allocator>
+void multiset<T, Compare, Allocator>::clear() {
+  tree_.Clear();
+}
+
+// Always inserts; the new element goes after its equivalents
+template <typename T, typename Compare, typename Allocator>
+typename multiset<T, Compare, Allocator>::iterator
+multiset<T, Compare, Allocator>::insert(const T& value) {
+  return iterator(tree_.InsertEqual(value));
+}
+
+template <typename T, typename Compare, typename Allocator>
+void multiset<T, Compare, Allocator>::erase(iterator pos) {
+  if (pos != nullptr) {
+    tree_.Erase(pos.GetNode());
+  }
+}
+
+// Removes every element equivalent to key, returns how many were removed
+template <typename T, typename Compare, typename Allocator>
+typename multiset<T, Compare, Allocator>::size_type
+multiset<T, Compare, Allocator>::erase(const T& key) {
+  return tree_.RemoveAll(key);
+}
+
+template <typename T, typename Compare, typename Allocator>
+void multiset<T, Compare, Allocator>::swap(multiset& other) {
+  tree_.Swap(other.tree_);
+}
+
+template <typename T, typename Compare, typename Allocator>
+void multiset<T, Compare, Allocator>::merge(multiset& other) {
+  if (this != &other) {
+    for (auto i = other.begin(); i != other.end(); i++) {
+      insert(*i);
+    }
+    other.clear();
+  }
+}
+
+template <typename T, typename Compare, typename Allocator>
+typename multiset<T, Compare, Allocator>::size_type
+multiset<T, Compare, Allocator>::count(const T& key) {
+  return tree_.Count(key);
+}
+
+template <typename T, typename Compare, typename Allocator>
+bool multiset<T, Compare, Allocator>::contains(const T& key) {
+  return tree_.Search(key) != nullptr;
+}
+
+// Returns the first of the equivalent elements
+template <typename T, typename Compare, typename Allocator>
+typename multiset<T, Compare, Allocator>::iterator
+multiset<T, Compare, Allocator>::find(const T& key) {
+  return IteratorFor(tree_.Search(key));
+}
+
+template <typename T, typename Compare, typename Allocator>
+typename multiset<T, Compare, Allocator>::iterator
+multiset<T, Compare, Allocator>::lower_bound(const T& key) {
+  return IteratorFor(tree_.LowerBound(key));
+}
+
+template <typename T, typename Compare, typename Allocator>
+typename multiset<T, Compare, Allocator>::iterator
+multiset<T, Compare, Allocator>::upper_bound(const T& key) {
+  return IteratorFor(tree_.UpperBound(key));
+}
+
+template <typename T, typename Compare, typename Allocator>
+std::pair<typename multiset<T, Compare, Allocator>::iterator,
+          typename multiset<T, Compare, Allocator>::iterator>
+multiset<T, Compare, Allocator>::equal_range(const T& key) {
+  auto nodes = tree_.EqualRange(key);
+  return std::make_pair(IteratorFor(nodes.first), IteratorFor(nodes.second));
+}
+
+template <typename T, typename Compare, typename Allocator>
+RangeView<typename multiset<T, Compare, Allocator>::iterator>
+multiset<T, Compare, Allocator>::range(const T& first, const T& last) {
+  return RangeView<iterator>(lower_bound(first), lower_bound(last));
+}
+
+template <typename T, typename Compare, typename Allocator>
+typename multiset<T, Compare, Allocator>::iterator
+multiset<T, Compare, Allocator>::IteratorFor(Node<T, T>* node) {
+  return node != nullptr ? iterator(node) : end();
+}
+
+template <typename T, typename Compare, typename Allocator>
+typename multiset<T, Compare, Allocator>::key_compare
+multiset<T, Compare, Allocator>::key_comp() const {
+  return tree_.GetCompare();
+}
+
+template <typename T, typename Compare, typename Allocator>
+typename multiset<T, Compare, Allocator>::allocator_type
+multiset<T, Compare, Allocator>::get_allocator() const {
+  return tree_.GetAllocator();
+}
+
+template <typename T, typename Compare, typename Allocator>
+const typename multiset<T, Compare, Allocator>::tree_type&
+multiset<T, Compare, Allocator>::get_tree() const {
+  return tree_;
+}
+
+template <typename T, typename Compare, typename Allocator>
+container_stats multiset<T, Compare, Allocator>::stats() const {
+  return tree_.GetStats();
+}
+
+}  // namespace s21
@@ -0,0 +1,77 @@
+#ifndef S21_MULTISET_H
+#define S21_MULTISET_H
+
+#include "../AVLTree/AVLTree.cpp"
+
+namespace s21 {
+// Ordered container that admits equivalent keys. Shares the AVL core with
+// set: duplicates are kept in insertion order, count() is answered from the
+// subtree sizes and erase(key) removes all k copies in O(log n + k)
+template <typename T, typename Compare = std::less<T>,
+          typename Allocator = std::allocator<T>>
+class multiset {
+ public:
+  using key_type = T;
+  using value_type = T;
+  using key_compare = Compare;
+  using iterator = Iterator<T, T>;
+  using const_iterator = ConstIterator<T, T>;
+  using size_type = size_t;
+  using allocator_type = Allocator;
+  using tree_type = AVLTree<T, T, Compare, IdentityKey<T>, Allocator>;
+
+  multiset();
+  explicit multiset(const Compare& comp, const Allocator& alloc = Allocator());
+  explicit multiset(const Allocator& alloc);
+  multiset(std::initializer_list<value_type> const& items,
+           const Allocator& alloc = Allocator());
+  multiset(const multiset& s);
+  multiset(const multiset& s, const Allocator& alloc);
+  multiset(multiset&& s) = default;
+  multiset(multiset&& s, const Allocator& alloc);
+  multiset& operator=(multiset&& s);
+  ~multiset(){};
+
+  iterator begin();
+  iterator end();
+
+  bool empty();
+  size_type size();
+  size_type max_size();
+  // Frees the node memory that erasures left unused; iterators stay valid
+  void shrink_to_fit();
+
+  void clear();
+  iterator insert(const T& value);
+  void erase(iterator pos);
+  size_type erase(const T& key);
+  void swap(multiset& other);
+  void merge(multiset& other);
+
+  size_type count(const T& key);
+  bool contains(const T& key);
+  iterator find(const T& key);
+  iterator lower_bound(const T& key);
+  iterator upper_bound(const T& key);
+  std::pair<iterator, iterator> equal_range(const T& key);
+  // Elements with keys in [first, last)
+  RangeView<iterator> range(const T& first, const T& last);
+
+  key_compare key_comp() const;
+  allocator_type get_allocator() const;
+  const tree_type& get_tree() const;
+  container_stats stats() const;
+
+ private:
+  tree_type tree_;
+
+  iterator IteratorFor(Node<T, T>* node);
+};
+
+namespace pmr {
+template <typename T, typename Compare = std::less<T>>
+using multiset = s21::multiset<T, Compare, std::pmr::polymorphic_allocator<T>>;
+}  // namespace pmr
+}  // namespace s21
+
+#endif  // S21_MULTISET_H
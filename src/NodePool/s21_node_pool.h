@@ -0,0 +1,80 @@
+#ifndef S21_CONTAINERS_NODE_POOL_H
+#define S21_CONTAINERS_NODE_POOL_H
+
+#include <cstddef>
+#include <memory>
+
+namespace s21 {
+// Node storage of a single tree. Nodes are carved out of blocks: Reserve
+// allocates one block for a known number of nodes, as a copy does, and
+// insertions otherwise take blocks that grow from kMinBlock to kMaxBlock
+// nodes. Destroyed nodes go on a free list for the next insertion; blocks
+// are returned by Release, once every node has been destroyed, and by
+// ShrinkToFit, which frees the blocks none of whose nodes are alive. A tree
+// that grew and then lost most of its nodes keeps its peak memory until
+// then, since its nodes are spread over the blocks and are never moved.
+//
+// Blocks come from Allocator rebound to the slot type. Moving and swapping
+// follow the allocator's propagation traits; when they do not propagate, the
+// owner must only move or swap pools with equal allocators.
+template <typename Node, typename Allocator = std::allocator<Node>>
+class NodePool {
+ public:
+  using allocator_type = Allocator;
+
+  explicit NodePool(const Allocator& alloc = Allocator());
+  NodePool(const NodePool&) = delete;
+  NodePool(NodePool&& other) noexcept;
+  NodePool& operator=(const NodePool&) = delete;
+  NodePool& operator=(NodePool&& other) noexcept;
+  ~NodePool();
+
+  allocator_type GetAllocator() const;
+
+  // Makes room for count more nodes in a single block
+  void Reserve(size_t count);
+  template <typename... Args>
+  Node* Create(Args&&... args);
+  void Destroy(Node* node);
+  void Release();
+  // Frees the blocks whose slots are all unused; live nodes stay where they
+  // are. O(f log b) for f free slots and b blocks
+  void ShrinkToFit();
+  void Swap(NodePool& other) noexcept;
+
+ private:
+  static constexpr size_t kMinBlock = 16;
+  static constexpr size_t kMaxBlock = 4096;
+
+  // A free slot links the next free one; the first slot of every block
+  // links the block allocated before it and keeps the block's length for
+  // the deallocation, and a count of its free slots for ShrinkToFit
+  union Slot {
+    Slot* next;
+    struct {
+      Slot* previous;
+      size_t count;
+      size_t free;
+    } block;
+    alignas(Node) unsigned char bytes[sizeof(Node)];
+  };
+  using slot_allocator =
+      typename std::allocator_traits<Allocator>::template rebind_alloc<Slot>;
+  using slot_traits = std::allocator_traits<slot_allocator>;
+
+  slot_allocator allocator_;
+  Slot* blocks_;
+  Slot* free_;
+  Slot* next_;  // unused slots of the newest block, up to end_
+  Slot* end_;
+  size_t grow_;
+
+  void AddBlock(size_t count);
+  void RetireNewest();
+  void SwapStorage(NodePool& other) noexcept;
+};
+}  // namespace s21
+
+#include "s21_node_pool.tpp"
+
+#endif
@@ -0,0 +1,188 @@
+#ifndef S21_CONTAINERS_NODE_POOL_TPP
+#define S21_CONTAINERS_NODE_POOL_TPP
+
+#include <algorithm>
+#include <functional>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace s21 {
+
+// functions
+
+template <typename Node, typename Allocator>
+NodePool<Node, Allocator>::NodePool(const Allocator& alloc)
+    : allocator_(alloc),
+      blocks_(nullptr),
+      free_(nullptr),
+      next_(nullptr),
+      end_(nullptr),
+      grow_(kMinBlock) {}
+
+template <typename Node, typename Allocator>
+NodePool<Node, Allocator>::NodePool(NodePool&& other) noexcept
+    : NodePool(Allocator(std::move(other.allocator_))) {
+  SwapStorage(other);
+}
+
+template <typename Node, typename Allocator>
+NodePool<Node, Allocator>& NodePool<Node, Allocator>::operator=(
+    NodePool&& other) noexcept {
+  if (this != &other) {
+    Release();
+    if constexpr (slot_traits::propagate_on_container_move_assignment::value) {
+      allocator_ = std::move(other.allocator_);
+    }
+    SwapStorage(other);
+  }
+  return *this;
+}
+
+template <typename Node, typename Allocator>
+NodePool<Node, Allocator>::~NodePool() {
+  Release();
+}
+
+template <typename Node, typename Allocator>
+typename NodePool<Node, Allocator>::allocator_type
+NodePool<Node, Allocator>::GetAllocator() const {
+  return allocator_type(allocator_);
+}
+
+template <typename Node, typename Allocator>
+void NodePool<Node, Allocator>::Reserve(size_t count) {
+  if (static_cast<size_t>(end_ - next_) < count) AddBlock(count);
+}
+
+template <typename Node, typename Allocator>
+template <typename... Args>
+Node* NodePool<Node, Allocator>::Create(Args&&... args) {
+  Slot* slot = free_;
+  if (slot != nullptr) {
+    free_ = slot->next;
+  } else {
+    if (next_ == end_) {
+      AddBlock(grow_);
+      if (grow_ < kMaxBlock) grow_ *= 2;
+    }
+    slot = next_++;
+  }
+  Node* node = reinterpret_cast<Node*>(slot->bytes);
+  try {
+    slot_traits::construct(allocator_, node, std::forward<Args>(args)...);
+    return node;
+  } catch (...) {
+    slot->next = free_;
+    free_ = slot;
+    throw;
+  }
+}
+
+template <typename Node, typename Allocator>
+void NodePool<Node, Allocator>::Destroy(Node* node) {
+  slot_traits::destroy(allocator_, node);
+  Slot* slot = reinterpret_cast<Slot*>(node);
+  slot->next = free_;
+  free_ = slot;
+}
+
+template <typename Node, typename Allocator>
+void NodePool<Node, Allocator>::Release() {
+  while (blocks_ != nullptr) {
+    Slot* previous = blocks_->block.previous;
+    slot_traits::deallocate(allocator_, blocks_, blocks_->block.count);
+    blocks_ = previous;
+  }
+  free_ = next_ = end_ = nullptr;
+  grow_ = kMinBlock;
+}
+
+// Every unused slot is first put on the free list and counted against its
+// block, found by a binary search over the blocks sorted by address; then
+// the empty blocks drop their slots from the free list and are freed
+template <typename Node, typename Allocator>
+void NodePool<Node, Allocator>::ShrinkToFit() {
+  RetireNewest();
+  std::vector<Slot*> blocks;
+  for (Slot* block = blocks_; block != nullptr;
+       block = block->block.previous) {
+    block->block.free = 0;
+    blocks.push_back(block);
+  }
+  std::sort(blocks.begin(), blocks.end(), std::less<Slot*>());
+  auto owner = [&blocks](Slot* slot) {
+    return *(std::upper_bound(blocks.begin(), blocks.end(), slot,
+                              std::less<Slot*>()) -
+             1);
+  };
+  auto empty = [](Slot* block) {
+    return block->block.free + 1 == block->block.count;
+  };
+
+  for (Slot* slot = free_; slot != nullptr; slot = slot->next) {
+    ++owner(slot)->block.free;
+  }
+  for (Slot** link = &free_; *link != nullptr;) {
+    if (empty(owner(*link))) {
+      *link = (*link)->next;
+    } else {
+      link = &(*link)->next;
+    }
+  }
+  for (Slot** link = &blocks_; *link != nullptr;) {
+    Slot* block = *link;
+    if (empty(block)) {
+      *link = block->block.previous;
+      slot_traits::deallocate(allocator_, block, block->block.count);
+    } else {
+      link = &block->block.previous;
+    }
+  }
+  if (blocks_ == nullptr) grow_ = kMinBlock;
+}
+
+template <typename Node, typename Allocator>
+void NodePool<Node, Allocator>::Swap(NodePool& other) noexcept {
+  if constexpr (slot_traits::propagate_on_container_swap::value) {
+    std::swap(allocator_, other.allocator_);
+  }
+  SwapStorage(other);
+}
+
+// helpers
+
+template <typename Node, typename Allocator>
+void NodePool<Node, Allocator>::SwapStorage(NodePool& other) noexcept {
+  std::swap(blocks_, other.blocks_);
+  std::swap(free_, other.free_);
+  std::swap(next_, other.next_);
+  std::swap(end_, other.end_);
+  std::swap(grow_, other.grow_);
+}
+
+// The unused slots of the current block stay available on the free list
+template <typename Node, typename Allocator>
+void NodePool<Node, Allocator>::AddBlock(size_t count) {
+  Slot* block = slot_traits::allocate(allocator_, count + 1);
+  block->block.previous = blocks_;
+  block->block.count = count + 1;
+  blocks_ = block;
+  RetireNewest();
+  next_ = block + 1;
+  end_ = block + count + 1;
+}
+
+// Moves the untouched slots of the newest block to the free list
+template <typename Node, typename Allocator>
+void NodePool<Node, Allocator>::RetireNewest() {
+  for (; next_ != end_; ++next_) {
+    next_->next = free_;
+    free_ = next_;
+  }
+  next_ = end_ = nullptr;
+}
+
+}  // namespace s21
+
+#endif
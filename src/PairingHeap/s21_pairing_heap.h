@@ -0,0 +1,135 @@
+#ifndef S21_CONTAINERS_PAIRING_HEAP_H
+#define S21_CONTAINERS_PAIRING_HEAP_H
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <memory_resource>
+#include <stdexcept>
+#include <utility>
+
+#include "../NodePool/s21_node_pool.h"
+
+namespace s21 {
+// Addressable priority queue: a pairing heap whose push returns a handle to
+// the element, valid until the element is popped or erased. top() is the
+// greatest element by Compare, as in priority_queue.
+//
+// update moves an element toward the top in O(1), the decrease-key of
+// Dijkstra's and Prim's algorithms under std::greater; moving it away from
+// the top and erase cost a pop. pop is O(log n) amortized. Nodes come from a
+// NodePool, so a heap that shrinks and grows again does not allocate.
+//
+// The pool's blocks come from Allocator. Moving a heap to one whose
+// allocator is unequal and does not propagate pushes the elements one at a
+// time, so handles to them do not carry over.
+template <typename T, typename Compare = std::less<T>,
+          typename Allocator = std::allocator<T>>
+class pairing_heap {
+  struct Node;
+  using alloc_traits = std::allocator_traits<Allocator>;
+  static constexpr bool kNothrowMoveAssign =
+      alloc_traits::propagate_on_container_move_assignment::value ||
+      alloc_traits::is_always_equal::value;
+
+ public:
+  // member type
+  using value_type = T;
+  using reference = T&;
+  using const_reference = const T&;
+  using value_compare = Compare;
+  using size_type = size_t;
+  using allocator_type = Allocator;
+
+  // Names an element of the heap; default-constructed handles name none
+  class handle {
+   public:
+    handle() : node_(nullptr) {}
+    bool operator==(const handle& other) const { return node_ == other.node_; }
+    bool operator!=(const handle& other) const { return node_ != other.node_; }
+
+   private:
+    friend class pairing_heap;
+    explicit handle(Node* node) : node_(node) {}
+    Node* node_;
+  };
+
+  // functions
+  pairing_heap();
+  explicit pairing_heap(const Compare& comp,
+                        const Allocator& alloc = Allocator());
+  explicit pairing_heap(const Allocator& alloc);
+  pairing_heap(const pairing_heap&) = delete;
+  pairing_heap(pairing_heap&& other) noexcept;
+  pairing_heap(pairing_heap&& other, const Allocator& alloc);
+  pairing_heap& operator=(const pairing_heap&) = delete;
+  pairing_heap& operator=(pairing_heap&& other) noexcept(kNothrowMoveAssign);
+  ~pairing_heap();
+  allocator_type get_allocator() const;
+
+  // element access, std::out_of_range on an empty heap
+  const_reference top() const;
+  const_reference value(handle element) const;
+
+  // capacity
+  bool empty() const;
+  size_type size() const;
+  // Makes room for count more elements without allocating
+  void reserve(size_type count);
+
+  // modifiers
+  handle push(const_reference value);
+  handle push(value_type&& value);
+  template <typename... Args>
+  handle emplace(Args&&... args);
+  void pop();
+  // Replaces the value of element, which keeps its handle
+  void update(handle element, value_type value);
+  void erase(handle element);
+  void clear();
+  // The allocators must be equal unless they propagate on swap
+  void swap(pairing_heap& other) noexcept;
+
+  // observers
+  value_compare value_comp() const;
+
+ private:
+  // A node's prev is its parent when it is the first child and its left
+  // sibling otherwise; the root has neither prev nor sibling
+  struct Node {
+    template <typename... Args>
+    explicit Node(Args&&... args)
+        : value(std::forward<Args>(args)...),
+          child(nullptr),
+          sibling(nullptr),
+          prev(nullptr) {}
+
+    T value;
+    Node* child;
+    Node* sibling;
+    Node* prev;
+  };
+
+  Node* root_;
+  size_type size_;
+  NodePool<Node, Allocator> pool_;
+  Compare comp_;
+
+  handle Insert(Node* node);
+  Node* Meld(Node* first, Node* second);
+  Node* MergePairs(Node* first);
+  void Cut(Node* node);
+  static Node* Parent(Node* node);
+  void MoveElements(pairing_heap& other);
+};
+
+namespace pmr {
+template <typename T, typename Compare = std::less<T>>
+using pairing_heap =
+    s21::pairing_heap<T, Compare, std::pmr::polymorphic_allocator<T>>;
+}  // namespace pmr
+}  // namespace s21
+
+#include "s21_pairing_heap.tpp"
+
+#endif
@@ -0,0 +1,311 @@
+#ifndef S21_CONTAINERS_PAIRING_HEAP_TPP
+#define S21_CONTAINERS_PAIRING_HEAP_TPP
+
+namespace s21 {
+
+// functions
+
+template <typename T, typename Compare, typename Allocator>
+pairing_heap<T, Compare, Allocator>::pairing_heap()
+    : root_(nullptr), size_(0), pool_(), comp_() {}
+
+template <typename T, typename Compare, typename Allocator>
+pairing_heap<T, Compare, Allocator>::pairing_heap(
+    const Compare& comp, const Allocator& alloc)
+    : root_(nullptr), size_(0), pool_(alloc), comp_(comp) {}
+
+template <typename T, typename Compare, typename Allocator>
+pairing_heap<T, Compare, Allocator>::pairing_heap(const Allocator& alloc)
+    : pairing_heap(Compare(), alloc) {}
+
+template <typename T, typename Compare, typename Allocator>
+pairing_heap<T, Compare, Allocator>::pairing_heap(pairing_heap&& other) noexcept
+    : root_(std::exchange(other.root_, nullptr)),
+      size_(std::exchange(other.size_, 0)),
+      pool_(std::move(other.pool_)),
+      comp_(other.comp_) {}
+
+template <typename T, typename Compare, typename Allocator>
+pairing_heap<T, Compare, Allocator>::pairing_heap(
+    pairing_heap&& other, const Allocator& alloc)
+    : pairing_heap(other.comp_, alloc) {
+  if (get_allocator() == other.get_allocator()) {
+    swap(other);
+  } else {
+    MoveElements(other);
+  }
+}
+
+template <typename T, typename Compare, typename Allocator>
+pairing_heap<T, Compare, Allocator>&
+pairing_heap<T, Compare, Allocator>::operator=(
+    pairing_heap&& other) noexcept(kNothrowMoveAssign) {
+  if (this != &other) {
+    clear();
+    comp_ = other.comp_;
+    if (kNothrowMoveAssign || get_allocator() == other.get_allocator()) {
+      root_ = std::exchange(other.root_, nullptr);
+      size_ = std::exchange(other.size_, 0);
+      pool_ = std::move(other.pool_);
+    } else {
+      MoveElements(other);
+    }
+  }
+  return *this;
+}
+
+template <typename T, typename Compare, typename Allocator>
+pairing_heap<T, Compare, Allocator>::~pairing_heap() {
+  clear();
+}
+
+template <typename T, typename Compare, typename Allocator>
+typename pairing_heap<T, Compare, Allocator>::allocator_type
+pairing_heap<T, Compare, Allocator>::get_allocator() const {
+  return pool_.GetAllocator();
+}
+
+// element access
+
+template <typename T, typename Compare, typename Allocator>
+typename pairing_heap<T, Compare, Allocator>::const_reference
+pairing_heap<T, Compare, Allocator>::top() const {
+  if (empty()) throw std::out_of_range("Pairing heap is empty");
+  return root_->value;
+}
+
+template <typename T, typename Compare, typename Allocator>
+typename pairing_heap<T, Compare, Allocator>::const_reference
+pairing_heap<T, Compare, Allocator>::value(handle element) const {
+  return element.node_->value;
+}
+
+// capacity
+
+template <typename T, typename Compare, typename Allocator>
+bool pairing_heap<T, Compare, Allocator>::empty() const {
+  return size_ == 0;
+}
+
+template <typename T, typename Compare, typename Allocator>
+typename pairing_heap<T, Compare, Allocator>::size_type
+pairing_heap<T, Compare, Allocator>::size() const {
+  return size_;
+}
+
+template <typename T, typename Compare, typename Allocator>
+void pairing_heap<T, Compare, Allocator>::reserve(size_type count) {
+  pool_.Reserve(count);
+}
+
+// modifiers
+
+template <typename T, typename Compare, typename Allocator>
+typename pairing_heap<T, Compare, Allocator>::handle
+pairing_heap<T, Compare, Allocator>::push(const_reference value) {
+  return Insert(pool_.Create(value));
+}
+
+template <typename T, typename Compare, typename Allocator>
+typename pairing_heap<T, Compare, Allocator>::handle
+pairing_heap<T, Compare, Allocator>::push(value_type&& value) {
+  return Insert(pool_.Create(std::move(value)));
+}
+
+template <typename T, typename Compare, typename Allocator>
+template <typename... Args>
+typename pairing_heap<T, Compare, Allocator>::handle
+pairing_heap<T, Compare, Allocator>::emplace(Args&&... args) {
+  return Insert(pool_.Create(std::forward<Args>(args)...));
+}
+
+template <typename T, typename Compare, typename Allocator>
+void pairing_heap<T, Compare, Allocator>::pop() {
+  if (empty()) throw std::out_of_range("Pairing heap is empty");
+  Node* old = root_;
+  root_ = MergePairs(old->child);
+  pool_.Destroy(old);
+  --size_;
+}
+
+// Toward the top the node is cut with its subtree, which stays ordered, and
+// linked to the root. Away from the top its children may now outrank it, so
+// they are merged back into the heap separately
+template <typename T, typename Compare, typename Allocator>
+void pairing_heap<T, Compare, Allocator>::update(
+    handle element, value_type value) {
+  Node* node = element.node_;
+  bool raised = comp_(node->value, value);
+  node->value = std::move(value);
+  if (raised) {
+    if (node != root_) {
+      Cut(node);
+      root_ = Meld(root_, node);
+    }
+    return;
+  }
+  Node* children = node->child;
+  if (children == nullptr) return;
+  node->child = nullptr;
+  if (node == root_) {
+    root_ = MergePairs(children);
+  } else {
+    Cut(node);
+    root_ = Meld(root_, MergePairs(children));
+  }
+  root_ = Meld(root_, node);
+}
+
+template <typename T, typename Compare, typename Allocator>
+void pairing_heap<T, Compare, Allocator>::erase(handle element) {
+  Node* node = element.node_;
+  if (node == root_) {
+    pop();
+    return;
+  }
+  Cut(node);
+  if (node->child != nullptr) root_ = Meld(root_, MergePairs(node->child));
+  pool_.Destroy(node);
+  --size_;
+}
+
+// Iterative, whatever the shape of the heap: a node with children hands its
+// first child the rest of them and is visited again after it
+template <typename T, typename Compare, typename Allocator>
+void pairing_heap<T, Compare, Allocator>::clear() {
+  Node* pending = root_;
+  while (pending != nullptr) {
+    Node* node = pending;
+    if (node->child != nullptr) {
+      Node* child = node->child;
+      node->child = child->sibling;
+      child->sibling = node;
+      pending = child;
+    } else {
+      pending = node->sibling;
+      pool_.Destroy(node);
+    }
+  }
+  pool_.Release();
+  root_ = nullptr;
+  size_ = 0;
+}
+
+template <typename T, typename Compare, typename Allocator>
+void pairing_heap<T, Compare, Allocator>::swap(pairing_heap& other) noexcept {
+  std::swap(root_, other.root_);
+  std::swap(size_, other.size_);
+  pool_.Swap(other.pool_);
+  std::swap(comp_, other.comp_);
+}
+
+// observers
+
+template <typename T, typename Compare, typename Allocator>
+typename pairing_heap<T, Compare, Allocator>::value_compare
+pairing_heap<T, Compare, Allocator>::value_comp() const {
+  return comp_;
+}
+
+// helpers
+
+template <typename T, typename Compare, typename Allocator>
+typename pairing_heap<T, Compare, Allocator>::handle
+pairing_heap<T, Compare, Allocator>::Insert(Node* node) {
+  root_ = root_ != nullptr ? Meld(root_, node) : node;
+  ++size_;
+  return handle(node);
+}
+
+// Links two roots, the lesser becoming the first child of the greater
+template <typename T, typename Compare, typename Allocator>
+typename pairing_heap<T, Compare, Allocator>::Node*
+pairing_heap<T, Compare, Allocator>::Meld(Node* first, Node* second) {
+  if (comp_(first->value, second->value)) std::swap(first, second);
+  second->prev = first;
+  second->sibling = first->child;
+  if (first->child != nullptr) first->child->prev = second;
+  first->child = second;
+  first->sibling = nullptr;
+  first->prev = nullptr;
+  return first;
+}
+
+// Two-pass pairing of a sibling list: melds neighbours left to right into a
+// stack, then melds the stack into one root from the right
+template <typename T, typename Compare, typename Allocator>
+typename pairing_heap<T, Compare, Allocator>::Node*
+pairing_heap<T, Compare, Allocator>::MergePairs(Node* first) {
+  if (first == nullptr) return nullptr;
+  Node* pairs = nullptr;
+  while (first != nullptr) {
+    Node* left = first;
+    Node* right = left->sibling;
+    if (right == nullptr) {
+      left->prev = nullptr;
+      left->sibling = pairs;
+      pairs = left;
+      break;
+    }
+    first = right->sibling;
+    left->sibling = right->sibling = nullptr;
+    left->prev = right->prev = nullptr;
+    Node* pair = Meld(left, right);
+    pair->sibling = pairs;
+    pairs = pair;
+  }
+  Node* root = pairs;
+  pairs = pairs->sibling;
+  root->sibling = nullptr;
+  while (pairs != nullptr) {
+    Node* next = pairs->sibling;
+    pairs->sibling = nullptr;
+    root = Meld(root, pairs);
+    pairs = next;
+  }
+  return root;
+}
+
+// Detaches a node other than the root, with its subtree, from its parent
+template <typename T, typename Compare, typename Allocator>
+void pairing_heap<T, Compare, Allocator>::Cut(Node* node) {
+  if (node->prev->child == node) {
+    node->prev->child = node->sibling;
+  } else {
+    node->prev->sibling = node->sibling;
+  }
+  if (node->sibling != nullptr) node->sibling->prev = node->prev;
+  node->prev = nullptr;
+  node->sibling = nullptr;
+}
+
+// The node whose child list holds node, null for the root
+template <typename T, typename Compare, typename Allocator>
+typename pairing_heap<T, Compare, Allocator>::Node*
+pairing_heap<T, Compare, Allocator>::Parent(Node* node) {
+  while (node->prev != nullptr && node->prev->child != node) {
+    node = node->prev;
+  }
+  return node->prev;
+}
+
+// This heap is empty. Walks other depth first through the child, sibling
+// and prev links without changing them, so a throwing push leaves other
+// whole, minus the values already moved out; it is cleared at the end
+template <typename T, typename Compare, typename Allocator>
+void pairing_heap<T, Compare, Allocator>::MoveElements(pairing_heap& other) {
+  for (Node* node = other.root_; node != nullptr;) {
+    Insert(pool_.Create(std::move(node->value)));
+    if (node->child != nullptr) {
+      node = node->child;
+      continue;
+    }
+    while (node != nullptr && node->sibling == nullptr) node = Parent(node);
+    if (node != nullptr) node = node->sibling;
+  }
+  other.clear();
+}
+
+}  // namespace s21
+
+#endif
@@ -0,0 +1,112 @@
+#ifndef S21_CONTAINERS_PATH_ITERATOR_H
+#define S21_CONTAINERS_PATH_ITERATOR_H
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+namespace s21 {
+// Bidirectional iterator over a binary search tree without parent pointers:
+// it holds the path from the root to its node. End() has an empty path; the
+// root is kept so that --End() can find the last element. Node needs Left(),
+// right and value. Copies only move the used part of the path; the rest is
+// zeroed so that no slot is ever read uninitialized
+template <typename Node, typename T, bool IsConst>
+class PathIterator {
+ public:
+  using value_type = T;
+  using reference = typename std::conditional<IsConst, const T&, T&>::type;
+  using pointer = typename std::conditional<IsConst, const T*, T*>::type;
+  using difference_type = std::ptrdiff_t;
+  using iterator_category = std::bidirectional_iterator_tag;
+
+  // A balanced tree of height 64 would hold more nodes than fit in memory
+  static constexpr int kMaxDepth = 64;
+
+  PathIterator() : root_(nullptr), depth_(0), path_{} {}
+  explicit PathIterator(Node* root) : root_(root), depth_(0), path_{} {}
+  PathIterator(const PathIterator& other)
+      : root_(other.root_), depth_(other.depth_), path_{} {
+    for (int i = 0; i < depth_; ++i) path_[i] = other.path_[i];
+  }
+  PathIterator& operator=(const PathIterator& other) {
+    root_ = other.root_;
+    depth_ = other.depth_;
+    for (int i = 0; i < depth_; ++i) path_[i] = other.path_[i];
+    return *this;
+  }
+  operator PathIterator<Node, T, true>() const {
+    PathIterator<Node, T, true> result(root_);
+    for (int i = 0; i < depth_; ++i) result.Push(path_[i]);
+    return result;
+  }
+
+  reference operator*() const { return Top()->value; }
+  pointer operator->() const { return &Top()->value; }
+
+  PathIterator& operator++() {
+    Node* node = path_[depth_ - 1];
+    if (node->right != nullptr) {
+      PushLeftmost(node->right);
+    } else {
+      Node* child;
+      do {
+        child = path_[--depth_];
+      } while (depth_ > 0 && path_[depth_ - 1]->right == child);
+    }
+    return *this;
+  }
+  PathIterator operator++(int) {
+    PathIterator temp = *this;
+    ++*this;
+    return temp;
+  }
+  PathIterator& operator--() {
+    if (depth_ == 0) {
+      PushRightmost(root_);
+    } else if (path_[depth_ - 1]->Left() != nullptr) {
+      PushRightmost(path_[depth_ - 1]->Left());
+    } else {
+      Node* child;
+      do {
+        child = path_[--depth_];
+      } while (depth_ > 0 && path_[depth_ - 1]->Left() == child);
+    }
+    return *this;
+  }
+  PathIterator operator--(int) {
+    PathIterator temp = *this;
+    --*this;
+    return temp;
+  }
+
+  // Mutable and const iterators compare with each other
+  template <bool OtherConst>
+  bool operator==(const PathIterator<Node, T, OtherConst>& other) const {
+    return Top() == other.Top();
+  }
+  template <bool OtherConst>
+  bool operator!=(const PathIterator<Node, T, OtherConst>& other) const {
+    return Top() != other.Top();
+  }
+
+  // Path building, used by the trees
+  Node* Top() const { return depth_ > 0 ? path_[depth_ - 1] : nullptr; }
+  int Depth() const { return depth_; }
+  void Truncate(int depth) { depth_ = depth; }
+  void Push(Node* node) { path_[depth_++] = node; }
+  void PushLeftmost(Node* node) {
+    for (; node != nullptr; node = node->Left()) Push(node);
+  }
+  void PushRightmost(Node* node) {
+    for (; node != nullptr; node = node->right) Push(node);
+  }
+
+ private:
+  Node* root_;
+  int depth_;
+  Node* path_[kMaxDepth];
+};
+}  // namespace s21
+
+#endif
@@ -0,0 +1,141 @@
+#ifndef S21_CONTAINERS_PERSISTENT_AVL_TREE_H
+#define S21_CONTAINERS_PERSISTENT_AVL_TREE_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <utility>
+
+#include "../KeyOfValue/s21_key_of_value.h"
+#include "../PathIterator/s21_path_iterator.h"
+#include "../RangeView/s21_range_view.h"
+#include "../Stats/s21_stats.h"
+
+namespace s21 {
+// Persistent AVL tree: nodes are immutable once shared and carry a
+// reference count, so copying a tree only shares its root. An update copies
+// the O(log n) nodes on its path (and an erase the few siblings it rotates)
+// and shares every other subtree with the previous versions. The copies are
+// made before anything changes, so an update that throws leaves the tree
+// as it was. A node referenced once, through a path referenced once,
+// belongs to this version alone and is updated in place, so a tree that has
+// no snapshots allocates no more than a plain one. Reference counts are
+// atomic: versions sharing nodes may be read and destroyed from different
+// threads, while each tree object itself is used by one thread at a time.
+// Nodes come from Allocator rebound to the node type and are shared only
+// between trees whose allocators compare equal; whichever version drops a
+// node last frees it, so that may happen on another thread.
+template <typename T, typename Compare = std::less<T>,
+          typename KeyOfValue = IdentityKey<T>,
+          typename Allocator = std::allocator<T>>
+class PersistentAVLTree {
+ private:
+  struct Node {
+    explicit Node(const T& item) : value(item) {}
+
+    Node* Left() const { return left; }
+
+    std::atomic<uint32_t> refs{1};
+    int height = 1;
+    Node* left = nullptr;
+    Node* right = nullptr;
+    const T value;
+  };
+
+  using alloc_traits = std::allocator_traits<Allocator>;
+  using node_allocator = typename alloc_traits::template rebind_alloc<Node>;
+  using node_traits = std::allocator_traits<node_allocator>;
+  static constexpr bool kNothrowMoveAssign =
+      alloc_traits::propagate_on_container_move_assignment::value ||
+      alloc_traits::is_always_equal::value;
+
+ public:
+  using key_type = typename KeyOfValue::key_type;
+  using key_compare = Compare;
+  using allocator_type = Allocator;
+  using size_type = size_t;
+  // Elements never change in place, only const iteration is offered
+  using const_iterator = PathIterator<Node, T, true>;
+  using iterator = const_iterator;
+
+  static constexpr size_type kNodeBytes = sizeof(Node);
+
+  explicit PersistentAVLTree(const Compare& comp = Compare(),
+                             const Allocator& alloc = Allocator());
+  // O(1): the copy shares every node, unless the allocator selected for it
+  // differs from the one of other and the nodes have to be copied
+  PersistentAVLTree(const PersistentAVLTree& other);
+  PersistentAVLTree(const PersistentAVLTree& other, const Allocator& alloc);
+  PersistentAVLTree(PersistentAVLTree&& other) noexcept;
+  PersistentAVLTree(PersistentAVLTree&& other, const Allocator& alloc);
+  ~PersistentAVLTree();
+  PersistentAVLTree& operator=(const PersistentAVLTree& other);
+  PersistentAVLTree& operator=(PersistentAVLTree&& other) noexcept(
+      kNothrowMoveAssign);
+
+  const_iterator Begin() const;
+  const_iterator End() const;
+
+  size_type Size() const;
+  // Adds value unless an equivalent key is present; with assign an element
+  // with that key is replaced by value
+  bool Insert(const T& value, bool assign = false);
+  template <typename K>
+  size_type Erase(const K& key);
+  void Clear();
+  void Swap(PersistentAVLTree& other) noexcept;
+
+  template <typename K>
+  const_iterator Find(const K& key) const;
+  template <typename K>
+  const_iterator LowerBound(const K& key) const;
+  template <typename K>
+  const_iterator UpperBound(const K& key) const;
+
+  // Whether both trees are the same version, i.e. share their root
+  bool SharesRoot(const PersistentAVLTree& other) const;
+  const Compare& GetCompare() const;
+  allocator_type GetAllocator() const;
+  int Height() const;
+  container_stats GetStats() const;
+
+ private:
+  Node* root_;
+  size_type size_;
+  Compare comp_;
+  Allocator allocator_;
+  S21_STATS_MEMBER
+
+  template <typename A, typename B>
+  bool Less(const A& lhs, const B& rhs) const;
+  const key_type& KeyOf(const Node* node) const;
+  template <typename K>
+  const_iterator LowerBound(const K& key, bool upper) const;
+  template <typename K>
+  bool Contains(const K& key) const;
+
+  void InsertAt(Node*& link, const T& value, bool assign, bool& inserted);
+  template <typename K>
+  void EraseAt(Node*& link, const K& key);
+  Node* DetachMin(Node*& link);
+  void PrepareShrink(Node* node, bool left_shrinks);
+  Node* Rebalance(Node* node);
+  Node* RotateLeft(Node* node);
+  Node* RotateRight(Node* node);
+  static int HeightOf(const Node* node);
+  static void UpdateHeight(Node* node);
+
+  void MakeWritable(Node*& link);
+  Node* NewNode(const T& value);
+  static Node* Retain(Node* node);
+  void Release(Node* node);
+  Node* CloneSubtree(const Node* node);
+  void Adopt(PersistentAVLTree& other);
+};
+}  // namespace s21
+
+#include "s21_persistent_avl_tree.tpp"
+
+#endif
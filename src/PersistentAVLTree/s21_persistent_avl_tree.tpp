@@ -0,0 +1,565 @@
+#ifndef S21_CONTAINERS_PERSISTENT_AVL_TREE_TPP
+#define S21_CONTAINERS_PERSISTENT_AVL_TREE_TPP
+
+namespace s21 {
+
+// functions
+
+template <typename T, typename Compare, typename KeyOfValue,
+          typename Allocator>
+PersistentAVLTree<T, Compare, KeyOfValue, Allocator>::PersistentAVLTree(
+    const Compare& comp, const Allocator& alloc)
+    : root_(nullptr), size_(0), comp_(comp), allocator_(alloc) {}
+
+template <typename T, typename Compare, typename KeyOfValue,
+          typename Allocator>
+PersistentAVLTree<T, Compare, KeyOfValue, Allocator>::PersistentAVLTree(
+    const PersistentAVLTree& other)
+    : PersistentAVLTree(
+          other, alloc_traits::select_on_container_copy_construction(
+                     other.allocator_)) {}
+
+// Nodes of an equal allocator can be freed by either tree, so they are shared
+template <typename T, typename Compare, typename KeyOfValue,
+          typename Allocator>
+PersistentAVLTree<T, Compare, KeyOfValue, Allocator>::PersistentAVLTree(
+    const PersistentAVLTree& other, const Allocator& alloc)
+    : PersistentAVLTree(other.comp_, alloc) {
+  root_ = allocator_ == other.allocator_ ? Retain(other.root_)
+                                         : CloneSubtree(other.root_);
+  size_ = other.size_;
+}
+
+template <typename T, typename Compare, typename KeyOfValue,
+          typename Allocator>
+PersistentAVLTree<T, Compare, KeyOfValue, Allocator>::PersistentAVLTree(
+    PersistentAVLTree&& other) noexcept
+    : root_(std::exchange(other.root_, nullptr)),
+      size_(std::exchange(other.size_, 0)),
+      comp_(other.comp_),
+      allocator_(std::move(other.allocator_)) {}
+
+template <typename T, typename Compare, typename KeyOfValue,
+          typename Allocator>
+PersistentAVLTree<T, Compare, KeyOfValue, Allocator>::PersistentAVLTree(
+    PersistentAVLTree&& other, const Allocator& alloc)
+    : PersistentAVLTree(other.comp_, alloc) {
+  if (allocator_ == other.allocator_) {
+    Adopt(other);
+  } else {
+    root_ = CloneSubtree(other.root_);
+    size_ = other.size_;
+  }
+}
+
+template <typename T, typename Compare, typename KeyOfValue,
+          typename Allocator>
+PersistentAVLTree<T, Compare, KeyOfValue, Allocator>::~PersistentAVLTree() {
+  Release(root_);
+}
+
+// The new version is set up before the old one is released, so a throwing
+// copy (only possible between unequal allocators) changes nothing
+template <typename T, typename Compare, typename KeyOfValue,
+          typename Allocator>
+PersistentAVLTree<T, Compare, KeyOfValue, Allocator>&
+PersistentAVLTree<T, Compare, KeyOfValue, Allocator>::operator=(
+    const PersistentAVLTree& other) {
+  if (this != &other) {
+    if constexpr (alloc_traits::propagate_on_container_copy_assignment::
+                      value) {
+      PersistentAVLTree tmp(other, other.allocator_);
+      Clear();
+      allocator_ = other.allocator_;
+      Adopt(tmp);
+    } else {
+      PersistentAVLTree tmp(other, allocator_);
+      Clear();
+      Adopt(tmp);
+    }
+  }
+  return *this;
+}
+
+// Nodes of an unequal allocator that stays behind are copied, since only
+// the versions using that allocator may free them
+template <typename T, typename Compare, typename KeyOfValue,
+          typename Allocator>
+PersistentAVLTree<T, Compare, KeyOfValue, Allocator>&
+PersistentAVLTree<T, Compare, KeyOfValue, Allocator>::operator=(
+    PersistentAVLTree&& other) noexcept(kNothrowMoveAssign) {
+  if (this != &other) {
+    if constexpr (alloc_traits::propagate_on_container_move_assignment::
+                      value) {
+      Clear();
+      allocator_ = std::move(other.allocator_);
+      Adopt(other);
+    } else if (allocator_ == other.allocator_) {
+      Clear();
+      Adopt(other);
+    } else {
+      PersistentAVLTree tmp(other, allocator_);
+      Clear();
+      Adopt(tmp);
+    }
+  }
+  return *this;
+}
+
+// iterators
+
+template <typename T, typename Compare, typename KeyOfValue,
+          typename Allocator>
+typename PersistentAVLTree<T, Compare, KeyOfValue, Allocator>::const_iterator
+PersistentAVLTree<T, Compare, KeyOfValue, Allocator>::Begin() const {
+  const_iterator it(root_);
+  it.PushLeftmost(root_);
+  return it;
+}
+
+template <typename T, typename Compare, typename KeyOfValue,
+          typename Allocator>
+typename PersistentAVLTree<T, Compare, KeyOfValue, Allocator>::const_iterator
+PersistentAVLTree<T, Compare, KeyOfValue, Allocator>::End() const {
+  return const_iterator(root_);
+}
+
+// capacity
+
+template <typename T, typename Compare, typename KeyOfValue,
+          typename Allocator>
+typename PersistentAVLTree<T, Compare, KeyOfValue, Allocator>::size_type
+PersistentAVLTree<T, Compare, KeyOfValue, Allocator>::Size() const {
+  return size_;
+}
+
+// modifiers
+
+// A shared root means the path would be copied even if nothing changes, so
+// the key is looked up first
+template <typename T, typename Compare, typename KeyOfValue,
+          typename Allocator>
+bool PersistentAVLTree<T, Compare, KeyOfValue, Allocator>::Insert(
+    const T& value, bool assign) {
+  if (!assign && root_ != nullptr &&
+      root_->refs.load(std::memory_order_acquire) > 1 &&
+      Contains(KeyOfValue()(value))) {
+    return false;
+  }
+  S21_STATS(Lookup());
+  bool inserted = false;
+  InsertAt(root_, value, assign, inserted);
+  if (inserted) ++size_;
+  return inserted;
+}
+
+template <typename T, typename Compare, typename KeyOfValue,
+          typename Allocator>
+template <typename K>
+typename PersistentAVLTree<T, Compare, KeyOfValue, Allocator>::size_type
+PersistentAVLTree<T, Compare, KeyOfValue, Allocator>::Erase(const K& key) {
+  if (!Contains(key)) return 0;
+  EraseAt(root_, key);
+  --size_;
+  return 1;
+}
+
+template <typename T, typename Compare, typename KeyOfValue,
+          typename Allocator>
+void PersistentAVLTree<T, Compare, KeyOfValue, Allocator>::Clear() {
+  Release(root_);
+  root_ = nullptr;
+  size_ = 0;
+}
+
+template <typename T, typename Compare, typename KeyOfValue,
+          typename Allocator>
+void PersistentAVLTree<T, Compare, KeyOfValue, Allocator>::Swap(
+    PersistentAVLTree& other) noexcept {
+  std::swap(root_, other.root_);
+  std::swap(size_, other.size_);
+  std::swap(comp_, other.comp_);
+  if constexpr (alloc_traits::propagate_on_container_swap::value) {
+    using std::swap;
+    swap(allocator_, other.allocator_);
+  }
+}
+
+// lookup
+
+template <typename T, typename Compare, typename KeyOfValue,
+          typename Allocator>
+template <typename K>
+typename PersistentAVLTree<T, Compare, KeyOfValue, Allocator>::const_iterator
+PersistentAVLTree<T, Compare, KeyOfValue, Allocator>::Find(const K& key) const {
+  const_iterator it = LowerBound(key, false);
+  if (it.Depth() > 0 && Less(key, KeyOf(it.Top()))) it.Truncate(0);
+  return it;
+}
+
+template <typename T, typename Compare, typename KeyOfValue,
+          typename Allocator>
+template <typename K>
+typename PersistentAVLTree<T, Compare, KeyOfValue, Allocator>::const_iterator
+PersistentAVLTree<T, Compare, KeyOfValue, Allocator>::LowerBound(
+    const K& key) const {
+  return LowerBound(key, false);
+}
+
+template <typename T, typename Compare, typename KeyOfValue,
+          typename Allocator>
+template <typename K>
+typename PersistentAVLTree<T, Compare, KeyOfValue, Allocator>::const_iterator
+PersistentAVLTree<T, Compare, KeyOfValue, Allocator>::UpperBound(
+    const K& key) const {
+  return LowerBound(key, true);
+}
+
+template <typename T, typename Compare, typename KeyOfValue,
+          typename Allocator>
+bool PersistentAVLTree<T, Compare, KeyOfValue, Allocator>::SharesRoot(
+    const PersistentAVLTree& other) const {
+  return root_ == other.root_;
+}
+
+template <typename T, typename Compare, typename KeyOfValue,
+          typename Allocator>
+const Compare&
+PersistentAVLTree<T, Compare, KeyOfValue, Allocator>::GetCompare() const {
+  return comp_;
+}
+
+template <typename T, typename Compare, typename KeyOfValue,
+          typename Allocator>
+typename PersistentAVLTree<T, Compare, KeyOfValue, Allocator>::allocator_type
+PersistentAVLTree<T, Compare, KeyOfValue, Allocator>::GetAllocator() const {
+  return allocator_;
+}
+
+template <typename T, typename Compare, typename KeyOfValue,
+          typename Allocator>
+int PersistentAVLTree<T, Compare, KeyOfValue, Allocator>::Height() const {
+  return HeightOf(root_);
+}
+
+template <typename T, typename Compare, typename KeyOfValue,
+          typename Allocator>
+container_stats
+PersistentAVLTree<T, Compare, KeyOfValue, Allocator>::GetStats() const {
+  return S21_STATS_GET();
+}
+
+// helpers
+
+template <typename T, typename Compare, typename KeyOfValue,
+          typename Allocator>
+template <typename A, typename B>
+bool PersistentAVLTree<T, Compare, KeyOfValue, Allocator>::Less(
+    const A& lhs, const B& rhs) const {
+  S21_STATS(Comparison());
+  return comp_(lhs, rhs);
+}
+
+template <typename T, typename Compare, typename KeyOfValue,
+          typename Allocator>
+const typename PersistentAVLTree<T, Compare, KeyOfValue, Allocator>::key_type&
+PersistentAVLTree<T, Compare, KeyOfValue, Allocator>::KeyOf(
+    const Node* node) const {
+  return KeyOfValue()(node->value);
+}
+
+// One Compare call per level; the path is cut back to the last node the
+// descent turned left at
+template <typename T, typename Compare, typename KeyOfValue,
+          typename Allocator>
+template <typename K>
+typename PersistentAVLTree<T, Compare, KeyOfValue, Allocator>::const_iterator
+PersistentAVLTree<T, Compare, KeyOfValue, Allocator>::LowerBound(
+    const K& key, bool upper) const {
+  S21_STATS(Lookup());
+  const_iterator it(root_);
+  int depth = 0;
+  for (Node* node = root_; node != nullptr;) {
+    S21_STATS(NodeVisit());
+    it.Push(node);
+    if (upper ? Less(key, KeyOf(node)) : !Less(KeyOf(node), key)) {
+      depth = it.Depth();
+      node = node->left;
+    } else {
+      node = node->right;
+    }
+  }
+  it.Truncate(depth);
+  return it;
+}
+
+template <typename T, typename Compare, typename KeyOfValue,
+          typename Allocator>
+template <typename K>
+bool PersistentAVLTree<T, Compare, KeyOfValue, Allocator>::Contains(
+    const K& key) const {
+  const_iterator it = Find(key);
+  return it.Depth() > 0;
+}
+
+// link belongs to a writable parent (or is the root) and is replaced by the
+// updated subtree. Everything that may throw (Compare, allocation, the copy
+// of T) happens on the way down, where the nodes made writable are copies
+// equal to the ones they replace, so the tree keeps its contents if it
+// does; the way back up only relinks and rebalances
+template <typename T, typename Compare, typename KeyOfValue,
+          typename Allocator>
+void PersistentAVLTree<T, Compare, KeyOfValue, Allocator>::InsertAt(
+    Node*& link, const T& value, bool assign, bool& inserted) {
+  if (link == nullptr) {
+    link = NewNode(value);
+    inserted = true;
+    return;
+  }
+
+  S21_STATS(NodeVisit());
+  const key_type& key = KeyOfValue()(value);
+  if (Less(key, KeyOf(link))) {
+    MakeWritable(link);
+    InsertAt(link->left, value, assign, inserted);
+  } else if (Less(KeyOf(link), key)) {
+    MakeWritable(link);
+    InsertAt(link->right, value, assign, inserted);
+  } else {
+    if (assign) {
+      // The element is const, a new node takes over the links
+      Node* fresh = NewNode(value);
+      fresh->left = Retain(link->left);
+      fresh->right = Retain(link->right);
+      fresh->height = link->height;
+      Release(std::exchange(link, fresh));
+    }
+    return;
+  }
+  link = Rebalance(link);
+}
+
+// The key is known to be present. As in InsertAt, nothing throws on the way
+// up: the nodes a rebalance rotates are made writable on the way down
+template <typename T, typename Compare, typename KeyOfValue,
+          typename Allocator>
+template <typename K>
+void PersistentAVLTree<T, Compare, KeyOfValue, Allocator>::EraseAt(
+    Node*& link, const K& key) {
+  S21_STATS(NodeVisit());
+  MakeWritable(link);
+  Node* node = link;
+  if (Less(key, KeyOf(node))) {
+    PrepareShrink(node, true);
+    EraseAt(node->left, key);
+  } else if (Less(KeyOf(node), key)) {
+    PrepareShrink(node, false);
+    EraseAt(node->right, key);
+  } else if (node->left == nullptr || node->right == nullptr) {
+    link = node->left != nullptr ? node->left : node->right;
+    node->left = nullptr;
+    node->right = nullptr;
+    Release(node);
+    return;
+  } else {
+    PrepareShrink(node, false);
+    Node* min = DetachMin(node->right);
+    min->left = std::exchange(node->left, nullptr);
+    min->right = std::exchange(node->right, nullptr);
+    Release(node);
+    node = min;
+  }
+  link = Rebalance(node);
+}
+
+// Unlinks the minimum of the subtree at link; it comes back writable and
+// unlinked
+template <typename T, typename Compare, typename KeyOfValue,
+          typename Allocator>
+typename PersistentAVLTree<T, Compare, KeyOfValue, Allocator>::Node*
+PersistentAVLTree<T, Compare, KeyOfValue, Allocator>::DetachMin(Node*& link) {
+  MakeWritable(link);
+  Node* node = link;
+  if (node->left == nullptr) {
+    link = std::exchange(node->right, nullptr);
+    return node;
+  }
+  PrepareShrink(node, true);
+  Node* min = DetachMin(node->left);
+  link = Rebalance(node);
+  return min;
+}
+
+// node is writable and the subtree on one side of it is about to lose a
+// level. Makes writable what Rebalance would then rotate: the other child
+// if it is the taller one, and its inner child if that is taller than the
+// outer one (a double rotation)
+template <typename T, typename Compare, typename KeyOfValue,
+          typename Allocator>
+void PersistentAVLTree<T, Compare, KeyOfValue, Allocator>::PrepareShrink(
+    Node* node, bool left_shrinks) {
+  Node*& sibling = left_shrinks ? node->right : node->left;
+  Node* shrinking = left_shrinks ? node->left : node->right;
+  if (HeightOf(sibling) <= HeightOf(shrinking)) return;
+  MakeWritable(sibling);
+  Node*& inner = left_shrinks ? sibling->left : sibling->right;
+  Node* outer = left_shrinks ? sibling->right : sibling->left;
+  if (HeightOf(inner) > HeightOf(outer)) MakeWritable(inner);
+}
+
+// node is writable; the children a rotation relinks are made writable first.
+// Updates have done so on the way down already, so nothing is copied here
+template <typename T, typename Compare, typename KeyOfValue,
+          typename Allocator>
+typename PersistentAVLTree<T, Compare, KeyOfValue, Allocator>::Node*
+PersistentAVLTree<T, Compare, KeyOfValue, Allocator>::Rebalance(Node* node) {
+  UpdateHeight(node);
+  int balance = HeightOf(node->right) - HeightOf(node->left);
+  if (balance < -1) {
+    MakeWritable(node->left);
+    if (HeightOf(node->left->right) > HeightOf(node->left->left)) {
+      node->left = RotateLeft(node->left);
+    }
+    node = RotateRight(node);
+  } else if (balance > 1) {
+    MakeWritable(node->right);
+    if (HeightOf(node->right->left) > HeightOf(node->right->right)) {
+      node->right = RotateRight(node->right);
+    }
+    node = RotateLeft(node);
+  }
+  return node;
+}
+
+template <typename T, typename Compare, typename KeyOfValue,
+          typename Allocator>
+typename PersistentAVLTree<T, Compare, KeyOfValue, Allocator>::Node*
+PersistentAVLTree<T, Compare, KeyOfValue, Allocator>::RotateLeft(Node* node) {
+  S21_STATS(Rotation());
+  MakeWritable(node->right);
+  Node* right = node->right;
+  node->right = right->left;
+  right->left = node;
+  UpdateHeight(node);
+  UpdateHeight(right);
+  return right;
+}
+
+template <typename T, typename Compare, typename KeyOfValue,
+          typename Allocator>
+typename PersistentAVLTree<T, Compare, KeyOfValue, Allocator>::Node*
+PersistentAVLTree<T, Compare, KeyOfValue, Allocator>::RotateRight(Node* node) {
+  S21_STATS(Rotation());
+  MakeWritable(node->left);
+  Node* left = node->left;
+  node->left = left->right;
+  left->right = node;
+  UpdateHeight(node);
+  UpdateHeight(left);
+  return left;
+}
+
+template <typename T, typename Compare, typename KeyOfValue,
+          typename Allocator>
+int PersistentAVLTree<T, Compare, KeyOfValue, Allocator>::HeightOf(
+    const Node* node) {
+  return node != nullptr ? node->height : 0;
+}
+
+template <typename T, typename Compare, typename KeyOfValue,
+          typename Allocator>
+void PersistentAVLTree<T, Compare, KeyOfValue, Allocator>::UpdateHeight(
+    Node* node) {
+  int left = HeightOf(node->left);
+  int right = HeightOf(node->right);
+  node->height = (left > right ? left : right) + 1;
+}
+
+// link belongs to a writable parent (or is the root): a node referenced
+// only there stays, a shared one is replaced by a copy that shares its
+// children. The copy is linked at once, so if it throws nothing changes
+template <typename T, typename Compare, typename KeyOfValue,
+          typename Allocator>
+void PersistentAVLTree<T, Compare, KeyOfValue, Allocator>::MakeWritable(
+    Node*& link) {
+  if (link->refs.load(std::memory_order_acquire) == 1) return;
+  Node* copy = NewNode(link->value);
+  copy->left = Retain(link->left);
+  copy->right = Retain(link->right);
+  copy->height = link->height;
+  Release(std::exchange(link, copy));
+}
+
+template <typename T, typename Compare, typename KeyOfValue,
+          typename Allocator>
+typename PersistentAVLTree<T, Compare, KeyOfValue, Allocator>::Node*
+PersistentAVLTree<T, Compare, KeyOfValue, Allocator>::NewNode(const T& value) {
+  node_allocator alloc(allocator_);
+  Node* node = node_traits::allocate(alloc, 1);
+  try {
+    node_traits::construct(alloc, node, value);
+  } catch (...) {
+    node_traits::deallocate(alloc, node, 1);
+    throw;
+  }
+  S21_STATS(Allocation(sizeof(Node)));
+  return node;
+}
+
+template <typename T, typename Compare, typename KeyOfValue,
+          typename Allocator>
+typename PersistentAVLTree<T, Compare, KeyOfValue, Allocator>::Node*
+PersistentAVLTree<T, Compare, KeyOfValue, Allocator>::Retain(Node* node) {
+  if (node != nullptr) node->refs.fetch_add(1, std::memory_order_relaxed);
+  return node;
+}
+
+// Drops one reference; the last one frees the node and releases its
+// children, iteratively along the right spine
+template <typename T, typename Compare, typename KeyOfValue,
+          typename Allocator>
+void PersistentAVLTree<T, Compare, KeyOfValue, Allocator>::Release(Node* node) {
+  while (node != nullptr &&
+         node->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+    Release(node->left);
+    Node* right = node->right;
+    node_allocator alloc(allocator_);
+    node_traits::destroy(alloc, node);
+    node_traits::deallocate(alloc, node, 1);
+    S21_STATS(Deallocation());
+    node = right;
+  }
+}
+
+// Unshared copies of every node, keeping the shape and the heights
+template <typename T, typename Compare, typename KeyOfValue,
+          typename Allocator>
+typename PersistentAVLTree<T, Compare, KeyOfValue, Allocator>::Node*
+PersistentAVLTree<T, Compare, KeyOfValue, Allocator>::CloneSubtree(
+    const Node* node) {
+  if (node == nullptr) return nullptr;
+  Node* copy = NewNode(node->value);
+  try {
+    copy->left = CloneSubtree(node->left);
+    copy->right = CloneSubtree(node->right);
+  } catch (...) {
+    Release(copy);
+    throw;
+  }
+  copy->height = node->height;
+  return copy;
+}
+
+// Takes over the nodes of other, which is left empty
+template <typename T, typename Compare, typename KeyOfValue,
+          typename Allocator>
+void PersistentAVLTree<T, Compare, KeyOfValue, Allocator>::Adopt(
+    PersistentAVLTree& other) {
+  root_ = std::exchange(other.root_, nullptr);
+  size_ = std::exchange(other.size_, 0);
+  comp_ = other.comp_;
+}
+
+}  // namespace s21
+
+#endif
@@ -0,0 +1,105 @@
+#ifndef S21_CONTAINERS_PERSISTENT_MAP_H
+#define S21_CONTAINERS_PERSISTENT_MAP_H
+
+#include <initializer_list>
+#include <limits>
+#include <memory>
+#include <memory_resource>
+#include <stdexcept>
+
+#include "../PersistentAVLTree/s21_persistent_avl_tree.h"
+
+namespace s21 {
+// Ordered map with O(1) snapshots (see PersistentAVLTree). Elements are
+// never modified in place, so there is no operator[] and values are changed
+// with insert_or_assign; a snapshot keeps the values it was taken with.
+// Iterators are invalidated by updates of the map they came from
+template <typename Key, typename T, typename Compare = std::less<Key>,
+          typename Allocator = std::allocator<std::pair<const Key, T>>>
+class persistent_map {
+ public:
+  // member type
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<const Key, T>;
+  using key_compare = Compare;
+  using reference = const value_type&;
+  using const_reference = const value_type&;
+  using tree_type = PersistentAVLTree<value_type, Compare,
+                                      PairFirstKey<value_type>, Allocator>;
+  using iterator = typename tree_type::const_iterator;
+  using const_iterator = typename tree_type::const_iterator;
+  using size_type = size_t;
+  using allocator_type = Allocator;
+
+  // functions
+  persistent_map();
+  explicit persistent_map(const Compare& comp,
+                          const Allocator& alloc = Allocator());
+  explicit persistent_map(const Allocator& alloc);
+  persistent_map(std::initializer_list<value_type> const& items,
+                 const Allocator& alloc = Allocator());
+  persistent_map(const persistent_map& other) = default;
+  persistent_map(persistent_map&& other) noexcept = default;
+  persistent_map(const persistent_map& other, const Allocator& alloc);
+  persistent_map(persistent_map&& other, const Allocator& alloc);
+  ~persistent_map() = default;
+  persistent_map& operator=(const persistent_map& other) = default;
+  persistent_map& operator=(persistent_map&& other) = default;
+  allocator_type get_allocator() const;
+
+  // Consistent read-only version of the current contents, in O(1); it
+  // keeps the allocator of this map, see persistent_set::snapshot
+  persistent_map snapshot() const;
+
+  // element access
+  const mapped_type& at(const Key& key) const;
+
+  // iterators
+  iterator begin() const;
+  iterator end() const;
+
+  // capacity
+  bool empty() const;
+  size_type size() const;
+  size_type max_size() const;
+
+  // modifiers
+  void clear();
+  std::pair<iterator, bool> insert(const value_type& value);
+  std::pair<iterator, bool> insert(const Key& key, const T& obj);
+  std::pair<iterator, bool> insert_or_assign(const Key& key, const T& obj);
+  void erase(iterator pos);
+  size_type erase(const Key& key);
+  void swap(persistent_map& other) noexcept;
+
+  // lookup
+  bool contains(const Key& key) const;
+  iterator find(const Key& key) const;
+  iterator lower_bound(const Key& key) const;
+  iterator upper_bound(const Key& key) const;
+  std::pair<iterator, iterator> equal_range(const Key& key) const;
+  // Elements with keys in [first, last)
+  RangeView<iterator> range(const Key& first, const Key& last) const;
+
+  // observers
+  key_compare key_comp() const;
+  const tree_type& get_tree() const;
+
+  // instrumentation, zeros unless built with S21_CONTAINERS_STATS
+  container_stats stats() const;
+
+ private:
+  tree_type tree_;
+};
+
+namespace pmr {
+template <typename Key, typename T, typename Compare = std::less<Key>>
+using persistent_map = s21::persistent_map<
+    Key, T, Compare, std::pmr::polymorphic_allocator<std::pair<const Key, T>>>;
+}  // namespace pmr
+}  // namespace s21
+
+#include "s21_persistent_map.tpp"
+
+#endif
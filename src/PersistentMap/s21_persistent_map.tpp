@@ -0,0 +1,202 @@
+#ifndef S21_CONTAINERS_PERSISTENT_MAP_TPP
+#define S21_CONTAINERS_PERSISTENT_MAP_TPP
+
+#include <utility>
+
+namespace s21 {
+
+// functions
+
+template <typename Key, typename T, typename Compare, typename Allocator>
+persistent_map<Key, T, Compare, Allocator>::persistent_map() : tree_() {}
+
+template <typename Key, typename T, typename Compare, typename Allocator>
+persistent_map<Key, T, Compare, Allocator>::persistent_map(
+    const Compare& comp, const Allocator& alloc)
+    : tree_(comp, alloc) {}
+
+template <typename Key, typename T, typename Compare, typename Allocator>
+persistent_map<Key, T, Compare, Allocator>::persistent_map(
+    const Allocator& alloc)
+    : tree_(Compare(), alloc) {}
+
+template <typename Key, typename T, typename Compare, typename Allocator>
+persistent_map<Key, T, Compare, Allocator>::persistent_map(
+    std::initializer_list<value_type> const& items, const Allocator& alloc)
+    : tree_(Compare(), alloc) {
+  for (const auto& item : items) tree_.Insert(item);
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator>
+persistent_map<Key, T, Compare, Allocator>::persistent_map(
+    const persistent_map& other, const Allocator& alloc)
+    : tree_(other.tree_, alloc) {}
+
+template <typename Key, typename T, typename Compare, typename Allocator>
+persistent_map<Key, T, Compare, Allocator>::persistent_map(
+    persistent_map&& other, const Allocator& alloc)
+    : tree_(std::move(other.tree_), alloc) {}
+
+template <typename Key, typename T, typename Compare, typename Allocator>
+typename persistent_map<Key, T, Compare, Allocator>::allocator_type
+persistent_map<Key, T, Compare, Allocator>::get_allocator() const {
+  return tree_.GetAllocator();
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator>
+persistent_map<Key, T, Compare, Allocator>
+persistent_map<Key, T, Compare, Allocator>::snapshot() const {
+  return persistent_map(*this, get_allocator());
+}
+
+// element access
+
+template <typename Key, typename T, typename Compare, typename Allocator>
+const typename persistent_map<Key, T, Compare, Allocator>::mapped_type&
+persistent_map<Key, T, Compare, Allocator>::at(const Key& key) const {
+  iterator it = tree_.Find(key);
+  if (it == tree_.End()) throw std::invalid_argument("This key doesn't exist");
+  return it->second;
+}
+
+// iterators
+
+template <typename Key, typename T, typename Compare, typename Allocator>
+typename persistent_map<Key, T, Compare, Allocator>::iterator
+persistent_map<Key, T, Compare, Allocator>::begin() const {
+  return tree_.Begin();
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator>
+typename persistent_map<Key, T, Compare, Allocator>::iterator
+persistent_map<Key, T, Compare, Allocator>::end() const {
+  return tree_.End();
+}
+
+// capacity
+
+template <typename Key, typename T, typename Compare, typename Allocator>
+bool persistent_map<Key, T, Compare, Allocator>::empty() const {
+  return tree_.Size() == 0;
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator>
+typename persistent_map<Key, T, Compare, Allocator>::size_type
+persistent_map<Key, T, Compare, Allocator>::size() const {
+  return tree_.Size();
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator>
+typename persistent_map<Key, T, Compare, Allocator>::size_type
+persistent_map<Key, T, Compare, Allocator>::max_size() const {
+  return std::numeric_limits<size_type>::max() / tree_type::kNodeBytes;
+}
+
+// modifiers
+
+template <typename Key, typename T, typename Compare, typename Allocator>
+void persistent_map<Key, T, Compare, Allocator>::clear() {
+  tree_.Clear();
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator>
+std::pair<typename persistent_map<Key, T, Compare, Allocator>::iterator, bool>
+persistent_map<Key, T, Compare, Allocator>::insert(const value_type& value) {
+  bool inserted = tree_.Insert(value);
+  return std::make_pair(tree_.Find(value.first), inserted);
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator>
+std::pair<typename persistent_map<Key, T, Compare, Allocator>::iterator, bool>
+persistent_map<Key, T, Compare, Allocator>::insert(
+    const Key& key, const T& obj) {
+  return insert(value_type(key, obj));
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator>
+std::pair<typename persistent_map<Key, T, Compare, Allocator>::iterator, bool>
+persistent_map<Key, T, Compare, Allocator>::insert_or_assign(
+    const Key& key, const T& obj) {
+  bool inserted = tree_.Insert(value_type(key, obj), true);
+  return std::make_pair(tree_.Find(key), inserted);
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator>
+void persistent_map<Key, T, Compare, Allocator>::erase(iterator pos) {
+  tree_.Erase(pos->first);
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator>
+typename persistent_map<Key, T, Compare, Allocator>::size_type
+persistent_map<Key, T, Compare, Allocator>::erase(const Key& key) {
+  return tree_.Erase(key);
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator>
+void persistent_map<Key, T, Compare, Allocator>::swap(
+    persistent_map& other) noexcept {
+  tree_.Swap(other.tree_);
+}
+
+// lookup
+
+template <typename Key, typename T, typename Compare, typename Allocator>
+bool persistent_map<Key, T, Compare, Allocator>::contains(
+    const Key& key) const {
+  return tree_.Find(key) != tree_.End();
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator>
+typename persistent_map<Key, T, Compare, Allocator>::iterator
+persistent_map<Key, T, Compare, Allocator>::find(const Key& key) const {
+  return tree_.Find(key);
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator>
+typename persistent_map<Key, T, Compare, Allocator>::iterator
+persistent_map<Key, T, Compare, Allocator>::lower_bound(const Key& key) const {
+  return tree_.LowerBound(key);
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator>
+typename persistent_map<Key, T, Compare, Allocator>::iterator
+persistent_map<Key, T, Compare, Allocator>::upper_bound(const Key& key) const {
+  return tree_.UpperBound(key);
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator>
+std::pair<typename persistent_map<Key, T, Compare, Allocator>::iterator,
+          typename persistent_map<Key, T, Compare, Allocator>::iterator>
+persistent_map<Key, T, Compare, Allocator>::equal_range(const Key& key) const {
+  return std::make_pair(lower_bound(key), upper_bound(key));
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator>
+RangeView<typename persistent_map<Key, T, Compare, Allocator>::iterator>
+persistent_map<Key, T, Compare, Allocator>::range(
+    const Key& first, const Key& last) const {
+  return RangeView<iterator>(lower_bound(first), lower_bound(last));
+}
+
+// observers
+
+template <typename Key, typename T, typename Compare, typename Allocator>
+typename persistent_map<Key, T, Compare, Allocator>::key_compare
+persistent_map<Key, T, Compare, Allocator>::key_comp() const {
+  return tree_.GetCompare();
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator>
+const typename persistent_map<Key, T, Compare, Allocator>::tree_type&
+persistent_map<Key, T, Compare, Allocator>::get_tree() const {
+  return tree_;
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator>
+container_stats persistent_map<Key, T, Compare, Allocator>::stats() const {
+  return tree_.GetStats();
+}
+
+}  // namespace s21
+
+#endif
@@ -0,0 +1,98 @@
+#ifndef S21_CONTAINERS_PERSISTENT_SET_H
+#define S21_CONTAINERS_PERSISTENT_SET_H
+
+#include <initializer_list>
+#include <limits>
+#include <memory>
+#include <memory_resource>
+
+#include "../PersistentAVLTree/s21_persistent_avl_tree.h"
+
+namespace s21 {
+// Ordered set with O(1) snapshots (see PersistentAVLTree). A snapshot, like
+// any copy with an equal allocator, shares all nodes and never observes
+// later updates; an update copies only its path. Iterators are invalidated
+// by updates of the set they came from, never by updates of other versions
+template <typename T, typename Compare = std::less<T>,
+          typename Allocator = std::allocator<T>>
+class persistent_set {
+ public:
+  // member type
+  using key_type = T;
+  using value_type = T;
+  using key_compare = Compare;
+  using reference = const T&;
+  using const_reference = const T&;
+  using tree_type = PersistentAVLTree<T, Compare, IdentityKey<T>, Allocator>;
+  using iterator = typename tree_type::const_iterator;
+  using const_iterator = typename tree_type::const_iterator;
+  using size_type = size_t;
+  using allocator_type = Allocator;
+
+  // functions
+  persistent_set();
+  explicit persistent_set(const Compare& comp,
+                          const Allocator& alloc = Allocator());
+  explicit persistent_set(const Allocator& alloc);
+  persistent_set(std::initializer_list<value_type> const& items,
+                 const Allocator& alloc = Allocator());
+  persistent_set(const persistent_set& other) = default;
+  persistent_set(persistent_set&& other) noexcept = default;
+  persistent_set(const persistent_set& other, const Allocator& alloc);
+  persistent_set(persistent_set&& other, const Allocator& alloc);
+  ~persistent_set() = default;
+  persistent_set& operator=(const persistent_set& other) = default;
+  persistent_set& operator=(persistent_set&& other) = default;
+  allocator_type get_allocator() const;
+
+  // Consistent read-only version of the current contents, in O(1). Unlike
+  // a copy it always keeps the allocator of this set, which a copy gives up
+  // when the allocator selects another one (as polymorphic_allocator does)
+  persistent_set snapshot() const;
+
+  // iterators
+  iterator begin() const;
+  iterator end() const;
+
+  // capacity
+  bool empty() const;
+  size_type size() const;
+  size_type max_size() const;
+
+  // modifiers
+  void clear();
+  std::pair<iterator, bool> insert(const value_type& value);
+  void erase(iterator pos);
+  size_type erase(const T& key);
+  void swap(persistent_set& other) noexcept;
+
+  // lookup
+  bool contains(const T& key) const;
+  iterator find(const T& key) const;
+  iterator lower_bound(const T& key) const;
+  iterator upper_bound(const T& key) const;
+  std::pair<iterator, iterator> equal_range(const T& key) const;
+  // Elements with keys in [first, last)
+  RangeView<iterator> range(const T& first, const T& last) const;
+
+  // observers
+  key_compare key_comp() const;
+  const tree_type& get_tree() const;
+
+  // instrumentation, zeros unless built with S21_CONTAINERS_STATS
+  container_stats stats() const;
+
+ private:
+  tree_type tree_;
+};
+
+namespace pmr {
+template <typename T, typename Compare = std::less<T>>
+using persistent_set =
+    s21::persistent_set<T, Compare, std::pmr::polymorphic_allocator<T>>;
+}  // namespace pmr
+}  // namespace s21
+
+#include "s21_persistent_set.tpp"
+
+#endif
@@ -0,0 +1,175 @@
+#ifndef S21_CONTAINERS_PERSISTENT_SET_TPP
+#define S21_CONTAINERS_PERSISTENT_SET_TPP
+
+#include <utility>
+
+namespace s21 {
+
+// functions
+
+template <typename T, typename Compare, typename Allocator>
+persistent_set<T, Compare, Allocator>::persistent_set() : tree_() {}
+
+template <typename T, typename Compare, typename Allocator>
+persistent_set<T, Compare, Allocator>::persistent_set(
+    const Compare& comp, const Allocator& alloc)
+    : tree_(comp, alloc) {}
+
+template <typename T, typename Compare, typename Allocator>
+persistent_set<T, Compare, Allocator>::persistent_set(const Allocator& alloc)
+    : tree_(Compare(), alloc) {}
+
+template <typename T, typename Compare, typename Allocator>
+persistent_set<T, Compare, Allocator>::persistent_set(
+    std::initializer_list<value_type> const& items, const Allocator& alloc)
+    : tree_(Compare(), alloc) {
+  for (const auto& item : items) tree_.Insert(item);
+}
+
+template <typename T, typename Compare, typename Allocator>
+persistent_set<T, Compare, Allocator>::persistent_set(
+    const persistent_set& other, const Allocator& alloc)
+    : tree_(other.tree_, alloc) {}
+
+template <typename T, typename Compare, typename Allocator>
+persistent_set<T, Compare, Allocator>::persistent_set(
+    persistent_set&& other, const Allocator& alloc)
+    : tree_(std::move(other.tree_), alloc) {}
+
+template <typename T, typename Compare, typename Allocator>
+typename persistent_set<T, Compare, Allocator>::allocator_type
+persistent_set<T, Compare, Allocator>::get_allocator() const {
+  return tree_.GetAllocator();
+}
+
+template <typename T, typename Compare, typename Allocator>
+persistent_set<T, Compare, Allocator>
+persistent_set<T, Compare, Allocator>::snapshot() const {
+  return persistent_set(*this, get_allocator());
+}
+
+// iterators
+
+template <typename T, typename Compare, typename Allocator>
+typename persistent_set<T, Compare, Allocator>::iterator
+persistent_set<T, Compare, Allocator>::begin() const {
+  return tree_.Begin();
+}
+
+template <typename T, typename Compare, typename Allocator>
+typename persistent_set<T, Compare, Allocator>::iterator
+persistent_set<T, Compare, Allocator>::end() const {
+  return tree_.End();
+}
+
+// capacity
+
+template <typename T, typename Compare, typename Allocator>
+bool persistent_set<T, Compare, Allocator>::empty() const {
+  return tree_.Size() == 0;
+}
+
+template <typename T, typename Compare, typename Allocator>
+typename persistent_set<T, Compare, Allocator>::size_type
+persistent_set<T, Compare, Allocator>::size() const {
+  return tree_.Size();
+}
+
+template <typename T, typename Compare, typename Allocator>
+typename persistent_set<T, Compare, Allocator>::size_type
+persistent_set<T, Compare, Allocator>::max_size() const {
+  return std::numeric_limits<size_type>::max() / tree_type::kNodeBytes;
+}
+
+// modifiers
+
+template <typename T, typename Compare, typename Allocator>
+void persistent_set<T, Compare, Allocator>::clear() {
+  tree_.Clear();
+}
+
+template <typename T, typename Compare, typename Allocator>
+std::pair<typename persistent_set<T, Compare, Allocator>::iterator, bool>
+persistent_set<T, Compare, Allocator>::insert(const value_type& value) {
+  bool inserted = tree_.Insert(value);
+  return std::make_pair(tree_.Find(value), inserted);
+}
+
+template <typename T, typename Compare, typename Allocator>
+void persistent_set<T, Compare, Allocator>::erase(iterator pos) {
+  tree_.Erase(*pos);
+}
+
+template <typename T, typename Compare, typename Allocator>
+typename persistent_set<T, Compare, Allocator>::size_type
+persistent_set<T, Compare, Allocator>::erase(const T& key) {
+  return tree_.Erase(key);
+}
+
+template <typename T, typename Compare, typename Allocator>
+void persistent_set<T, Compare, Allocator>::swap(
+    persistent_set& other) noexcept {
+  tree_.Swap(other.tree_);
+}
+
+// lookup
+
+template <typename T, typename Compare, typename Allocator>
+bool persistent_set<T, Compare, Allocator>::contains(const T& key) const {
+  return tree_.Find(key) != tree_.End();
+}
+
+template <typename T, typename Compare, typename Allocator>
+typename persistent_set<T, Compare, Allocator>::iterator
+persistent_set<T, Compare, Allocator>::find(const T& key) const {
+  return tree_.Find(key);
+}
+
+template <typename T, typename Compare, typename Allocator>
+typename persistent_set<T, Compare, Allocator>::iterator
+persistent_set<T, Compare, Allocator>::lower_bound(const T& key) const {
+  return tree_.LowerBound(key);
+}
+
+template <typename T, typename Compare, typename Allocator>
+typename persistent_set<T, Compare, Allocator>::iterator
+persistent_set<T, Compare, Allocator>::upper_bound(const T& key) const {
+  return tree_.UpperBound(key);
+}
+
+template <typename T, typename Compare, typename Allocator>
+std::pair<typename persistent_set<T, Compare, Allocator>::iterator,
+          typename persistent_set<T, Compare, Allocator>::iterator>
+persistent_set<T, Compare, Allocator>::equal_range(const T& key) const {
+  return std::make_pair(lower_bound(key), upper_bound(key));
+}
+
+template <typename T, typename Compare, typename Allocator>
+RangeView<typename persistent_set<T, Compare, Allocator>::iterator>
+persistent_set<T, Compare, Allocator>::range(
+    const T& first, const T& last) const {
+  return RangeView<iterator>(lower_bound(first), lower_bound(last));
+}
+
+// observers
+
+template <typename T, typename Compare, typename Allocator>
+typename persistent_set<T, Compare, Allocator>::key_compare
+persistent_set<T, Compare, Allocator>::key_comp() const {
+  return tree_.GetCompare();
+}
+
+template <typename T, typename Compare, typename Allocator>
+const typename persistent_set<T, Compare, Allocator>::tree_type&
+persistent_set<T, Compare, Allocator>::get_tree() const {
+  return tree_;
+}
+
+template <typename T, typename Compare, typename Allocator>
+container_stats persistent_set<T, Compare, Allocator>::stats() const {
+  return tree_.GetStats();
+}
+
+}  // namespace s21
+
+#endif
@@ -0,0 +1,11 @@
+#ifndef S21_CONTAINERS_PREFETCH_H
+#define S21_CONTAINERS_PREFETCH_H
+
+// Hint to fetch the cache line at address, which may be null, ahead of use
+#if defined(__GNUC__)
+#define S21_PREFETCH(address) __builtin_prefetch(address)
+#else
+#define S21_PREFETCH(address) static_cast<void>(address)
+#endif
+
+#endif
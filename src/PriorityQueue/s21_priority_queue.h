@@ -0,0 +1,95 @@
+#ifndef S21_CONTAINERS_PRIORITY_QUEUE_H
+#define S21_CONTAINERS_PRIORITY_QUEUE_H
+
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <stdexcept>
+
+#include "../Vector/s21_vector.hpp"
+
+namespace s21 {
+// Priority queue adaptor: a d-ary heap with Arity children per node stored
+// in Container, any sequence with a random-access begin(), size, push_back,
+// emplace_back and pop_back. top() is the greatest element by Compare, as in
+// std::priority_queue. A wider heap is shallower, so a pop makes fewer
+// moves, and a node's children share a cache line; 4 suits small elements.
+//
+// Sifting moves a hole through the heap instead of swapping, one move per
+// level; pops sink it to a leaf first, as the value that fills it comes
+// from the bottom. push_pop and replace_top do a push and a pop in a single
+// sift.
+template <typename T, typename Container = s21::vector<T>,
+          typename Compare = std::less<T>, size_t Arity = 4>
+class priority_queue {
+  static_assert(Arity >= 2, "a heap node needs at least two children");
+
+ public:
+  // member type
+  using container_type = Container;
+  using value_compare = Compare;
+  using value_type = T;
+  using reference = T&;
+  using const_reference = const T&;
+  using size_type = size_t;
+
+  static constexpr size_type arity = Arity;
+
+  // functions
+  priority_queue();
+  explicit priority_queue(const Compare& comp);
+  // The constructors from elements build the heap in O(n)
+  priority_queue(std::initializer_list<value_type> const& items);
+  template <typename InputIt>
+  priority_queue(InputIt first, InputIt last, const Compare& comp = Compare());
+  priority_queue(const Compare& comp, Container&& elements);
+  priority_queue(const priority_queue& other) = default;
+  priority_queue(priority_queue&& other) = default;
+  ~priority_queue() = default;
+  priority_queue& operator=(const priority_queue& other) = default;
+  priority_queue& operator=(priority_queue&& other) = default;
+
+  // element access, std::out_of_range on an empty queue
+  const_reference top() const;
+
+  // capacity
+  bool empty() const;
+  size_type size() const;
+  void reserve(size_type count);
+
+  // modifiers
+  void push(const_reference value);
+  void push(value_type&& value);
+  template <typename... Args>
+  void emplace(Args&&... args);
+  void pop();
+  // Pushes value and pops the greatest element, which is returned; value
+  // itself when nothing in the queue is greater, without touching the heap
+  value_type push_pop(value_type value);
+  // Pops the greatest element, which is returned, and pushes value;
+  // std::out_of_range on an empty queue
+  value_type replace_top(value_type value);
+  void clear();
+  void swap(priority_queue& other);
+
+  // observers
+  value_compare value_comp() const;
+  // Elements in heap order
+  const container_type& container() const;
+
+  // Counters of the S21_CONTAINERS_STATS mode of the container
+  container_stats stats() const;
+
+ private:
+  Container c_;
+  Compare comp_;
+
+  void SiftUp(size_type index);
+  void SiftDown(size_type index);
+  void Heapify();
+};
+}  // namespace s21
+
+#include "s21_priority_queue.tpp"
+
+#endif
@@ -0,0 +1,215 @@
+#ifndef S21_CONTAINERS_PRIORITY_QUEUE_TPP
+#define S21_CONTAINERS_PRIORITY_QUEUE_TPP
+
+#include <utility>
+
+namespace s21 {
+
+// functions
+
+template <typename T, typename Container, typename Compare, size_t Arity>
+priority_queue<T, Container, Compare, Arity>::priority_queue()
+    : c_(), comp_() {}
+
+template <typename T, typename Container, typename Compare, size_t Arity>
+priority_queue<T, Container, Compare, Arity>::priority_queue(
+    const Compare& comp)
+    : c_(), comp_(comp) {}
+
+template <typename T, typename Container, typename Compare, size_t Arity>
+priority_queue<T, Container, Compare, Arity>::priority_queue(
+    std::initializer_list<value_type> const& items)
+    : priority_queue(items.begin(), items.end()) {}
+
+template <typename T, typename Container, typename Compare, size_t Arity>
+template <typename InputIt>
+priority_queue<T, Container, Compare, Arity>::priority_queue(
+    InputIt first, InputIt last, const Compare& comp)
+    : c_(), comp_(comp) {
+  for (; first != last; ++first) c_.push_back(*first);
+  Heapify();
+}
+
+template <typename T, typename Container, typename Compare, size_t Arity>
+priority_queue<T, Container, Compare, Arity>::priority_queue(
+    const Compare& comp, Container&& elements)
+    : c_(std::move(elements)), comp_(comp) {
+  Heapify();
+}
+
+// element access
+
+template <typename T, typename Container, typename Compare, size_t Arity>
+typename priority_queue<T, Container, Compare, Arity>::const_reference
+priority_queue<T, Container, Compare, Arity>::top() const {
+  if (empty()) throw std::out_of_range("Priority queue is empty");
+  return c_[0];
+}
+
+// capacity
+
+template <typename T, typename Container, typename Compare, size_t Arity>
+bool priority_queue<T, Container, Compare, Arity>::empty() const {
+  return c_.size() == 0;
+}
+
+template <typename T, typename Container, typename Compare, size_t Arity>
+typename priority_queue<T, Container, Compare, Arity>::size_type
+priority_queue<T, Container, Compare, Arity>::size() const {
+  return c_.size();
+}
+
+template <typename T, typename Container, typename Compare, size_t Arity>
+void priority_queue<T, Container, Compare, Arity>::reserve(size_type count) {
+  c_.reserve(count);
+}
+
+// modifiers
+
+template <typename T, typename Container, typename Compare, size_t Arity>
+void priority_queue<T, Container, Compare, Arity>::push(
+    const_reference value) {
+  c_.push_back(value);
+  SiftUp(c_.size() - 1);
+}
+
+template <typename T, typename Container, typename Compare, size_t Arity>
+void priority_queue<T, Container, Compare, Arity>::push(value_type&& value) {
+  c_.push_back(std::move(value));
+  SiftUp(c_.size() - 1);
+}
+
+template <typename T, typename Container, typename Compare, size_t Arity>
+template <typename... Args>
+void priority_queue<T, Container, Compare, Arity>::emplace(Args&&... args) {
+  c_.emplace_back(std::forward<Args>(args)...);
+  SiftUp(c_.size() - 1);
+}
+
+// The last element fills the root and sinks
+template <typename T, typename Container, typename Compare, size_t Arity>
+void priority_queue<T, Container, Compare, Arity>::pop() {
+  if (empty()) throw std::out_of_range("Priority queue is empty");
+  if (c_.size() > 1) c_[0] = std::move(c_[c_.size() - 1]);
+  c_.pop_back();
+  if (c_.size() > 1) SiftDown(0);
+}
+
+template <typename T, typename Container, typename Compare, size_t Arity>
+typename priority_queue<T, Container, Compare, Arity>::value_type
+priority_queue<T, Container, Compare, Arity>::push_pop(value_type value) {
+  if (empty() || !comp_(value, c_[0])) return value;
+  std::swap(value, *c_.begin());
+  SiftDown(0);
+  return value;
+}
+
+template <typename T, typename Container, typename Compare, size_t Arity>
+typename priority_queue<T, Container, Compare, Arity>::value_type
+priority_queue<T, Container, Compare, Arity>::replace_top(value_type value) {
+  if (empty()) throw std::out_of_range("Priority queue is empty");
+  std::swap(value, *c_.begin());
+  SiftDown(0);
+  return value;
+}
+
+template <typename T, typename Container, typename Compare, size_t Arity>
+void priority_queue<T, Container, Compare, Arity>::clear() {
+  c_.clear();
+}
+
+template <typename T, typename Container, typename Compare, size_t Arity>
+void priority_queue<T, Container, Compare, Arity>::swap(
+    priority_queue& other) {
+  using std::swap;
+  swap(c_, other.c_);
+  swap(comp_, other.comp_);
+}
+
+// observers
+
+template <typename T, typename Container, typename Compare, size_t Arity>
+typename priority_queue<T, Container, Compare, Arity>::value_compare
+priority_queue<T, Container, Compare, Arity>::value_comp() const {
+  return comp_;
+}
+
+template <typename T, typename Container, typename Compare, size_t Arity>
+const typename priority_queue<T, Container, Compare, Arity>::container_type&
+priority_queue<T, Container, Compare, Arity>::container() const {
+  return c_;
+}
+
+template <typename T, typename Container, typename Compare, size_t Arity>
+container_stats priority_queue<T, Container, Compare, Arity>::stats() const {
+  return c_.stats();
+}
+
+// helpers
+
+// Node i has children Arity * i + 1 .. Arity * i + Arity and parent
+// (i - 1) / Arity. The sifts index through begin(), which is not checked
+
+template <typename T, typename Container, typename Compare, size_t Arity>
+void priority_queue<T, Container, Compare, Arity>::SiftUp(size_type index) {
+  auto heap = c_.begin();
+  value_type value = std::move(heap[index]);
+  while (index > 0) {
+    size_type parent = (index - 1) / Arity;
+    if (!comp_(heap[parent], value)) break;
+    heap[index] = std::move(heap[parent]);
+    index = parent;
+  }
+  heap[index] = std::move(value);
+}
+
+// Moves the hole at index along the greater children down to a leaf, then
+// the value up from there. The value comes from the bottom of the heap and
+// usually belongs near it, so it is not compared on the way down
+template <typename T, typename Container, typename Compare, size_t Arity>
+void priority_queue<T, Container, Compare, Arity>::SiftDown(size_type index) {
+  const size_type count = c_.size();
+  const size_type start = index;
+  auto heap = c_.begin();
+  value_type value = std::move(heap[index]);
+  // Inner nodes with all Arity children, then the one that may have fewer
+  for (size_type first = index * Arity + 1; first + Arity <= count;
+       first = index * Arity + 1) {
+    size_type best = first;
+    for (size_type child = 1; child < Arity; ++child) {
+      if (comp_(heap[best], heap[first + child])) best = first + child;
+    }
+    heap[index] = std::move(heap[best]);
+    index = best;
+  }
+  size_type first = index * Arity + 1;
+  if (first < count) {
+    size_type best = first;
+    for (size_type child = first + 1; child < count; ++child) {
+      if (comp_(heap[best], heap[child])) best = child;
+    }
+    heap[index] = std::move(heap[best]);
+    index = best;
+  }
+  while (index > start) {
+    size_type parent = (index - 1) / Arity;
+    if (!comp_(heap[parent], value)) break;
+    heap[index] = std::move(heap[parent]);
+    index = parent;
+  }
+  heap[index] = std::move(value);
+}
+
+// Floyd's construction: sinking every inner node, last to first, is O(n)
+template <typename T, typename Container, typename Compare, size_t Arity>
+void priority_queue<T, Container, Compare, Arity>::Heapify() {
+  const size_type count = c_.size();
+  if (count < 2) return;
+  for (size_type index = (count - 2) / Arity + 1; index-- > 0;) {
+    SiftDown(index);
+  }
+}
+
+}  // namespace s21
+
+#endif
@@ -1,15 +1,22 @@
-
 #ifndef S21_CONTAINERS_QUEUE_H
 #define S21_CONTAINERS_QUEUE_H
 
 #include <iostream>
+#include <memory>
+#include <type_traits>
+
+#include "../RingBuffer/s21_ring_buffer.h"
 
 namespace s21 {
-template <typename T>
+// Адаптер очереди. По умолчанию элементы хранятся в кольцевом буфере
+// s21::ring_buffer; любой контейнер с front/back/push_back/pop_front
+// (например, s21::list) может быть передан в качестве Container
+template <typename T, typename Container = s21::ring_buffer<T>>
 class queue {
  public:
   // member type
   // Определение типов данных, используемых в классе
+  using container_type = Container;  // Тип контейнера-хранилища
   using value_type = T;  // Тип элементов очереди
   using reference = T &;  // Ссылочный тип для элементов очереди
   using const_reference = const T &;  // Константная ссылка на элементы очереди
@@ -17,6 +24,10 @@ class queue {
 
   // functions
   queue();  // Конструктор по умолчанию
+  // Пустая очередь, хранилище которой выделяет память через alloc
+  template <typename Alloc, typename = std::enable_if_t<
+                                std::uses_allocator<Container, Alloc>::value>>
+  explicit queue(const Alloc &alloc);
   queue(std::initializer_list<value_type> const
             &items);  // Конструктор, принимающий std::initializer_list
   queue(const queue &q);  // Конструктор копирования
@@ -43,18 +54,18 @@ class queue {
   void insert_many_back(
       Args &&...args);  // Добавление нескольких элементов в конец очереди
 
+  // Счетчики режима S21_CONTAINERS_STATS базового контейнера
+  container_stats stats() const;
+
  private:
-  struct Node {  // Структура узла связного списка
-    value_type data_node;  // Данные узла
-    Node *next_node;  // Указатель на следующий узел
-    Node(const_reference value)
-        : data_node(value), next_node(nullptr) {}  // Конструктор узла
-  };
-
-  Node *front_node;  // Указатель на первый узел
-  Node *back_node;   // Указатель на последний узел
-  size_type size_queue;  // Количество элементов в очереди
+  container_type data_;  // Контейнер, в котором хранятся элементы
 };
+
+namespace pmr {
+// Очередь на кольцевом буфере с std::pmr::polymorphic_allocator
+template <typename T>
+using queue = s21::queue<T, s21::pmr::ring_buffer<T>>;
+}  // namespace pmr
 };  // namespace s21
 
 #include "s21_queue.tpp"
@@ -2,67 +2,47 @@
 #define S21_CONTAINERS_QUEUE_TPP
 
 #include <iostream>
+#include <utility>
 
 namespace s21 {
 
 // functions
 
 // Конструктор по умолчанию, инициализирует пустую очередь
-template <typename T>
-queue<T>::queue() : front_node(nullptr), back_node(nullptr), size_queue(0) {}
+template <typename T, typename Container>
+queue<T, Container>::queue() : data_() {}
+
+template <typename T, typename Container>
+template <typename Alloc, typename>
+queue<T, Container>::queue(const Alloc &alloc) : data_(alloc) {}
 
 // Конструктор, инициализирующий очередь элементами из std::initializer_list
-template <typename T>
-queue<T>::queue(std::initializer_list<value_type> const &items)
-    : front_node(nullptr), back_node(nullptr), size_queue(0) {
+template <typename T, typename Container>
+queue<T, Container>::queue(std::initializer_list<value_type> const &items)
+    : data_() {
   for (const auto &item : items) {
     push(item);  // Добавляем каждый элемент в конец очереди
   }
 }
 
 // Конструктор копирования, создает глубокую копию переданной очереди
-template <typename T>
-queue<T>::queue(const queue &q)
-    : front_node(nullptr), back_node(nullptr), size_queue(0) {
-  Node *current_node = q.front_node;
-  while (current_node != nullptr) {
-    push(current_node
-             ->data_node);  // Добавляем каждый элемент в конец новой очереди
-    current_node = current_node->next_node;
-  }
-}
+template <typename T, typename Container>
+queue<T, Container>::queue(const queue &q) : data_(q.data_) {}
 
 // Конструктор перемещения, перемещает ресурсы из переданной очереди в новую
-template <typename T>
-queue<T>::queue(queue &&q)
-    : front_node(q.front_node),
-      back_node(q.back_node),
-      size_queue(q.size_queue) {
-  q.front_node = nullptr;
-  q.back_node = nullptr;
-  q.size_queue = 0;
-}
+template <typename T, typename Container>
+queue<T, Container>::queue(queue &&q) : data_(std::move(q.data_)) {}
 
-// Деструктор, освобождает память, занимаемую очередью
-template <typename T>
-queue<T>::~queue() {
-  while (!empty()) pop();  // Удаляем все элементы очереди
-}
+// Деструктор, память освобождает контейнер-хранилище
+template <typename T, typename Container>
+queue<T, Container>::~queue() {}
 
 // Оператор присваивания перемещением
-template <typename T>
-queue<T> &queue<T>::operator=(queue &&q) {
-  while (!empty()) pop();  // Удаляем все элементы текущей очереди
-
-  // Перемещаем ресурсы из переданной очереди в текущую
-  front_node = q.front_node;
-  back_node = q.back_node;
-  size_queue = q.size_queue;
-
-  // Обнуляем поля переданной очереди
-  q.front_node = nullptr;
-  q.back_node = nullptr;
-  q.size_queue = 0;
+template <typename T, typename Container>
+queue<T, Container> &queue<T, Container>::operator=(queue &&q) {
+  if (this != &q) {
+    data_ = std::move(q.data_);  // Перемещаем ресурсы в текущую очередь
+  }
 
   return *this;
 }
@@ -70,81 +50,71 @@ queue<T> &queue<T>::operator=(queue &&q) {
 // element access
 
 // Возвращает ссылку на первый элемент очереди
-template <typename T>
-typename queue<T>::const_reference queue<T>::front() {
+template <typename T, typename Container>
+typename queue<T, Container>::const_reference queue<T, Container>::front() {
   if (empty()) throw std::out_of_range("Queue is empty");
-  return front_node->data_node;
+  return data_.front();
 }
 
 // Возвращает ссылку на последний элемент очереди
-template <typename T>
-typename queue<T>::const_reference queue<T>::back() {
+template <typename T, typename Container>
+typename queue<T, Container>::const_reference queue<T, Container>::back() {
   if (empty()) throw std::out_of_range("Queue is empty");
-  return back_node->data_node;
+  return data_.back();
 }
 
 // capacity
 
 // Проверяет, пуста ли очередь
-template <typename T>
-bool queue<T>::empty() {
-  return (front_node == nullptr && back_node == nullptr && size_queue == 0);
+template <typename T, typename Container>
+bool queue<T, Container>::empty() {
+  return data_.empty();
 }
 
 // Возвращает количество элементов в очереди
-template <typename T>
-typename queue<T>::size_type queue<T>::size() {
-  return size_queue;
+template <typename T, typename Container>
+typename queue<T, Container>::size_type queue<T, Container>::size() {
+  return data_.size();
 }
 
 // modifiers
 
 // Добавляет новый элемент в конец очереди
-template <typename T>
-void queue<T>::push(const_reference value) {
-  Node *new_node = new Node(value);
-  if (empty()) {
-    front_node = new_node;
-  } else {
-    back_node->next_node = new_node;
-  }
-  back_node = new_node;
-  ++size_queue;
+template <typename T, typename Container>
+void queue<T, Container>::push(const_reference value) {
+  data_.push_back(value);
 }
 
 // Удаляет первый элемент из очереди
-template <typename T>
-void queue<T>::pop() {
+template <typename T, typename Container>
+void queue<T, Container>::pop() {
   if (empty()) throw std::out_of_range("Queue is empty");
-  Node *temp_node = front_node;
-  front_node = front_node->next_node;
-  delete temp_node;
-  --size_queue;
-  if (front_node == nullptr) {
-    back_node = nullptr;  // Если очередь опустела, обнуляем указатель на
-                          // последний элемент
-  }
+  data_.pop_front();
 }
 
 // Обменивает содержимое текущей очереди с переданной
-template <typename T>
-void queue<T>::swap(queue &other) {
-  std::swap(front_node, other.front_node);
-  std::swap(back_node, other.back_node);
-  std::swap(size_queue, other.size_queue);
+template <typename T, typename Container>
+void queue<T, Container>::swap(queue &other) {
+  data_.swap(other.data_);
 }
 
 // insert_many
 
 // Добавляет несколько элементов в конец очереди
-template <typename T>
+template <typename T, typename Container>
 template <typename... Args>
-void queue<T>::insert_many_back(Args &&...args) {
+void queue<T, Container>::insert_many_back(Args &&...args) {
   for (const auto &arg : {args...}) {
     push(arg);
   }
 }
 
+// Возвращает счетчики базового контейнера (нули, если режим выключен)
+template <typename T, typename Container>
+container_stats queue<T, Container>::stats() const {
+  return data_.stats();
+}
+
 };  // namespace s21
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,21 @@
+#ifndef S21_CONTAINERS_RANGE_VIEW_H
+#define S21_CONTAINERS_RANGE_VIEW_H
+
+namespace s21 {
+// Pair of iterators usable in a range-based for loop, returned by range()
+template <typename It>
+class RangeView {
+ public:
+  RangeView(It first, It last) : first_(first), last_(last) {}
+
+  It begin() const { return first_; }
+  It end() const { return last_; }
+  bool empty() const { return first_ == last_; }
+
+ private:
+  It first_;
+  It last_;
+};
+}  // namespace s21
+
+#endif
@@ -0,0 +1,99 @@
+#ifndef S21_CONTAINERS_RING_BUFFER_H
+#define S21_CONTAINERS_RING_BUFFER_H
+
+#include <initializer_list>
+#include <limits>
+#include <memory>
+#include <memory_resource>
+#include <stdexcept>
+
+#include "../Stats/s21_stats.h"
+
+namespace s21 {
+// Contiguous growable circular buffer. Capacity is always a power of two so
+// that the physical slot of a logical index is computed with a mask instead
+// of a division; growth doubles the capacity (amortized O(1) push_back).
+// Storage comes from Allocator through std::allocator_traits.
+template <typename T, typename Allocator = std::allocator<T>>
+class ring_buffer {
+  using alloc_traits = std::allocator_traits<Allocator>;
+  static constexpr bool kNothrowMoveAssign =
+      alloc_traits::propagate_on_container_move_assignment::value ||
+      alloc_traits::is_always_equal::value;
+
+ public:
+  // member type
+  using value_type = T;
+  using reference = T&;
+  using const_reference = const T&;
+  using size_type = size_t;
+  using allocator_type = Allocator;
+
+  // functions
+  ring_buffer();
+  explicit ring_buffer(const Allocator& alloc);
+  ring_buffer(std::initializer_list<value_type> const& items,
+              const Allocator& alloc = Allocator());
+  ring_buffer(const ring_buffer& other);
+  ring_buffer(ring_buffer&& other) noexcept;
+  ring_buffer(const ring_buffer& other, const Allocator& alloc);
+  ring_buffer(ring_buffer&& other, const Allocator& alloc);
+  ~ring_buffer();
+  ring_buffer& operator=(const ring_buffer& other);
+  ring_buffer& operator=(ring_buffer&& other) noexcept(kNothrowMoveAssign);
+  allocator_type get_allocator() const;
+
+  // element access
+  reference front();
+  const_reference front() const;
+  reference back();
+  const_reference back() const;
+  reference operator[](size_type index);
+  const_reference operator[](size_type index) const;
+
+  // capacity
+  bool empty() const;
+  size_type size() const;
+  size_type capacity() const;
+  size_type max_size() const;
+  void reserve(size_type new_capacity);
+
+  // modifiers
+  void clear();
+  void push_back(const_reference value);
+  void push_back(value_type&& value);
+  template <typename... Args>
+  reference emplace_back(Args&&... args);
+  void pop_front();
+  void pop_back();
+  void swap(ring_buffer& other) noexcept;
+
+  // instrumentation, zeros unless built with S21_CONTAINERS_STATS
+  container_stats stats() const;
+
+ private:
+  static constexpr size_type kMinCapacity = 8;
+
+  T* data_;
+  size_type head_;
+  size_type size_;
+  size_type capacity_;
+  Allocator allocator_;
+  S21_STATS_MEMBER
+
+  void Release();
+  void Adopt(ring_buffer& other);
+  size_type Slot(size_type index) const;
+  void Grow(size_type min_capacity);
+  static size_type RoundUpPowerOfTwo(size_type value);
+};
+
+namespace pmr {
+template <typename T>
+using ring_buffer = s21::ring_buffer<T, std::pmr::polymorphic_allocator<T>>;
+}  // namespace pmr
+}  // namespace s21
+
+#include "s21_ring_buffer.tpp"
+
+#endif
@@ -0,0 +1,384 @@
+#ifndef S21_CONTAINERS_RING_BUFFER_TPP
+#define S21_CONTAINERS_RING_BUFFER_TPP
+
+#include <utility>
+
+namespace s21 {
+
+// functions
+
+// Default constructor, no storage is allocated until the first push
+template <typename T, typename Allocator>
+ring_buffer<T, Allocator>::ring_buffer() : ring_buffer(Allocator()) {}
+
+// Empty buffer whose storage will come from alloc
+template <typename T, typename Allocator>
+ring_buffer<T, Allocator>::ring_buffer(const Allocator& alloc)
+    : data_(nullptr), head_(0), size_(0), capacity_(0), allocator_(alloc) {}
+
+// Constructor that creates a buffer from an initializer list
+template <typename T, typename Allocator>
+ring_buffer<T, Allocator>::ring_buffer(
+    std::initializer_list<value_type> const& items, const Allocator& alloc)
+    : ring_buffer(alloc) {
+  reserve(items.size());
+  for (const auto& item : items) {
+    push_back(item);
+  }
+}
+
+// Copy constructor, the copy is compacted so that its head starts at slot 0.
+// The allocator is the one select_on_container_copy_construction gives
+template <typename T, typename Allocator>
+ring_buffer<T, Allocator>::ring_buffer(const ring_buffer& other)
+    : ring_buffer(other, alloc_traits::select_on_container_copy_construction(
+                             other.allocator_)) {}
+
+// Move constructor, steals the storage together with its allocator and
+// leaves the source empty
+template <typename T, typename Allocator>
+ring_buffer<T, Allocator>::ring_buffer(ring_buffer&& other) noexcept
+    : data_(other.data_),
+      head_(other.head_),
+      size_(other.size_),
+      capacity_(other.capacity_),
+      allocator_(std::move(other.allocator_)) {
+  other.data_ = nullptr;
+  other.head_ = 0;
+  other.size_ = 0;
+  other.capacity_ = 0;
+}
+
+template <typename T, typename Allocator>
+ring_buffer<T, Allocator>::ring_buffer(const ring_buffer& other,
+                                       const Allocator& alloc)
+    : ring_buffer(alloc) {
+  reserve(other.size_);
+  for (size_type i = 0; i < other.size_; ++i) {
+    push_back(other[i]);
+  }
+}
+
+// Steals the storage if alloc equals the source's allocator, moves the
+// elements one by one otherwise
+template <typename T, typename Allocator>
+ring_buffer<T, Allocator>::ring_buffer(ring_buffer&& other,
+                                       const Allocator& alloc)
+    : ring_buffer(alloc) {
+  if (allocator_ == other.allocator_) {
+    Adopt(other);
+  } else {
+    reserve(other.size_);
+    for (size_type i = 0; i < other.size_; ++i) {
+      push_back(std::move(other[i]));
+    }
+  }
+}
+
+// Destructor, destroys the elements and releases the storage
+template <typename T, typename Allocator>
+ring_buffer<T, Allocator>::~ring_buffer() {
+  Release();
+}
+
+// Copy assignment operator. The copy is built aside with the allocator this
+// buffer ends up with: its own, or other's under
+// propagate_on_container_copy_assignment
+template <typename T, typename Allocator>
+ring_buffer<T, Allocator>& ring_buffer<T, Allocator>::operator=(
+    const ring_buffer& other) {
+  if (this != &other) {
+    if constexpr (alloc_traits::propagate_on_container_copy_assignment::
+                      value) {
+      ring_buffer tmp(other, other.allocator_);
+      Release();
+      allocator_ = other.allocator_;
+      Adopt(tmp);
+    } else {
+      ring_buffer tmp(other, allocator_);
+      Release();
+      Adopt(tmp);
+    }
+  }
+  return *this;
+}
+
+// Move assignment operator. The storage is stolen when the allocator
+// propagates or the two are equal; otherwise the elements are moved into
+// storage from this buffer's allocator
+template <typename T, typename Allocator>
+ring_buffer<T, Allocator>& ring_buffer<T, Allocator>::operator=(
+    ring_buffer&& other) noexcept(kNothrowMoveAssign) {
+  if (this != &other) {
+    if constexpr (alloc_traits::propagate_on_container_move_assignment::
+                      value) {
+      Release();
+      allocator_ = std::move(other.allocator_);
+      Adopt(other);
+    } else if (allocator_ == other.allocator_) {
+      Release();
+      Adopt(other);
+    } else {
+      ring_buffer tmp(std::move(other), allocator_);
+      Release();
+      Adopt(tmp);
+    }
+  }
+  return *this;
+}
+
+template <typename T, typename Allocator>
+typename ring_buffer<T, Allocator>::allocator_type
+ring_buffer<T, Allocator>::get_allocator() const {
+  return allocator_;
+}
+
+// element access
+
+// Returns a reference to the oldest element
+template <typename T, typename Allocator>
+typename ring_buffer<T, Allocator>::reference
+ring_buffer<T, Allocator>::front() {
+  if (empty()) throw std::out_of_range("Ring buffer is empty");
+  return data_[head_];
+}
+
+template <typename T, typename Allocator>
+typename ring_buffer<T, Allocator>::const_reference
+ring_buffer<T, Allocator>::front() const {
+  if (empty()) throw std::out_of_range("Ring buffer is empty");
+  return data_[head_];
+}
+
+// Returns a reference to the newest element
+template <typename T, typename Allocator>
+typename ring_buffer<T, Allocator>::reference
+ring_buffer<T, Allocator>::back() {
+  if (empty()) throw std::out_of_range("Ring buffer is empty");
+  return data_[Slot(size_ - 1)];
+}
+
+template <typename T, typename Allocator>
+typename ring_buffer<T, Allocator>::const_reference
+ring_buffer<T, Allocator>::back() const {
+  if (empty()) throw std::out_of_range("Ring buffer is empty");
+  return data_[Slot(size_ - 1)];
+}
+
+// Returns a reference to the element at the logical position index, where 0
+// is the front
+template <typename T, typename Allocator>
+typename ring_buffer<T, Allocator>::reference
+ring_buffer<T, Allocator>::operator[](size_type index) {
+  return data_[Slot(index)];
+}
+
+template <typename T, typename Allocator>
+typename ring_buffer<T, Allocator>::const_reference
+ring_buffer<T, Allocator>::operator[](size_type index) const {
+  return data_[Slot(index)];
+}
+
+// capacity
+
+// Returns true if the buffer holds no elements
+template <typename T, typename Allocator>
+bool ring_buffer<T, Allocator>::empty() const {
+  return size_ == 0;
+}
+
+// Returns the number of elements in the buffer
+template <typename T, typename Allocator>
+typename ring_buffer<T, Allocator>::size_type
+ring_buffer<T, Allocator>::size() const {
+  return size_;
+}
+
+// Returns the number of slots allocated, always zero or a power of two
+template <typename T, typename Allocator>
+typename ring_buffer<T, Allocator>::size_type
+ring_buffer<T, Allocator>::capacity() const {
+  return capacity_;
+}
+
+// Returns the maximum number of elements the buffer can hold
+template <typename T, typename Allocator>
+typename ring_buffer<T, Allocator>::size_type
+ring_buffer<T, Allocator>::max_size() const {
+  return std::numeric_limits<size_type>::max() / sizeof(value_type) / 2;
+}
+
+// Makes room for at least new_capacity elements, rounded up to a power of two
+template <typename T, typename Allocator>
+void ring_buffer<T, Allocator>::reserve(size_type new_capacity) {
+  if (new_capacity > capacity_) Grow(new_capacity);
+}
+
+// modifiers
+
+// Destroys all elements, the storage is kept for reuse
+template <typename T, typename Allocator>
+void ring_buffer<T, Allocator>::clear() {
+  for (size_type i = 0; i < size_; ++i) {
+    alloc_traits::destroy(allocator_, data_ + Slot(i));
+  }
+  head_ = 0;
+  size_ = 0;
+}
+
+// Appends a copy of value to the back of the buffer
+template <typename T, typename Allocator>
+void ring_buffer<T, Allocator>::push_back(const_reference value) {
+  emplace_back(value);
+}
+
+// Appends value to the back of the buffer by moving it
+template <typename T, typename Allocator>
+void ring_buffer<T, Allocator>::push_back(value_type&& value) {
+  emplace_back(std::move(value));
+}
+
+// Constructs a new element in place at the back of the buffer. A full
+// buffer builds it in a temporary first, as vector does: args may refer to
+// elements that Grow moves and frees
+template <typename T, typename Allocator>
+template <typename... Args>
+typename ring_buffer<T, Allocator>::reference
+ring_buffer<T, Allocator>::emplace_back(Args&&... args) {
+  T* slot;
+  if (size_ == capacity_) {
+    T value(std::forward<Args>(args)...);
+    Grow(size_ + 1);
+    slot = data_ + Slot(size_);
+    alloc_traits::construct(allocator_, slot, std::move(value));
+  } else {
+    slot = data_ + Slot(size_);
+    alloc_traits::construct(allocator_, slot, std::forward<Args>(args)...);
+  }
+  ++size_;
+  return *slot;
+}
+
+// Removes the oldest element
+template <typename T, typename Allocator>
+void ring_buffer<T, Allocator>::pop_front() {
+  if (empty()) throw std::out_of_range("Ring buffer is empty");
+  alloc_traits::destroy(allocator_, data_ + head_);
+  head_ = (head_ + 1) & (capacity_ - 1);
+  --size_;
+}
+
+// Removes the newest element
+template <typename T, typename Allocator>
+void ring_buffer<T, Allocator>::pop_back() {
+  if (empty()) throw std::out_of_range("Ring buffer is empty");
+  --size_;
+  alloc_traits::destroy(allocator_, data_ + Slot(size_));
+}
+
+// Swaps the contents of the buffer with another buffer. The allocators are
+// swapped only under propagate_on_container_swap, otherwise they must be
+// equal, as for the standard containers
+template <typename T, typename Allocator>
+void ring_buffer<T, Allocator>::swap(ring_buffer& other) noexcept {
+  std::swap(data_, other.data_);
+  std::swap(head_, other.head_);
+  std::swap(size_, other.size_);
+  std::swap(capacity_, other.capacity_);
+  if constexpr (alloc_traits::propagate_on_container_swap::value) {
+    using std::swap;
+    swap(allocator_, other.allocator_);
+  }
+}
+
+// helpers
+
+// Maps a logical index to a physical slot; capacity_ is a power of two
+template <typename T, typename Allocator>
+typename ring_buffer<T, Allocator>::size_type ring_buffer<T, Allocator>::Slot(
+    size_type index) const {
+  return (head_ + index) & (capacity_ - 1);
+}
+
+// Reallocates the storage to hold at least min_capacity elements and moves
+// the elements so that the front lands in slot 0. The old elements are
+// destroyed only once all of them are in the new storage, so a throwing
+// copy leaves the buffer as it was
+template <typename T, typename Allocator>
+void ring_buffer<T, Allocator>::Grow(size_type min_capacity) {
+  size_type new_capacity = capacity_ ? capacity_ * 2 : kMinCapacity;
+  if (new_capacity < min_capacity) {
+    new_capacity = RoundUpPowerOfTwo(min_capacity);
+  }
+  if (new_capacity > max_size()) {
+    throw std::length_error("Ring buffer is full");
+  }
+
+  T* new_data = alloc_traits::allocate(allocator_, new_capacity);
+  size_type moved = 0;
+  try {
+    for (; moved < size_; ++moved) {
+      alloc_traits::construct(allocator_, new_data + moved,
+                              std::move_if_noexcept(data_[Slot(moved)]));
+    }
+  } catch (...) {
+    for (size_type i = 0; i < moved; ++i) {
+      alloc_traits::destroy(allocator_, new_data + i);
+    }
+    alloc_traits::deallocate(allocator_, new_data, new_capacity);
+    throw;
+  }
+  S21_STATS(Allocation(new_capacity * sizeof(T)));
+  for (size_type i = 0; i < size_; ++i) {
+    alloc_traits::destroy(allocator_, data_ + Slot(i));
+  }
+  if (data_ != nullptr) {
+    alloc_traits::deallocate(allocator_, data_, capacity_);
+    S21_STATS(Deallocation());
+    S21_STATS(Reallocation());
+  }
+
+  data_ = new_data;
+  head_ = 0;
+  capacity_ = new_capacity;
+}
+
+// Returns the smallest power of two that is not less than value
+template <typename T, typename Allocator>
+typename ring_buffer<T, Allocator>::size_type
+ring_buffer<T, Allocator>::RoundUpPowerOfTwo(size_type value) {
+  size_type result = kMinCapacity;
+  while (result < value) result <<= 1;
+  return result;
+}
+
+// Destroys the elements and returns the storage to the allocator
+template <typename T, typename Allocator>
+void ring_buffer<T, Allocator>::Release() {
+  clear();
+  if (data_ != nullptr) {
+    alloc_traits::deallocate(allocator_, data_, capacity_);
+    S21_STATS(Deallocation());
+    data_ = nullptr;
+    capacity_ = 0;
+  }
+}
+
+// Takes over the storage of other; the allocators must be equal
+template <typename T, typename Allocator>
+void ring_buffer<T, Allocator>::Adopt(ring_buffer& other) {
+  data_ = std::exchange(other.data_, nullptr);
+  head_ = std::exchange(other.head_, 0);
+  size_ = std::exchange(other.size_, 0);
+  capacity_ = std::exchange(other.capacity_, 0);
+}
+
+// Counters of the instrumentation mode, zeros when it is disabled
+template <typename T, typename Allocator>
+container_stats ring_buffer<T, Allocator>::stats() const {
+  return S21_STATS_GET();
+}
+
+}  // namespace s21
+
+#endif
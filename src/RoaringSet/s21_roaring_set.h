@@ -0,0 +1,217 @@
+#ifndef S21_CONTAINERS_ROARING_SET_H
+#define S21_CONTAINERS_ROARING_SET_H
+
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <utility>
+
+#include "../Bitset/s21_bitset.h"
+#include "../RangeView/s21_range_view.h"
+#include "../Set/s21_set.hpp"
+#include "../Stats/s21_stats.h"
+#include "../Vector/s21_vector.hpp"
+
+namespace s21 {
+// Compressed ordered set of 32-bit keys with the interface of s21::set, in
+// the layout of roaring bitmaps. Keys are split by their high 16 bits into
+// chunks kept in an s21::vector sorted by those bits; a chunk stores the low
+// 16 bits of its keys in whichever of three forms is smallest:
+//
+//  - array: up to 4096 sorted uint16_t, 2 bytes a key;
+//  - bitmap: 65536 bits in 1024 words, 8 KiB whatever the count, used past
+//    4096 keys, where it becomes the smaller one;
+//  - run: start and length of each run of consecutive keys, 4 bytes a run.
+//
+// Arrays and bitmaps convert into each other as chunks cross 4096 keys.
+// Runs are made by optimize(), which also trims the spare capacity, and by
+// union and intersection of two run chunks; an insertion or erasure in a
+// run chunk turns it back into an array or a bitmap, as is the usual
+// practice with these sets.
+//
+// Dense or clustered sets of ids cost from a bit to two bytes per key
+// against about 40 per element of s21::set<uint32_t>. |=, &= and and_not
+// walk the two chunk lists in step and combine chunks by their forms:
+// bitmaps a word, or four with AVX2, at a time, arrays by merging, runs as
+// lists of intervals.
+//
+// Iterators are forward and read-only; any insertion or erasure
+// invalidates them.
+class roaring_set {
+ public:
+  // member type
+  using key_type = uint32_t;
+  using value_type = uint32_t;
+  // Keys are put together from the chunk and the low bits rather than
+  // stored, so the iterators return them by value
+  using reference = uint32_t;
+  using const_reference = uint32_t;
+  using size_type = size_t;
+  class const_iterator;
+  using iterator = const_iterator;
+
+  // functions
+  roaring_set();
+  roaring_set(std::initializer_list<value_type> const& items);
+  template <typename Key, typename Compare>
+  explicit roaring_set(const s21::set<Key, Compare>& keys);
+  roaring_set(const roaring_set& other) = default;
+  roaring_set(roaring_set&& other) noexcept;
+  roaring_set& operator=(const roaring_set& other) = default;
+  roaring_set& operator=(roaring_set&& other) noexcept;
+  ~roaring_set() = default;
+
+  // iterators
+  iterator begin() const;
+  iterator end() const;
+
+  // capacity
+  bool empty() const;
+  size_type size() const;
+  size_type max_size() const;
+  // Bytes of the chunk list and of the chunks' storage
+  size_type memory_usage() const;
+
+  // modifiers
+  void clear();
+  std::pair<iterator, bool> insert(value_type value);
+  void erase(iterator pos);
+  size_type erase(value_type key);
+  void swap(roaring_set& other) noexcept;
+  // Moves in the keys of other; the ones already here stay in other
+  void merge(roaring_set& other);
+  // Replaces the contents by the keys of a range, in any order
+  template <typename ForwardIt>
+  void assign_sorted(ForwardIt first, ForwardIt last);
+  // Union, intersection and difference, *this & ~other
+  roaring_set& operator|=(const roaring_set& other);
+  roaring_set& operator&=(const roaring_set& other);
+  roaring_set& and_not(const roaring_set& other);
+  // Stores every chunk in its smallest form, runs included, and releases
+  // spare capacity
+  void optimize();
+  bool operator==(const roaring_set& other) const;
+  bool operator!=(const roaring_set& other) const;
+
+  // lookup
+  bool contains(value_type key) const;
+  iterator find(value_type key) const;
+  iterator lower_bound(value_type key) const;
+  iterator upper_bound(value_type key) const;
+  std::pair<iterator, iterator> equal_range(value_type key) const;
+  // Keys in [first, last)
+  RangeView<iterator> range(value_type first, value_type last) const;
+  // Calls visit(key) for all keys or those in [first, last) in ascending
+  // order, a chunk at a time
+  template <typename F>
+  void for_each(F visit) const;
+  template <typename F>
+  void visit_range(value_type first, value_type last, F visit) const;
+  template <typename Key = uint32_t>
+  s21::set<Key> to_set() const;
+
+  // Counters of the S21_CONTAINERS_STATS mode of the chunk list
+  container_stats stats() const;
+
+ private:
+  using word_type = bitset_detail::word_t;
+
+  static constexpr size_type kArrayMax = 4096;
+  static constexpr size_type kBitmapWords = 1024;
+  static constexpr size_type kChunkBits = 65536;
+
+  struct Chunk {
+    enum class Kind : uint8_t { kArray, kBitmap, kRun };
+
+    uint16_t key = 0;
+    Kind kind = Kind::kArray;
+    uint32_t cardinality = 0;
+    // Array: the sorted keys; run: start and length - 1 of each run in turn
+    s21::vector<uint16_t> values;
+    // Bitmap: kBitmapWords words
+    s21::vector<word_type> words;
+  };
+
+  s21::vector<Chunk> chunks_;
+  size_type size_;
+
+  Chunk* Chunks() { return chunks_.begin(); }
+  const Chunk* Chunks() const { return chunks_.begin(); }
+  size_type ChunkIndex(uint16_t key) const;
+  iterator At(size_type chunk, uint32_t low) const;
+  void EraseChunk(size_type chunk);
+  void Recount();
+
+  static uint16_t High(value_type key) { return key >> 16; }
+  static uint16_t Low(value_type key) { return key & 0xFFFF; }
+  static size_type RunCount(const Chunk& chunk);
+  static size_type CountRuns(const Chunk& chunk);
+  static size_type FindRun(const Chunk& chunk, uint16_t low);
+  static bool Contains(const Chunk& chunk, uint16_t low);
+  static bool Add(Chunk& chunk, uint16_t low);
+  static bool Remove(Chunk& chunk, uint16_t low);
+  template <typename F>
+  static void ForEach(const Chunk& chunk, F visit);
+  static void ToArray(Chunk& chunk);
+  static void ToBitmap(Chunk& chunk);
+  static void ToRuns(Chunk& chunk);
+  static void Unpack(Chunk& chunk);
+  static void Normalize(Chunk& chunk);
+  static void Optimize(Chunk& chunk);
+  static const Chunk& Plain(const Chunk& chunk, Chunk& scratch);
+  static void PushRun(Chunk& chunk, uint32_t start, uint32_t last);
+  static Chunk UniteRuns(const Chunk& left, const Chunk& right);
+  static Chunk IntersectRuns(const Chunk& left, const Chunk& right);
+  static Chunk Unite(const Chunk& left, const Chunk& right);
+  static Chunk Intersect(const Chunk& left, const Chunk& right);
+  static Chunk Subtract(const Chunk& left, const Chunk& right);
+
+ public:
+  class const_iterator {
+   public:
+    using value_type = uint32_t;
+    using reference = uint32_t;
+    using pointer = const uint32_t*;
+    using difference_type = std::ptrdiff_t;
+    using iterator_category = std::forward_iterator_tag;
+
+    const_iterator() : set_(nullptr), chunk_(0), cursor_(0), value_(0) {}
+
+    reference operator*() const { return value_; }
+    const_iterator& operator++();
+    const_iterator operator++(int) {
+      const_iterator temp = *this;
+      ++*this;
+      return temp;
+    }
+    bool operator==(const const_iterator& other) const {
+      return chunk_ == other.chunk_ && value_ == other.value_;
+    }
+    bool operator!=(const const_iterator& other) const {
+      return !(*this == other);
+    }
+
+   private:
+    friend class roaring_set;
+
+    // cursor is the index of the key in an array chunk and of the run in a
+    // run chunk; a bitmap chunk needs only the key
+    const_iterator(const roaring_set* set, size_type chunk, size_type cursor,
+                   uint32_t value)
+        : set_(set), chunk_(chunk), cursor_(cursor), value_(value) {}
+
+    const roaring_set* set_;
+    size_type chunk_;
+    size_type cursor_;
+    uint32_t value_;
+  };
+};
+
+roaring_set operator|(roaring_set left, const roaring_set& right);
+roaring_set operator&(roaring_set left, const roaring_set& right);
+}  // namespace s21
+
+#include "s21_roaring_set.tpp"
+
+#endif
@@ -0,0 +1,799 @@
+#ifndef S21_CONTAINERS_ROARING_SET_TPP
+#define S21_CONTAINERS_ROARING_SET_TPP
+
+#include <algorithm>
+#include <utility>
+
+namespace s21 {
+
+// functions
+
+inline roaring_set::roaring_set() : chunks_(), size_(0) {}
+
+inline roaring_set::roaring_set(std::initializer_list<value_type> const& items)
+    : roaring_set() {
+  for (value_type item : items) insert(item);
+}
+
+template <typename Key, typename Compare>
+roaring_set::roaring_set(const s21::set<Key, Compare>& keys) : roaring_set() {
+  bitset_detail::CheckKeyType<Key>();
+  keys.for_each(
+      [this](const Key& key) { insert(static_cast<value_type>(key)); });
+}
+
+inline roaring_set::roaring_set(roaring_set&& other) noexcept
+    : chunks_(std::move(other.chunks_)), size_(other.size_) {
+  other.size_ = 0;
+}
+
+inline roaring_set& roaring_set::operator=(roaring_set&& other) noexcept {
+  if (this != &other) {
+    chunks_ = std::move(other.chunks_);
+    size_ = other.size_;
+    other.size_ = 0;
+  }
+  return *this;
+}
+
+// iterators
+
+inline roaring_set::iterator roaring_set::begin() const { return At(0, 0); }
+
+inline roaring_set::iterator roaring_set::end() const {
+  return iterator(this, chunks_.size(), 0, 0);
+}
+
+inline roaring_set::const_iterator& roaring_set::const_iterator::operator++() {
+  using Kind = Chunk::Kind;
+  const Chunk& chunk = set_->Chunks()[chunk_];
+  const uint32_t high = value_ & ~uint32_t(0xFFFF);
+  const uint32_t low = Low(value_);
+  if (chunk.kind == Kind::kArray) {
+    if (++cursor_ < chunk.cardinality) {
+      value_ = high | chunk.values.begin()[cursor_];
+      return *this;
+    }
+  } else if (chunk.kind == Kind::kBitmap) {
+    size_type pos =
+        bitset_detail::FindFrom(chunk.words.begin(), kBitmapWords, low + 1);
+    if (pos < kChunkBits) {
+      value_ = high | static_cast<uint32_t>(pos);
+      return *this;
+    }
+  } else {
+    const uint16_t* runs = chunk.values.begin();
+    if (low < uint32_t(runs[2 * cursor_]) + runs[2 * cursor_ + 1]) {
+      ++value_;
+      return *this;
+    }
+    if (++cursor_ < RunCount(chunk)) {
+      value_ = high | runs[2 * cursor_];
+      return *this;
+    }
+  }
+  *this = set_->At(chunk_ + 1, 0);
+  return *this;
+}
+
+// capacity
+
+inline bool roaring_set::empty() const { return size_ == 0; }
+
+inline roaring_set::size_type roaring_set::size() const { return size_; }
+
+inline roaring_set::size_type roaring_set::max_size() const {
+  return size_type(1) << 32;
+}
+
+inline roaring_set::size_type roaring_set::memory_usage() const {
+  size_type bytes = chunks_.capacity() * sizeof(Chunk);
+  for (const Chunk& chunk : chunks_) {
+    bytes += chunk.values.capacity() * sizeof(uint16_t) +
+             chunk.words.capacity() * sizeof(word_type);
+  }
+  return bytes;
+}
+
+// modifiers
+
+inline void roaring_set::clear() {
+  chunks_.clear();
+  size_ = 0;
+}
+
+inline std::pair<roaring_set::iterator, bool> roaring_set::insert(
+    value_type value) {
+  const uint16_t high = High(value);
+  const size_type index = ChunkIndex(high);
+  if (index == chunks_.size() || Chunks()[index].key != high) {
+    Chunk chunk;
+    chunk.key = high;
+    chunks_.push_back(std::move(chunk));
+    std::rotate(Chunks() + index, Chunks() + chunks_.size() - 1,
+                Chunks() + chunks_.size());
+  }
+  const bool inserted = Add(Chunks()[index], Low(value));
+  if (inserted) ++size_;
+  return std::make_pair(At(index, Low(value)), inserted);
+}
+
+inline void roaring_set::erase(iterator pos) {
+  if (pos != end()) erase(*pos);
+}
+
+inline roaring_set::size_type roaring_set::erase(value_type key) {
+  const size_type index = ChunkIndex(High(key));
+  if (index == chunks_.size() || Chunks()[index].key != High(key)) return 0;
+  if (!Remove(Chunks()[index], Low(key))) return 0;
+  --size_;
+  if (Chunks()[index].cardinality == 0) EraseChunk(index);
+  return 1;
+}
+
+inline void roaring_set::swap(roaring_set& other) noexcept {
+  chunks_.swap(other.chunks_);
+  std::swap(size_, other.size_);
+}
+
+inline void roaring_set::merge(roaring_set& other) {
+  if (this == &other) return;
+  roaring_set rest(other);
+  rest &= *this;
+  *this |= other;
+  other = std::move(rest);
+}
+
+template <typename ForwardIt>
+void roaring_set::assign_sorted(ForwardIt first, ForwardIt last) {
+  clear();
+  for (; first != last; ++first) insert(static_cast<value_type>(*first));
+}
+
+// Chunks found on one side only are moved or copied as they are
+inline roaring_set& roaring_set::operator|=(const roaring_set& other) {
+  if (this == &other) return *this;
+  const size_type count = chunks_.size();
+  const size_type other_count = other.chunks_.size();
+  s21::vector<Chunk> result;
+  result.reserve(count + other_count);
+  size_type i = 0;
+  size_type j = 0;
+  while (i < count || j < other_count) {
+    if (j == other_count ||
+        (i < count && Chunks()[i].key < other.Chunks()[j].key)) {
+      result.push_back(std::move(Chunks()[i++]));
+    } else if (i == count || other.Chunks()[j].key < Chunks()[i].key) {
+      result.push_back(other.Chunks()[j++]);
+    } else {
+      result.push_back(Unite(Chunks()[i++], other.Chunks()[j++]));
+    }
+  }
+  chunks_ = std::move(result);
+  Recount();
+  return *this;
+}
+
+inline roaring_set& roaring_set::operator&=(const roaring_set& other) {
+  if (this == &other) return *this;
+  const size_type count = chunks_.size();
+  const size_type other_count = other.chunks_.size();
+  s21::vector<Chunk> result;
+  result.reserve(std::min(count, other_count));
+  size_type i = 0;
+  size_type j = 0;
+  while (i < count && j < other_count) {
+    if (Chunks()[i].key < other.Chunks()[j].key) {
+      ++i;
+    } else if (other.Chunks()[j].key < Chunks()[i].key) {
+      ++j;
+    } else {
+      Chunk chunk = Intersect(Chunks()[i++], other.Chunks()[j++]);
+      if (chunk.cardinality != 0) result.push_back(std::move(chunk));
+    }
+  }
+  chunks_ = std::move(result);
+  Recount();
+  return *this;
+}
+
+inline roaring_set& roaring_set::and_not(const roaring_set& other) {
+  if (this == &other) {
+    clear();
+    return *this;
+  }
+  const size_type count = chunks_.size();
+  const size_type other_count = other.chunks_.size();
+  s21::vector<Chunk> result;
+  result.reserve(count);
+  size_type j = 0;
+  for (size_type i = 0; i < count; ++i) {
+    while (j < other_count && other.Chunks()[j].key < Chunks()[i].key) ++j;
+    if (j == other_count || Chunks()[i].key < other.Chunks()[j].key) {
+      result.push_back(std::move(Chunks()[i]));
+    } else {
+      Chunk chunk = Subtract(Chunks()[i], other.Chunks()[j]);
+      if (chunk.cardinality != 0) result.push_back(std::move(chunk));
+    }
+  }
+  chunks_ = std::move(result);
+  Recount();
+  return *this;
+}
+
+inline void roaring_set::optimize() {
+  for (Chunk& chunk : chunks_) Optimize(chunk);
+  // The copies, of the list and of each chunk, are sized to fit
+  chunks_ = s21::vector<Chunk>(chunks_);
+}
+
+// The chunks may hold the same keys in different forms, so the keys are
+// compared
+inline bool roaring_set::operator==(const roaring_set& other) const {
+  if (size_ != other.size_) return false;
+  for (iterator i = begin(), j = other.begin(); i != end(); ++i, ++j) {
+    if (*i != *j) return false;
+  }
+  return true;
+}
+
+inline bool roaring_set::operator!=(const roaring_set& other) const {
+  return !(*this == other);
+}
+
+// lookup
+
+inline bool roaring_set::contains(value_type key) const {
+  const size_type index = ChunkIndex(High(key));
+  return index < chunks_.size() && Chunks()[index].key == High(key) &&
+         Contains(Chunks()[index], Low(key));
+}
+
+inline roaring_set::iterator roaring_set::find(value_type key) const {
+  if (!contains(key)) return end();
+  return At(ChunkIndex(High(key)), Low(key));
+}
+
+inline roaring_set::iterator roaring_set::lower_bound(value_type key) const {
+  const size_type index = ChunkIndex(High(key));
+  if (index < chunks_.size() && Chunks()[index].key == High(key)) {
+    return At(index, Low(key));
+  }
+  return At(index, 0);
+}
+
+inline roaring_set::iterator roaring_set::upper_bound(value_type key) const {
+  if (key == ~value_type(0)) return end();
+  return lower_bound(key + 1);
+}
+
+inline std::pair<roaring_set::iterator, roaring_set::iterator>
+roaring_set::equal_range(value_type key) const {
+  return std::make_pair(lower_bound(key), upper_bound(key));
+}
+
+inline RangeView<roaring_set::iterator> roaring_set::range(
+    value_type first, value_type last) const {
+  return RangeView<iterator>(lower_bound(first), lower_bound(last));
+}
+
+template <typename F>
+void roaring_set::for_each(F visit) const {
+  for (const Chunk& chunk : chunks_) {
+    const uint32_t high = uint32_t(chunk.key) << 16;
+    ForEach(chunk, [&visit, high](uint32_t low) { visit(high | low); });
+  }
+}
+
+template <typename F>
+void roaring_set::visit_range(value_type first, value_type last,
+                              F visit) const {
+  for (iterator i = lower_bound(first); i != end() && *i < last; ++i) {
+    visit(*i);
+  }
+}
+
+template <typename Key>
+s21::set<Key> roaring_set::to_set() const {
+  bitset_detail::CheckKeyType<Key>();
+  s21::set<Key> keys;
+  keys.assign_sorted(begin(), end());
+  return keys;
+}
+
+inline container_stats roaring_set::stats() const { return chunks_.stats(); }
+
+// helpers
+
+// First chunk whose high bits are not below key
+inline roaring_set::size_type roaring_set::ChunkIndex(uint16_t key) const {
+  size_type first = 0;
+  size_type last = chunks_.size();
+  while (first < last) {
+    size_type middle = first + (last - first) / 2;
+    if (Chunks()[middle].key < key) {
+      first = middle + 1;
+    } else {
+      last = middle;
+    }
+  }
+  return first;
+}
+
+// First key not below low in the chunk, or in the chunks after it
+inline roaring_set::iterator roaring_set::At(size_type chunk,
+                                             uint32_t low) const {
+  using Kind = Chunk::Kind;
+  for (; chunk < chunks_.size(); ++chunk, low = 0) {
+    const Chunk& current = Chunks()[chunk];
+    const uint32_t high = uint32_t(current.key) << 16;
+    if (current.kind == Kind::kArray) {
+      const uint16_t* values = current.values.begin();
+      size_type pos =
+          std::lower_bound(values, values + current.cardinality, low) - values;
+      if (pos < current.cardinality) {
+        return iterator(this, chunk, pos, high | values[pos]);
+      }
+    } else if (current.kind == Kind::kBitmap) {
+      size_type pos =
+          bitset_detail::FindFrom(current.words.begin(), kBitmapWords, low);
+      if (pos < kChunkBits) {
+        return iterator(this, chunk, 0, high | static_cast<uint32_t>(pos));
+      }
+    } else {
+      const uint16_t* runs = current.values.begin();
+      size_type run = FindRun(current, static_cast<uint16_t>(low));
+      if (run > 0 && low <= uint32_t(runs[2 * run - 2]) + runs[2 * run - 1]) {
+        return iterator(this, chunk, run - 1, high | low);
+      }
+      if (run < RunCount(current)) {
+        return iterator(this, chunk, run, high | runs[2 * run]);
+      }
+    }
+  }
+  return end();
+}
+
+inline void roaring_set::EraseChunk(size_type chunk) {
+  std::rotate(Chunks() + chunk, Chunks() + chunk + 1,
+              Chunks() + chunks_.size());
+  chunks_.pop_back();
+}
+
+inline void roaring_set::Recount() {
+  size_ = 0;
+  for (const Chunk& chunk : chunks_) size_ += chunk.cardinality;
+}
+
+inline roaring_set::size_type roaring_set::RunCount(const Chunk& chunk) {
+  return chunk.values.size() / 2;
+}
+
+// Runs the keys of the chunk would take: in a bitmap, the set bits whose
+// lower neighbour is clear
+inline roaring_set::size_type roaring_set::CountRuns(const Chunk& chunk) {
+  using Kind = Chunk::Kind;
+  if (chunk.kind == Kind::kRun) return RunCount(chunk);
+  size_type runs = 0;
+  if (chunk.kind == Kind::kBitmap) {
+    const word_type* words = chunk.words.begin();
+    word_type carry = 0;
+    for (size_type i = 0; i < kBitmapWords; ++i) {
+      runs += bitset_detail::Popcount(words[i] & ~((words[i] << 1) | carry));
+      carry = words[i] >> 63;
+    }
+    return runs;
+  }
+  const uint16_t* values = chunk.values.begin();
+  for (size_type i = 0; i < chunk.cardinality; ++i) {
+    if (i == 0 || values[i] != values[i - 1] + 1) ++runs;
+  }
+  return runs;
+}
+
+// Runs starting at or before low
+inline roaring_set::size_type roaring_set::FindRun(const Chunk& chunk,
+                                                   uint16_t low) {
+  const uint16_t* runs = chunk.values.begin();
+  size_type first = 0;
+  size_type last = RunCount(chunk);
+  while (first < last) {
+    size_type middle = first + (last - first) / 2;
+    if (runs[2 * middle] <= low) {
+      first = middle + 1;
+    } else {
+      last = middle;
+    }
+  }
+  return first;
+}
+
+inline bool roaring_set::Contains(const Chunk& chunk, uint16_t low) {
+  using Kind = Chunk::Kind;
+  if (chunk.kind == Kind::kArray) {
+    const uint16_t* values = chunk.values.begin();
+    return std::binary_search(values, values + chunk.cardinality, low);
+  }
+  if (chunk.kind == Kind::kBitmap) {
+    return (chunk.words.begin()[low / bitset_detail::kWordBits] >>
+            (low % bitset_detail::kWordBits)) &
+           1;
+  }
+  const uint16_t* runs = chunk.values.begin();
+  size_type run = FindRun(chunk, low);
+  return run > 0 && low <= uint32_t(runs[2 * run - 2]) + runs[2 * run - 1];
+}
+
+inline bool roaring_set::Add(Chunk& chunk, uint16_t low) {
+  using Kind = Chunk::Kind;
+  if (chunk.kind == Kind::kRun) {
+    if (Contains(chunk, low)) return false;
+    Unpack(chunk);
+  }
+  if (chunk.kind == Kind::kArray) {
+    const uint16_t* values = chunk.values.begin();
+    size_type pos =
+        std::lower_bound(values, values + chunk.cardinality, low) - values;
+    if (pos < chunk.cardinality && values[pos] == low) return false;
+    if (chunk.cardinality == kArrayMax) {
+      ToBitmap(chunk);
+      return Add(chunk, low);
+    }
+    chunk.values.push_back(low);
+    std::rotate(chunk.values.begin() + pos,
+                chunk.values.begin() + chunk.cardinality,
+                chunk.values.end());
+  } else {
+    word_type& word = chunk.words.begin()[low / bitset_detail::kWordBits];
+    word_type bit = word_type(1) << (low % bitset_detail::kWordBits);
+    if (word & bit) return false;
+    word |= bit;
+  }
+  ++chunk.cardinality;
+  return true;
+}
+
+inline bool roaring_set::Remove(Chunk& chunk, uint16_t low) {
+  using Kind = Chunk::Kind;
+  if (!Contains(chunk, low)) return false;
+  if (chunk.kind == Kind::kRun) Unpack(chunk);
+  if (chunk.kind == Kind::kArray) {
+    uint16_t* values = chunk.values.begin();
+    uint16_t* pos = std::lower_bound(values, values + chunk.cardinality, low);
+    std::rotate(pos, pos + 1, values + chunk.cardinality);
+    chunk.values.pop_back();
+  } else {
+    chunk.words.begin()[low / bitset_detail::kWordBits] &=
+        ~(word_type(1) << (low % bitset_detail::kWordBits));
+  }
+  --chunk.cardinality;
+  Normalize(chunk);
+  return true;
+}
+
+// Calls visit(low) for the keys of the chunk in ascending order
+template <typename F>
+void roaring_set::ForEach(const Chunk& chunk, F visit) {
+  using Kind = Chunk::Kind;
+  if (chunk.kind == Kind::kArray) {
+    const uint16_t* values = chunk.values.begin();
+    for (size_type i = 0; i < chunk.cardinality; ++i) visit(values[i]);
+  } else if (chunk.kind == Kind::kBitmap) {
+    bitset_detail::ForEach(chunk.words.begin(), kBitmapWords,
+                           [&visit](size_type pos) {
+                             visit(static_cast<uint32_t>(pos));
+                           });
+  } else {
+    const uint16_t* runs = chunk.values.begin();
+    for (size_type run = 0; run < RunCount(chunk); ++run) {
+      const uint32_t last = uint32_t(runs[2 * run]) + runs[2 * run + 1];
+      for (uint32_t low = runs[2 * run]; low <= last; ++low) visit(low);
+    }
+  }
+}
+
+inline void roaring_set::ToArray(Chunk& chunk) {
+  s21::vector<uint16_t> values;
+  values.reserve(chunk.cardinality);
+  ForEach(chunk, [&values](uint32_t low) {
+    values.push_back(static_cast<uint16_t>(low));
+  });
+  chunk.values = std::move(values);
+  chunk.words = s21::vector<word_type>();
+  chunk.kind = Chunk::Kind::kArray;
+}
+
+inline void roaring_set::ToBitmap(Chunk& chunk) {
+  s21::vector<word_type> words;
+  words.reserve(kBitmapWords);
+  for (size_type i = 0; i < kBitmapWords; ++i) words.push_back(0);
+  word_type* bits = words.begin();
+  ForEach(chunk, [bits](uint32_t low) {
+    bits[low / bitset_detail::kWordBits] |= word_type(1)
+                                            << (low % bitset_detail::kWordBits);
+  });
+  chunk.words = std::move(words);
+  chunk.values = s21::vector<uint16_t>();
+  chunk.kind = Chunk::Kind::kBitmap;
+}
+
+inline void roaring_set::ToRuns(Chunk& chunk) {
+  s21::vector<uint16_t> runs;
+  runs.reserve(2 * CountRuns(chunk));
+  uint32_t start = 0;
+  uint32_t last = 0;
+  bool open = false;
+  ForEach(chunk, [&](uint32_t low) {
+    if (open && low == last + 1) {
+      last = low;
+      return;
+    }
+    if (open) {
+      runs.push_back(static_cast<uint16_t>(start));
+      runs.push_back(static_cast<uint16_t>(last - start));
+    }
+    start = last = low;
+    open = true;
+  });
+  if (open) {
+    runs.push_back(static_cast<uint16_t>(start));
+    runs.push_back(static_cast<uint16_t>(last - start));
+  }
+  chunk.values = std::move(runs);
+  chunk.words = s21::vector<word_type>();
+  chunk.kind = Chunk::Kind::kRun;
+}
+
+// A run chunk to an array or a bitmap by its count
+inline void roaring_set::Unpack(Chunk& chunk) {
+  if (chunk.cardinality > kArrayMax) {
+    ToBitmap(chunk);
+  } else {
+    ToArray(chunk);
+  }
+}
+
+inline void roaring_set::Normalize(Chunk& chunk) {
+  using Kind = Chunk::Kind;
+  if (chunk.kind == Kind::kBitmap && chunk.cardinality <= kArrayMax) {
+    ToArray(chunk);
+  } else if (chunk.kind == Kind::kArray && chunk.cardinality > kArrayMax) {
+    ToBitmap(chunk);
+  }
+}
+
+inline void roaring_set::Optimize(Chunk& chunk) {
+  const size_type plain = chunk.cardinality <= kArrayMax
+                              ? chunk.cardinality * sizeof(uint16_t)
+                              : kBitmapWords * sizeof(word_type);
+  if (2 * CountRuns(chunk) * sizeof(uint16_t) < plain) {
+    if (chunk.kind != Chunk::Kind::kRun) ToRuns(chunk);
+  } else if (chunk.kind == Chunk::Kind::kRun) {
+    Unpack(chunk);
+  }
+}
+
+// The chunk itself, or a run chunk unpacked into scratch
+inline const roaring_set::Chunk& roaring_set::Plain(const Chunk& chunk,
+                                                    Chunk& scratch) {
+  if (chunk.kind != Chunk::Kind::kRun) return chunk;
+  scratch = chunk;
+  Unpack(scratch);
+  return scratch;
+}
+
+// Appends [start, last] to a run chunk, joining it to the last run when
+// they touch; starts come in ascending order
+inline void roaring_set::PushRun(Chunk& chunk, uint32_t start,
+                                 uint32_t last) {
+  const size_type runs = RunCount(chunk);
+  uint16_t* values = chunk.values.begin();
+  if (runs > 0) {
+    const uint32_t end = uint32_t(values[2 * runs - 2]) + values[2 * runs - 1];
+    if (start <= end + 1) {
+      if (last > end) {
+        values[2 * runs - 1] =
+            static_cast<uint16_t>(last - values[2 * runs - 2]);
+        chunk.cardinality += last - end;
+      }
+      return;
+    }
+  }
+  chunk.values.push_back(static_cast<uint16_t>(start));
+  chunk.values.push_back(static_cast<uint16_t>(last - start));
+  chunk.cardinality += last - start + 1;
+}
+
+// Two run chunks are combined as lists of intervals, without unpacking
+inline roaring_set::Chunk roaring_set::UniteRuns(const Chunk& left,
+                                                 const Chunk& right) {
+  const uint16_t* x = left.values.begin();
+  const uint16_t* y = right.values.begin();
+  const uint16_t* x_end = x + left.values.size();
+  const uint16_t* y_end = y + right.values.size();
+  Chunk result;
+  result.key = left.key;
+  result.kind = Chunk::Kind::kRun;
+  result.values.reserve(left.values.size() + right.values.size());
+  while (x != x_end || y != y_end) {
+    const uint16_t*& next = y == y_end || (x != x_end && x[0] < y[0]) ? x : y;
+    PushRun(result, next[0], uint32_t(next[0]) + next[1]);
+    next += 2;
+  }
+  Optimize(result);
+  return result;
+}
+
+inline roaring_set::Chunk roaring_set::IntersectRuns(const Chunk& left,
+                                                     const Chunk& right) {
+  const uint16_t* x = left.values.begin();
+  const uint16_t* y = right.values.begin();
+  const uint16_t* x_end = x + left.values.size();
+  const uint16_t* y_end = y + right.values.size();
+  Chunk result;
+  result.key = left.key;
+  result.kind = Chunk::Kind::kRun;
+  while (x != x_end && y != y_end) {
+    const uint32_t x_last = uint32_t(x[0]) + x[1];
+    const uint32_t y_last = uint32_t(y[0]) + y[1];
+    const uint32_t start = std::max(x[0], y[0]);
+    const uint32_t last = std::min(x_last, y_last);
+    if (start <= last) PushRun(result, start, last);
+    if (x_last < y_last) {
+      x += 2;
+    } else {
+      y += 2;
+    }
+  }
+  Optimize(result);
+  return result;
+}
+
+inline roaring_set::Chunk roaring_set::Unite(const Chunk& left,
+                                             const Chunk& right) {
+  using Kind = Chunk::Kind;
+  if (left.kind == Kind::kRun && right.kind == Kind::kRun) {
+    return UniteRuns(left, right);
+  }
+  Chunk left_scratch;
+  Chunk right_scratch;
+  const Chunk& a = Plain(left, left_scratch);
+  const Chunk& b = Plain(right, right_scratch);
+  Chunk result;
+  result.key = left.key;
+  if (a.kind == Kind::kBitmap || b.kind == Kind::kBitmap) {
+    const Chunk& bitmap = a.kind == Kind::kBitmap ? a : b;
+    const Chunk& other = a.kind == Kind::kBitmap ? b : a;
+    result.kind = Kind::kBitmap;
+    result.words = bitmap.words;
+    word_type* bits = result.words.begin();
+    if (other.kind == Kind::kBitmap) {
+      bitset_detail::Combine<bitset_detail::BitOp::kOr>(
+          bits, other.words.begin(), kBitmapWords);
+    } else {
+      ForEach(other, [bits](uint32_t low) {
+        bits[low / bitset_detail::kWordBits] |=
+            word_type(1) << (low % bitset_detail::kWordBits);
+      });
+    }
+    result.cardinality =
+        static_cast<uint32_t>(bitset_detail::Count(bits, kBitmapWords));
+  } else {
+    const uint16_t* x = a.values.begin();
+    const uint16_t* y = b.values.begin();
+    const uint16_t* x_end = x + a.cardinality;
+    const uint16_t* y_end = y + b.cardinality;
+    result.values.reserve(a.cardinality + b.cardinality);
+    while (x != x_end && y != y_end) {
+      if (*x < *y) {
+        result.values.push_back(*x++);
+      } else if (*y < *x) {
+        result.values.push_back(*y++);
+      } else {
+        result.values.push_back(*x++);
+        ++y;
+      }
+    }
+    for (; x != x_end; ++x) result.values.push_back(*x);
+    for (; y != y_end; ++y) result.values.push_back(*y);
+    result.cardinality = static_cast<uint32_t>(result.values.size());
+  }
+  Normalize(result);
+  return result;
+}
+
+inline roaring_set::Chunk roaring_set::Intersect(const Chunk& left,
+                                                 const Chunk& right) {
+  using Kind = Chunk::Kind;
+  if (left.kind == Kind::kRun && right.kind == Kind::kRun) {
+    return IntersectRuns(left, right);
+  }
+  Chunk left_scratch;
+  Chunk right_scratch;
+  const Chunk& a = Plain(left, left_scratch);
+  const Chunk& b = Plain(right, right_scratch);
+  Chunk result;
+  result.key = left.key;
+  if (a.kind == Kind::kBitmap && b.kind == Kind::kBitmap) {
+    result.kind = Kind::kBitmap;
+    result.words = a.words;
+    bitset_detail::Combine<bitset_detail::BitOp::kAnd>(
+        result.words.begin(), b.words.begin(), kBitmapWords);
+    result.cardinality = static_cast<uint32_t>(
+        bitset_detail::Count(result.words.begin(), kBitmapWords));
+  } else if (a.kind == Kind::kBitmap || b.kind == Kind::kBitmap) {
+    const Chunk& bitmap = a.kind == Kind::kBitmap ? a : b;
+    const Chunk& array = a.kind == Kind::kBitmap ? b : a;
+    result.values.reserve(array.cardinality);
+    const uint16_t* values = array.values.begin();
+    for (size_type i = 0; i < array.cardinality; ++i) {
+      if (Contains(bitmap, values[i])) result.values.push_back(values[i]);
+    }
+    result.cardinality = static_cast<uint32_t>(result.values.size());
+  } else {
+    const uint16_t* x = a.values.begin();
+    const uint16_t* y = b.values.begin();
+    const uint16_t* x_end = x + a.cardinality;
+    const uint16_t* y_end = y + b.cardinality;
+    result.values.reserve(std::min(a.cardinality, b.cardinality));
+    while (x != x_end && y != y_end) {
+      if (*x < *y) {
+        ++x;
+      } else if (*y < *x) {
+        ++y;
+      } else {
+        result.values.push_back(*x++);
+        ++y;
+      }
+    }
+    result.cardinality = static_cast<uint32_t>(result.values.size());
+  }
+  Normalize(result);
+  return result;
+}
+
+inline roaring_set::Chunk roaring_set::Subtract(const Chunk& left,
+                                                const Chunk& right) {
+  using Kind = Chunk::Kind;
+  Chunk left_scratch;
+  const Chunk& a = Plain(left, left_scratch);
+  Chunk result;
+  result.key = left.key;
+  if (a.kind == Kind::kBitmap) {
+    result.kind = Kind::kBitmap;
+    result.words = a.words;
+    word_type* bits = result.words.begin();
+    if (right.kind == Kind::kBitmap) {
+      bitset_detail::Combine<bitset_detail::BitOp::kAndNot>(
+          bits, right.words.begin(), kBitmapWords);
+    } else {
+      ForEach(right, [bits](uint32_t low) {
+        bits[low / bitset_detail::kWordBits] &=
+            ~(word_type(1) << (low % bitset_detail::kWordBits));
+      });
+    }
+    result.cardinality =
+        static_cast<uint32_t>(bitset_detail::Count(bits, kBitmapWords));
+  } else {
+    result.values.reserve(a.cardinality);
+    const uint16_t* values = a.values.begin();
+    for (size_type i = 0; i < a.cardinality; ++i) {
+      if (!Contains(right, values[i])) result.values.push_back(values[i]);
+    }
+    result.cardinality = static_cast<uint32_t>(result.values.size());
+  }
+  Normalize(result);
+  return result;
+}
+
+inline roaring_set operator|(roaring_set left, const roaring_set& right) {
+  return left |= right;
+}
+
+inline roaring_set operator&(roaring_set left, const roaring_set& right) {
+  return left &= right;
+}
+
+}  // namespace s21
+
+#endif
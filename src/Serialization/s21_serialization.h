@@ -0,0 +1,182 @@
+#ifndef S21_CONTAINERS_SERIALIZATION_H
+#define S21_CONTAINERS_SERIALIZATION_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iosfwd>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include "../Array/s21_array.hpp"
+#include "../Map/s21_map.hpp"
+#include "../MappedFile/s21_mapped_file.h"
+#include "../Set/s21_set.hpp"
+#include "../Vector/s21_vector.hpp"
+
+namespace s21 {
+// Binary format of vector, S21Array, set and map. A 32-byte header is
+// followed by the elements, in key order for set and map:
+// - bulk layout, when the element types are trivially copyable: the bytes of
+//   the elements as one array, which a reader can use in place. A map keeps
+//   an array of keys, then an array of values aligned for the value type,
+//   so that the keys alone are binary-searched;
+// - element-wise layout otherwise: one serializer<T>::write per element,
+//   key before value for a map.
+// Files are native-endian. The header records the byte order, the format
+// version, the container kind and the element sizes; loading a file that
+// does not match throws std::runtime_error.
+struct serialization_header {
+  static constexpr uint16_t kVersion = 1;
+  static constexpr uint16_t kByteOrder = 0x0102;
+
+  char magic[4];
+  uint16_t version;
+  uint16_t byte_order;
+  uint16_t kind;
+  uint16_t layout;
+  uint32_t key_bytes;
+  uint32_t mapped_bytes;  // zero except for maps
+  uint32_t reserved;
+  uint64_t count;
+};
+static_assert(sizeof(serialization_header) == 32, "header must be 32 bytes");
+
+// Encoding of one element in the element-wise layout. Trivially copyable
+// types are written as their bytes and std::string as its length and
+// characters; other types need a specialization with the same members
+template <typename T, typename = void>
+struct serializer {
+  static_assert(sizeof(T) == 0, "specialize s21::serializer for this type");
+  static void write(std::ostream& out, const T& item);
+  static T read(std::istream& in);
+};
+
+template <typename T>
+struct serializer<T, std::enable_if_t<std::is_trivially_copyable_v<T>>> {
+  static void write(std::ostream& out, const T& item);
+  static T read(std::istream& in);
+};
+
+template <>
+struct serializer<std::string> {
+  static void write(std::ostream& out, const std::string& item);
+  static std::string read(std::istream& in);
+};
+
+// Writing, throws std::runtime_error if the stream fails
+template <typename T, typename Allocator>
+void serialize(std::ostream& out, const vector<T, Allocator>& items);
+template <typename T, size_t N>
+void serialize(std::ostream& out, const S21Array<T, N>& items);
+template <typename T, typename Compare>
+void serialize(std::ostream& out, const set<T, Compare>& items);
+template <typename Key, typename T, typename Compare>
+void serialize(std::ostream& out, const map<Key, T, Compare>& items);
+template <typename Container>
+void serialize_file(const std::string& path, const Container& items);
+
+// Reading replaces the contents. A set or map is built from its sorted
+// elements in O(n), without a single rebalancing step
+template <typename T, typename Allocator>
+void deserialize(std::istream& in, vector<T, Allocator>& items);
+template <typename T, size_t N>
+void deserialize(std::istream& in, S21Array<T, N>& items);
+template <typename T, typename Compare>
+void deserialize(std::istream& in, set<T, Compare>& items);
+template <typename Key, typename T, typename Compare>
+void deserialize(std::istream& in, map<Key, T, Compare>& items);
+// A file in bulk layout is memory-mapped and the container filled straight
+// from the mapping, with no parsing of elements; other files are streamed
+template <typename Container>
+void deserialize_file(const std::string& path, Container& items);
+
+// Read-only sorted view of a set file in bulk layout, searched in place in
+// the mapping. The file is trusted to be sorted, as written by serialize
+template <typename T, typename Compare = std::less<T>>
+class set_view {
+ public:
+  // member type
+  using key_type = T;
+  using value_type = T;
+  using key_compare = Compare;
+  using const_iterator = const T*;
+  using iterator = const_iterator;
+  using size_type = size_t;
+
+  // functions
+  explicit set_view(const std::string& path, const Compare& comp = Compare());
+
+  // iterators
+  iterator begin() const;
+  iterator end() const;
+
+  // capacity
+  bool empty() const;
+  size_type size() const;
+
+  // lookup, binary searches
+  bool contains(const T& key) const;
+  iterator find(const T& key) const;
+  iterator lower_bound(const T& key) const;
+  iterator upper_bound(const T& key) const;
+
+ private:
+  static_assert(std::is_trivially_copyable_v<T>,
+                "views need the bulk layout of a trivially copyable type");
+
+  mapped_file file_;
+  const T* data_;
+  size_type size_;
+  Compare comp_;
+};
+
+// Read-only sorted view of a map file in bulk layout. Keys and values are
+// two arrays in the mapping; lookups return positions in them
+template <typename Key, typename T, typename Compare = std::less<Key>>
+class map_view {
+ public:
+  // member type
+  using key_type = Key;
+  using mapped_type = T;
+  using key_compare = Compare;
+  using size_type = size_t;
+
+  // functions
+  explicit map_view(const std::string& path, const Compare& comp = Compare());
+
+  // element access
+  const mapped_type& at(const Key& key) const;
+  // Keys in ascending order and the values at the same positions
+  const key_type* keys() const;
+  const mapped_type* values() const;
+
+  // capacity
+  bool empty() const;
+  size_type size() const;
+
+  // lookup, binary searches over the keys; size() stands for none
+  bool contains(const Key& key) const;
+  size_type find(const Key& key) const;
+  size_type lower_bound(const Key& key) const;
+  size_type upper_bound(const Key& key) const;
+
+ private:
+  static_assert(std::is_trivially_copyable_v<Key> &&
+                    std::is_trivially_copyable_v<T>,
+                "views need the bulk layout of trivially copyable types");
+
+  mapped_file file_;
+  const Key* keys_;
+  const T* values_;
+  size_type size_;
+  Compare comp_;
+};
+}  // namespace s21
+
+#include "s21_serialization.tpp"
+
+#endif
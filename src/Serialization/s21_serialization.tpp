@@ -0,0 +1,585 @@
+#ifndef S21_CONTAINERS_SERIALIZATION_TPP
+#define S21_CONTAINERS_SERIALIZATION_TPP
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <istream>
+#include <new>
+#include <ostream>
+#include <stdexcept>
+
+namespace s21 {
+
+namespace serialization_detail {
+enum Kind : uint16_t { kVector = 1, kArray = 2, kSet = 3, kMap = 4 };
+enum Layout : uint16_t { kElementwise = 0, kBulk = 1 };
+
+template <typename... Ts>
+constexpr bool kIsBulk = (std::is_trivially_copyable_v<Ts> && ...);
+
+inline void WriteBytes(std::ostream& out, const void* data, size_t bytes) {
+  out.write(static_cast<const char*>(data),
+            static_cast<std::streamsize>(bytes));
+  if (!out) throw std::runtime_error("Cannot write the serialized container");
+}
+
+inline void ReadBytes(std::istream& in, void* data, size_t bytes) {
+  in.read(static_cast<char*>(data), static_cast<std::streamsize>(bytes));
+  if (static_cast<size_t>(in.gcount()) != bytes) {
+    throw std::runtime_error("Serialized container is truncated");
+  }
+}
+
+inline void WritePadding(std::ostream& out, size_t bytes) {
+  static const char kZeros[64] = {};
+  for (; bytes > sizeof(kZeros); bytes -= sizeof(kZeros)) {
+    WriteBytes(out, kZeros, sizeof(kZeros));
+  }
+  WriteBytes(out, kZeros, bytes);
+}
+
+inline void SkipPadding(std::istream& in, size_t bytes) {
+  in.ignore(static_cast<std::streamsize>(bytes));
+  if (static_cast<size_t>(in.gcount()) != bytes) {
+    throw std::runtime_error("Serialized container is truncated");
+  }
+}
+
+inline size_t AlignUp(size_t offset, size_t alignment) {
+  return (offset + alignment - 1) / alignment * alignment;
+}
+
+// File offsets of the element arrays in the bulk layout: the keys (or
+// elements) follow the header, the values of a map follow the keys
+template <typename Key>
+size_t KeysOffset() {
+  return AlignUp(sizeof(serialization_header), alignof(Key));
+}
+
+template <typename Key, typename T>
+size_t ValuesOffset(size_t count) {
+  return AlignUp(KeysOffset<Key>() + count * sizeof(Key), alignof(T));
+}
+
+// Header of a container of Key elements, or of a map from Key to Mapped
+template <typename Key, typename... Mapped>
+serialization_header MakeHeader(Kind kind, size_t count) {
+  serialization_header header;
+  std::memcpy(header.magic, "S21C", sizeof(header.magic));
+  header.version = serialization_header::kVersion;
+  header.byte_order = serialization_header::kByteOrder;
+  header.kind = kind;
+  header.layout = kIsBulk<Key, Mapped...> ? kBulk : kElementwise;
+  header.key_bytes = sizeof(Key);
+  header.mapped_bytes = (0 + ... + sizeof(Mapped));
+  header.reserved = 0;
+  header.count = count;
+  return header;
+}
+
+inline void CheckHeader(const serialization_header& header,
+                        const serialization_header& expected) {
+  if (std::memcmp(header.magic, expected.magic, sizeof(header.magic)) != 0) {
+    throw std::runtime_error("Not a serialized s21 container");
+  }
+  if (header.version != expected.version) {
+    throw std::runtime_error("Unsupported container format version");
+  }
+  if (header.byte_order != expected.byte_order) {
+    throw std::runtime_error("Serialized container has another byte order");
+  }
+  if (header.kind != expected.kind || header.layout != expected.layout ||
+      header.key_bytes != expected.key_bytes ||
+      header.mapped_bytes != expected.mapped_bytes) {
+    throw std::runtime_error(
+        "Serialized container does not match the requested type");
+  }
+}
+
+inline serialization_header ReadHeader(std::istream& in,
+                                       const serialization_header& expected) {
+  serialization_header header;
+  ReadBytes(in, &header, sizeof(header));
+  CheckHeader(header, expected);
+  return header;
+}
+
+inline serialization_header ReadHeader(const mapped_file& file,
+                                       const serialization_header& expected) {
+  if (file.size() < sizeof(serialization_header)) {
+    throw std::runtime_error("Serialized container is truncated");
+  }
+  serialization_header header;
+  std::memcpy(&header, file.data(), sizeof(header));
+  CheckHeader(header, expected);
+  return header;
+}
+
+// Array of count elements at offset in a mapping, after checking that the
+// file holds all of them
+template <typename T>
+const T* MappedArray(const mapped_file& file, size_t offset, size_t count) {
+  if (offset > file.size() || count > (file.size() - offset) / sizeof(T)) {
+    throw std::runtime_error("Serialized container is truncated");
+  }
+  return reinterpret_cast<const T*>(file.data() + offset);
+}
+
+// Collects trivially copyable elements met one at a time, such as during a
+// tree walk, and writes them in blocks
+template <typename T>
+class BulkWriter {
+ public:
+  explicit BulkWriter(std::ostream& out)
+      : out_(out), buffer_(new unsigned char[kItems * sizeof(T)]), used_(0) {}
+
+  void Add(const T& item) {
+    if (used_ == kItems) Flush();
+    std::memcpy(buffer_.get() + used_ * sizeof(T), &item, sizeof(T));
+    ++used_;
+  }
+
+  void Flush() {
+    WriteBytes(out_, buffer_.get(), used_ * sizeof(T));
+    used_ = 0;
+  }
+
+ private:
+  static constexpr size_t kBufferBytes = 1 << 16;
+  static constexpr size_t kItems =
+      sizeof(T) < kBufferBytes ? kBufferBytes / sizeof(T) : 1;
+
+  std::ostream& out_;
+  std::unique_ptr<unsigned char[]> buffer_;
+  size_t used_;
+};
+
+// Appends count elements read from a stream in the layout of T
+template <typename T, typename Allocator>
+void ReadElements(std::istream& in, size_t count,
+                  vector<T, Allocator>& items) {
+  items.reserve(items.size() + count);
+  if constexpr (kIsBulk<T>) {
+    constexpr size_t kChunk = sizeof(T) < 4096 ? 4096 / sizeof(T) : 1;
+    typename std::aligned_storage<sizeof(T), alignof(T)>::type chunk[kChunk];
+    while (count != 0) {
+      size_t items_read = std::min(count, kChunk);
+      ReadBytes(in, chunk, items_read * sizeof(T));
+      for (size_t i = 0; i < items_read; ++i) {
+        items.push_back(*std::launder(reinterpret_cast<T*>(&chunk[i])));
+      }
+      count -= items_read;
+    }
+  } else {
+    for (; count != 0; --count) items.push_back(serializer<T>::read(in));
+  }
+}
+
+template <typename T>
+void WriteElements(std::ostream& out, const T* first, size_t count) {
+  if constexpr (kIsBulk<T>) {
+    WriteBytes(out, first, count * sizeof(T));
+  } else {
+    for (size_t i = 0; i < count; ++i) serializer<T>::write(out, first[i]);
+  }
+}
+
+template <typename Tree>
+size_t TreeSize(const Tree& tree) {
+  return tree.GetRoot() != nullptr ? tree.GetRoot()->size_ : 0;
+}
+
+// Pairs a column of keys with a column of values as the elements of a map,
+// to build the map from them
+template <typename Key, typename T>
+class ColumnIterator {
+ public:
+  using iterator_category = std::forward_iterator_tag;
+  using value_type = std::pair<const Key, T>;
+  using difference_type = std::ptrdiff_t;
+  using pointer = void;
+  using reference = value_type;
+
+  ColumnIterator(const Key* key, const T* value) : key_(key), value_(value) {}
+
+  value_type operator*() const { return value_type(*key_, *value_); }
+  ColumnIterator& operator++() {
+    ++key_;
+    ++value_;
+    return *this;
+  }
+  ColumnIterator operator++(int) {
+    ColumnIterator copy(*this);
+    ++*this;
+    return copy;
+  }
+  bool operator==(const ColumnIterator& other) const {
+    return key_ == other.key_;
+  }
+  bool operator!=(const ColumnIterator& other) const {
+    return key_ != other.key_;
+  }
+
+ private:
+  const Key* key_;
+  const T* value_;
+};
+
+template <typename Container>
+void StreamFile(const std::string& path, Container& items) {
+  std::ifstream in(path, std::ios::binary);
+  if (!in) throw std::runtime_error("Cannot open " + path);
+  deserialize(in, items);
+}
+
+template <typename T, typename Allocator>
+void LoadFile(const std::string& path, vector<T, Allocator>& items) {
+  if constexpr (kIsBulk<T>) {
+    mapped_file file(path);
+    size_t count = ReadHeader(file, MakeHeader<T>(kVector, 0)).count;
+    const T* first = MappedArray<T>(file, KeysOffset<T>(), count);
+    items.assign(first, first + count);
+  } else {
+    StreamFile(path, items);
+  }
+}
+
+template <typename T, size_t N>
+void LoadFile(const std::string& path, S21Array<T, N>& items) {
+  if constexpr (kIsBulk<T>) {
+    mapped_file file(path);
+    size_t count = ReadHeader(file, MakeHeader<T>(kArray, 0)).count;
+    if (count != N) {
+      throw std::runtime_error(
+          "Serialized container does not match the requested type");
+    }
+    std::memcpy(items.data(), MappedArray<T>(file, KeysOffset<T>(), N),
+                N * sizeof(T));
+  } else {
+    StreamFile(path, items);
+  }
+}
+
+template <typename T, typename Compare>
+void LoadFile(const std::string& path, set<T, Compare>& items) {
+  if constexpr (kIsBulk<T>) {
+    mapped_file file(path);
+    size_t count = ReadHeader(file, MakeHeader<T>(kSet, 0)).count;
+    const T* first = MappedArray<T>(file, KeysOffset<T>(), count);
+    items.assign_sorted(first, first + count);
+  } else {
+    StreamFile(path, items);
+  }
+}
+
+template <typename Key, typename T, typename Compare>
+void LoadFile(const std::string& path, map<Key, T, Compare>& items) {
+  if constexpr (kIsBulk<Key, T>) {
+    mapped_file file(path);
+    size_t count = ReadHeader(file, MakeHeader<Key, T>(kMap, 0)).count;
+    const Key* keys = MappedArray<Key>(file, KeysOffset<Key>(), count);
+    const T* values =
+        MappedArray<T>(file, ValuesOffset<Key, T>(count), count);
+    items.assign_sorted(ColumnIterator<Key, T>(keys, values),
+                        ColumnIterator<Key, T>(keys + count, values + count));
+  } else {
+    StreamFile(path, items);
+  }
+}
+}  // namespace serialization_detail
+
+// serializer
+
+template <typename T>
+void serializer<T, std::enable_if_t<std::is_trivially_copyable_v<T>>>::write(
+    std::ostream& out, const T& item) {
+  serialization_detail::WriteBytes(out, &item, sizeof(T));
+}
+
+template <typename T>
+T serializer<T, std::enable_if_t<std::is_trivially_copyable_v<T>>>::read(
+    std::istream& in) {
+  typename std::aligned_storage<sizeof(T), alignof(T)>::type storage;
+  serialization_detail::ReadBytes(in, &storage, sizeof(T));
+  return *std::launder(reinterpret_cast<T*>(&storage));
+}
+
+inline void serializer<std::string>::write(std::ostream& out,
+                                           const std::string& item) {
+  uint64_t length = item.size();
+  serialization_detail::WriteBytes(out, &length, sizeof(length));
+  serialization_detail::WriteBytes(out, item.data(), item.size());
+}
+
+inline std::string serializer<std::string>::read(std::istream& in) {
+  uint64_t length = 0;
+  serialization_detail::ReadBytes(in, &length, sizeof(length));
+  std::string item(static_cast<size_t>(length), '\0');
+  serialization_detail::ReadBytes(in, item.data(), item.size());
+  return item;
+}
+
+// writing
+
+template <typename T, typename Allocator>
+void serialize(std::ostream& out, const vector<T, Allocator>& items) {
+  using namespace serialization_detail;
+  serialization_header header = MakeHeader<T>(kVector, items.size());
+  WriteBytes(out, &header, sizeof(header));
+  if constexpr (kIsBulk<T>) WritePadding(out, KeysOffset<T>() - sizeof(header));
+  WriteElements(out, items.begin(), items.size());
+}
+
+template <typename T, size_t N>
+void serialize(std::ostream& out, const S21Array<T, N>& items) {
+  using namespace serialization_detail;
+  serialization_header header = MakeHeader<T>(kArray, N);
+  WriteBytes(out, &header, sizeof(header));
+  if constexpr (kIsBulk<T>) WritePadding(out, KeysOffset<T>() - sizeof(header));
+  WriteElements(out, items.data(), N);
+}
+
+template <typename T, typename Compare>
+void serialize(std::ostream& out, const set<T, Compare>& items) {
+  using namespace serialization_detail;
+  serialization_header header =
+      MakeHeader<T>(kSet, TreeSize(items.get_tree()));
+  WriteBytes(out, &header, sizeof(header));
+  if constexpr (kIsBulk<T>) {
+    WritePadding(out, KeysOffset<T>() - sizeof(header));
+    BulkWriter<T> writer(out);
+    items.get_tree().ForEach([&writer](const T& item) { writer.Add(item); });
+    writer.Flush();
+  } else {
+    items.get_tree().ForEach(
+        [&out](const T& item) { serializer<T>::write(out, item); });
+  }
+}
+
+template <typename Key, typename T, typename Compare>
+void serialize(std::ostream& out, const map<Key, T, Compare>& items) {
+  using namespace serialization_detail;
+  using value_type = typename map<Key, T, Compare>::value_type;
+  const size_t count = TreeSize(items.get_tree());
+  serialization_header header = MakeHeader<Key, T>(kMap, count);
+  WriteBytes(out, &header, sizeof(header));
+  if constexpr (kIsBulk<Key, T>) {
+    WritePadding(out, KeysOffset<Key>() - sizeof(header));
+    BulkWriter<Key> keys(out);
+    items.get_tree().ForEach(
+        [&keys](const value_type& item) { keys.Add(item.first); });
+    keys.Flush();
+    WritePadding(out, ValuesOffset<Key, T>(count) - KeysOffset<Key>() -
+                          count * sizeof(Key));
+    BulkWriter<T> values(out);
+    items.get_tree().ForEach(
+        [&values](const value_type& item) { values.Add(item.second); });
+    values.Flush();
+  } else {
+    items.get_tree().ForEach([&out](const value_type& item) {
+      serializer<Key>::write(out, item.first);
+      serializer<T>::write(out, item.second);
+    });
+  }
+}
+
+template <typename Container>
+void serialize_file(const std::string& path, const Container& items) {
+  std::ofstream out(path, std::ios::binary | std::ios::trunc);
+  if (!out) throw std::runtime_error("Cannot create " + path);
+  serialize(out, items);
+  out.close();
+  if (!out) throw std::runtime_error("Cannot write " + path);
+}
+
+// reading
+
+template <typename T, typename Allocator>
+void deserialize(std::istream& in, vector<T, Allocator>& items) {
+  using namespace serialization_detail;
+  serialization_header header = ReadHeader(in, MakeHeader<T>(kVector, 0));
+  if constexpr (kIsBulk<T>) SkipPadding(in, KeysOffset<T>() - sizeof(header));
+  vector<T, Allocator> result;
+  ReadElements(in, header.count, result);
+  items = std::move(result);
+}
+
+template <typename T, size_t N>
+void deserialize(std::istream& in, S21Array<T, N>& items) {
+  using namespace serialization_detail;
+  serialization_header header = ReadHeader(in, MakeHeader<T>(kArray, 0));
+  if (header.count != N) {
+    throw std::runtime_error(
+        "Serialized container does not match the requested type");
+  }
+  if constexpr (kIsBulk<T>) SkipPadding(in, KeysOffset<T>() - sizeof(header));
+  vector<T> result;
+  ReadElements(in, N, result);
+  std::copy(result.begin(), result.end(), items.data());
+}
+
+template <typename T, typename Compare>
+void deserialize(std::istream& in, set<T, Compare>& items) {
+  using namespace serialization_detail;
+  serialization_header header = ReadHeader(in, MakeHeader<T>(kSet, 0));
+  if constexpr (kIsBulk<T>) SkipPadding(in, KeysOffset<T>() - sizeof(header));
+  vector<T> sorted;
+  ReadElements(in, header.count, sorted);
+  items.assign_sorted(sorted.begin(), sorted.end());
+}
+
+template <typename Key, typename T, typename Compare>
+void deserialize(std::istream& in, map<Key, T, Compare>& items) {
+  using namespace serialization_detail;
+  serialization_header header = ReadHeader(in, MakeHeader<Key, T>(kMap, 0));
+  const size_t count = header.count;
+  vector<Key> keys;
+  vector<T> values;
+  if constexpr (kIsBulk<Key, T>) {
+    SkipPadding(in, KeysOffset<Key>() - sizeof(header));
+    ReadElements(in, count, keys);
+    SkipPadding(in, ValuesOffset<Key, T>(count) - KeysOffset<Key>() -
+                        count * sizeof(Key));
+    ReadElements(in, count, values);
+  } else {
+    keys.reserve(count);
+    values.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+      keys.push_back(serializer<Key>::read(in));
+      values.push_back(serializer<T>::read(in));
+    }
+  }
+  items.assign_sorted(ColumnIterator<Key, T>(keys.begin(), values.begin()),
+                      ColumnIterator<Key, T>(keys.end(), values.end()));
+}
+
+template <typename Container>
+void deserialize_file(const std::string& path, Container& items) {
+  serialization_detail::LoadFile(path, items);
+}
+
+// set_view
+
+template <typename T, typename Compare>
+set_view<T, Compare>::set_view(const std::string& path, const Compare& comp)
+    : file_(path), data_(nullptr), size_(0), comp_(comp) {
+  using namespace serialization_detail;
+  size_ = ReadHeader(file_, MakeHeader<T>(kSet, 0)).count;
+  data_ = MappedArray<T>(file_, KeysOffset<T>(), size_);
+}
+
+template <typename T, typename Compare>
+typename set_view<T, Compare>::iterator set_view<T, Compare>::begin() const {
+  return data_;
+}
+
+template <typename T, typename Compare>
+typename set_view<T, Compare>::iterator set_view<T, Compare>::end() const {
+  return data_ + size_;
+}
+
+template <typename T, typename Compare>
+bool set_view<T, Compare>::empty() const {
+  return size_ == 0;
+}
+
+template <typename T, typename Compare>
+typename set_view<T, Compare>::size_type set_view<T, Compare>::size() const {
+  return size_;
+}
+
+template <typename T, typename Compare>
+bool set_view<T, Compare>::contains(const T& key) const {
+  return find(key) != end();
+}
+
+template <typename T, typename Compare>
+typename set_view<T, Compare>::iterator set_view<T, Compare>::find(
+    const T& key) const {
+  iterator it = lower_bound(key);
+  return it != end() && !comp_(key, *it) ? it : end();
+}
+
+template <typename T, typename Compare>
+typename set_view<T, Compare>::iterator set_view<T, Compare>::lower_bound(
+    const T& key) const {
+  return std::lower_bound(begin(), end(), key, comp_);
+}
+
+template <typename T, typename Compare>
+typename set_view<T, Compare>::iterator set_view<T, Compare>::upper_bound(
+    const T& key) const {
+  return std::upper_bound(begin(), end(), key, comp_);
+}
+
+// map_view
+
+template <typename Key, typename T, typename Compare>
+map_view<Key, T, Compare>::map_view(const std::string& path,
+                                    const Compare& comp)
+    : file_(path), keys_(nullptr), values_(nullptr), size_(0), comp_(comp) {
+  using namespace serialization_detail;
+  size_ = ReadHeader(file_, MakeHeader<Key, T>(kMap, 0)).count;
+  keys_ = MappedArray<Key>(file_, KeysOffset<Key>(), size_);
+  values_ = MappedArray<T>(file_, ValuesOffset<Key, T>(size_), size_);
+}
+
+template <typename Key, typename T, typename Compare>
+const typename map_view<Key, T, Compare>::mapped_type&
+map_view<Key, T, Compare>::at(const Key& key) const {
+  size_type index = find(key);
+  if (index == size_) throw std::invalid_argument("This key doesn't exist");
+  return values_[index];
+}
+
+template <typename Key, typename T, typename Compare>
+const typename map_view<Key, T, Compare>::key_type*
+map_view<Key, T, Compare>::keys() const {
+  return keys_;
+}
+
+template <typename Key, typename T, typename Compare>
+const typename map_view<Key, T, Compare>::mapped_type*
+map_view<Key, T, Compare>::values() const {
+  return values_;
+}
+
+template <typename Key, typename T, typename Compare>
+bool map_view<Key, T, Compare>::empty() const {
+  return size_ == 0;
+}
+
+template <typename Key, typename T, typename Compare>
+typename map_view<Key, T, Compare>::size_type map_view<Key, T, Compare>::size()
+    const {
+  return size_;
+}
+
+template <typename Key, typename T, typename Compare>
+bool map_view<Key, T, Compare>::contains(const Key& key) const {
+  return find(key) != size_;
+}
+
+template <typename Key, typename T, typename Compare>
+typename map_view<Key, T, Compare>::size_type map_view<Key, T, Compare>::find(
+    const Key& key) const {
+  size_type index = lower_bound(key);
+  return index != size_ && !comp_(key, keys_[index]) ? index : size_;
+}
+
+template <typename Key, typename T, typename Compare>
+typename map_view<Key, T, Compare>::size_type
+map_view<Key, T, Compare>::lower_bound(const Key& key) const {
+  return std::lower_bound(keys_, keys_ + size_, key, comp_) - keys_;
+}
+
+template <typename Key, typename T, typename Compare>
+typename map_view<Key, T, Compare>::size_type
+map_view<Key, T, Compare>::upper_bound(const Key& key) const {
+  return std::upper_bound(keys_, keys_ + size_, key, comp_) - keys_;
+}
+
+}  // namespace s21
+
+#endif
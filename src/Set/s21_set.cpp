@@ -1,21 +1,47 @@
 #include "s21_set.hpp"
 
 namespace s21 {
-template <typename T>
-set<T>::set() : tree_() {}
-
-template <typename T>
-set<T>::set(std::initializer_list<value_type> const& items) : tree_() {
+template <typename T, typename Compare, typename Allocator>
+set<T, Compare, Allocator>::set() : tree_() {}
+
+template <typename T, typename Compare, typename Allocator>
+set<T, Compare, Allocator>::set(const Compare& comp,
+                                const Allocator& alloc)
+    : tree_(comp, alloc) {}
+
+template <typename T, typename Compare, typename Allocator>
+set<T, Compare, Allocator>::set(const Allocator& alloc)
+    : tree_(Compare(), alloc) {}
+
+template <typename T, typename Compare, typename Allocator>
+set<T, Compare, Allocator>::set(
+    std::initializer_list<value_type> const& items, const Allocator& alloc)
+    : tree_(Compare(), alloc) {
   for (auto i = items.begin(); i != items.end(); i++) {
     this->insert(*i);
   }
 }
 
-template <typename T>
-set<T>::set(const set& s) : tree_(s.get_tree()) {}
+template <typename T, typename Compare, typename Allocator>
+set<T, Compare, Allocator>::set(const set& s) : tree_(s.get_tree()) {}
+
+template <typename T, typename Compare, typename Allocator>
+set<T, Compare, Allocator>::set(const set& s, const Allocator& alloc)
+    : tree_(s.tree_, alloc) {}
+
+template <typename T, typename Compare, typename Allocator>
+set<T, Compare, Allocator>::set(set&& s, const Allocator& alloc)
+    : tree_(std::move(s.tree_), alloc) {}
+
+template <typename T, typename Compare, typename Allocator>
+set<T, Compare, Allocator>& set<T, Compare, Allocator>::operator=(
+    const set& s) {
+  tree_ = s.tree_;
+  return *this;
+}
 
-template <typename T>
-set<T>& set<T>::operator=(set<T>&& s) {
+template <typename T, typename Compare, typename Allocator>
+set<T, Compare, Allocator>& set<T, Compare, Allocator>::operator=(set&& s) {
   if (this != &s) {
     tree_ = std::move(s.tree_);
   }
@@ -23,8 +49,9 @@ set<T>& set<T>::operator=(set<T>&& s) {
   return *this;
 }
 
-template <typename T>
-typename set<T>::iterator set<T>::begin() {
+template <typename T, typename Compare, typename Allocator>
+typename set<T, Compare, Allocator>::iterator
+set<T, Compare, Allocator>::begin() {
   Node<T, T>* node = tree_.GetRoot();
 
   if (node == nullptr) {
@@ -38,13 +65,14 @@ typename set<T>::iterator set<T>::begin() {
   return iterator(node);
 }
 
-template <typename T>
-typename set<T>::iterator set<T>::end() {
+template <typename T, typename Compare, typename Allocator>
+typename set<T, Compare, Allocator>::iterator
+set<T, Compare, Allocator>::end() {
   return iterator(nullptr, tree_.GetRoot());
 }
 
-template <typename T>
-bool set<T>::empty() {
+template <typename T, typename Compare, typename Allocator>
+bool set<T, Compare, Allocator>::empty() {
   if (this->tree_.GetRoot() == nullptr) {
     return true;
   }
@@ -56,8 +84,9 @@ bool set<T>::empty() {
   return false;
 }
 
-template <typename T>
-typename set<T>::size_type set<T>::size() {
+template <typename T, typename Compare, typename Allocator>
+typename set<T, Compare, Allocator>::size_type
+set<T, Compare, Allocator>::size() {
   if (this->tree_.GetRoot() == nullptr) {
     return 0;
   }
@@ -65,48 +94,44 @@ typename set<T>::size_type set<T>::size() {
   return tree_.GetRoot()->size_;
 }
 
-template <typename T>
-typename set<T>::size_type set<T>::max_size() {
-  return allocator.max_size() / 10;
+template <typename T, typename Compare, typename Allocator>
+typename set<T, Compare, Allocator>::size_type
+set<T, Compare, Allocator>::max_size() {
+  return std::allocator_traits<Allocator>::max_size(tree_.GetAllocator()) /
+         10;
 }
 
-template <typename T>
-void set<T>::clear() {
-  if (this->tree_.GetRoot()) {
-    Node<T, T>* root = this->tree_.GetRoot();
-    this->tree_.Clear(root);
-    this->tree_.SetRoot(nullptr);
-  }
+template <typename T, typename Compare, typename Allocator>
+void set<T, Compare, Allocator>::shrink_to_fit() {
+  tree_.ShrinkToFit();
 }
 
-template <typename T>
-std::pair<typename set<T>::iterator, bool> set<T>::insert(const T& value) {
-  std::pair<typename set<T>::iterator, bool> result;
-  this->tree_.Insert(value);
-
-  if (this->tree_.GetInserted()) {
-    result = std::pair<typename set<T>::iterator, bool>(find(value), true);
-  } else {
-    result = std::pair<typename set<T>::iterator, bool>(find(value), false);
-  }
+template <typename T, typename Compare, typename Allocator>
+void set<T, Compare, Allocator>::clear() {
+  tree_.Clear();
+}
 
-  return result;
+template <typename T, typename Compare, typename Allocator>
+std::pair<typename set<T, Compare, Allocator>::iterator, bool>
+set<T, Compare, Allocator>::insert(const T& value) {
+  auto result = tree_.Insert(value);
+  return std::make_pair(iterator(result.first), result.second);
 }
 
-template <typename T>
-void set<T>::erase(set<T>::iterator pos) {
+template <typename T, typename Compare, typename Allocator>
+void set<T, Compare, Allocator>::erase(iterator pos) {
   if (pos != nullptr) {
-    tree_.Remove(*pos);
+    tree_.Erase(pos.GetNode());
   }
 }
 
-template <typename T>
-void set<T>::swap(set<T>& other) {
+template <typename T, typename Compare, typename Allocator>
+void set<T, Compare, Allocator>::swap(set& other) {
   tree_.Swap(other.tree_);
 }
 
-template <typename T>
-void set<T>::merge(set<T>& other) {
+template <typename T, typename Compare, typename Allocator>
+void set<T, Compare, Allocator>::merge(set& other) {
   if (this != &other) {
     for (auto i = other.begin(); i != other.end(); i++) {
       insert(*i);
@@ -116,19 +141,105 @@ void set<T>::merge(set<T>& other) {
   other.clear();
 }
 
-template <typename T>
-bool set<T>::contains(const T& key) {
+template <typename T, typename Compare, typename Allocator>
+template <typename ForwardIt>
+void set<T, Compare, Allocator>::assign_sorted(
+    ForwardIt first, ForwardIt last) {
+  tree_.AssignSorted(static_cast<size_t>(std::distance(first, last)),
+                     [&first]() -> decltype(auto) { return *first++; });
+}
+
+template <typename T, typename Compare, typename Allocator>
+bool set<T, Compare, Allocator>::contains(const T& key) {
   return tree_.Search(key) != nullptr;
 }
 
-template <typename T>
-typename set<T>::iterator set<T>::find(const T& key) {
-  return iterator(tree_.Search(key));
+template <typename T, typename Compare, typename Allocator>
+typename set<T, Compare, Allocator>::iterator set<T, Compare, Allocator>::find(
+    const T& key) {
+  return IteratorFor(tree_.Search(key));
+}
+
+template <typename T, typename Compare, typename Allocator>
+template <typename K, typename, typename>
+bool set<T, Compare, Allocator>::contains(const K& key) {
+  return tree_.Search(key) != nullptr;
+}
+
+template <typename T, typename Compare, typename Allocator>
+template <typename K, typename, typename>
+typename set<T, Compare, Allocator>::iterator set<T, Compare, Allocator>::find(
+    const K& key) {
+  return IteratorFor(tree_.Search(key));
+}
+
+template <typename T, typename Compare, typename Allocator>
+typename set<T, Compare, Allocator>::iterator
+set<T, Compare, Allocator>::lower_bound(const T& key) {
+  return IteratorFor(tree_.LowerBound(key));
 }
 
-template <typename T>
-const AVLTree<T, T>& set<T>::get_tree() const {
+template <typename T, typename Compare, typename Allocator>
+typename set<T, Compare, Allocator>::iterator
+set<T, Compare, Allocator>::upper_bound(const T& key) {
+  return IteratorFor(tree_.UpperBound(key));
+}
+
+template <typename T, typename Compare, typename Allocator>
+std::pair<typename set<T, Compare, Allocator>::iterator,
+          typename set<T, Compare, Allocator>::iterator>
+set<T, Compare, Allocator>::equal_range(const T& key) {
+  auto nodes = tree_.EqualRange(key);
+  return std::make_pair(IteratorFor(nodes.first), IteratorFor(nodes.second));
+}
+
+template <typename T, typename Compare, typename Allocator>
+RangeView<typename set<T, Compare, Allocator>::iterator>
+set<T, Compare, Allocator>::range(const T& first, const T& last) {
+  return RangeView<iterator>(lower_bound(first), lower_bound(last));
+}
+
+template <typename T, typename Compare, typename Allocator>
+template <typename F>
+void set<T, Compare, Allocator>::for_each(F visit) const {
+  tree_.ForEach(visit);
+}
+
+template <typename T, typename Compare, typename Allocator>
+template <typename F>
+void set<T, Compare, Allocator>::visit_range(
+    const T& first, const T& last, F visit) const {
+  tree_.VisitRange(first, last, visit);
+}
+
+// Null stands for end(), which also carries the root for operator--
+template <typename T, typename Compare, typename Allocator>
+typename set<T, Compare, Allocator>::iterator
+set<T, Compare, Allocator>::IteratorFor(Node<T, T>* node) {
+  return node != nullptr ? iterator(node) : end();
+}
+
+template <typename T, typename Compare, typename Allocator>
+typename set<T, Compare, Allocator>::key_compare
+set<T, Compare, Allocator>::key_comp() const {
+  return tree_.GetCompare();
+}
+
+template <typename T, typename Compare, typename Allocator>
+typename set<T, Compare, Allocator>::allocator_type
+set<T, Compare, Allocator>::get_allocator() const {
+  return tree_.GetAllocator();
+}
+
+template <typename T, typename Compare, typename Allocator>
+const typename set<T, Compare, Allocator>::tree_type&
+set<T, Compare, Allocator>::get_tree() const {
   return tree_;
 }
 
+template <typename T, typename Compare, typename Allocator>
+container_stats set<T, Compare, Allocator>::stats() const {
+  return tree_.GetStats();
+}
+
 }  // namespace s21
\ No newline at end of file
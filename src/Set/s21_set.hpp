@@ -2,24 +2,35 @@
 #define S21_SET_H
 
 #include <algorithm>
+#include <iterator>
 
 #include "../AVLTree/AVLTree.cpp"
 
 namespace s21 {
-template <typename T>
+template <typename T, typename Compare = std::less<T>,
+          typename Allocator = std::allocator<T>>
 class set {
  public:
+  using key_type = T;
   using value_type = T;
+  using key_compare = Compare;
   using iterator = Iterator<T, T>;
   using const_iterator = ConstIterator<T, T>;
   using size_type = size_t;
-  using Allocator = std::allocator<T>;
+  using allocator_type = Allocator;
+  using tree_type = AVLTree<T, T, Compare, IdentityKey<T>, Allocator>;
 
   set();
-  set(std::initializer_list<value_type> const& items);
+  explicit set(const Compare& comp, const Allocator& alloc = Allocator());
+  explicit set(const Allocator& alloc);
+  set(std::initializer_list<value_type> const& items,
+      const Allocator& alloc = Allocator());
   set(const set& s);
-  set(set<T>&& s) = default;
-  set<T>& operator=(set&& s);
+  set(const set& s, const Allocator& alloc);
+  set(set&& s) = default;
+  set(set&& s, const Allocator& alloc);
+  set& operator=(const set& s);
+  set& operator=(set&& s);
   ~set(){};
 
   iterator begin();
@@ -28,21 +39,58 @@ class set {
   bool empty();
   size_type size();
   size_type max_size();
+  // Frees the node memory that erasures left unused; iterators stay valid
+  void shrink_to_fit();
 
   void clear();
   std::pair<iterator, bool> insert(const T& value);
   void erase(iterator pos);
-  void swap(set<T>& other);
-  void merge(set<T>& other);
+  void swap(set& other);
+  void merge(set& other);
+  // Replaces the contents by a range whose keys are strictly ascending, in
+  // O(n) without rebalancing; std::invalid_argument if they are not
+  template <typename ForwardIt>
+  void assign_sorted(ForwardIt first, ForwardIt last);
 
   bool contains(const T& key);
   iterator find(const T& key);
-  const AVLTree<T, T>& get_tree() const;
+  // Heterogeneous lookup, only with a comparator that has is_transparent
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  bool contains(const K& key);
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  iterator find(const K& key);
+
+  // Range lookups, each a single descent of the tree
+  iterator lower_bound(const T& key);
+  iterator upper_bound(const T& key);
+  std::pair<iterator, iterator> equal_range(const T& key);
+  // Elements with keys in [first, last)
+  RangeView<iterator> range(const T& first, const T& last);
+  // Scans calling visit(element) in key order, for all elements or those
+  // with keys in [first, last). They walk the tree with a stack and
+  // prefetching instead of climbing parent pointers like the iterators
+  template <typename F>
+  void for_each(F visit) const;
+  template <typename F>
+  void visit_range(const T& first, const T& last, F visit) const;
+
+  key_compare key_comp() const;
+  allocator_type get_allocator() const;
+  const tree_type& get_tree() const;
+  container_stats stats() const;
 
  private:
-  AVLTree<T, T> tree_;
-  Allocator allocator;
+  tree_type tree_;
+
+  iterator IteratorFor(Node<T, T>* node);
 };
+
+namespace pmr {
+template <typename T, typename Compare = std::less<T>>
+using set = s21::set<T, Compare, std::pmr::polymorphic_allocator<T>>;
+}  // namespace pmr
 }  // namespace s21
 
 #endif  // S21_SET_H
@@ -0,0 +1,73 @@
+#ifndef S21_CONTAINERS_SPSC_QUEUE_H
+#define S21_CONTAINERS_SPSC_QUEUE_H
+
+#include <atomic>
+#include <cstddef>
+#include <type_traits>
+
+namespace s21 {
+// Bounded wait-free single-producer/single-consumer queue. Exactly one thread
+// may call the push family and exactly one thread may call the pop family.
+// head_ and tail_ live on separate cache lines together with a cached copy of
+// the opposite index, so the steady state touches no shared line per item.
+template <typename T>
+class spsc_queue {
+ public:
+  // member type
+  using value_type = T;
+  using reference = T&;
+  using const_reference = const T&;
+  using size_type = size_t;
+
+  // functions
+  explicit spsc_queue(size_type capacity);
+  spsc_queue(const spsc_queue&) = delete;
+  spsc_queue& operator=(const spsc_queue&) = delete;
+  ~spsc_queue();
+
+  // capacity
+  bool empty() const;
+  size_type size() const;
+  size_type capacity() const;
+
+  // producer side
+  bool try_push(const_reference value);
+  bool try_push(value_type&& value);
+  template <typename... Args>
+  bool try_emplace(Args&&... args);
+  // Spin with std::this_thread::yield while the queue is full, keeping the
+  // core busy; meant for consumers that keep up, otherwise poll try_push
+  void push(const_reference value);
+  void push(value_type&& value);
+  template <typename InputIt>
+  size_type try_push_many(InputIt first, InputIt last);
+
+  // consumer side
+  bool try_pop(reference value);
+  // Spins like push while the queue is empty
+  void pop(reference value);
+  template <typename OutputIt>
+  size_type try_pop_many(OutputIt out, size_type max_count);
+
+ private:
+  static constexpr size_type kCacheLine = 64;
+
+  using Storage = typename std::aligned_storage<sizeof(T), alignof(T)>::type;
+
+  // consumer-owned line
+  alignas(kCacheLine) std::atomic<size_type> head_;
+  size_type cached_tail_;
+  // producer-owned line
+  alignas(kCacheLine) std::atomic<size_type> tail_;
+  size_type cached_head_;
+  // read-only after construction
+  alignas(kCacheLine) Storage* slots_;
+  size_type mask_;
+
+  T* Slot(size_type index) const;
+};
+}  // namespace s21
+
+#include "s21_spsc_queue.tpp"
+
+#endif
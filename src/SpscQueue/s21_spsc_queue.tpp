@@ -0,0 +1,178 @@
+#ifndef S21_CONTAINERS_SPSC_QUEUE_TPP
+#define S21_CONTAINERS_SPSC_QUEUE_TPP
+
+#include <new>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+
+namespace s21 {
+
+// functions
+
+// Creates a queue for at least capacity elements; the slot count is rounded up
+// to a power of two so that indices wrap with a mask
+template <typename T>
+spsc_queue<T>::spsc_queue(size_type capacity)
+    : head_(0), cached_tail_(0), tail_(0), cached_head_(0) {
+  if (capacity == 0) throw std::invalid_argument("Capacity must be positive");
+  size_type slots = 1;
+  while (slots < capacity) slots <<= 1;
+  slots_ = new Storage[slots];
+  mask_ = slots - 1;
+}
+
+// Destructor, destroys the elements that were never popped
+template <typename T>
+spsc_queue<T>::~spsc_queue() {
+  size_type tail = tail_.load(std::memory_order_relaxed);
+  for (size_type i = head_.load(std::memory_order_relaxed); i != tail; ++i) {
+    Slot(i)->~T();
+  }
+  delete[] slots_;
+}
+
+// capacity
+
+// Returns true if the queue looked empty at the moment of the call
+template <typename T>
+bool spsc_queue<T>::empty() const {
+  return size() == 0;
+}
+
+// Returns the number of elements at the moment of the call
+template <typename T>
+typename spsc_queue<T>::size_type spsc_queue<T>::size() const {
+  size_type head = head_.load(std::memory_order_acquire);
+  size_type tail = tail_.load(std::memory_order_acquire);
+  return tail - head;
+}
+
+// Returns the number of slots
+template <typename T>
+typename spsc_queue<T>::size_type spsc_queue<T>::capacity() const {
+  return mask_ + 1;
+}
+
+// producer side
+
+// Appends a copy of value, returns false if the queue is full
+template <typename T>
+bool spsc_queue<T>::try_push(const_reference value) {
+  return try_emplace(value);
+}
+
+// Appends value by moving it, returns false if the queue is full
+template <typename T>
+bool spsc_queue<T>::try_push(value_type&& value) {
+  return try_emplace(std::move(value));
+}
+
+// Constructs a new element in place, returns false if the queue is full
+template <typename T>
+template <typename... Args>
+bool spsc_queue<T>::try_emplace(Args&&... args) {
+  size_type tail = tail_.load(std::memory_order_relaxed);
+  if (tail - cached_head_ > mask_) {
+    cached_head_ = head_.load(std::memory_order_acquire);
+    if (tail - cached_head_ > mask_) return false;
+  }
+  new (Slot(tail)) T(std::forward<Args>(args)...);
+  tail_.store(tail + 1, std::memory_order_release);
+  return true;
+}
+
+// Appends a copy of value, spinning while the queue is full
+template <typename T>
+void spsc_queue<T>::push(const_reference value) {
+  while (!try_emplace(value)) std::this_thread::yield();
+}
+
+// Appends value by moving it, spinning while the queue is full
+template <typename T>
+void spsc_queue<T>::push(value_type&& value) {
+  while (!try_emplace(std::move(value))) std::this_thread::yield();
+}
+
+// Appends as many elements of [first, last) as fit and publishes them with a
+// single store, returns the number of elements pushed. If a copy throws, the
+// elements built before it are published and the exception is rethrown
+template <typename T>
+template <typename InputIt>
+typename spsc_queue<T>::size_type spsc_queue<T>::try_push_many(InputIt first,
+                                                               InputIt last) {
+  size_type tail = tail_.load(std::memory_order_relaxed);
+  cached_head_ = head_.load(std::memory_order_acquire);
+  size_type free_slots = capacity() - (tail - cached_head_);
+  size_type pushed = 0;
+  try {
+    for (; first != last && pushed < free_slots; ++first, ++pushed) {
+      new (Slot(tail + pushed)) T(*first);
+    }
+  } catch (...) {
+    if (pushed) tail_.store(tail + pushed, std::memory_order_release);
+    throw;
+  }
+  if (pushed) tail_.store(tail + pushed, std::memory_order_release);
+  return pushed;
+}
+
+// consumer side
+
+// Moves the oldest element into value, returns false if the queue is empty
+template <typename T>
+bool spsc_queue<T>::try_pop(reference value) {
+  size_type head = head_.load(std::memory_order_relaxed);
+  if (head == cached_tail_) {
+    cached_tail_ = tail_.load(std::memory_order_acquire);
+    if (head == cached_tail_) return false;
+  }
+  T* slot = Slot(head);
+  value = std::move(*slot);
+  slot->~T();
+  head_.store(head + 1, std::memory_order_release);
+  return true;
+}
+
+// Moves the oldest element into value, spinning while the queue is empty
+template <typename T>
+void spsc_queue<T>::pop(reference value) {
+  while (!try_pop(value)) std::this_thread::yield();
+}
+
+// Moves up to max_count elements to out and releases their slots with a
+// single store, returns the number of elements popped. If a move throws, the
+// slots emptied before it are released, the failed element stays at the front
+// and the exception is rethrown
+template <typename T>
+template <typename OutputIt>
+typename spsc_queue<T>::size_type spsc_queue<T>::try_pop_many(
+    OutputIt out, size_type max_count) {
+  size_type head = head_.load(std::memory_order_relaxed);
+  cached_tail_ = tail_.load(std::memory_order_acquire);
+  size_type popped = 0;
+  try {
+    for (; head + popped != cached_tail_ && popped < max_count; ++popped) {
+      T* slot = Slot(head + popped);
+      *out++ = std::move(*slot);
+      slot->~T();
+    }
+  } catch (...) {
+    if (popped) head_.store(head + popped, std::memory_order_release);
+    throw;
+  }
+  if (popped) head_.store(head + popped, std::memory_order_release);
+  return popped;
+}
+
+// helpers
+
+// Returns the slot of a monotonically increasing index
+template <typename T>
+T* spsc_queue<T>::Slot(size_type index) const {
+  return std::launder(reinterpret_cast<T*>(&slots_[index & mask_]));
+}
+
+}  // namespace s21
+
+#endif
@@ -9,22 +9,84 @@ stack<T, Container>::stack() = default;
 template <typename T, typename Container>
 stack<T, Container>::stack(const container_type& right) : data(right) {}
 
+template <typename T, typename Container>
+template <typename Alloc, typename>
+stack<T, Container>::stack(const Alloc& alloc) : data(alloc) {}
+
 // Помещает элемент на вершину стека
 template <typename T, typename Container>
 void stack<T, Container>::push(const value_type& val) {
   data.push_back(val);
 }
-// Удаляет элемент с вершины стека и возвращает его значение
+
+// Помещает элемент на вершину стека, перемещая его
+template <typename T, typename Container>
+void stack<T, Container>::push(value_type&& val) {
+  data.push_back(std::move(val));
+}
+
+// Создает элемент на вершине стека из аргументов конструктора
+template <typename T, typename Container>
+template <typename... Args>
+void stack<T, Container>::emplace(Args&&... args) {
+  data.emplace_back(std::forward<Args>(args)...);
+}
+
+// Удаляет элемент с вершины стека без копирования
 template <typename T, typename Container>
-typename stack<T, Container>::value_type stack<T, Container>::pop() {
+void stack<T, Container>::pop() {
   if (data.empty()) {
     throw std::out_of_range("Stack is empty");
   }
-  value_type item = data.back();
+  data.pop_back();
+}
+
+// Удаляет элемент с вершины стека и возвращает его значение, перемещая его
+template <typename T, typename Container>
+typename stack<T, Container>::value_type stack<T, Container>::pop_value() {
+  if (data.empty()) {
+    throw std::out_of_range("Stack is empty");
+  }
+  value_type item = std::move(data.back());
   data.pop_back();
   return item;
 }
 
+// Помещает элементы диапазона [first, last) на вершину стека по порядку
+template <typename T, typename Container>
+template <typename InputIt>
+void stack<T, Container>::push_range(InputIt first, InputIt last) {
+  using category = typename std::iterator_traits<InputIt>::iterator_category;
+  if constexpr (std::is_base_of<std::forward_iterator_tag, category>::value) {
+    reserve(data.size() + std::distance(first, last));
+  }
+  for (; first != last; ++first) {
+    data.push_back(*first);
+  }
+}
+
+// Перемещает count элементов с вершины стека в out, начиная с вершины
+template <typename T, typename Container>
+template <typename OutputIt>
+OutputIt stack<T, Container>::pop_n(size_type count, OutputIt out) {
+  if (count > data.size()) {
+    throw std::out_of_range("Stack has fewer elements than requested");
+  }
+  for (size_type i = 0; i < count; ++i) {
+    *out++ = std::move(data.back());
+    data.pop_back();
+  }
+  return out;
+}
+
+// Резервирует память в контейнере, если он это поддерживает
+template <typename T, typename Container>
+void stack<T, Container>::reserve(size_type new_capacity) {
+  if constexpr (HasReserve<container_type>::value) {
+    data.reserve(new_capacity);
+  }
+}
+
 // Проверяет, пуст ли стек
 template <typename T, typename Container>
 bool stack<T, Container>::empty() const {
@@ -54,4 +116,10 @@ typename stack<T, Container>::const_reference stack<T, Container>::top() const {
   }
   return data.back();
 }
+
+// Возвращает счетчики режима S21_CONTAINERS_STATS базового контейнера
+template <typename T, typename Container>
+container_stats stack<T, Container>::stats() const {
+  return data.stats();
+}
 }  // namespace s21
\ No newline at end of file
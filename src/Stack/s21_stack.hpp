@@ -2,11 +2,23 @@
 #define S21_STACK_H
 
 #include <iostream>
+#include <iterator>
+#include <type_traits>
+#include <utility>
 
 #include "../Vector/s21_vector.hpp"
 
 namespace s21 {
 
+// Проверяет, есть ли у контейнера метод reserve
+template <typename Container, typename = void>
+struct HasReserve : std::false_type {};
+
+template <typename Container>
+struct HasReserve<Container,
+                  std::void_t<decltype(std::declval<Container&>().reserve(0))>>
+    : std::true_type {};
+
 template <typename T, typename Container = s21::vector<T>>
 class stack {
  public:
@@ -26,12 +38,32 @@ class stack {
  public:
   stack();
   stack(const container_type& right);
+  // Пустой стек, хранилище которого выделяет память через alloc
+  template <typename Alloc, typename = std::enable_if_t<
+                                std::uses_allocator<Container, Alloc>::value>>
+  explicit stack(const Alloc& alloc);
   void push(const value_type& val);
-  value_type pop();
+  void push(value_type&& val);
+  template <typename... Args>
+  void emplace(Args&&... args);
+  void pop();
+  value_type pop_value();
+  template <typename InputIt>
+  void push_range(InputIt first, InputIt last);
+  template <typename OutputIt>
+  OutputIt pop_n(size_type count, OutputIt out);
+  void reserve(size_type new_capacity);
   bool empty() const;
   size_type size() const;
   reference top();
   const_reference top() const;
+  container_stats stats() const;
 };
+
+namespace pmr {
+// Стек на s21::pmr::vector
+template <typename T>
+using stack = s21::stack<T, s21::pmr::vector<T>>;
+}  // namespace pmr
 }  // namespace s21
-#endif  // S21_STACK_HPP
\ No newline at end of file
+#endif  // S21_STACK_HPP
@@ -0,0 +1,91 @@
+#ifndef S21_CONTAINERS_STATIC_QUEUE_H
+#define S21_CONTAINERS_STATIC_QUEUE_H
+
+#include <cstddef>
+#include <initializer_list>
+#include <stdexcept>
+#include <type_traits>
+
+#include "../Stats/s21_stats.h"
+
+namespace s21 {
+// FIFO queue of at most N elements in an inline ring, the fixed-capacity
+// counterpart of s21::queue over ring_buffer. Slots hold constructed
+// elements only between the front and the back; pushing into a full queue
+// throws std::length_error and leaves it unchanged. Positions wrap by a
+// compare rather than a mask, so N need not be a power of two.
+template <typename T, size_t N>
+class static_queue {
+  static_assert(N > 0, "a static_queue needs room for an element");
+
+ public:
+  // member type
+  using value_type = T;
+  using reference = T&;
+  using const_reference = const T&;
+  using size_type = size_t;
+
+  // functions
+  static_queue() noexcept;
+  static_queue(std::initializer_list<value_type> const& items);
+  static_queue(const static_queue& other);
+  static_queue(static_queue&& other) noexcept(
+      std::is_nothrow_move_constructible<T>::value);
+  ~static_queue();
+  static_queue& operator=(const static_queue& other);
+  static_queue& operator=(static_queue&& other) noexcept(
+      std::is_nothrow_move_constructible<T>::value);
+
+  // element access, std::out_of_range on an empty queue
+  reference front();
+  const_reference front() const;
+  reference back();
+  const_reference back() const;
+  // Element index places behind the front, unchecked
+  reference operator[](size_type index);
+  const_reference operator[](size_type index) const;
+
+  // capacity
+  constexpr bool empty() const noexcept { return size_ == 0; }
+  constexpr bool full() const noexcept { return size_ == N; }
+  constexpr size_type size() const noexcept { return size_; }
+  static constexpr size_type capacity() noexcept { return N; }
+  static constexpr size_type max_size() noexcept { return N; }
+
+  // modifiers
+  void push(const_reference value);
+  void push(value_type&& value);
+  template <typename... Args>
+  reference emplace(Args&&... args);
+  // std::out_of_range on an empty queue
+  void pop();
+  void clear() noexcept;
+  void swap(static_queue& other);
+
+  // insert_many
+  template <typename... Args>
+  void insert_many_back(Args&&... args);
+
+  // The storage is inline so there is nothing to count
+  container_stats stats() const;
+
+ private:
+  size_type head_;
+  size_type size_;
+  alignas(T) unsigned char storage_[N * sizeof(T)];
+
+  T* Slots() noexcept { return reinterpret_cast<T*>(storage_); }
+  const T* Slots() const noexcept {
+    return reinterpret_cast<const T*>(storage_);
+  }
+  // Physical slot of the element index places behind the front
+  size_type Slot(size_type index) const noexcept {
+    size_type slot = head_ + index;
+    return slot < N ? slot : slot - N;
+  }
+};
+}  // namespace s21
+
+#include "s21_static_queue.tpp"
+
+#endif
@@ -0,0 +1,173 @@
+#ifndef S21_CONTAINERS_STATIC_QUEUE_TPP
+#define S21_CONTAINERS_STATIC_QUEUE_TPP
+
+#include <new>
+#include <utility>
+
+namespace s21 {
+
+// functions
+
+template <typename T, size_t N>
+static_queue<T, N>::static_queue() noexcept : head_(0), size_(0) {}
+
+template <typename T, size_t N>
+static_queue<T, N>::static_queue(std::initializer_list<value_type> const& items)
+    : static_queue() {
+  if (items.size() > N) throw std::length_error("Static queue is full");
+  for (const auto& item : items) push(item);
+}
+
+// Copies and moves unwrap the ring, the front landing in slot 0
+template <typename T, size_t N>
+static_queue<T, N>::static_queue(const static_queue& other) : static_queue() {
+  for (; size_ < other.size_; ++size_) {
+    new (Slots() + size_) T(other[size_]);
+  }
+}
+
+template <typename T, size_t N>
+static_queue<T, N>::static_queue(static_queue&& other) noexcept(
+    std::is_nothrow_move_constructible<T>::value)
+    : static_queue() {
+  for (; size_ < other.size_; ++size_) {
+    new (Slots() + size_) T(std::move(other[size_]));
+  }
+  other.clear();
+}
+
+template <typename T, size_t N>
+static_queue<T, N>::~static_queue() {
+  clear();
+}
+
+template <typename T, size_t N>
+static_queue<T, N>& static_queue<T, N>::operator=(const static_queue& other) {
+  if (this != &other) {
+    clear();
+    for (; size_ < other.size_; ++size_) {
+      new (Slots() + size_) T(other[size_]);
+    }
+  }
+  return *this;
+}
+
+template <typename T, size_t N>
+static_queue<T, N>& static_queue<T, N>::operator=(
+    static_queue&& other) noexcept(
+    std::is_nothrow_move_constructible<T>::value) {
+  if (this != &other) {
+    clear();
+    for (; size_ < other.size_; ++size_) {
+      new (Slots() + size_) T(std::move(other[size_]));
+    }
+    other.clear();
+  }
+  return *this;
+}
+
+// element access
+
+template <typename T, size_t N>
+typename static_queue<T, N>::reference static_queue<T, N>::front() {
+  if (empty()) throw std::out_of_range("Queue is empty");
+  return Slots()[head_];
+}
+
+template <typename T, size_t N>
+typename static_queue<T, N>::const_reference static_queue<T, N>::front()
+    const {
+  if (empty()) throw std::out_of_range("Queue is empty");
+  return Slots()[head_];
+}
+
+template <typename T, size_t N>
+typename static_queue<T, N>::reference static_queue<T, N>::back() {
+  if (empty()) throw std::out_of_range("Queue is empty");
+  return Slots()[Slot(size_ - 1)];
+}
+
+template <typename T, size_t N>
+typename static_queue<T, N>::const_reference static_queue<T, N>::back()
+    const {
+  if (empty()) throw std::out_of_range("Queue is empty");
+  return Slots()[Slot(size_ - 1)];
+}
+
+template <typename T, size_t N>
+typename static_queue<T, N>::reference static_queue<T, N>::operator[](
+    size_type index) {
+  return Slots()[Slot(index)];
+}
+
+template <typename T, size_t N>
+typename static_queue<T, N>::const_reference static_queue<T, N>::operator[](
+    size_type index) const {
+  return Slots()[Slot(index)];
+}
+
+// modifiers
+
+template <typename T, size_t N>
+void static_queue<T, N>::push(const_reference value) {
+  emplace(value);
+}
+
+template <typename T, size_t N>
+void static_queue<T, N>::push(value_type&& value) {
+  emplace(std::move(value));
+}
+
+template <typename T, size_t N>
+template <typename... Args>
+typename static_queue<T, N>::reference static_queue<T, N>::emplace(
+    Args&&... args) {
+  if (full()) throw std::length_error("Static queue is full");
+  T* slot = new (Slots() + Slot(size_)) T(std::forward<Args>(args)...);
+  ++size_;
+  return *slot;
+}
+
+template <typename T, size_t N>
+void static_queue<T, N>::pop() {
+  if (empty()) throw std::out_of_range("Queue is empty");
+  Slots()[head_].~T();
+  head_ = head_ + 1 < N ? head_ + 1 : 0;
+  --size_;
+}
+
+template <typename T, size_t N>
+void static_queue<T, N>::clear() noexcept {
+  for (size_type i = 0; i < size_; ++i) Slots()[Slot(i)].~T();
+  head_ = 0;
+  size_ = 0;
+}
+
+// Through a temporary: the two rings need not line up
+template <typename T, size_t N>
+void static_queue<T, N>::swap(static_queue& other) {
+  if (this == &other) return;
+  static_queue temp(std::move(other));
+  other = std::move(*this);
+  *this = std::move(temp);
+}
+
+// insert_many
+
+template <typename T, size_t N>
+template <typename... Args>
+void static_queue<T, N>::insert_many_back(Args&&... args) {
+  if (size_ + sizeof...(Args) > N) {
+    throw std::length_error("Static queue is full");
+  }
+  (emplace(std::forward<Args>(args)), ...);
+}
+
+template <typename T, size_t N>
+container_stats static_queue<T, N>::stats() const {
+  return container_stats();
+}
+
+}  // namespace s21
+
+#endif
@@ -0,0 +1,113 @@
+#ifndef S21_CONTAINERS_STATIC_VECTOR_H
+#define S21_CONTAINERS_STATIC_VECTOR_H
+
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+
+#include "../Stats/s21_stats.h"
+
+namespace s21 {
+// Vector of at most N elements stored inline, like S21Array, but in raw
+// storage: only the first size() slots hold constructed elements, so T needs
+// no default constructor and an empty vector constructs nothing. It never
+// allocates; growing past N throws std::length_error and leaves the vector
+// unchanged.
+//
+// Moves move the elements one by one, O(size()), and leave the source empty.
+// Capacity queries are constexpr, the storage itself cannot be in C++17.
+template <typename T, size_t N>
+class static_vector {
+  static_assert(N > 0, "a static_vector needs room for an element");
+
+ public:
+  // member type
+  using value_type = T;
+  using reference = T&;
+  using const_reference = const T&;
+  using pointer = T*;
+  using const_pointer = const T*;
+  using iterator = T*;
+  using const_iterator = const T*;
+  using reverse_iterator = std::reverse_iterator<iterator>;
+  using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+  using size_type = size_t;
+  using difference_type = std::ptrdiff_t;
+
+  // functions
+  static_vector() noexcept;
+  static_vector(std::initializer_list<value_type> const& items);
+  static_vector(const static_vector& other);
+  static_vector(static_vector&& other) noexcept(
+      std::is_nothrow_move_constructible<T>::value);
+  ~static_vector();
+  static_vector& operator=(const static_vector& other);
+  static_vector& operator=(static_vector&& other) noexcept(
+      std::is_nothrow_move_constructible<T>::value);
+
+  void assign(size_type count, const_reference value);
+  void assign(std::initializer_list<value_type> items);
+  void assign(const_pointer first, const_pointer last);
+
+  // element access
+  reference at(size_type pos);
+  const_reference at(size_type pos) const;
+  // Unchecked, as the point of the container is the hot path
+  reference operator[](size_type pos);
+  const_reference operator[](size_type pos) const;
+  // std::out_of_range on an empty vector
+  reference front();
+  const_reference front() const;
+  reference back();
+  const_reference back() const;
+  pointer data() noexcept;
+  const_pointer data() const noexcept;
+
+  // iterators
+  iterator begin() noexcept;
+  iterator end() noexcept;
+  const_iterator begin() const noexcept;
+  const_iterator end() const noexcept;
+  const_iterator cbegin() const noexcept;
+  const_iterator cend() const noexcept;
+
+  // capacity
+  constexpr bool empty() const noexcept { return size_ == 0; }
+  constexpr bool full() const noexcept { return size_ == N; }
+  constexpr size_type size() const noexcept { return size_; }
+  static constexpr size_type capacity() noexcept { return N; }
+  static constexpr size_type max_size() noexcept { return N; }
+  // Checks that new_capacity fits, there is nothing to allocate
+  void reserve(size_type new_capacity) const;
+
+  // modifiers
+  void clear() noexcept;
+  void push_back(const_reference value);
+  void push_back(value_type&& value);
+  template <typename... Args>
+  reference emplace_back(Args&&... args);
+  // Does nothing on an empty vector, as s21::vector
+  void pop_back();
+  void resize(size_type count);
+  void swap(static_vector& other);
+
+  // The storage is inline so there is nothing to count
+  container_stats stats() const;
+
+ private:
+  size_type size_;
+  alignas(T) unsigned char storage_[N * sizeof(T)];
+
+  T* Slots() noexcept { return reinterpret_cast<T*>(storage_); }
+  const T* Slots() const noexcept {
+    return reinterpret_cast<const T*>(storage_);
+  }
+  void CheckRoom(size_type count) const;
+};
+}  // namespace s21
+
+#include "s21_static_vector.tpp"
+
+#endif
@@ -0,0 +1,265 @@
+#ifndef S21_CONTAINERS_STATIC_VECTOR_TPP
+#define S21_CONTAINERS_STATIC_VECTOR_TPP
+
+#include <algorithm>
+#include <memory>
+#include <new>
+#include <utility>
+
+namespace s21 {
+
+// functions
+
+template <typename T, size_t N>
+static_vector<T, N>::static_vector() noexcept : size_(0) {}
+
+template <typename T, size_t N>
+static_vector<T, N>::static_vector(
+    std::initializer_list<value_type> const& items)
+    : size_(0) {
+  assign(items);
+}
+
+template <typename T, size_t N>
+static_vector<T, N>::static_vector(const static_vector& other) : size_(0) {
+  std::uninitialized_copy_n(other.Slots(), other.size_, Slots());
+  size_ = other.size_;
+}
+
+template <typename T, size_t N>
+static_vector<T, N>::static_vector(static_vector&& other) noexcept(
+    std::is_nothrow_move_constructible<T>::value)
+    : size_(0) {
+  std::uninitialized_move_n(other.Slots(), other.size_, Slots());
+  size_ = other.size_;
+  other.clear();
+}
+
+template <typename T, size_t N>
+static_vector<T, N>::~static_vector() {
+  clear();
+}
+
+template <typename T, size_t N>
+static_vector<T, N>& static_vector<T, N>::operator=(
+    const static_vector& other) {
+  if (this != &other) assign(other.begin(), other.end());
+  return *this;
+}
+
+template <typename T, size_t N>
+static_vector<T, N>& static_vector<T, N>::operator=(
+    static_vector&& other) noexcept(
+    std::is_nothrow_move_constructible<T>::value) {
+  if (this != &other) {
+    clear();
+    std::uninitialized_move_n(other.Slots(), other.size_, Slots());
+    size_ = other.size_;
+    other.clear();
+  }
+  return *this;
+}
+
+template <typename T, size_t N>
+void static_vector<T, N>::assign(size_type count, const_reference value) {
+  CheckRoom(count);
+  clear();
+  std::uninitialized_fill_n(Slots(), count, value);
+  size_ = count;
+}
+
+template <typename T, size_t N>
+void static_vector<T, N>::assign(std::initializer_list<value_type> items) {
+  assign(items.begin(), items.end());
+}
+
+template <typename T, size_t N>
+void static_vector<T, N>::assign(const_pointer first, const_pointer last) {
+  size_type count = static_cast<size_type>(last - first);
+  CheckRoom(count);
+  clear();
+  std::uninitialized_copy_n(first, count, Slots());
+  size_ = count;
+}
+
+// element access
+
+template <typename T, size_t N>
+typename static_vector<T, N>::reference static_vector<T, N>::at(
+    size_type pos) {
+  if (pos >= size_) throw std::out_of_range("Index out of range");
+  return Slots()[pos];
+}
+
+template <typename T, size_t N>
+typename static_vector<T, N>::const_reference static_vector<T, N>::at(
+    size_type pos) const {
+  if (pos >= size_) throw std::out_of_range("Index out of range");
+  return Slots()[pos];
+}
+
+template <typename T, size_t N>
+typename static_vector<T, N>::reference static_vector<T, N>::operator[](
+    size_type pos) {
+  return Slots()[pos];
+}
+
+template <typename T, size_t N>
+typename static_vector<T, N>::const_reference static_vector<T, N>::operator[](
+    size_type pos) const {
+  return Slots()[pos];
+}
+
+template <typename T, size_t N>
+typename static_vector<T, N>::reference static_vector<T, N>::front() {
+  if (empty()) throw std::out_of_range("Vector is empty");
+  return Slots()[0];
+}
+
+template <typename T, size_t N>
+typename static_vector<T, N>::const_reference static_vector<T, N>::front()
+    const {
+  if (empty()) throw std::out_of_range("Vector is empty");
+  return Slots()[0];
+}
+
+template <typename T, size_t N>
+typename static_vector<T, N>::reference static_vector<T, N>::back() {
+  if (empty()) throw std::out_of_range("Vector is empty");
+  return Slots()[size_ - 1];
+}
+
+template <typename T, size_t N>
+typename static_vector<T, N>::const_reference static_vector<T, N>::back()
+    const {
+  if (empty()) throw std::out_of_range("Vector is empty");
+  return Slots()[size_ - 1];
+}
+
+template <typename T, size_t N>
+typename static_vector<T, N>::pointer static_vector<T, N>::data() noexcept {
+  return Slots();
+}
+
+template <typename T, size_t N>
+typename static_vector<T, N>::const_pointer static_vector<T, N>::data()
+    const noexcept {
+  return Slots();
+}
+
+// iterators
+
+template <typename T, size_t N>
+typename static_vector<T, N>::iterator static_vector<T, N>::begin() noexcept {
+  return Slots();
+}
+
+template <typename T, size_t N>
+typename static_vector<T, N>::iterator static_vector<T, N>::end() noexcept {
+  return Slots() + size_;
+}
+
+template <typename T, size_t N>
+typename static_vector<T, N>::const_iterator static_vector<T, N>::begin()
+    const noexcept {
+  return Slots();
+}
+
+template <typename T, size_t N>
+typename static_vector<T, N>::const_iterator static_vector<T, N>::end()
+    const noexcept {
+  return Slots() + size_;
+}
+
+template <typename T, size_t N>
+typename static_vector<T, N>::const_iterator static_vector<T, N>::cbegin()
+    const noexcept {
+  return begin();
+}
+
+template <typename T, size_t N>
+typename static_vector<T, N>::const_iterator static_vector<T, N>::cend()
+    const noexcept {
+  return end();
+}
+
+// capacity
+
+template <typename T, size_t N>
+void static_vector<T, N>::reserve(size_type new_capacity) const {
+  CheckRoom(new_capacity);
+}
+
+// modifiers
+
+template <typename T, size_t N>
+void static_vector<T, N>::clear() noexcept {
+  std::destroy_n(Slots(), size_);
+  size_ = 0;
+}
+
+template <typename T, size_t N>
+void static_vector<T, N>::push_back(const_reference value) {
+  emplace_back(value);
+}
+
+template <typename T, size_t N>
+void static_vector<T, N>::push_back(value_type&& value) {
+  emplace_back(std::move(value));
+}
+
+template <typename T, size_t N>
+template <typename... Args>
+typename static_vector<T, N>::reference static_vector<T, N>::emplace_back(
+    Args&&... args) {
+  CheckRoom(size_ + 1);
+  T* slot = new (Slots() + size_) T(std::forward<Args>(args)...);
+  ++size_;
+  return *slot;
+}
+
+template <typename T, size_t N>
+void static_vector<T, N>::pop_back() {
+  if (!empty()) Slots()[--size_].~T();
+}
+
+// New elements are value-initialized
+template <typename T, size_t N>
+void static_vector<T, N>::resize(size_type count) {
+  CheckRoom(count);
+  if (count < size_) {
+    std::destroy(Slots() + count, Slots() + size_);
+  } else {
+    std::uninitialized_value_construct(Slots() + size_, Slots() + count);
+  }
+  size_ = count;
+}
+
+// Swaps the common prefix in place and moves the rest of the longer vector
+template <typename T, size_t N>
+void static_vector<T, N>::swap(static_vector& other) {
+  if (this == &other) return;
+  static_vector* longer = size_ >= other.size_ ? this : &other;
+  static_vector* shorter = longer == this ? &other : this;
+  std::swap_ranges(shorter->begin(), shorter->end(), longer->begin());
+  std::uninitialized_move(longer->begin() + shorter->size_, longer->end(),
+                          shorter->end());
+  std::destroy(longer->begin() + shorter->size_, longer->end());
+  std::swap(size_, other.size_);
+}
+
+template <typename T, size_t N>
+container_stats static_vector<T, N>::stats() const {
+  return container_stats();
+}
+
+// helpers
+
+template <typename T, size_t N>
+void static_vector<T, N>::CheckRoom(size_type count) const {
+  if (count > N) throw std::length_error("Static vector is full");
+}
+
+}  // namespace s21
+
+#endif
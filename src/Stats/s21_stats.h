@@ -0,0 +1,143 @@
+#ifndef S21_CONTAINERS_STATS_H
+#define S21_CONTAINERS_STATS_H
+
+#include <cstddef>
+
+#ifdef S21_CONTAINERS_STATS
+#include <atomic>
+#endif
+
+namespace s21 {
+// Counters collected in the instrumentation mode. Build with
+// -DS21_CONTAINERS_STATS to enable it; otherwise the hooks expand to nothing,
+// containers carry no extra member and every stats() returns zeros.
+struct container_stats {
+  size_t allocations = 0;
+  size_t deallocations = 0;
+  size_t bytes_allocated = 0;
+  size_t rotations = 0;
+  size_t reallocations = 0;
+  size_t comparisons = 0;
+  size_t lookups = 0;
+  size_t node_visits = 0;
+
+  // Average number of tree nodes touched by one lookup
+  double visits_per_lookup() const {
+    return lookups ? static_cast<double>(node_visits) / lookups : 0.0;
+  }
+};
+
+#ifdef S21_CONTAINERS_STATS
+
+namespace stats_detail {
+// Relaxed atomics: the process-wide totals are updated from every thread,
+// and a container read concurrently (see concurrent_map) updates its own
+// counters from all of its readers. The counters only need to add up
+struct atomic_counters {
+  std::atomic<size_t> allocations{0};
+  std::atomic<size_t> deallocations{0};
+  std::atomic<size_t> bytes_allocated{0};
+  std::atomic<size_t> rotations{0};
+  std::atomic<size_t> reallocations{0};
+  std::atomic<size_t> comparisons{0};
+  std::atomic<size_t> lookups{0};
+  std::atomic<size_t> node_visits{0};
+};
+
+// Process-wide totals, updated next to the per-container counters
+inline atomic_counters& Global() {
+  static atomic_counters counters;
+  return counters;
+}
+
+inline void Add(std::atomic<size_t>& counter, size_t value) {
+  counter.fetch_add(value, std::memory_order_relaxed);
+}
+
+inline container_stats Load(const atomic_counters& counters) {
+  container_stats result;
+  result.allocations = counters.allocations.load(std::memory_order_relaxed);
+  result.deallocations =
+      counters.deallocations.load(std::memory_order_relaxed);
+  result.bytes_allocated =
+      counters.bytes_allocated.load(std::memory_order_relaxed);
+  result.rotations = counters.rotations.load(std::memory_order_relaxed);
+  result.reallocations =
+      counters.reallocations.load(std::memory_order_relaxed);
+  result.comparisons = counters.comparisons.load(std::memory_order_relaxed);
+  result.lookups = counters.lookups.load(std::memory_order_relaxed);
+  result.node_visits = counters.node_visits.load(std::memory_order_relaxed);
+  return result;
+}
+
+inline void Reset(atomic_counters& counters) {
+  counters.allocations.store(0, std::memory_order_relaxed);
+  counters.deallocations.store(0, std::memory_order_relaxed);
+  counters.bytes_allocated.store(0, std::memory_order_relaxed);
+  counters.rotations.store(0, std::memory_order_relaxed);
+  counters.reallocations.store(0, std::memory_order_relaxed);
+  counters.comparisons.store(0, std::memory_order_relaxed);
+  counters.lookups.store(0, std::memory_order_relaxed);
+  counters.node_visits.store(0, std::memory_order_relaxed);
+}
+}  // namespace stats_detail
+
+// Counters of a single container. Copies of a container start from zero
+class stats_recorder {
+ public:
+  stats_recorder() = default;
+  stats_recorder(const stats_recorder&) {}
+  stats_recorder& operator=(const stats_recorder&) { return *this; }
+
+  void Allocation(size_t bytes) {
+    Count(&stats_detail::atomic_counters::allocations, 1);
+    Count(&stats_detail::atomic_counters::bytes_allocated, bytes);
+  }
+  void Deallocation() { Count(&stats_detail::atomic_counters::deallocations); }
+  void Rotation() { Count(&stats_detail::atomic_counters::rotations); }
+  void Reallocation() { Count(&stats_detail::atomic_counters::reallocations); }
+  void Comparison() { Count(&stats_detail::atomic_counters::comparisons); }
+  void Lookup() { Count(&stats_detail::atomic_counters::lookups); }
+  void NodeVisit() { Count(&stats_detail::atomic_counters::node_visits); }
+
+  container_stats get() const { return stats_detail::Load(local_); }
+  void reset() { stats_detail::Reset(local_); }
+
+ private:
+  stats_detail::atomic_counters local_;
+
+  void Count(std::atomic<size_t> stats_detail::atomic_counters::*counter,
+             size_t value = 1) {
+    stats_detail::Add(local_.*counter, value);
+    stats_detail::Add(stats_detail::Global().*counter, value);
+  }
+};
+
+// Totals over every container since start-up or the last stats_reset()
+inline container_stats stats_snapshot() {
+  return stats_detail::Load(stats_detail::Global());
+}
+
+inline void stats_reset() { stats_detail::Reset(stats_detail::Global()); }
+
+// Declares the counters inside a container class
+#define S21_STATS_MEMBER mutable s21::stats_recorder stats_;
+// Records an event on the counters of this container, e.g.
+// S21_STATS(Allocation(sizeof(Node)))
+#define S21_STATS(event) (stats_.event)
+// Counters of this container for its stats() accessor
+#define S21_STATS_GET() (stats_.get())
+
+#else
+
+inline container_stats stats_snapshot() { return container_stats(); }
+inline void stats_reset() {}
+
+#define S21_STATS_MEMBER
+#define S21_STATS(event) ((void)0)
+#define S21_STATS_GET() (s21::container_stats())
+
+#endif
+}  // namespace s21
+
+#endif
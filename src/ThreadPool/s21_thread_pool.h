@@ -0,0 +1,115 @@
+#ifndef S21_CONTAINERS_THREAD_POOL_H
+#define S21_CONTAINERS_THREAD_POOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <thread>
+
+#include "../Queue/s21_queue.h"
+#include "../Vector/s21_vector.hpp"
+#include "../WorkStealingDeque/s21_work_stealing_deque.h"
+
+namespace s21 {
+// Fixed-size pool of worker threads. Every worker owns a work-stealing deque:
+// tasks spawned by a worker go to the bottom of its own deque, idle workers
+// steal from the top of the others. Tasks submitted from outside the pool go
+// through a shared injection queue.
+class thread_pool {
+ public:
+  using size_type = size_t;
+
+  explicit thread_pool(
+      size_type threads = std::thread::hardware_concurrency());
+  thread_pool(const thread_pool&) = delete;
+  thread_pool& operator=(const thread_pool&) = delete;
+  ~thread_pool();
+
+  size_type size() const;
+
+  // Schedules task; exceptions escaping a detached task terminate the program
+  template <typename F>
+  void submit(F&& task);
+
+  // Calls body(i) for every i in [first, last), split into chunks of grain
+  // indices, and returns when all calls finished
+  template <typename Index, typename F>
+  void parallel_for(Index first, Index last, F&& body, size_type grain = 0);
+
+  // Calls body(element) for every element of a forward iterator range
+  template <typename ForwardIt, typename F>
+  void parallel_for_each(ForwardIt first, ForwardIt last, F&& body,
+                         size_type grain = 0);
+
+ private:
+  friend class task_group;
+
+  struct Task {
+    virtual ~Task() = default;
+    virtual void Run() = 0;
+  };
+
+  template <typename F>
+  struct TaskImpl : Task {
+    F function;
+    template <typename U>
+    explicit TaskImpl(U&& f) : function(std::forward<U>(f)) {}
+    void Run() override { function(); }
+  };
+
+  struct Worker {
+    work_stealing_deque<Task*> deque;
+    std::thread thread;
+  };
+
+  struct Context {
+    thread_pool* pool = nullptr;
+    size_type index = 0;
+  };
+
+  s21::vector<Worker*> workers_;
+  s21::queue<Task*> injection_;
+  std::mutex mutex_;
+  std::condition_variable wake_;
+  std::atomic<size_type> pending_;
+  std::atomic<size_type> injected_;
+  std::atomic<size_type> sleeping_;
+  std::atomic<bool> stop_;
+
+  static Context& CurrentContext();
+  void Schedule(Task* task);
+  Task* FindTask();
+  bool RunOneTask();
+  void WorkerLoop(size_type index);
+  size_type GrainFor(size_type count, size_type grain) const;
+};
+
+// Fork-join scope on top of a thread_pool: run() spawns a task, wait() blocks
+// until every spawned task finished and executes pending tasks meanwhile, so
+// nested groups inside tasks do not deadlock the pool.
+class task_group {
+ public:
+  explicit task_group(thread_pool& pool);
+  task_group(const task_group&) = delete;
+  task_group& operator=(const task_group&) = delete;
+  ~task_group();
+
+  template <typename F>
+  void run(F&& task);
+  void wait();
+
+ private:
+  thread_pool& pool_;
+  std::atomic<size_t> pending_;
+  std::mutex error_mutex_;
+  std::exception_ptr error_;
+
+  void Join();
+};
+}  // namespace s21
+
+#include "s21_thread_pool.tpp"
+
+#endif
@@ -0,0 +1,229 @@
+#ifndef S21_CONTAINERS_THREAD_POOL_TPP
+#define S21_CONTAINERS_THREAD_POOL_TPP
+
+#include <type_traits>
+#include <utility>
+
+namespace s21 {
+
+// thread_pool
+
+// Starts threads workers; zero (unknown hardware concurrency) means one
+inline thread_pool::thread_pool(size_type threads)
+    : pending_(0), injected_(0), sleeping_(0), stop_(false) {
+  if (threads == 0) threads = 1;
+  for (size_type i = 0; i < threads; ++i) {
+    workers_.push_back(new Worker());
+  }
+  for (size_type i = 0; i < threads; ++i) {
+    workers_[i]->thread = std::thread(&thread_pool::WorkerLoop, this, i);
+  }
+}
+
+// Destructor, runs the tasks that are still queued and joins the workers
+inline thread_pool::~thread_pool() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stop_.store(true);
+  }
+  wake_.notify_all();
+  for (Worker* worker : workers_) worker->thread.join();
+  for (Worker* worker : workers_) delete worker;
+}
+
+// Returns the number of worker threads
+inline thread_pool::size_type thread_pool::size() const {
+  return workers_.size();
+}
+
+// Wraps task and hands it to the scheduler
+template <typename F>
+void thread_pool::submit(F&& task) {
+  Schedule(new TaskImpl<typename std::decay<F>::type>(std::forward<F>(task)));
+}
+
+// Splits [first, last) into chunks and runs them as a task group
+template <typename Index, typename F>
+void thread_pool::parallel_for(Index first, Index last, F&& body,
+                               size_type grain) {
+  if (!(first < last)) return;
+  size_type chunk = GrainFor(static_cast<size_type>(last - first), grain);
+
+  task_group group(*this);
+  for (Index begin = first; begin < last;) {
+    Index end = static_cast<size_type>(last - begin) > chunk
+                    ? begin + static_cast<Index>(chunk)
+                    : last;
+    group.run([&body, begin, end] {
+      for (Index i = begin; i < end; ++i) body(i);
+    });
+    begin = end;
+  }
+  group.wait();
+}
+
+// Same as parallel_for, but over iterators that only support ++, such as the
+// iterators of s21::map and s21::set
+template <typename ForwardIt, typename F>
+void thread_pool::parallel_for_each(ForwardIt first, ForwardIt last, F&& body,
+                                    size_type grain) {
+  size_type count = 0;
+  for (ForwardIt it = first; it != last; ++it) ++count;
+  if (count == 0) return;
+  size_type chunk = GrainFor(count, grain);
+
+  task_group group(*this);
+  ForwardIt begin = first;
+  while (count > 0) {
+    ForwardIt end = begin;
+    size_type steps = count < chunk ? count : chunk;
+    for (size_type i = 0; i < steps; ++i) ++end;
+    count -= steps;
+    group.run([&body, begin, end] {
+      for (ForwardIt it = begin; it != end; ++it) body(*it);
+    });
+    begin = end;
+  }
+  group.wait();
+}
+
+// Returns the identity of the calling thread inside its pool, if any
+inline thread_pool::Context& thread_pool::CurrentContext() {
+  static thread_local Context context;
+  return context;
+}
+
+// Workers push to their own deque; other threads use the injection queue.
+// pending_ is raised before the task is published and sleeping_ is read after,
+// which pairs with the worker raising sleeping_ before re-reading pending_, so
+// a wake-up cannot be lost
+inline void thread_pool::Schedule(Task* task) {
+  pending_.fetch_add(1);
+  Context& context = CurrentContext();
+  if (context.pool == this) {
+    workers_[context.index]->deque.push(task);
+  } else {
+    std::lock_guard<std::mutex> lock(mutex_);
+    injection_.push(task);
+    injected_.fetch_add(1);
+  }
+
+  if (sleeping_.load() > 0) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    wake_.notify_one();
+  }
+}
+
+// Own deque first (hot in cache, depth-first), then the injection queue, then
+// steal the oldest task of another worker
+inline thread_pool::Task* thread_pool::FindTask() {
+  Context& context = CurrentContext();
+  bool is_worker = context.pool == this;
+  Task* task = nullptr;
+
+  if (is_worker && workers_[context.index]->deque.pop(task)) {
+    pending_.fetch_sub(1);
+    return task;
+  }
+
+  if (injected_.load() > 0) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!injection_.empty()) {
+      task = injection_.front();
+      injection_.pop();
+      injected_.fetch_sub(1);
+      pending_.fetch_sub(1);
+      return task;
+    }
+  }
+
+  size_type count = workers_.size();
+  size_type start = is_worker ? context.index + 1 : 0;
+  for (size_type i = 0; i < count; ++i) {
+    size_type victim = (start + i) % count;
+    if (is_worker && victim == context.index) continue;
+    if (workers_[victim]->deque.steal(task)) {
+      pending_.fetch_sub(1);
+      return task;
+    }
+  }
+  return nullptr;
+}
+
+// Runs one queued task on the calling thread, returns false if none was found
+inline bool thread_pool::RunOneTask() {
+  Task* task = FindTask();
+  if (task == nullptr) return false;
+  task->Run();
+  delete task;
+  return true;
+}
+
+// Main loop of worker index; sleeps when no task is pending anywhere
+inline void thread_pool::WorkerLoop(size_type index) {
+  Context& context = CurrentContext();
+  context.pool = this;
+  context.index = index;
+
+  for (;;) {
+    if (RunOneTask()) continue;
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    sleeping_.fetch_add(1);
+    wake_.wait(lock, [this] { return pending_.load() > 0 || stop_.load(); });
+    sleeping_.fetch_sub(1);
+    if (stop_.load() && pending_.load() == 0) break;
+  }
+}
+
+// Default chunk size: about eight chunks per worker
+inline thread_pool::size_type thread_pool::GrainFor(size_type count,
+                                                    size_type grain) const {
+  if (grain > 0) return grain;
+  size_type chunk = count / (workers_.size() * 8);
+  return chunk > 0 ? chunk : 1;
+}
+
+// task_group
+
+inline task_group::task_group(thread_pool& pool) : pool_(pool), pending_(0) {}
+
+// Destructor, waits for the spawned tasks; errors are dropped
+inline task_group::~task_group() { Join(); }
+
+// Spawns task; its exception, if any, is rethrown by wait()
+template <typename F>
+void task_group::run(F&& task) {
+  pending_.fetch_add(1);
+  pool_.submit([this, function = std::forward<F>(task)]() mutable {
+    try {
+      function();
+    } catch (...) {
+      std::lock_guard<std::mutex> lock(error_mutex_);
+      if (!error_) error_ = std::current_exception();
+    }
+    pending_.fetch_sub(1, std::memory_order_release);
+  });
+}
+
+// Waits for every spawned task and rethrows the first exception
+inline void task_group::wait() {
+  Join();
+  std::exception_ptr error;
+  {
+    std::lock_guard<std::mutex> lock(error_mutex_);
+    std::swap(error, error_);
+  }
+  if (error) std::rethrow_exception(error);
+}
+
+// Executes queued tasks until every task of the group finished
+inline void task_group::Join() {
+  while (pending_.load(std::memory_order_acquire) > 0) {
+    if (!pool_.RunOneTask()) std::this_thread::yield();
+  }
+}
+
+}  // namespace s21
+
+#endif
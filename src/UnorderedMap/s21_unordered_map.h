@@ -0,0 +1,123 @@
+#ifndef S21_CONTAINERS_UNORDERED_MAP_H
+#define S21_CONTAINERS_UNORDERED_MAP_H
+
+#include <initializer_list>
+#include <limits>
+#include <memory>
+#include <memory_resource>
+#include <stdexcept>
+#include <tuple>
+
+#include "../HashTable/s21_hash_table.h"
+
+namespace s21 {
+// Hash map with open addressing (see HashTable). Member names follow
+// s21::map; iterators and references are invalidated by any rehash
+template <typename Key, typename T, typename Hash = std::hash<Key>,
+          typename KeyEqual = std::equal_to<Key>,
+          typename Allocator = std::allocator<std::pair<const Key, T>>>
+class unordered_map {
+ public:
+  // member type
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<const Key, T>;
+  using hasher = Hash;
+  using key_equal = KeyEqual;
+  using reference = value_type&;
+  using const_reference = const value_type&;
+  using iterator = HashIterator<value_type, false>;
+  using const_iterator = HashIterator<value_type, true>;
+  using size_type = size_t;
+  using allocator_type = Allocator;
+
+  // functions
+  unordered_map();
+  explicit unordered_map(const Allocator& alloc);
+  explicit unordered_map(size_type bucket_count, const Hash& hash = Hash(),
+                         const KeyEqual& equal = KeyEqual(),
+                         const Allocator& alloc = Allocator());
+  unordered_map(std::initializer_list<value_type> const& items,
+                const Allocator& alloc = Allocator());
+  unordered_map(const unordered_map& other) = default;
+  unordered_map(unordered_map&& other) noexcept = default;
+  unordered_map(const unordered_map& other, const Allocator& alloc);
+  unordered_map(unordered_map&& other, const Allocator& alloc);
+  ~unordered_map() = default;
+  unordered_map& operator=(const unordered_map& other) = default;
+  unordered_map& operator=(unordered_map&& other) = default;
+  allocator_type get_allocator() const;
+
+  // element access
+  mapped_type& at(const Key& key);
+  const mapped_type& at(const Key& key) const;
+  mapped_type& operator[](const Key& key);
+
+  // iterators
+  iterator begin();
+  iterator end();
+  const_iterator begin() const;
+  const_iterator end() const;
+
+  // capacity
+  bool empty() const;
+  size_type size() const;
+  size_type max_size() const;
+
+  // modifiers
+  void clear();
+  std::pair<iterator, bool> insert(const value_type& value);
+  std::pair<iterator, bool> insert(const Key& key, const T& obj);
+  std::pair<iterator, bool> insert_or_assign(const Key& key, const T& obj);
+  template <typename... Args>
+  std::pair<iterator, bool> try_emplace(const Key& key, Args&&... args);
+  void erase(const_iterator pos);
+  size_type erase(const Key& key);
+  void swap(unordered_map& other) noexcept;
+  void merge(unordered_map& other);
+
+  // lookup
+  bool contains(const Key& key) const;
+  iterator find(const Key& key);
+  const_iterator find(const Key& key) const;
+  size_type count(const Key& key) const;
+  // Heterogeneous lookup, only when both Hash and KeyEqual are transparent
+  template <typename K, typename H = Hash, typename E = KeyEqual,
+            typename = hash_detail::EnableIfTransparent<H, E>>
+  bool contains(const K& key) const;
+  template <typename K, typename H = Hash, typename E = KeyEqual,
+            typename = hash_detail::EnableIfTransparent<H, E>>
+  iterator find(const K& key);
+
+  // hash policy
+  size_type bucket_count() const;
+  float load_factor() const;
+  float max_load_factor() const;
+  void max_load_factor(float ml);
+  void rehash(size_type count);
+  void reserve(size_type count);
+
+  // observers
+  hasher hash_function() const;
+  key_equal key_eq() const;
+
+  // instrumentation, zeros unless built with S21_CONTAINERS_STATS
+  container_stats stats() const;
+
+ private:
+  HashTable<value_type, Hash, KeyEqual, PairFirstKey<value_type>, Allocator>
+      table_;
+};
+
+namespace pmr {
+template <typename Key, typename T, typename Hash = std::hash<Key>,
+          typename KeyEqual = std::equal_to<Key>>
+using unordered_map = s21::unordered_map<
+    Key, T, Hash, KeyEqual,
+    std::pmr::polymorphic_allocator<std::pair<const Key, T>>>;
+}  // namespace pmr
+}  // namespace s21
+
+#include "s21_unordered_map.tpp"
+
+#endif
@@ -0,0 +1,334 @@
+#ifndef S21_CONTAINERS_UNORDERED_MAP_TPP
+#define S21_CONTAINERS_UNORDERED_MAP_TPP
+
+#include <utility>
+
+namespace s21 {
+
+// functions
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Allocator>
+unordered_map<Key, T, Hash, KeyEqual, Allocator>::unordered_map() : table_() {}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Allocator>
+unordered_map<Key, T, Hash, KeyEqual, Allocator>::unordered_map(
+    const Allocator& alloc)
+    : table_(0, Hash(), KeyEqual(), alloc) {}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Allocator>
+unordered_map<Key, T, Hash, KeyEqual, Allocator>::unordered_map(
+    size_type bucket_count, const Hash& hash, const KeyEqual& equal,
+    const Allocator& alloc)
+    : table_(bucket_count, hash, equal, alloc) {}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Allocator>
+unordered_map<Key, T, Hash, KeyEqual, Allocator>::unordered_map(
+    std::initializer_list<value_type> const& items, const Allocator& alloc)
+    : table_(items.size(), Hash(), KeyEqual(), alloc) {
+  for (const auto& item : items) insert(item);
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Allocator>
+unordered_map<Key, T, Hash, KeyEqual, Allocator>::unordered_map(
+    const unordered_map& other, const Allocator& alloc)
+    : table_(other.table_, alloc) {}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Allocator>
+unordered_map<Key, T, Hash, KeyEqual, Allocator>::unordered_map(
+    unordered_map&& other, const Allocator& alloc)
+    : table_(std::move(other.table_), alloc) {}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Allocator>
+typename unordered_map<Key, T, Hash, KeyEqual, Allocator>::allocator_type
+unordered_map<Key, T, Hash, KeyEqual, Allocator>::get_allocator() const {
+  return table_.GetAllocator();
+}
+
+// element access
+
+// Throws std::invalid_argument for a missing key, like s21::map
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Allocator>
+typename unordered_map<Key, T, Hash, KeyEqual, Allocator>::mapped_type&
+unordered_map<Key, T, Hash, KeyEqual, Allocator>::at(const Key& key) {
+  iterator it = find(key);
+  if (it == end()) throw std::invalid_argument("This key doesn't exist");
+  return it->second;
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Allocator>
+const typename unordered_map<Key, T, Hash, KeyEqual, Allocator>::mapped_type&
+unordered_map<Key, T, Hash, KeyEqual, Allocator>::at(const Key& key) const {
+  const_iterator it = find(key);
+  if (it == end()) throw std::invalid_argument("This key doesn't exist");
+  return it->second;
+}
+
+// Inserts a value-initialized element if the key is missing
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Allocator>
+typename unordered_map<Key, T, Hash, KeyEqual, Allocator>::mapped_type&
+unordered_map<Key, T, Hash, KeyEqual, Allocator>::operator[](const Key& key) {
+  return try_emplace(key).first->second;
+}
+
+// iterators
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Allocator>
+typename unordered_map<Key, T, Hash, KeyEqual, Allocator>::iterator
+unordered_map<Key, T, Hash, KeyEqual, Allocator>::begin() {
+  return table_.Begin();
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Allocator>
+typename unordered_map<Key, T, Hash, KeyEqual, Allocator>::iterator
+unordered_map<Key, T, Hash, KeyEqual, Allocator>::end() {
+  return table_.End();
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Allocator>
+typename unordered_map<Key, T, Hash, KeyEqual, Allocator>::const_iterator
+unordered_map<Key, T, Hash, KeyEqual, Allocator>::begin() const {
+  return table_.Begin();
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Allocator>
+typename unordered_map<Key, T, Hash, KeyEqual, Allocator>::const_iterator
+unordered_map<Key, T, Hash, KeyEqual, Allocator>::end() const {
+  return table_.End();
+}
+
+// capacity
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Allocator>
+bool unordered_map<Key, T, Hash, KeyEqual, Allocator>::empty() const {
+  return table_.Size() == 0;
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Allocator>
+typename unordered_map<Key, T, Hash, KeyEqual, Allocator>::size_type
+unordered_map<Key, T, Hash, KeyEqual, Allocator>::size() const {
+  return table_.Size();
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Allocator>
+typename unordered_map<Key, T, Hash, KeyEqual, Allocator>::size_type
+unordered_map<Key, T, Hash, KeyEqual, Allocator>::max_size() const {
+  return std::numeric_limits<size_type>::max() / (sizeof(value_type) + 1);
+}
+
+// modifiers
+
+// Destroys the elements, the buckets are kept
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Allocator>
+void unordered_map<Key, T, Hash, KeyEqual, Allocator>::clear() {
+  table_.Clear();
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Allocator>
+std::pair<typename unordered_map<Key, T, Hash, KeyEqual, Allocator>::iterator,
+          bool>
+unordered_map<Key, T, Hash, KeyEqual, Allocator>::insert(
+    const value_type& value) {
+  return table_.TryEmplace(value.first, value);
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Allocator>
+std::pair<typename unordered_map<Key, T, Hash, KeyEqual, Allocator>::iterator,
+          bool>
+unordered_map<Key, T, Hash, KeyEqual, Allocator>::insert(
+    const Key& key, const T& obj) {
+  return table_.TryEmplace(key, key, obj);
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Allocator>
+std::pair<typename unordered_map<Key, T, Hash, KeyEqual, Allocator>::iterator,
+          bool>
+unordered_map<Key, T, Hash, KeyEqual, Allocator>::insert_or_assign(
+    const Key& key, const T& obj) {
+  auto result = table_.TryEmplace(key, key, obj);
+  if (!result.second) result.first->second = obj;
+  return result;
+}
+
+// Builds the mapped value from args only if the key is missing
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Allocator>
+template <typename... Args>
+std::pair<typename unordered_map<Key, T, Hash, KeyEqual, Allocator>::iterator,
+          bool>
+unordered_map<Key, T, Hash, KeyEqual, Allocator>::try_emplace(
+    const Key& key, Args&&... args) {
+  return table_.TryEmplace(key, std::piecewise_construct,
+                           std::forward_as_tuple(key),
+                           std::forward_as_tuple(std::forward<Args>(args)...));
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Allocator>
+void unordered_map<Key, T, Hash, KeyEqual, Allocator>::erase(
+    const_iterator pos) {
+  table_.Erase(pos);
+}
+
+// Returns the number of removed elements, 0 or 1
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Allocator>
+typename unordered_map<Key, T, Hash, KeyEqual, Allocator>::size_type
+unordered_map<Key, T, Hash, KeyEqual, Allocator>::erase(const Key& key) {
+  return table_.EraseKey(key);
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Allocator>
+void unordered_map<Key, T, Hash, KeyEqual, Allocator>::swap(
+    unordered_map& other) noexcept {
+  table_.Swap(other.table_);
+}
+
+// Moves the elements whose keys are missing here, duplicates stay in other
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Allocator>
+void unordered_map<Key, T, Hash, KeyEqual, Allocator>::merge(
+    unordered_map& other) {
+  if (this == &other) return;
+  for (iterator it = other.begin(); it != other.end();) {
+    iterator current = it++;
+    if (insert(*current).second) other.erase(current);
+  }
+}
+
+// lookup
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Allocator>
+bool unordered_map<Key, T, Hash, KeyEqual, Allocator>::contains(
+    const Key& key) const {
+  return table_.Find(key) != table_.End();
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Allocator>
+typename unordered_map<Key, T, Hash, KeyEqual, Allocator>::iterator
+unordered_map<Key, T, Hash, KeyEqual, Allocator>::find(const Key& key) {
+  return table_.Find(key);
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Allocator>
+typename unordered_map<Key, T, Hash, KeyEqual, Allocator>::const_iterator
+unordered_map<Key, T, Hash, KeyEqual, Allocator>::find(const Key& key) const {
+  return table_.Find(key);
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Allocator>
+typename unordered_map<Key, T, Hash, KeyEqual, Allocator>::size_type
+unordered_map<Key, T, Hash, KeyEqual, Allocator>::count(const Key& key) const {
+  return contains(key) ? 1 : 0;
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Allocator>
+template <typename K, typename, typename, typename>
+bool unordered_map<Key, T, Hash, KeyEqual, Allocator>::contains(
+    const K& key) const {
+  return table_.Find(key) != table_.End();
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Allocator>
+template <typename K, typename, typename, typename>
+typename unordered_map<Key, T, Hash, KeyEqual, Allocator>::iterator
+unordered_map<Key, T, Hash, KeyEqual, Allocator>::find(const K& key) {
+  return table_.Find(key);
+}
+
+// hash policy
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Allocator>
+typename unordered_map<Key, T, Hash, KeyEqual, Allocator>::size_type
+unordered_map<Key, T, Hash, KeyEqual, Allocator>::bucket_count() const {
+  return table_.Capacity();
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Allocator>
+float unordered_map<Key, T, Hash, KeyEqual, Allocator>::load_factor() const {
+  return table_.LoadFactor();
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Allocator>
+float
+unordered_map<Key, T, Hash, KeyEqual, Allocator>::max_load_factor() const {
+  return table_.MaxLoadFactor();
+}
+
+// Throws std::invalid_argument unless 0 < ml <= 1
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Allocator>
+void unordered_map<Key, T, Hash, KeyEqual, Allocator>::max_load_factor(
+    float ml) {
+  table_.SetMaxLoadFactor(ml);
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Allocator>
+void unordered_map<Key, T, Hash, KeyEqual, Allocator>::rehash(size_type count) {
+  table_.Rehash(count);
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Allocator>
+void unordered_map<Key, T, Hash, KeyEqual, Allocator>::reserve(
+    size_type count) {
+  table_.Reserve(count);
+}
+
+// observers
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Allocator>
+typename unordered_map<Key, T, Hash, KeyEqual, Allocator>::hasher
+unordered_map<Key, T, Hash, KeyEqual, Allocator>::hash_function() const {
+  return table_.GetHash();
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Allocator>
+typename unordered_map<Key, T, Hash, KeyEqual, Allocator>::key_equal
+unordered_map<Key, T, Hash, KeyEqual, Allocator>::key_eq() const {
+  return table_.GetKeyEqual();
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Allocator>
+container_stats
+unordered_map<Key, T, Hash, KeyEqual, Allocator>::stats() const {
+  return table_.GetStats();
+}
+
+}  // namespace s21
+
+#endif
@@ -0,0 +1,109 @@
+#ifndef S21_CONTAINERS_UNORDERED_SET_H
+#define S21_CONTAINERS_UNORDERED_SET_H
+
+#include <initializer_list>
+#include <limits>
+#include <memory>
+#include <memory_resource>
+
+#include "../HashTable/s21_hash_table.h"
+
+namespace s21 {
+// Hash set with open addressing (see HashTable). Member names follow
+// s21::set; iterators are invalidated by any rehash
+template <typename Key, typename Hash = std::hash<Key>,
+          typename KeyEqual = std::equal_to<Key>,
+          typename Allocator = std::allocator<Key>>
+class unordered_set {
+ public:
+  // member type
+  using key_type = Key;
+  using value_type = Key;
+  using hasher = Hash;
+  using key_equal = KeyEqual;
+  using reference = const Key&;
+  using const_reference = const Key&;
+  using iterator = HashIterator<Key, true>;
+  using const_iterator = HashIterator<Key, true>;
+  using size_type = size_t;
+  using allocator_type = Allocator;
+
+  // functions
+  unordered_set();
+  explicit unordered_set(const Allocator& alloc);
+  explicit unordered_set(size_type bucket_count, const Hash& hash = Hash(),
+                         const KeyEqual& equal = KeyEqual(),
+                         const Allocator& alloc = Allocator());
+  unordered_set(std::initializer_list<value_type> const& items,
+                const Allocator& alloc = Allocator());
+  unordered_set(const unordered_set& other) = default;
+  unordered_set(unordered_set&& other) noexcept = default;
+  unordered_set(const unordered_set& other, const Allocator& alloc);
+  unordered_set(unordered_set&& other, const Allocator& alloc);
+  ~unordered_set() = default;
+  unordered_set& operator=(const unordered_set& other) = default;
+  unordered_set& operator=(unordered_set&& other) = default;
+  allocator_type get_allocator() const;
+
+  // iterators
+  iterator begin() const;
+  iterator end() const;
+
+  // capacity
+  bool empty() const;
+  size_type size() const;
+  size_type max_size() const;
+
+  // modifiers
+  void clear();
+  std::pair<iterator, bool> insert(const value_type& value);
+  std::pair<iterator, bool> insert(value_type&& value);
+  template <typename... Args>
+  std::pair<iterator, bool> emplace(Args&&... args);
+  void erase(iterator pos);
+  size_type erase(const Key& key);
+  void swap(unordered_set& other) noexcept;
+  void merge(unordered_set& other);
+
+  // lookup
+  bool contains(const Key& key) const;
+  iterator find(const Key& key) const;
+  size_type count(const Key& key) const;
+  // Heterogeneous lookup, only when both Hash and KeyEqual are transparent
+  template <typename K, typename H = Hash, typename E = KeyEqual,
+            typename = hash_detail::EnableIfTransparent<H, E>>
+  bool contains(const K& key) const;
+  template <typename K, typename H = Hash, typename E = KeyEqual,
+            typename = hash_detail::EnableIfTransparent<H, E>>
+  iterator find(const K& key) const;
+
+  // hash policy
+  size_type bucket_count() const;
+  float load_factor() const;
+  float max_load_factor() const;
+  void max_load_factor(float ml);
+  void rehash(size_type count);
+  void reserve(size_type count);
+
+  // observers
+  hasher hash_function() const;
+  key_equal key_eq() const;
+
+  // instrumentation, zeros unless built with S21_CONTAINERS_STATS
+  container_stats stats() const;
+
+ private:
+  HashTable<Key, Hash, KeyEqual, IdentityKey<Key>, Allocator> table_;
+};
+
+namespace pmr {
+template <typename Key, typename Hash = std::hash<Key>,
+          typename KeyEqual = std::equal_to<Key>>
+using unordered_set = s21::unordered_set<Key, Hash, KeyEqual,
+                                         std::pmr::polymorphic_allocator<Key>>;
+}  // namespace pmr
+}  // namespace s21
+
+#include "s21_unordered_set.tpp"
+
+#endif
@@ -0,0 +1,229 @@
+#ifndef S21_CONTAINERS_UNORDERED_SET_TPP
+#define S21_CONTAINERS_UNORDERED_SET_TPP
+
+#include <utility>
+
+namespace s21 {
+
+// functions
+
+template <typename Key, typename Hash, typename KeyEqual, typename Allocator>
+unordered_set<Key, Hash, KeyEqual, Allocator>::unordered_set() : table_() {}
+
+template <typename Key, typename Hash, typename KeyEqual, typename Allocator>
+unordered_set<Key, Hash, KeyEqual, Allocator>::unordered_set(
+    const Allocator& alloc)
+    : table_(0, Hash(), KeyEqual(), alloc) {}
+
+template <typename Key, typename Hash, typename KeyEqual, typename Allocator>
+unordered_set<Key, Hash, KeyEqual, Allocator>::unordered_set(
+    size_type bucket_count, const Hash& hash, const KeyEqual& equal,
+    const Allocator& alloc)
+    : table_(bucket_count, hash, equal, alloc) {}
+
+template <typename Key, typename Hash, typename KeyEqual, typename Allocator>
+unordered_set<Key, Hash, KeyEqual, Allocator>::unordered_set(
+    std::initializer_list<value_type> const& items, const Allocator& alloc)
+    : table_(items.size(), Hash(), KeyEqual(), alloc) {
+  for (const auto& item : items) insert(item);
+}
+
+template <typename Key, typename Hash, typename KeyEqual, typename Allocator>
+unordered_set<Key, Hash, KeyEqual, Allocator>::unordered_set(
+    const unordered_set& other, const Allocator& alloc)
+    : table_(other.table_, alloc) {}
+
+template <typename Key, typename Hash, typename KeyEqual, typename Allocator>
+unordered_set<Key, Hash, KeyEqual, Allocator>::unordered_set(
+    unordered_set&& other, const Allocator& alloc)
+    : table_(std::move(other.table_), alloc) {}
+
+template <typename Key, typename Hash, typename KeyEqual, typename Allocator>
+typename unordered_set<Key, Hash, KeyEqual, Allocator>::allocator_type
+unordered_set<Key, Hash, KeyEqual, Allocator>::get_allocator() const {
+  return table_.GetAllocator();
+}
+
+// iterators
+
+template <typename Key, typename Hash, typename KeyEqual, typename Allocator>
+typename unordered_set<Key, Hash, KeyEqual, Allocator>::iterator
+unordered_set<Key, Hash, KeyEqual, Allocator>::begin() const {
+  return table_.Begin();
+}
+
+template <typename Key, typename Hash, typename KeyEqual, typename Allocator>
+typename unordered_set<Key, Hash, KeyEqual, Allocator>::iterator
+unordered_set<Key, Hash, KeyEqual, Allocator>::end() const {
+  return table_.End();
+}
+
+// capacity
+
+template <typename Key, typename Hash, typename KeyEqual, typename Allocator>
+bool unordered_set<Key, Hash, KeyEqual, Allocator>::empty() const {
+  return table_.Size() == 0;
+}
+
+template <typename Key, typename Hash, typename KeyEqual, typename Allocator>
+typename unordered_set<Key, Hash, KeyEqual, Allocator>::size_type
+unordered_set<Key, Hash, KeyEqual, Allocator>::size() const {
+  return table_.Size();
+}
+
+template <typename Key, typename Hash, typename KeyEqual, typename Allocator>
+typename unordered_set<Key, Hash, KeyEqual, Allocator>::size_type
+unordered_set<Key, Hash, KeyEqual, Allocator>::max_size() const {
+  return std::numeric_limits<size_type>::max() / (sizeof(value_type) + 1);
+}
+
+// modifiers
+
+// Destroys the elements, the buckets are kept
+template <typename Key, typename Hash, typename KeyEqual, typename Allocator>
+void unordered_set<Key, Hash, KeyEqual, Allocator>::clear() {
+  table_.Clear();
+}
+
+template <typename Key, typename Hash, typename KeyEqual, typename Allocator>
+std::pair<typename unordered_set<Key, Hash, KeyEqual, Allocator>::iterator,
+          bool>
+unordered_set<Key, Hash, KeyEqual, Allocator>::insert(const value_type& value) {
+  return table_.TryEmplace(value, value);
+}
+
+template <typename Key, typename Hash, typename KeyEqual, typename Allocator>
+std::pair<typename unordered_set<Key, Hash, KeyEqual, Allocator>::iterator,
+          bool>
+unordered_set<Key, Hash, KeyEqual, Allocator>::insert(value_type&& value) {
+  return table_.TryEmplace(value, std::move(value));
+}
+
+// The key has to be built first to be hashed
+template <typename Key, typename Hash, typename KeyEqual, typename Allocator>
+template <typename... Args>
+std::pair<typename unordered_set<Key, Hash, KeyEqual, Allocator>::iterator,
+          bool>
+unordered_set<Key, Hash, KeyEqual, Allocator>::emplace(Args&&... args) {
+  return insert(value_type(std::forward<Args>(args)...));
+}
+
+template <typename Key, typename Hash, typename KeyEqual, typename Allocator>
+void unordered_set<Key, Hash, KeyEqual, Allocator>::erase(iterator pos) {
+  table_.Erase(pos);
+}
+
+// Returns the number of removed elements, 0 or 1
+template <typename Key, typename Hash, typename KeyEqual, typename Allocator>
+typename unordered_set<Key, Hash, KeyEqual, Allocator>::size_type
+unordered_set<Key, Hash, KeyEqual, Allocator>::erase(const Key& key) {
+  return table_.EraseKey(key);
+}
+
+template <typename Key, typename Hash, typename KeyEqual, typename Allocator>
+void unordered_set<Key, Hash, KeyEqual, Allocator>::swap(
+    unordered_set& other) noexcept {
+  table_.Swap(other.table_);
+}
+
+// Moves the keys missing here, duplicates stay in other
+template <typename Key, typename Hash, typename KeyEqual, typename Allocator>
+void unordered_set<Key, Hash, KeyEqual, Allocator>::merge(
+    unordered_set& other) {
+  if (this == &other) return;
+  for (iterator it = other.begin(); it != other.end();) {
+    iterator current = it++;
+    if (insert(*current).second) other.erase(current);
+  }
+}
+
+// lookup
+
+template <typename Key, typename Hash, typename KeyEqual, typename Allocator>
+bool unordered_set<Key, Hash, KeyEqual, Allocator>::contains(
+    const Key& key) const {
+  return table_.Find(key) != table_.End();
+}
+
+template <typename Key, typename Hash, typename KeyEqual, typename Allocator>
+typename unordered_set<Key, Hash, KeyEqual, Allocator>::iterator
+unordered_set<Key, Hash, KeyEqual, Allocator>::find(const Key& key) const {
+  return table_.Find(key);
+}
+
+template <typename Key, typename Hash, typename KeyEqual, typename Allocator>
+typename unordered_set<Key, Hash, KeyEqual, Allocator>::size_type
+unordered_set<Key, Hash, KeyEqual, Allocator>::count(const Key& key) const {
+  return contains(key) ? 1 : 0;
+}
+
+template <typename Key, typename Hash, typename KeyEqual, typename Allocator>
+template <typename K, typename, typename, typename>
+bool unordered_set<Key, Hash, KeyEqual, Allocator>::contains(
+    const K& key) const {
+  return table_.Find(key) != table_.End();
+}
+
+template <typename Key, typename Hash, typename KeyEqual, typename Allocator>
+template <typename K, typename, typename, typename>
+typename unordered_set<Key, Hash, KeyEqual, Allocator>::iterator
+unordered_set<Key, Hash, KeyEqual, Allocator>::find(const K& key) const {
+  return table_.Find(key);
+}
+
+// hash policy
+
+template <typename Key, typename Hash, typename KeyEqual, typename Allocator>
+typename unordered_set<Key, Hash, KeyEqual, Allocator>::size_type
+unordered_set<Key, Hash, KeyEqual, Allocator>::bucket_count() const {
+  return table_.Capacity();
+}
+
+template <typename Key, typename Hash, typename KeyEqual, typename Allocator>
+float unordered_set<Key, Hash, KeyEqual, Allocator>::load_factor() const {
+  return table_.LoadFactor();
+}
+
+template <typename Key, typename Hash, typename KeyEqual, typename Allocator>
+float unordered_set<Key, Hash, KeyEqual, Allocator>::max_load_factor() const {
+  return table_.MaxLoadFactor();
+}
+
+// Throws std::invalid_argument unless 0 < ml <= 1
+template <typename Key, typename Hash, typename KeyEqual, typename Allocator>
+void unordered_set<Key, Hash, KeyEqual, Allocator>::max_load_factor(float ml) {
+  table_.SetMaxLoadFactor(ml);
+}
+
+template <typename Key, typename Hash, typename KeyEqual, typename Allocator>
+void unordered_set<Key, Hash, KeyEqual, Allocator>::rehash(size_type count) {
+  table_.Rehash(count);
+}
+
+template <typename Key, typename Hash, typename KeyEqual, typename Allocator>
+void unordered_set<Key, Hash, KeyEqual, Allocator>::reserve(size_type count) {
+  table_.Reserve(count);
+}
+
+// observers
+
+template <typename Key, typename Hash, typename KeyEqual, typename Allocator>
+typename unordered_set<Key, Hash, KeyEqual, Allocator>::hasher
+unordered_set<Key, Hash, KeyEqual, Allocator>::hash_function() const {
+  return table_.GetHash();
+}
+
+template <typename Key, typename Hash, typename KeyEqual, typename Allocator>
+typename unordered_set<Key, Hash, KeyEqual, Allocator>::key_equal
+unordered_set<Key, Hash, KeyEqual, Allocator>::key_eq() const {
+  return table_.GetKeyEqual();
+}
+
+template <typename Key, typename Hash, typename KeyEqual, typename Allocator>
+container_stats unordered_set<Key, Hash, KeyEqual, Allocator>::stats() const {
+  return table_.GetStats();
+}
+
+}  // namespace s21
+
+#endif
@@ -5,20 +5,108 @@ namespace s21 {
 template <typename T, typename Allocator>
 vector<T, Allocator>::vector() : size_(0), capacity_(0), data_(nullptr) {}
 
+template <typename T, typename Allocator>
+vector<T, Allocator>::vector(const Allocator& alloc)
+    : size_(0), capacity_(0), data_(nullptr), allocator_(alloc) {}
+
 template <typename T, typename Allocator>
 vector<T, Allocator>::~vector() {
-  if (data_ != nullptr) {
-    for (size_type i = 0; i < size_; i++) {
-      allocator_.destroy(data_ + i);
+  Release();
+}
+
+template <typename T, typename Allocator>
+vector<T, Allocator>::vector(std::initializer_list<T> initList,
+                             const Allocator& alloc)
+    : size_(0), capacity_(0), data_(nullptr), allocator_(alloc) {
+  assign(initList);
+}
+
+template <typename T, typename Allocator>
+vector<T, Allocator>::vector(const vector& other)
+    : vector(other, alloc_traits::select_on_container_copy_construction(
+                        other.allocator_)) {}
+
+template <typename T, typename Allocator>
+vector<T, Allocator>::vector(vector&& other) noexcept
+    : size_(other.size_),
+      capacity_(other.capacity_),
+      data_(other.data_),
+      allocator_(std::move(other.allocator_)) {
+  other.size_ = 0;
+  other.capacity_ = 0;
+  other.data_ = nullptr;
+}
+
+template <typename T, typename Allocator>
+vector<T, Allocator>::vector(const vector& other, const Allocator& alloc)
+    : size_(0), capacity_(0), data_(nullptr), allocator_(alloc) {
+  reserve(other.size_);
+  for (size_type i = 0; i < other.size_; ++i) {
+    alloc_traits::construct(allocator_, data_ + i, other.data_[i]);
+    ++size_;
+  }
+}
+
+template <typename T, typename Allocator>
+vector<T, Allocator>::vector(vector&& other, const Allocator& alloc)
+    : size_(0), capacity_(0), data_(nullptr), allocator_(alloc) {
+  if (allocator_ == other.allocator_) {
+    Adopt(other);
+  } else {
+    reserve(other.size_);
+    for (size_type i = 0; i < other.size_; ++i) {
+      alloc_traits::construct(allocator_, data_ + i, std::move(other.data_[i]));
+      ++size_;
     }
-    allocator_.deallocate(data_, capacity_);
   }
 }
 
+// Копия строится отдельно, поэтому при исключении вектор не меняется
 template <typename T, typename Allocator>
-vector<T, Allocator>::vector(std::initializer_list<T> initList)
-    : size_(0), capacity_(0), data_(nullptr) {
-  assign(initList);
+vector<T, Allocator>& vector<T, Allocator>::operator=(const vector& other) {
+  if (this != &other) {
+    if constexpr (alloc_traits::propagate_on_container_copy_assignment::
+                      value) {
+      vector tmp(other, other.allocator_);
+      Release();
+      allocator_ = other.allocator_;
+      Adopt(tmp);
+    } else {
+      vector tmp(other, allocator_);
+      Release();
+      Adopt(tmp);
+    }
+  }
+  return *this;
+}
+
+template <typename T, typename Allocator>
+vector<T, Allocator>& vector<T, Allocator>::operator=(vector&& other) noexcept(
+    std::allocator_traits<
+        Allocator>::propagate_on_container_move_assignment::value ||
+    std::allocator_traits<Allocator>::is_always_equal::value) {
+  if (this != &other) {
+    if constexpr (alloc_traits::propagate_on_container_move_assignment::
+                      value) {
+      Release();
+      allocator_ = std::move(other.allocator_);
+      Adopt(other);
+    } else if (allocator_ == other.allocator_) {
+      Release();
+      Adopt(other);
+    } else {
+      vector tmp(std::move(other), allocator_);
+      Release();
+      Adopt(tmp);
+    }
+  }
+  return *this;
+}
+
+template <typename T, typename Allocator>
+typename vector<T, Allocator>::allocator_type
+vector<T, Allocator>::get_allocator() const {
+  return allocator_;
 }
 
 template <typename T, typename Allocator>
@@ -27,10 +115,10 @@ void vector<T, Allocator>::assign(size_t count, const T& value) {
   reserve(count);  // Резервируем достаточное место для count элементов
 
   for (size_t i = 0; i < count; ++i) {
-    data_[i] = value;  // Присваиваем значение value элементу вектора
+    // Создаем копию value в еще не занятой памяти
+    alloc_traits::construct(allocator_, data_ + i, value);
+    ++size_;
   }
-
-  size_ = count;  // Устанавливаем новый размер вектора
 }
 
 template <typename T, typename Allocator>
@@ -107,6 +195,13 @@ void vector<T, Allocator>::swap(vector<T, Allocator>& right) {
   pointer temp_data = data_;
   data_ = right.data_;
   right.data_ = temp_data;
+
+  // Аллокаторы меняются местами только при propagate_on_container_swap;
+  // иначе, как и у std::vector, они должны быть равны
+  if constexpr (alloc_traits::propagate_on_container_swap::value) {
+    using std::swap;
+    swap(allocator_, right.allocator_);
+  }
 }
 
 // Определение friend-функции swap
@@ -124,7 +219,7 @@ void swap(vector<T, Allocator>& left, vector<T, Allocator>& right) {
 template <typename T, class Allocator>
 void s21::vector<T, Allocator>::clear() {
   for (size_type i = 0; i < size_; ++i) {
-    allocator_.destroy(&data_[i]);  // Уничтожаем каждый элемент
+    alloc_traits::destroy(allocator_, data_ + i);  // Уничтожаем каждый элемент
   }
   size_ = 0;  // Устанавливаем размер вектора в 0
 }
@@ -151,19 +246,39 @@ bool vector<T, Allocator>::empty() const {
 // Добавляет элемент в конец вектора
 template <typename T, typename Allocator>
 void vector<T, Allocator>::push_back(const T& value) {
-  if (size_ == 0 or capacity_ == 0) reserve(1);
+  emplace_back(value);
+}
+
+// Добавляет элемент в конец вектора, перемещая его
+template <typename T, typename Allocator>
+void vector<T, Allocator>::push_back(T&& value) {
+  emplace_back(std::move(value));
+}
+
+// Создает элемент на месте в конце вектора. При нехватке емкости элемент
+// сначала создается во временном объекте: аргументы могут ссылаться на
+// элементы самого вектора, которые reserve переместит
+template <typename T, typename Allocator>
+template <typename... Args>
+typename vector<T, Allocator>::reference vector<T, Allocator>::emplace_back(
+    Args&&... args) {
   if (size_ == capacity_) {
-    reserve(capacity_ * 2);
+    T value(std::forward<Args>(args)...);
+    reserve(capacity_ ? capacity_ * 2 : 1);
+    alloc_traits::construct(allocator_, data_ + size_, std::move(value));
+  } else {
+    alloc_traits::construct(allocator_, data_ + size_,
+                            std::forward<Args>(args)...);
   }
-  data_[size_] = value;
-  size_++;
+  return data_[size_++];
 }
 
 template <typename T, typename Allocator>
 void vector<T, Allocator>::pop_back() {
   if (!empty()) {
-    --size_;            // Уменьшаем размер вектора
-    data_[size_].~T();  // Вызываем деструктор для последнего элемента
+    --size_;  // Уменьшаем размер вектора
+    // Вызываем деструктор для последнего элемента
+    alloc_traits::destroy(allocator_, data_ + size_);
   }
 }
 
@@ -245,25 +360,30 @@ template <typename T, class Allocator>
 void s21::vector<T, Allocator>::reserve(size_type new_capacity) {
   if (new_capacity > capacity_) {
     // Выделение новой памяти с запрошенной емкостью
-    pointer new_data = allocator_.allocate(new_capacity);
+    pointer new_data = alloc_traits::allocate(allocator_, new_capacity);
 
     // Проверка на успешное выделение памяти
     if (new_data == nullptr) {
       throw std::bad_alloc();
     }
+    S21_STATS(Allocation(new_capacity * sizeof(value_type)));
 
     // Копирование существующих элементов в новую память
     for (size_type i = 0; i < size_; ++i) {
       // Копирование элементов, используя перемещающий конструктор, если
       // доступен
-      allocator_.construct(&new_data[i], std::move(data_[i]));
+      alloc_traits::construct(allocator_, new_data + i, std::move(data_[i]));
     }
 
     // Освобождение старой памяти
     for (size_type i = 0; i < size_; ++i) {
-      allocator_.destroy(&data_[i]);
+      alloc_traits::destroy(allocator_, data_ + i);
+    }
+    if (data_ != nullptr) {
+      alloc_traits::deallocate(allocator_, data_, capacity_);
+      S21_STATS(Deallocation());
+      S21_STATS(Reallocation());
     }
-    allocator_.deallocate(data_, capacity_);
 
     // Обновление указателей и емкости
     data_ = new_data;
@@ -271,4 +391,27 @@ void s21::vector<T, Allocator>::reserve(size_type new_capacity) {
   }
 }
 
+template <typename T, class Allocator>
+container_stats vector<T, Allocator>::stats() const {
+  return S21_STATS_GET();
+}
+
+template <typename T, class Allocator>
+void vector<T, Allocator>::Release() {
+  if (data_ != nullptr) {
+    clear();
+    alloc_traits::deallocate(allocator_, data_, capacity_);
+    S21_STATS(Deallocation());
+    data_ = nullptr;
+    capacity_ = 0;
+  }
+}
+
+template <typename T, class Allocator>
+void vector<T, Allocator>::Adopt(vector& other) {
+  size_ = std::exchange(other.size_, 0);
+  capacity_ = std::exchange(other.capacity_, 0);
+  data_ = std::exchange(other.data_, nullptr);
+}
+
 };  // namespace s21
\ No newline at end of file
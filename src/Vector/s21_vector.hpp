@@ -3,7 +3,12 @@
 
 #include <cstdlib>  // для std::malloc и std::free
 #include <iostream>
+#include <memory>
+#include <memory_resource>
 #include <stdexcept>
+#include <utility>
+
+#include "../Stats/s21_stats.h"
 
 namespace my_allocator {
 
@@ -11,6 +16,8 @@ namespace my_allocator {
 template <typename T>
 class Allocator {
  public:
+  // Тип элементов, обязательный для std::allocator_traits
+  using value_type = T;
   // Тип, представляющий указатель на T
   using pointer = T*;
 
@@ -36,7 +43,8 @@ class vector {
   typedef ptrdiff_t difference_type;
   typedef T& reference;
   typedef const T& const_reference;
-  typedef typename Allocator::pointer pointer;
+  typedef Allocator allocator_type;
+  typedef typename std::allocator_traits<Allocator>::pointer pointer;
   typedef const T* const_pointer;
   typedef std::reverse_iterator<iterator> reverse_iterator;
   typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
@@ -44,10 +52,38 @@ class vector {
   // Конструктор по умолчанию
   vector();
 
+  // Пустой вектор, память которого выделяет alloc
+  explicit vector(const Allocator& alloc);
+
   // Деструктор
   ~vector();
 
-  vector(std::initializer_list<T> initList);
+  vector(std::initializer_list<T> initList,
+         const Allocator& alloc = Allocator());
+
+  // Конструктор копирования. Аллокатор берется из
+  // select_on_container_copy_construction: у polymorphic_allocator это
+  // ресурс по умолчанию, а не ресурс other
+  vector(const vector& other);
+
+  // Конструктор перемещения, аллокатор переходит вместе с памятью
+  vector(vector&& other) noexcept;
+
+  // Копирование и перемещение с заданным аллокатором. При аллокаторе, не
+  // равном аллокатору other, элементы перемещаются по одному
+  vector(const vector& other, const Allocator& alloc);
+  vector(vector&& other, const Allocator& alloc);
+
+  // Операторы присваивания копированием и перемещением. Аллокатор
+  // заменяется только при propagate_on_container_copy/move_assignment;
+  // иначе память other забирается лишь у равного аллокатора
+  vector& operator=(const vector& other);
+  vector& operator=(vector&& other) noexcept(
+      std::allocator_traits<
+          Allocator>::propagate_on_container_move_assignment::value ||
+      std::allocator_traits<Allocator>::is_always_equal::value);
+
+  allocator_type get_allocator() const;
 
   void assign(size_t count, const T& value);
 
@@ -88,6 +124,10 @@ class vector {
   void clear();
   // Добавляет элемент в конец вектора
   void push_back(const T& value);
+  void push_back(T&& value);
+  // Создает элемент на месте в конце вектора
+  template <typename... Args>
+  reference emplace_back(Args&&... args);
   void pop_back();
 
   // Доступ к элементу по индексу (неконстантная версия)
@@ -111,13 +151,30 @@ class vector {
   // Увеличивает емкость вектора
   void reserve(size_type new_capacity);
 
+  // Счетчики режима S21_CONTAINERS_STATS (нули, если режим выключен)
+  container_stats stats() const;
+
  private:
+  using alloc_traits = std::allocator_traits<Allocator>;
+
   size_type size_;      // Текущий размер вектора
   size_type capacity_;  // Емкость вектора
   pointer data_;        // Указатель на данные
   Allocator allocator_;  // Аллокатор для управления памятью
+  S21_STATS_MEMBER
+
+  // Уничтожает элементы и возвращает память аллокатору
+  void Release();
+  // Забирает память other, аллокаторы должны быть равны
+  void Adopt(vector& other);
 };
 
+namespace pmr {
+// Вектор на std::pmr::memory_resource, как std::pmr::vector
+template <typename T>
+using vector = s21::vector<T, std::pmr::polymorphic_allocator<T>>;
+}  // namespace pmr
+
 template <typename T, class Allocator = std::allocator<T>>
 class vector_iterator {
  public:
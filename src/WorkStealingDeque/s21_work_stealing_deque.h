@@ -0,0 +1,67 @@
+#ifndef S21_CONTAINERS_WORK_STEALING_DEQUE_H
+#define S21_CONTAINERS_WORK_STEALING_DEQUE_H
+
+#include <atomic>
+#include <cstddef>
+#include <type_traits>
+
+#include "../Vector/s21_vector.hpp"
+
+namespace s21 {
+// Chase-Lev work-stealing deque. The owning thread pushes and pops at the
+// bottom (LIFO), any number of other threads steal from the top (FIFO). The
+// circular array grows on demand; retired arrays are kept until destruction
+// because a concurrent thief may still be reading from them.
+template <typename T>
+class work_stealing_deque {
+  static_assert(std::is_trivially_copyable<T>::value,
+                "work_stealing_deque stores elements in atomics");
+
+ public:
+  // member type
+  using value_type = T;
+  using size_type = size_t;
+
+  // functions
+  explicit work_stealing_deque(size_type capacity = 64);
+  work_stealing_deque(const work_stealing_deque&) = delete;
+  work_stealing_deque& operator=(const work_stealing_deque&) = delete;
+  ~work_stealing_deque();
+
+  // capacity
+  bool empty() const;
+  size_type size() const;
+
+  // owner side
+  void push(value_type value);
+  bool pop(value_type& value);
+
+  // thief side
+  bool steal(value_type& value);
+
+ private:
+  struct Array {
+    std::ptrdiff_t mask;
+    std::atomic<T>* slots;
+
+    explicit Array(std::ptrdiff_t capacity);
+    ~Array();
+    std::ptrdiff_t Capacity() const { return mask + 1; }
+    T Get(std::ptrdiff_t index) const;
+    void Put(std::ptrdiff_t index, T value);
+  };
+
+  static constexpr size_t kCacheLine = 64;
+
+  alignas(kCacheLine) std::atomic<std::ptrdiff_t> top_;
+  alignas(kCacheLine) std::atomic<std::ptrdiff_t> bottom_;
+  alignas(kCacheLine) std::atomic<Array*> array_;
+  s21::vector<Array*> retired_;
+
+  Array* Grow(Array* array, std::ptrdiff_t top, std::ptrdiff_t bottom);
+};
+}  // namespace s21
+
+#include "s21_work_stealing_deque.tpp"
+
+#endif
@@ -0,0 +1,137 @@
+#ifndef S21_CONTAINERS_WORK_STEALING_DEQUE_TPP
+#define S21_CONTAINERS_WORK_STEALING_DEQUE_TPP
+
+namespace s21 {
+
+// circular array
+
+template <typename T>
+work_stealing_deque<T>::Array::Array(std::ptrdiff_t capacity)
+    : mask(capacity - 1), slots(new std::atomic<T>[capacity]) {}
+
+template <typename T>
+work_stealing_deque<T>::Array::~Array() {
+  delete[] slots;
+}
+
+template <typename T>
+T work_stealing_deque<T>::Array::Get(std::ptrdiff_t index) const {
+  return slots[index & mask].load(std::memory_order_relaxed);
+}
+
+template <typename T>
+void work_stealing_deque<T>::Array::Put(std::ptrdiff_t index, T value) {
+  slots[index & mask].store(value, std::memory_order_relaxed);
+}
+
+// functions
+
+// Creates a deque with room for capacity elements before the first growth,
+// rounded up to a power of two
+template <typename T>
+work_stealing_deque<T>::work_stealing_deque(size_type capacity)
+    : top_(0), bottom_(0) {
+  std::ptrdiff_t slots = 2;
+  while (static_cast<size_type>(slots) < capacity) slots <<= 1;
+  array_.store(new Array(slots), std::memory_order_relaxed);
+}
+
+// Destructor, releases the current and every retired array
+template <typename T>
+work_stealing_deque<T>::~work_stealing_deque() {
+  delete array_.load(std::memory_order_relaxed);
+  for (Array* array : retired_) delete array;
+}
+
+// capacity
+
+// Returns true if the deque looked empty at the moment of the call
+template <typename T>
+bool work_stealing_deque<T>::empty() const {
+  return size() == 0;
+}
+
+// Returns the number of elements at the moment of the call
+template <typename T>
+typename work_stealing_deque<T>::size_type work_stealing_deque<T>::size()
+    const {
+  std::ptrdiff_t bottom = bottom_.load(std::memory_order_acquire);
+  std::ptrdiff_t top = top_.load(std::memory_order_acquire);
+  return bottom > top ? static_cast<size_type>(bottom - top) : 0;
+}
+
+// owner side
+
+// Pushes value at the bottom; only the owning thread may call it
+template <typename T>
+void work_stealing_deque<T>::push(value_type value) {
+  std::ptrdiff_t bottom = bottom_.load(std::memory_order_relaxed);
+  std::ptrdiff_t top = top_.load(std::memory_order_acquire);
+  Array* array = array_.load(std::memory_order_relaxed);
+  if (bottom - top > array->Capacity() - 1) {
+    array = Grow(array, top, bottom);
+  }
+  array->Put(bottom, value);
+  bottom_.store(bottom + 1, std::memory_order_release);
+}
+
+// Pops the most recently pushed element; only the owning thread may call it.
+// The last element is arbitrated with the thieves through a CAS on top_
+template <typename T>
+bool work_stealing_deque<T>::pop(value_type& value) {
+  std::ptrdiff_t bottom = bottom_.load(std::memory_order_relaxed) - 1;
+  Array* array = array_.load(std::memory_order_relaxed);
+  bottom_.store(bottom, std::memory_order_seq_cst);
+  std::ptrdiff_t top = top_.load(std::memory_order_seq_cst);
+
+  bool taken = false;
+  if (top <= bottom) {
+    value = array->Get(bottom);
+    taken = true;
+    if (top == bottom) {
+      taken = top_.compare_exchange_strong(top, top + 1,
+                                           std::memory_order_seq_cst,
+                                           std::memory_order_relaxed);
+      bottom_.store(bottom + 1, std::memory_order_relaxed);
+    }
+  } else {
+    bottom_.store(bottom + 1, std::memory_order_relaxed);
+  }
+  return taken;
+}
+
+// thief side
+
+// Takes the oldest element; returns false if the deque is empty or another
+// thread won the race for the same element
+template <typename T>
+bool work_stealing_deque<T>::steal(value_type& value) {
+  std::ptrdiff_t top = top_.load(std::memory_order_seq_cst);
+  std::ptrdiff_t bottom = bottom_.load(std::memory_order_seq_cst);
+  if (top >= bottom) return false;
+
+  Array* array = array_.load(std::memory_order_acquire);
+  value = array->Get(top);
+  return top_.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst,
+                                      std::memory_order_relaxed);
+}
+
+// helpers
+
+// Doubles the array; the old one is retired rather than freed because a
+// thief may have loaded it just before the swap
+template <typename T>
+typename work_stealing_deque<T>::Array* work_stealing_deque<T>::Grow(
+    Array* array, std::ptrdiff_t top, std::ptrdiff_t bottom) {
+  Array* bigger = new Array(array->Capacity() * 2);
+  for (std::ptrdiff_t i = top; i < bottom; ++i) {
+    bigger->Put(i, array->Get(i));
+  }
+  retired_.push_back(array);
+  array_.store(bigger, std::memory_order_release);
+  return bigger;
+}
+
+}  // namespace s21
+
+#endif
@@ -0,0 +1,1816 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <list>
+#include <map>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <optional>
+#include <queue>
+#include <random>
+#include <set>
+#include <stack>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+#include "s21_containers.h"
+#include "s21_containersplus.h"
+
+// queue
+template <typename Queue>
+static void BM_QueuePushPop(benchmark::State &state) {
+  const int count = static_cast<int>(state.range(0));
+  for (auto _ : state) {
+    Queue queue;
+    for (int i = 0; i < count; ++i) queue.push(i);
+    while (!queue.empty()) {
+      benchmark::DoNotOptimize(queue.front());
+      queue.pop();
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * count);
+}
+
+// Producer/consumer stage: a bounded number of messages is in flight, so the
+// ring buffer reaches a steady capacity and stops allocating
+template <typename Queue>
+static void BM_QueueSteadyState(benchmark::State &state) {
+  const int in_flight = static_cast<int>(state.range(0));
+  Queue queue;
+  for (int i = 0; i < in_flight; ++i) queue.push(i);
+  int next = in_flight;
+  for (auto _ : state) {
+    queue.push(next++);
+    benchmark::DoNotOptimize(queue.front());
+    queue.pop();
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK_TEMPLATE(BM_QueuePushPop, s21::queue<int>)->Range(1 << 8, 1 << 20);
+BENCHMARK_TEMPLATE(BM_QueuePushPop, s21::queue<int, s21::list<int>>)
+    ->Range(1 << 8, 1 << 20);
+BENCHMARK_TEMPLATE(BM_QueuePushPop, std::queue<int>)->Range(1 << 8, 1 << 20);
+BENCHMARK_TEMPLATE(BM_QueueSteadyState, s21::queue<int>)->Range(16, 1 << 16);
+BENCHMARK_TEMPLATE(BM_QueueSteadyState, s21::queue<int, s21::list<int>>)
+    ->Range(16, 1 << 16);
+BENCHMARK_TEMPLATE(BM_QueueSteadyState, std::queue<int>)->Range(16, 1 << 16);
+BENCHMARK_TEMPLATE(BM_QueuePushPop, s21::queue<int, s21::deque<int>>)
+    ->Range(1 << 8, 1 << 20);
+BENCHMARK_TEMPLATE(BM_QueueSteadyState, s21::queue<int, s21::deque<int>>)
+    ->Range(16, 1 << 16);
+
+// stack
+template <typename Stack>
+static void BM_StackPushPop(benchmark::State &state) {
+  const int count = static_cast<int>(state.range(0));
+  for (auto _ : state) {
+    Stack stack;
+    for (int i = 0; i < count; ++i) stack.push(i);
+    while (!stack.empty()) {
+      benchmark::DoNotOptimize(stack.top());
+      stack.pop();
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * count);
+}
+
+BENCHMARK_TEMPLATE(BM_StackPushPop, s21::stack<int>)->Range(1 << 8, 1 << 20);
+BENCHMARK_TEMPLATE(BM_StackPushPop, s21::stack<int, s21::deque<int>>)
+    ->Range(1 << 8, 1 << 20);
+BENCHMARK_TEMPLATE(BM_StackPushPop, std::stack<int>)->Range(1 << 8, 1 << 20);
+
+// Depth-first walk of an implicit binary tree; every frame carries a heap
+// payload, so each extra copy of a frame costs an allocation and a memcpy
+struct DfsFrame {
+  int node;
+  std::string payload;
+};
+
+static void BM_StackDfsCopyingPop(benchmark::State &state) {
+  const int nodes = static_cast<int>(state.range(0));
+  const std::string payload(256, 'p');
+  for (auto _ : state) {
+    s21::stack<DfsFrame> stack;
+    stack.push(DfsFrame{0, payload});
+    long long visited = 0;
+    while (!stack.empty()) {
+      DfsFrame frame = stack.top();  // what the old value-returning pop did
+      stack.pop();
+      visited += frame.node;
+      for (int child = 2 * frame.node + 1; child <= 2 * frame.node + 2;
+           ++child) {
+        if (child < nodes) stack.push(DfsFrame{child, frame.payload});
+      }
+    }
+    benchmark::DoNotOptimize(visited);
+  }
+  state.SetItemsProcessed(state.iterations() * nodes);
+}
+
+static void BM_StackDfsMovingPop(benchmark::State &state) {
+  const int nodes = static_cast<int>(state.range(0));
+  const std::string payload(256, 'p');
+  for (auto _ : state) {
+    s21::stack<DfsFrame> stack;
+    stack.emplace(DfsFrame{0, payload});
+    long long visited = 0;
+    while (!stack.empty()) {
+      DfsFrame frame = stack.pop_value();
+      visited += frame.node;
+      for (int child = 2 * frame.node + 1; child <= 2 * frame.node + 2;
+           ++child) {
+        if (child < nodes) stack.emplace(DfsFrame{child, frame.payload});
+      }
+    }
+    benchmark::DoNotOptimize(visited);
+  }
+  state.SetItemsProcessed(state.iterations() * nodes);
+}
+
+BENCHMARK(BM_StackDfsCopyingPop)->Range(1 << 10, 1 << 18);
+BENCHMARK(BM_StackDfsMovingPop)->Range(1 << 10, 1 << 18);
+
+// concurrent queues
+
+// s21::queue guarded by a mutex, the baseline the lock-free queues replace
+template <typename T>
+class LockedQueue {
+ public:
+  explicit LockedQueue(size_t capacity) : capacity_(capacity) {}
+  bool try_push(const T &value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (queue_.size() >= capacity_) return false;
+    queue_.push(value);
+    return true;
+  }
+  bool try_pop(T &value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (queue_.empty()) return false;
+    value = queue_.front();
+    queue_.pop();
+    return true;
+  }
+
+ private:
+  size_t capacity_;
+  std::mutex mutex_;
+  s21::queue<T> queue_;
+};
+
+// Moves per_producer items from every producer to the consumers, returns
+// when all items have been received
+template <typename Queue>
+static void RunPipeline(Queue &queue, int producers, int consumers,
+                        int per_producer) {
+  const long long total = static_cast<long long>(producers) * per_producer;
+  std::atomic<long long> received(0);
+  std::vector<std::thread> threads;
+  for (int p = 0; p < producers; ++p) {
+    threads.emplace_back([&queue, per_producer] {
+      for (int i = 0; i < per_producer; ++i) {
+        while (!queue.try_push(i)) std::this_thread::yield();
+      }
+    });
+  }
+  for (int c = 0; c < consumers; ++c) {
+    threads.emplace_back([&queue, &received, total] {
+      int value;
+      while (received.load(std::memory_order_relaxed) < total) {
+        if (queue.try_pop(value)) {
+          received.fetch_add(1, std::memory_order_relaxed);
+        } else {
+          std::this_thread::yield();
+        }
+      }
+    });
+  }
+  for (auto &thread : threads) thread.join();
+}
+
+template <typename Queue>
+static void BM_ConcurrentQueueThroughput(benchmark::State &state) {
+  const int producers = static_cast<int>(state.range(0));
+  const int consumers = static_cast<int>(state.range(1));
+  const int per_producer = 100000 / producers;
+  for (auto _ : state) {
+    Queue queue(1024);
+    RunPipeline(queue, producers, consumers, per_producer);
+  }
+  state.SetItemsProcessed(state.iterations() * producers * per_producer);
+}
+
+static void BM_SpscQueueThroughput(benchmark::State &state) {
+  const int count = 100000;
+  for (auto _ : state) {
+    s21::spsc_queue<int> queue(1024);
+    RunPipeline(queue, 1, 1, count);
+  }
+  state.SetItemsProcessed(state.iterations() * count);
+}
+
+// Round trip of one message through a pair of queues
+template <typename Queue>
+static void BM_QueuePingPongLatency(benchmark::State &state) {
+  Queue ping(64);
+  Queue pong(64);
+  std::atomic<bool> done(false);
+  std::thread echo([&] {
+    int value;
+    while (!done.load(std::memory_order_relaxed)) {
+      if (ping.try_pop(value)) {
+        while (!pong.try_push(value)) std::this_thread::yield();
+      } else {
+        std::this_thread::yield();
+      }
+    }
+  });
+  int value = 0;
+  for (auto _ : state) {
+    while (!ping.try_push(value)) std::this_thread::yield();
+    while (!pong.try_pop(value)) std::this_thread::yield();
+  }
+  done.store(true);
+  echo.join();
+}
+
+static void ProducerConsumerArgs(benchmark::internal::Benchmark *bench) {
+  for (int producers : {1, 2, 4, 8, 16}) {
+    for (int consumers : {1, 2, 4, 8, 16}) {
+      bench->Args({producers, consumers});
+    }
+  }
+}
+
+BENCHMARK(BM_SpscQueueThroughput)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_ConcurrentQueueThroughput, s21::mpmc_queue<int>)
+    ->Apply(ProducerConsumerArgs)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_ConcurrentQueueThroughput, LockedQueue<int>)
+    ->Apply(ProducerConsumerArgs)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_QueuePingPongLatency, s21::spsc_queue<int>)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_QueuePingPongLatency, s21::mpmc_queue<int>)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_QueuePingPongLatency, LockedQueue<int>)->UseRealTime();
+
+// thread pool
+
+static long long SerialFibonacci(int n) {
+  return n < 2 ? n : SerialFibonacci(n - 1) + SerialFibonacci(n - 2);
+}
+
+static long long ForkJoinFibonacci(s21::thread_pool &pool, int n) {
+  if (n < 20) return SerialFibonacci(n);
+  long long left = 0;
+  s21::task_group group(pool);
+  group.run([&pool, &left, n] { left = ForkJoinFibonacci(pool, n - 1); });
+  long long right = ForkJoinFibonacci(pool, n - 2);
+  group.wait();
+  return left + right;
+}
+
+static void BM_ThreadPoolFibonacci(benchmark::State &state) {
+  s21::thread_pool pool(static_cast<size_t>(state.range(0)));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(ForkJoinFibonacci(pool, 30));
+  }
+}
+
+static void BM_ThreadPoolParallelFor(benchmark::State &state) {
+  s21::thread_pool pool(static_cast<size_t>(state.range(0)));
+  s21::vector<double> values;
+  for (int i = 0; i < (1 << 20); ++i) values.push_back(i);
+  for (auto _ : state) {
+    pool.parallel_for(size_t(0), values.size(), [&values](size_t i) {
+      double x = values[i];
+      for (int k = 0; k < 16; ++k) x = x * 0.5 + 1.0;
+      values[i] = x;
+    });
+  }
+  state.SetItemsProcessed(state.iterations() * values.size());
+}
+
+static void ThreadCountArgs(benchmark::internal::Benchmark *bench) {
+  int max_threads = static_cast<int>(std::thread::hardware_concurrency());
+  if (max_threads < 1) max_threads = 1;
+  for (int threads = 1; threads < max_threads; threads *= 2) {
+    bench->Arg(threads);
+  }
+  bench->Arg(max_threads);
+}
+
+BENCHMARK(BM_ThreadPoolFibonacci)->Apply(ThreadCountArgs)->UseRealTime();
+BENCHMARK(BM_ThreadPoolParallelFor)->Apply(ThreadCountArgs)->UseRealTime();
+
+// container suite: every container next to its std counterpart, one
+// benchmark per operation, 10^2 .. 10^7 elements. S21_BENCH_MAX_SIZE in the
+// environment lowers the upper bound for quick runs
+
+static long SuiteMaxSize() {
+  const char *limit = std::getenv("S21_BENCH_MAX_SIZE");
+  return limit ? std::atol(limit) : 10000000;
+}
+
+static void SuiteSizes(benchmark::internal::Benchmark *bench) {
+  for (long n = 100; n <= SuiteMaxSize(); n *= 10) bench->Arg(n);
+}
+
+// Distinct pseudo-random keys: multiplying by an odd constant is a bijection
+// on 32-bit integers
+static int SuiteKey(long i) {
+  return static_cast<int>(static_cast<uint32_t>(i) * 2654435761u);
+}
+
+template <typename C>
+static void SuiteAdd(C &c, int value) {
+  c.push_back(value);
+}
+template <typename T>
+static void SuiteAdd(s21::set<T> &c, int value) {
+  c.insert(value);
+}
+template <typename T>
+static void SuiteAdd(std::set<T> &c, int value) {
+  c.insert(value);
+}
+template <typename K, typename V>
+static void SuiteAdd(s21::map<K, V> &c, int value) {
+  c.insert(value, value);
+}
+template <typename K, typename V>
+static void SuiteAdd(std::map<K, V> &c, int value) {
+  c.emplace(value, value);
+}
+template <typename T, typename C>
+static void SuiteAdd(s21::queue<T, C> &c, int value) {
+  c.push(value);
+}
+template <typename T, typename C>
+static void SuiteAdd(std::queue<T, C> &c, int value) {
+  c.push(value);
+}
+template <typename T, typename C>
+static void SuiteAdd(s21::stack<T, C> &c, int value) {
+  c.push(value);
+}
+template <typename T, typename C>
+static void SuiteAdd(std::stack<T, C> &c, int value) {
+  c.push(value);
+}
+
+// Removes one element from the cheap end of the container
+template <typename T>
+static void SuiteRemove(s21::vector<T> &c) {
+  c.pop_back();
+}
+template <typename T>
+static void SuiteRemove(std::vector<T> &c) {
+  c.pop_back();
+}
+template <typename T>
+static void SuiteRemove(s21::list<T> &c) {
+  c.pop_front();
+}
+template <typename T>
+static void SuiteRemove(std::list<T> &c) {
+  c.pop_front();
+}
+template <typename C>
+static void SuiteRemove(C &c) {
+  c.pop();
+}
+template <typename T>
+static void SuiteRemove(s21::set<T> &c) {
+  c.erase(c.begin());
+}
+template <typename T>
+static void SuiteRemove(std::set<T> &c) {
+  c.erase(c.begin());
+}
+template <typename K, typename V>
+static void SuiteRemove(s21::map<K, V> &c) {
+  c.erase(c.begin());
+}
+template <typename K, typename V>
+static void SuiteRemove(std::map<K, V> &c) {
+  c.erase(c.begin());
+}
+
+// Key of a stored element, the first member for maps
+static long long SuiteValue(int value) { return value; }
+template <typename K, typename V>
+static long long SuiteValue(const std::pair<K, V> &value) {
+  return value.first;
+}
+
+// Looks up the element stored for index i of the fill sequence
+template <typename T>
+static bool SuiteLookup(s21::vector<T> &c, long i) {
+  return c[i] == SuiteKey(i);
+}
+template <typename T>
+static bool SuiteLookup(std::vector<T> &c, long i) {
+  return c[i] == SuiteKey(i);
+}
+template <typename C>
+static bool SuiteLookup(C &c, long i) {
+  const int key = SuiteKey(i);
+  for (auto it = c.begin(); it != c.end(); ++it) {
+    if (SuiteValue(*it) == key) return true;
+  }
+  return false;
+}
+template <typename T>
+static bool SuiteLookup(s21::set<T> &c, long i) {
+  return c.contains(SuiteKey(i));
+}
+template <typename T>
+static bool SuiteLookup(std::set<T> &c, long i) {
+  return c.find(SuiteKey(i)) != c.end();
+}
+template <typename K, typename V>
+static bool SuiteLookup(s21::map<K, V> &c, long i) {
+  return c.contains(SuiteKey(i));
+}
+template <typename K, typename V>
+static bool SuiteLookup(std::map<K, V> &c, long i) {
+  return c.find(SuiteKey(i)) != c.end();
+}
+
+template <typename C>
+static void SuiteFill(C &c, long n) {
+  for (long i = 0; i < n; ++i) SuiteAdd(c, SuiteKey(i));
+}
+
+// Deterministic probe order over [0, n)
+static std::vector<long> SuiteProbes(long n) {
+  std::vector<long> probes(1024);
+  uint64_t state = 88172645463325252ull;
+  for (long &probe : probes) {
+    state ^= state << 13;
+    state ^= state >> 7;
+    state ^= state << 17;
+    probe = static_cast<long>(state % static_cast<uint64_t>(n));
+  }
+  return probes;
+}
+
+template <typename C>
+static void BM_SuiteInsert(benchmark::State &state) {
+  const long n = state.range(0);
+  for (auto _ : state) {
+    C c;
+    SuiteFill(c, n);
+    benchmark::DoNotOptimize(c);
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+
+template <typename C>
+static void BM_SuiteLookup(benchmark::State &state) {
+  const long n = state.range(0);
+  C c;
+  SuiteFill(c, n);
+  const std::vector<long> probes = SuiteProbes(n);
+  size_t next = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(SuiteLookup(c, probes[next]));
+    next = (next + 1) & (probes.size() - 1);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+template <typename C>
+static void BM_SuiteIterate(benchmark::State &state) {
+  const long n = state.range(0);
+  C c;
+  SuiteFill(c, n);
+  for (auto _ : state) {
+    long long sum = 0;
+    for (auto it = c.begin(); it != c.end(); ++it) sum += SuiteValue(*it);
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+
+// Erases every element; only the erasing is timed
+template <typename C>
+static void BM_SuiteErase(benchmark::State &state) {
+  const long n = state.range(0);
+  for (auto _ : state) {
+    state.PauseTiming();
+    C c;
+    SuiteFill(c, n);
+    state.ResumeTiming();
+    for (long i = 0; i < n; ++i) SuiteRemove(c);
+    benchmark::DoNotOptimize(c);
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+
+// Copy construction, including the destruction of the copy
+template <typename C>
+static void BM_SuiteCopy(benchmark::State &state) {
+  const long n = state.range(0);
+  C c;
+  SuiteFill(c, n);
+  for (auto _ : state) {
+    C copy(c);
+    benchmark::DoNotOptimize(copy);
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+
+// insert, erase and copy work on every container; lookup and iterate need
+// iterators, so the adaptors only get the first group
+#define SUITE_BENCHMARKS(Container, Sizes)                     \
+  BENCHMARK_TEMPLATE(BM_SuiteInsert, Container)->Apply(Sizes); \
+  BENCHMARK_TEMPLATE(BM_SuiteErase, Container)->Apply(Sizes);  \
+  BENCHMARK_TEMPLATE(BM_SuiteCopy, Container)->Apply(Sizes)
+#define SUITE_TRAVERSAL_BENCHMARKS(Container, Sizes)            \
+  BENCHMARK_TEMPLATE(BM_SuiteLookup, Container)->Apply(Sizes); \
+  BENCHMARK_TEMPLATE(BM_SuiteIterate, Container)->Apply(Sizes)
+
+using SuiteIntMap = s21::map<int, int>;
+using StdIntMap = std::map<int, int>;
+
+SUITE_BENCHMARKS(s21::vector<int>, SuiteSizes);
+SUITE_BENCHMARKS(std::vector<int>, SuiteSizes);
+SUITE_TRAVERSAL_BENCHMARKS(s21::vector<int>, SuiteSizes);
+SUITE_TRAVERSAL_BENCHMARKS(std::vector<int>, SuiteSizes);
+SUITE_BENCHMARKS(s21::list<int>, SuiteSizes);
+SUITE_BENCHMARKS(std::list<int>, SuiteSizes);
+SUITE_TRAVERSAL_BENCHMARKS(s21::list<int>, SuiteSizes);
+SUITE_TRAVERSAL_BENCHMARKS(std::list<int>, SuiteSizes);
+SUITE_BENCHMARKS(s21::queue<int>, SuiteSizes);
+SUITE_BENCHMARKS(std::queue<int>, SuiteSizes);
+SUITE_BENCHMARKS(s21::stack<int>, SuiteSizes);
+SUITE_BENCHMARKS(std::stack<int>, SuiteSizes);
+SUITE_BENCHMARKS(s21::set<int>, SuiteSizes);
+SUITE_BENCHMARKS(std::set<int>, SuiteSizes);
+SUITE_TRAVERSAL_BENCHMARKS(s21::set<int>, SuiteSizes);
+SUITE_TRAVERSAL_BENCHMARKS(std::set<int>, SuiteSizes);
+SUITE_BENCHMARKS(SuiteIntMap, SuiteSizes);
+SUITE_BENCHMARKS(StdIntMap, SuiteSizes);
+SUITE_TRAVERSAL_BENCHMARKS(SuiteIntMap, SuiteSizes);
+SUITE_TRAVERSAL_BENCHMARKS(StdIntMap, SuiteSizes);
+
+// Fixed-size arrays: the size is part of the type, so every size is
+// registered separately. The arrays live on the heap, 10^7 ints do not fit
+// on the stack
+template <typename Array>
+static void BM_SuiteArrayFill(benchmark::State &state) {
+  auto array = std::make_unique<Array>();
+  for (auto _ : state) {
+    array->fill(1);
+    benchmark::DoNotOptimize(array->data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename Array>
+static void BM_SuiteArrayLookup(benchmark::State &state) {
+  auto array = std::make_unique<Array>();
+  for (long i = 0; i < state.range(0); ++i) (*array)[i] = SuiteKey(i);
+  const std::vector<long> probes = SuiteProbes(state.range(0));
+  size_t next = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(array->at(probes[next]));
+    next = (next + 1) & (probes.size() - 1);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+template <typename Array>
+static void BM_SuiteArrayIterate(benchmark::State &state) {
+  auto array = std::make_unique<Array>();
+  array->fill(1);
+  for (auto _ : state) {
+    long long sum = 0;
+    for (auto it = array->begin(); it != array->end(); ++it) sum += *it;
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename Array>
+static void BM_SuiteArrayCopy(benchmark::State &state) {
+  auto array = std::make_unique<Array>();
+  array->fill(1);
+  for (auto _ : state) {
+    auto copy = std::make_unique<Array>(*array);
+    benchmark::DoNotOptimize(copy->data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <template <typename, size_t> class Array, size_t N>
+static void RegisterArraySuite(const std::string &name) {
+  if (static_cast<long>(N) > SuiteMaxSize()) return;
+  const std::string type = "<" + name + "<int, " + std::to_string(N) + ">>";
+  const long n = static_cast<long>(N);
+  benchmark::RegisterBenchmark(("BM_SuiteArrayFill" + type).c_str(),
+                               BM_SuiteArrayFill<Array<int, N>>)
+      ->Arg(n);
+  benchmark::RegisterBenchmark(("BM_SuiteArrayLookup" + type).c_str(),
+                               BM_SuiteArrayLookup<Array<int, N>>)
+      ->Arg(n);
+  benchmark::RegisterBenchmark(("BM_SuiteArrayIterate" + type).c_str(),
+                               BM_SuiteArrayIterate<Array<int, N>>)
+      ->Arg(n);
+  benchmark::RegisterBenchmark(("BM_SuiteArrayCopy" + type).c_str(),
+                               BM_SuiteArrayCopy<Array<int, N>>)
+      ->Arg(n);
+}
+
+template <template <typename, size_t> class Array, size_t... Sizes>
+static bool RegisterArraySuites(const std::string &name) {
+  (RegisterArraySuite<Array, Sizes>(name), ...);
+  return true;
+}
+
+static const bool s21_array_suite =
+    RegisterArraySuites<s21::S21Array, 100, 1000, 10000, 100000, 1000000,
+                        10000000>("s21::S21Array");
+static const bool std_array_suite =
+    RegisterArraySuites<std::array, 100, 1000, 10000, 100000, 1000000,
+                        10000000>("std::array");
+
+// range scans
+
+// Time-series index: timestamps 10 apart, each query sums the values of a
+// window [t0, t0 + width) of about range(1) points
+template <typename Map>
+static void BM_RangeScan(benchmark::State &state) {
+  const long n = state.range(0);
+  const long width = state.range(1) * 10;
+  Map index;
+  for (long i = 0; i < n; ++i) index.insert({i * 10, static_cast<int>(i)});
+  const std::vector<long> probes = SuiteProbes(n);
+  size_t next = 0;
+  for (auto _ : state) {
+    const long t0 = probes[next] * 10 + 5;
+    long long sum = 0;
+    for (auto it = index.lower_bound(t0), last = index.lower_bound(t0 + width);
+         it != last; ++it) {
+      sum += it->second;
+    }
+    benchmark::DoNotOptimize(sum);
+    next = (next + 1) & (probes.size() - 1);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(1));
+}
+
+// Same workload through the range view
+static void BM_RangeScanView(benchmark::State &state) {
+  const long n = state.range(0);
+  const long width = state.range(1) * 10;
+  s21::map<long, int> index;
+  for (long i = 0; i < n; ++i) index.insert({i * 10, static_cast<int>(i)});
+  const std::vector<long> probes = SuiteProbes(n);
+  size_t next = 0;
+  for (auto _ : state) {
+    const long t0 = probes[next] * 10 + 5;
+    long long sum = 0;
+    for (auto &point : index.range(t0, t0 + width)) sum += point.second;
+    benchmark::DoNotOptimize(sum);
+    next = (next + 1) & (probes.size() - 1);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(1));
+}
+
+static void RangeScanArgs(benchmark::internal::Benchmark *bench) {
+  for (long n : {1L << 12, 1L << 16, 1L << 20}) {
+    for (long width : {1L, 16L, 256L}) bench->Args({n, width});
+  }
+}
+
+BENCHMARK_TEMPLATE(BM_RangeScan, s21::map<long, int>)->Apply(RangeScanArgs);
+BENCHMARK_TEMPLATE(BM_RangeScan, std::map<long, int>)->Apply(RangeScanArgs);
+BENCHMARK(BM_RangeScanView)->Apply(RangeScanArgs);
+
+// hash tables
+
+// Point lookups of a session-store style workload: hits, then misses
+template <typename Map>
+static void BM_PointLookup(benchmark::State &state) {
+  const long n = state.range(0);
+  const long miss = state.range(1);
+  Map map;
+  for (long i = 0; i < n; ++i) map.insert({SuiteKey(i), static_cast<int>(i)});
+  const std::vector<long> probes = SuiteProbes(n);
+  size_t next = 0;
+  for (auto _ : state) {
+    const int key = SuiteKey(probes[next] + miss * n);
+    benchmark::DoNotOptimize(map.find(key) != map.end());
+    next = (next + 1) & (probes.size() - 1);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+template <typename Map>
+static void BM_PointInsert(benchmark::State &state) {
+  const long n = state.range(0);
+  for (auto _ : state) {
+    Map map;
+    for (long i = 0; i < n; ++i) {
+      map.insert({SuiteKey(i), static_cast<int>(i)});
+    }
+    benchmark::DoNotOptimize(map.size());
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+
+static void PointLookupArgs(benchmark::internal::Benchmark *bench) {
+  for (long n : {1 << 10, 1 << 16, 1 << 20}) {
+    bench->Args({n, 0});
+    bench->Args({n, 1});
+  }
+}
+
+BENCHMARK_TEMPLATE(BM_PointLookup, s21::unordered_map<int, int>)
+    ->Apply(PointLookupArgs);
+BENCHMARK_TEMPLATE(BM_PointLookup, std::unordered_map<int, int>)
+    ->Apply(PointLookupArgs);
+BENCHMARK_TEMPLATE(BM_PointLookup, s21::map<int, int>)->Apply(PointLookupArgs);
+BENCHMARK_TEMPLATE(BM_PointInsert, s21::unordered_map<int, int>)
+    ->RangeMultiplier(64)
+    ->Range(1 << 10, 1 << 22);
+BENCHMARK_TEMPLATE(BM_PointInsert, std::unordered_map<int, int>)
+    ->RangeMultiplier(64)
+    ->Range(1 << 10, 1 << 22);
+BENCHMARK_TEMPLATE(BM_PointInsert, s21::map<int, int>)
+    ->RangeMultiplier(64)
+    ->Range(1 << 10, 1 << 22);
+
+// multisets
+
+// n elements, range(1) copies of every key
+template <typename Set>
+static Set MultisetFill(long n, long copies) {
+  Set set;
+  for (long i = 0; i < n; ++i) set.insert(SuiteKey(i / copies));
+  return set;
+}
+
+template <typename Set>
+static void BM_MultisetInsert(benchmark::State &state) {
+  const long n = state.range(0);
+  const long copies = state.range(1);
+  for (auto _ : state) {
+    Set set = MultisetFill<Set>(n, copies);
+    benchmark::DoNotOptimize(set.size());
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+
+template <typename Set>
+static void BM_MultisetCount(benchmark::State &state) {
+  const long n = state.range(0);
+  const long copies = state.range(1);
+  Set set = MultisetFill<Set>(n, copies);
+  const std::vector<long> probes = SuiteProbes(n / copies);
+  size_t next = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(set.count(SuiteKey(probes[next])));
+    next = (next + 1) & (probes.size() - 1);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+template <typename Set>
+static void BM_MultisetEqualRange(benchmark::State &state) {
+  const long n = state.range(0);
+  const long copies = state.range(1);
+  Set set = MultisetFill<Set>(n, copies);
+  const std::vector<long> probes = SuiteProbes(n / copies);
+  size_t next = 0;
+  for (auto _ : state) {
+    auto range = set.equal_range(SuiteKey(probes[next]));
+    benchmark::DoNotOptimize(range.first != range.second);
+    next = (next + 1) & (probes.size() - 1);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+// erase(key) of all range(1) copies, put back while the timer is paused
+template <typename Set>
+static void BM_MultisetEraseKey(benchmark::State &state) {
+  const long n = state.range(0);
+  const long copies = state.range(1);
+  Set set = MultisetFill<Set>(n, copies);
+  const std::vector<long> probes = SuiteProbes(n / copies);
+  size_t next = 0;
+  for (auto _ : state) {
+    const int key = SuiteKey(probes[next]);
+    benchmark::DoNotOptimize(set.erase(key));
+    state.PauseTiming();
+    for (long i = 0; i < copies; ++i) set.insert(key);
+    next = (next + 1) & (probes.size() - 1);
+    state.ResumeTiming();
+  }
+  state.SetItemsProcessed(state.iterations() * copies);
+}
+
+static void MultisetArgs(benchmark::internal::Benchmark *bench) {
+  for (long copies : {1, 16, 1024}) bench->Args({1 << 16, copies});
+}
+
+#define MULTISET_BENCHMARKS(Set)                                       \
+  BENCHMARK_TEMPLATE(BM_MultisetInsert, Set)->Apply(MultisetArgs);     \
+  BENCHMARK_TEMPLATE(BM_MultisetCount, Set)->Apply(MultisetArgs);      \
+  BENCHMARK_TEMPLATE(BM_MultisetEqualRange, Set)->Apply(MultisetArgs); \
+  BENCHMARK_TEMPLATE(BM_MultisetEraseKey, Set)->Apply(MultisetArgs)
+
+MULTISET_BENCHMARKS(s21::multiset<int>);
+MULTISET_BENCHMARKS(std::multiset<int>);
+
+// comparators
+
+// std::less<int> that counts its calls, works without S21_CONTAINERS_STATS
+struct CountingLess {
+  static inline size_t calls = 0;
+  bool operator()(int lhs, int rhs) const {
+    ++calls;
+    return lhs < rhs;
+  }
+};
+
+template <typename Set>
+static void BM_ComparisonsPerLookup(benchmark::State &state) {
+  const long n = state.range(0);
+  Set set;
+  for (long i = 0; i < n; ++i) set.insert(SuiteKey(i));
+  const std::vector<long> probes = SuiteProbes(n);
+  size_t next = 0;
+  CountingLess::calls = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(set.find(SuiteKey(probes[next])));
+    next = (next + 1) & (probes.size() - 1);
+  }
+  state.counters["comparisons_per_lookup"] =
+      static_cast<double>(CountingLess::calls) / state.iterations();
+}
+
+BENCHMARK_TEMPLATE(BM_ComparisonsPerLookup, s21::set<int, CountingLess>)
+    ->Range(1 << 8, 1 << 20);
+BENCHMARK_TEMPLATE(BM_ComparisonsPerLookup, std::set<int, CountingLess>)
+    ->Range(1 << 8, 1 << 20);
+
+// Keys share a long prefix so that every comparison reads memory
+static std::string StringKey(long i) {
+  return "/usr/share/containers/key/" + std::to_string(SuiteKey(i));
+}
+
+template <typename Compare, typename = void>
+struct IsTransparent : std::false_type {};
+template <typename Compare>
+struct IsTransparent<Compare, std::void_t<typename Compare::is_transparent>>
+    : std::true_type {};
+
+// Lookup of a string_view in a set of strings: without a transparent
+// comparator every probe builds a temporary std::string
+template <typename Set>
+static void BM_StringViewLookup(benchmark::State &state) {
+  const long n = state.range(0);
+  Set set;
+  std::vector<std::string> probes;
+  for (long i = 0; i < n; ++i) set.insert(StringKey(i));
+  for (long probe : SuiteProbes(n)) probes.push_back(StringKey(probe));
+  size_t next = 0;
+  for (auto _ : state) {
+    std::string_view probe = probes[next];
+    if constexpr (IsTransparent<typename Set::key_compare>::value) {
+      benchmark::DoNotOptimize(set.find(probe));
+    } else {
+      benchmark::DoNotOptimize(set.find(std::string(probe)));
+    }
+    next = (next + 1) & (probes.size() - 1);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK_TEMPLATE(BM_StringViewLookup, s21::set<std::string>)
+    ->Range(1 << 8, 1 << 18);
+BENCHMARK_TEMPLATE(BM_StringViewLookup, s21::set<std::string, std::less<>>)
+    ->Range(1 << 8, 1 << 18);
+BENCHMARK_TEMPLATE(BM_StringViewLookup, std::set<std::string>)
+    ->Range(1 << 8, 1 << 18);
+BENCHMARK_TEMPLATE(BM_StringViewLookup, std::set<std::string, std::less<>>)
+    ->Range(1 << 8, 1 << 18);
+
+// b-trees
+
+// Bytes of node memory per element: the B-tree reports its node footprint,
+// an AVL map spends one heap node per element
+template <typename Map>
+static size_t TreeBytes(const Map &map) {
+  return map.get_tree().MemoryUsage();
+}
+template <typename K, typename V>
+static size_t TreeBytes(s21::map<K, V> &map) {
+  return map.size() * sizeof(s21::Node<std::pair<const K, V>, V>);
+}
+// libstdc++ red-black nodes: color, parent, left and right before the value
+template <typename K, typename V>
+static size_t TreeBytes(std::map<K, V> &map) {
+  return map.size() * (4 * sizeof(void *) + sizeof(std::pair<const K, V>));
+}
+
+template <typename Map>
+static void BM_OrderedInsert(benchmark::State &state) {
+  const long n = state.range(0);
+  size_t bytes = 0;
+  for (auto _ : state) {
+    Map map;
+    for (long i = 0; i < n; ++i) {
+      map.insert({SuiteKey(i), static_cast<int>(i)});
+    }
+    bytes = TreeBytes(map);
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+  state.counters["bytes_per_element"] = static_cast<double>(bytes) / n;
+}
+
+// In-order walk over every element
+template <typename Map>
+static void BM_OrderedScan(benchmark::State &state) {
+  const long n = state.range(0);
+  Map map;
+  for (long i = 0; i < n; ++i) map.insert({SuiteKey(i), static_cast<int>(i)});
+  for (auto _ : state) {
+    long long sum = 0;
+    for (auto it = map.begin(); it != map.end(); ++it) sum += it->second;
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+
+#define ORDERED_BENCHMARKS(Map)                                             \
+  BENCHMARK_TEMPLATE(BM_OrderedInsert, Map)->RangeMultiplier(64)->Range( \
+      1 << 10, 1 << 22);                                                  \
+  BENCHMARK_TEMPLATE(BM_OrderedScan, Map)->RangeMultiplier(64)->Range(   \
+      1 << 10, 1 << 22)
+
+using BTreeIntMap = s21::btree_map<int, int>;
+using BTreeIntMap4K = s21::btree_map<int, int, std::less<int>, 4096>;
+ORDERED_BENCHMARKS(BTreeIntMap);
+ORDERED_BENCHMARKS(BTreeIntMap4K);
+ORDERED_BENCHMARKS(SuiteIntMap);
+ORDERED_BENCHMARKS(StdIntMap);
+BENCHMARK_TEMPLATE(BM_PointLookup, BTreeIntMap)->Apply(PointLookupArgs);
+BENCHMARK_TEMPLATE(BM_PointLookup, BTreeIntMap4K)->Apply(PointLookupArgs);
+BENCHMARK_TEMPLATE(BM_PointLookup, StdIntMap)->Apply(PointLookupArgs);
+BENCHMARK_TEMPLATE(BM_RangeScan, s21::btree_map<long, int>)
+    ->Apply(RangeScanArgs);
+
+// compact trees
+
+// Same workloads on the parent-less AVL nodes, with and without subtree sizes
+using CompactIntMap = s21::compact_map<int, int>;
+using RankedIntMap = s21::compact_map<int, int, std::less<int>,
+                                      s21::avl_order_statistics_policy>;
+ORDERED_BENCHMARKS(CompactIntMap);
+ORDERED_BENCHMARKS(RankedIntMap);
+BENCHMARK_TEMPLATE(BM_PointLookup, CompactIntMap)->Apply(PointLookupArgs);
+BENCHMARK_TEMPLATE(BM_PointLookup, RankedIntMap)->Apply(PointLookupArgs);
+
+// snapshots
+
+// Cost of one snapshot: a deep copy for s21::map, a shared root for
+// persistent_map
+template <typename Map>
+static void BM_Snapshot(benchmark::State &state) {
+  const long n = state.range(0);
+  Map map;
+  for (long i = 0; i < n; ++i) map.insert(SuiteKey(i), static_cast<int>(i));
+  for (auto _ : state) {
+    Map snapshot(map);
+    benchmark::DoNotOptimize(snapshot.size());
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+// Writer throughput when readers take a snapshot every range(1) updates;
+// each snapshot lives until the next one is taken
+template <typename Map>
+static void BM_SnapshotUpdates(benchmark::State &state) {
+  const long n = state.range(0);
+  const long period = state.range(1);
+  Map map;
+  for (long i = 0; i < n; ++i) map.insert(SuiteKey(i), static_cast<int>(i));
+  Map snapshot(map);
+  const std::vector<long> probes = SuiteProbes(n);
+  size_t next = 0;
+  long updates = 0;
+  for (auto _ : state) {
+    map.insert_or_assign(SuiteKey(probes[next]), static_cast<int>(updates));
+    next = (next + 1) & (probes.size() - 1);
+    if (++updates % period == 0) snapshot = map;
+  }
+  benchmark::DoNotOptimize(snapshot.size());
+  state.SetItemsProcessed(state.iterations());
+}
+
+static void SnapshotUpdateArgs(benchmark::internal::Benchmark *bench) {
+  for (long n : {1L << 10, 1L << 16, 1L << 20}) {
+    for (long period : {1L, 64L, 4096L}) bench->Args({n, period});
+  }
+}
+
+BENCHMARK_TEMPLATE(BM_Snapshot, s21::persistent_map<int, int>)
+    ->RangeMultiplier(64)
+    ->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(BM_Snapshot, s21::map<int, int>)
+    ->RangeMultiplier(64)
+    ->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(BM_SnapshotUpdates, s21::persistent_map<int, int>)
+    ->Apply(SnapshotUpdateArgs);
+BENCHMARK_TEMPLATE(BM_SnapshotUpdates, s21::map<int, int>)
+    ->Apply(SnapshotUpdateArgs);
+
+// concurrent maps
+
+// s21::map guarded by a mutex, the baseline for concurrent_map
+template <typename Key, typename T>
+class LockedMap {
+ public:
+  std::optional<T> find(const Key &key) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = map_.find(key);
+    if (it == map_.end()) return std::nullopt;
+    return (*it).second;
+  }
+  void insert_or_assign(const Key &key, const T &obj) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    map_.insert_or_assign(key, obj);
+  }
+
+ private:
+  std::mutex mutex_;
+  s21::map<Key, T> map_;
+};
+
+// Lookups per second of range(0) reader threads sharing a map of 64K
+// elements, with range(1) writer threads updating it meanwhile
+template <typename Map>
+static void BM_ConcurrentMapReads(benchmark::State &state) {
+  const int readers = static_cast<int>(state.range(0));
+  const int writers = static_cast<int>(state.range(1));
+  const long n = 1 << 16;
+  const int per_reader = 200000;
+  Map map;
+  for (long i = 0; i < n; ++i) map.insert_or_assign(SuiteKey(i), 0);
+  const std::vector<long> probes = SuiteProbes(n);
+  for (auto _ : state) {
+    std::atomic<bool> done(false);
+    std::vector<std::thread> threads;
+    for (int w = 0; w < writers; ++w) {
+      threads.emplace_back([&map, &done, &probes, w] {
+        for (size_t i = w; !done.load(std::memory_order_relaxed); ++i) {
+          long key = probes[i & (probes.size() - 1)];
+          map.insert_or_assign(SuiteKey(key), static_cast<int>(i));
+        }
+      });
+    }
+    std::vector<std::thread> lookups;
+    for (int r = 0; r < readers; ++r) {
+      lookups.emplace_back([&map, &probes, per_reader, r] {
+        long found = 0;
+        for (int i = 0; i < per_reader; ++i) {
+          size_t index = (static_cast<size_t>(r) * 7919 + i) &
+                         (probes.size() - 1);
+          found += map.find(SuiteKey(probes[index])).has_value();
+        }
+        benchmark::DoNotOptimize(found);
+      });
+    }
+    for (auto &thread : lookups) thread.join();
+    done.store(true);
+    for (auto &thread : threads) thread.join();
+  }
+  state.SetItemsProcessed(state.iterations() * readers * per_reader);
+}
+
+static void ReaderWriterArgs(benchmark::internal::Benchmark *bench) {
+  int max_threads = static_cast<int>(std::thread::hardware_concurrency());
+  if (max_threads < 1) max_threads = 1;
+  for (int writers : {0, 1}) {
+    for (int readers = 1; readers < max_threads; readers *= 2) {
+      bench->Args({readers, writers});
+    }
+    bench->Args({max_threads, writers});
+  }
+}
+
+BENCHMARK_TEMPLATE(BM_ConcurrentMapReads, s21::concurrent_map<int, int>)
+    ->Apply(ReaderWriterArgs)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_ConcurrentMapReads, LockedMap<int, int>)
+    ->Apply(ReaderWriterArgs)
+    ->UseRealTime();
+
+// full scans
+
+// Sum of every mapped value of a map filled in random key order, through
+// the iterators
+template <typename Map>
+static void BM_ScanIterate(benchmark::State &state) {
+  const long n = state.range(0);
+  Map map;
+  for (long i = 0; i < n; ++i) map.insert({SuiteKey(i), static_cast<int>(i)});
+  for (auto _ : state) {
+    long sum = 0;
+    for (auto &item : map) sum += item.second;
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+
+// Same sum through for_each
+static void BM_ScanForEach(benchmark::State &state) {
+  const long n = state.range(0);
+  s21::map<int, int> map;
+  for (long i = 0; i < n; ++i) map.insert(SuiteKey(i), static_cast<int>(i));
+  for (auto _ : state) {
+    long sum = 0;
+    map.for_each([&sum](const auto &item) { sum += item.second; });
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+
+static void ScanArgs(benchmark::internal::Benchmark *bench) {
+  for (long n = 1000; n <= SuiteMaxSize(); n *= 100) bench->Arg(n);
+}
+
+BENCHMARK_TEMPLATE(BM_ScanIterate, s21::map<int, int>)->Apply(ScanArgs);
+BENCHMARK(BM_ScanForEach)->Apply(ScanArgs);
+BENCHMARK_TEMPLATE(BM_ScanIterate, std::map<int, int>)->Apply(ScanArgs);
+
+// caches
+
+// Access trace over 2^20 keys whose popularity follows Zipf's law with
+// exponent 0.99: key rank r is drawn with probability proportional to
+// 1 / r^0.99, by binary search in the cumulative distribution
+static const std::vector<int> &ZipfTrace() {
+  static const std::vector<int> trace = [] {
+    const size_t keys = 1 << 20;
+    std::vector<double> cumulative(keys);
+    double total = 0;
+    for (size_t rank = 0; rank < keys; ++rank) {
+      total += 1.0 / std::pow(static_cast<double>(rank + 1), 0.99);
+      cumulative[rank] = total;
+    }
+    std::mt19937_64 random(42);
+    std::uniform_real_distribution<double> uniform(0.0, total);
+    std::vector<int> result(1 << 20);
+    for (int &key : result) {
+      double point = uniform(random);
+      size_t rank = std::lower_bound(cumulative.begin(), cumulative.end(),
+                                     point) -
+                    cumulative.begin();
+      key = SuiteKey(static_cast<long>(rank));
+    }
+    return result;
+  }();
+  return trace;
+}
+
+// The hand-built LRU lru_cache replaces: an s21::list in recency order and
+// an s21::map from key to list position. A hit erases and re-inserts the
+// list node, since s21::list cannot splice a single node
+class ComposedLru {
+ public:
+  explicit ComposedLru(size_t capacity) : capacity_(capacity) {}
+
+  int *get(int key) {
+    auto found = index_.find(key);
+    if (found == index_.end()) return nullptr;
+    std::pair<int, int> item = *found->second;
+    order_.erase(found->second);
+    order_.push_front(item);
+    found->second = order_.begin();
+    return &(*order_.begin()).second;
+  }
+
+  void put(int key, int value) {
+    if (order_.size() == capacity_) {
+      index_.erase(index_.find(order_.back().first));
+      order_.pop_back();
+    }
+    order_.push_front({key, value});
+    index_.insert(key, order_.begin());
+  }
+
+ private:
+  size_t capacity_;
+  s21::list<std::pair<int, int>> order_;
+  s21::map<int, s21::list<std::pair<int, int>>::iterator> index_;
+};
+
+// The same with std::list::splice and std::unordered_map
+class StdLru {
+ public:
+  explicit StdLru(size_t capacity) : capacity_(capacity) {}
+
+  int *get(int key) {
+    auto found = index_.find(key);
+    if (found == index_.end()) return nullptr;
+    order_.splice(order_.begin(), order_, found->second);
+    return &found->second->second;
+  }
+
+  void put(int key, int value) {
+    if (order_.size() == capacity_) {
+      index_.erase(order_.back().first);
+      order_.pop_back();
+    }
+    order_.emplace_front(key, value);
+    index_[key] = order_.begin();
+  }
+
+ private:
+  size_t capacity_;
+  std::list<std::pair<int, int>> order_;
+  std::unordered_map<int, std::list<std::pair<int, int>>::iterator> index_;
+};
+
+// Read-through use of a cache of range(0) entries: every access is a get,
+// followed by a put on a miss
+template <typename Cache>
+static void BM_CacheZipf(benchmark::State &state) {
+  const std::vector<int> &trace = ZipfTrace();
+  Cache cache(static_cast<size_t>(state.range(0)));
+  size_t next = 0;
+  long hits = 0;
+  for (auto _ : state) {
+    const int key = trace[next];
+    if (cache.get(key) != nullptr) {
+      ++hits;
+    } else {
+      cache.put(key, key);
+    }
+    next = (next + 1) & (trace.size() - 1);
+  }
+  state.SetItemsProcessed(state.iterations());
+  state.counters["hit_ratio"] =
+      static_cast<double>(hits) / static_cast<double>(state.iterations());
+}
+
+static void CacheArgs(benchmark::internal::Benchmark *bench) {
+  for (long capacity : {1L << 10, 1L << 14, 1L << 17}) bench->Arg(capacity);
+}
+
+BENCHMARK_TEMPLATE(BM_CacheZipf, s21::lru_cache<int, int>)->Apply(CacheArgs);
+BENCHMARK_TEMPLATE(BM_CacheZipf, s21::lfu_cache<int, int>)->Apply(CacheArgs);
+BENCHMARK_TEMPLATE(BM_CacheZipf, ComposedLru)->Apply(CacheArgs);
+BENCHMARK_TEMPLATE(BM_CacheZipf, StdLru)->Apply(CacheArgs);
+
+// intrusive containers
+
+// Object of an arena, 80 bytes with its hooks
+struct ArenaRecord {
+  int key;
+  int value;
+  char payload[24];
+  s21::list_hook<ArenaRecord> order;
+  s21::set_hook<ArenaRecord> by_key;
+};
+
+struct ArenaRecordLess {
+  bool operator()(const ArenaRecord &a, const ArenaRecord &b) const {
+    return a.key < b.key;
+  }
+};
+
+static std::vector<ArenaRecord> MakeArena(long n) {
+  std::vector<ArenaRecord> arena(n);
+  for (long i = 0; i < n; ++i) {
+    arena[i].key = SuiteKey(i);
+    arena[i].value = static_cast<int>(i);
+  }
+  return arena;
+}
+
+// Indexes every record of an arena of range(0) records and drops the index:
+// an intrusive container links the records where they are, an owning one
+// copies each into a node of its own
+template <typename Index>
+static void BM_IndexArenaSet(benchmark::State &state) {
+  std::vector<ArenaRecord> arena = MakeArena(state.range(0));
+  for (auto _ : state) {
+    Index index;
+    for (ArenaRecord &record : arena) index.insert(record);
+    benchmark::DoNotOptimize(index.size());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename Index>
+static void BM_IndexArenaList(benchmark::State &state) {
+  std::vector<ArenaRecord> arena = MakeArena(state.range(0));
+  for (auto _ : state) {
+    Index index;
+    for (ArenaRecord &record : arena) index.push_back(record);
+    benchmark::DoNotOptimize(index.size());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void ArenaArgs(benchmark::internal::Benchmark *bench) {
+  for (long n : {1L << 20, 10000000L}) {
+    if (n <= SuiteMaxSize()) bench->Arg(n);
+  }
+  bench->Unit(benchmark::kMillisecond);
+}
+
+using SafeRecordSet =
+    s21::intrusive_set<ArenaRecord, &ArenaRecord::by_key, ArenaRecordLess>;
+using NormalRecordSet =
+    s21::intrusive_set<ArenaRecord, &ArenaRecord::by_key, ArenaRecordLess,
+                       s21::link_mode::normal>;
+using SafeRecordList = s21::intrusive_list<ArenaRecord, &ArenaRecord::order>;
+using NormalRecordList =
+    s21::intrusive_list<ArenaRecord, &ArenaRecord::order,
+                        s21::link_mode::normal>;
+using OwningRecordSet = s21::set<ArenaRecord, ArenaRecordLess>;
+using StdRecordSet = std::set<ArenaRecord, ArenaRecordLess>;
+
+BENCHMARK_TEMPLATE(BM_IndexArenaSet, SafeRecordSet)->Apply(ArenaArgs);
+BENCHMARK_TEMPLATE(BM_IndexArenaSet, NormalRecordSet)->Apply(ArenaArgs);
+BENCHMARK_TEMPLATE(BM_IndexArenaSet, OwningRecordSet)->Apply(ArenaArgs);
+BENCHMARK_TEMPLATE(BM_IndexArenaSet, StdRecordSet)->Apply(ArenaArgs);
+BENCHMARK_TEMPLATE(BM_IndexArenaList, SafeRecordList)->Apply(ArenaArgs);
+BENCHMARK_TEMPLATE(BM_IndexArenaList, NormalRecordList)->Apply(ArenaArgs);
+BENCHMARK_TEMPLATE(BM_IndexArenaList, s21::list<ArenaRecord>)
+    ->Apply(ArenaArgs);
+BENCHMARK_TEMPLATE(BM_IndexArenaList, std::list<ArenaRecord>)
+    ->Apply(ArenaArgs);
+
+// priority queues
+
+// Event of a discrete-event simulation: its time and an id that keeps
+// events unique for the set-based queue
+using Event = std::pair<std::uint64_t, int>;
+
+// Event times are drawn from [0, 2^20) and every processed event schedules
+// its successor a random delay of up to 2^20 later
+static const std::vector<std::uint64_t> &HoldDelays() {
+  static const std::vector<std::uint64_t> delays = [] {
+    std::vector<std::uint64_t> result(1 << 16);
+    std::mt19937_64 engine(46);
+    for (std::uint64_t &delay : result) delay = engine() & ((1 << 20) - 1);
+    return result;
+  }();
+  return delays;
+}
+
+// The ordered-set queue a priority queue replaces: top is the first key
+struct SetEventQueue {
+  s21::set<Event> events;
+
+  void push(const Event &event) { events.insert(event); }
+  const Event &top() { return *events.begin(); }
+  void pop() { events.erase(events.begin()); }
+};
+
+// Fills a queue with range(0) events and runs as many hold steps, so that
+// timing starts at the steady state; a pairing heap starts out as a root
+// with every event as its child
+template <typename Queue>
+static void FillHoldQueue(Queue &queue, long n) {
+  const std::vector<std::uint64_t> &delays = HoldDelays();
+  for (int i = 0; i < n; ++i) {
+    queue.push(Event(delays[i & (delays.size() - 1)], i));
+  }
+  for (long i = 0; i < n; ++i) {
+    Event event = queue.top();
+    queue.pop();
+    event.first += delays[i & (delays.size() - 1)];
+    queue.push(event);
+  }
+}
+
+// Hold model: every iteration pops the earliest event and pushes its
+// successor
+template <typename Queue>
+static void BM_HoldModel(benchmark::State &state) {
+  const std::vector<std::uint64_t> &delays = HoldDelays();
+  Queue queue;
+  FillHoldQueue(queue, state.range(0));
+  size_t next = 0;
+  for (auto _ : state) {
+    Event event = queue.top();
+    queue.pop();
+    event.first += delays[next];
+    queue.push(event);
+    next = (next + 1) & (delays.size() - 1);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+// The same through replace_top, one sift per event
+template <typename Queue>
+static void BM_HoldModelFused(benchmark::State &state) {
+  const std::vector<std::uint64_t> &delays = HoldDelays();
+  Queue queue;
+  FillHoldQueue(queue, state.range(0));
+  size_t next = 0;
+  for (auto _ : state) {
+    Event event = queue.top();
+    event.first += delays[next];
+    queue.replace_top(event);
+    next = (next + 1) & (delays.size() - 1);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+static void HoldArgs(benchmark::internal::Benchmark *bench) {
+  for (long n : {1L << 10, 1L << 16, 1L << 20}) bench->Arg(n);
+}
+
+template <size_t Arity>
+using EventHeap = s21::priority_queue<Event, s21::vector<Event>,
+                                      std::greater<Event>, Arity>;
+using StdEventHeap =
+    std::priority_queue<Event, std::vector<Event>, std::greater<Event>>;
+using EventPairingHeap = s21::pairing_heap<Event, std::greater<Event>>;
+
+BENCHMARK_TEMPLATE(BM_HoldModel, EventHeap<2>)->Apply(HoldArgs);
+BENCHMARK_TEMPLATE(BM_HoldModel, EventHeap<4>)->Apply(HoldArgs);
+BENCHMARK_TEMPLATE(BM_HoldModelFused, EventHeap<4>)->Apply(HoldArgs);
+BENCHMARK_TEMPLATE(BM_HoldModel, StdEventHeap)->Apply(HoldArgs);
+BENCHMARK_TEMPLATE(BM_HoldModel, EventPairingHeap)->Apply(HoldArgs);
+BENCHMARK_TEMPLATE(BM_HoldModel, SetEventQueue)->Apply(HoldArgs);
+
+// fixed-capacity containers
+
+// Containers sized for the largest workload; the steady-state queue holds
+// one element more than range(0) between its push and pop
+
+// Short-lived scratch vector of range(0) elements: filled, summed and
+// dropped, as in a per-request hot path
+template <typename Vector>
+static void BM_SmallVectorScratch(benchmark::State &state) {
+  const int count = static_cast<int>(state.range(0));
+  for (auto _ : state) {
+    Vector vec;
+    for (int i = 0; i < count; ++i) vec.push_back(i);
+    long sum = 0;
+    for (int value : vec) sum += value;
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * count);
+}
+
+static void SmallArgs(benchmark::internal::Benchmark *bench) {
+  for (long n : {8, 16, 32, 64}) bench->Arg(n);
+}
+
+BENCHMARK_TEMPLATE(BM_SmallVectorScratch, s21::static_vector<int, 64>)
+    ->Apply(SmallArgs);
+BENCHMARK_TEMPLATE(BM_SmallVectorScratch, s21::vector<int>)->Apply(SmallArgs);
+BENCHMARK_TEMPLATE(BM_SmallVectorScratch, std::vector<int>)->Apply(SmallArgs);
+BENCHMARK_TEMPLATE(BM_QueuePushPop, s21::static_queue<int, 128>)
+    ->Apply(SmallArgs);
+BENCHMARK_TEMPLATE(BM_QueuePushPop, s21::queue<int>)->Apply(SmallArgs);
+BENCHMARK_TEMPLATE(BM_QueueSteadyState, s21::static_queue<int, 128>)
+    ->Apply(SmallArgs);
+BENCHMARK_TEMPLATE(BM_QueueSteadyState, s21::queue<int>)->Apply(SmallArgs);
+
+// id sets
+
+// range(0) distinct ids drawn from [0, 2^24)
+static s21::set<uint32_t> RandomIds(long n, unsigned seed) {
+  s21::set<uint32_t> ids;
+  std::mt19937 engine(seed);
+  while (static_cast<long>(ids.size()) < n) ids.insert(engine() & 0xFFFFFF);
+  return ids;
+}
+
+// The same number of ids in runs of 256 consecutive ones, as ids handed out
+// in blocks come
+static s21::set<uint32_t> ClusteredIds(long n, unsigned seed) {
+  s21::set<uint32_t> ids;
+  std::mt19937 engine(seed);
+  while (static_cast<long>(ids.size()) < n) {
+    uint32_t start = engine() & 0xFFFF00;
+    for (uint32_t id = start; id < start + 256; ++id) ids.insert(id);
+  }
+  return ids;
+}
+
+// Random ids, or clustered ones when range(1) is 1
+static s21::set<uint32_t> Ids(benchmark::State &state, unsigned seed) {
+  return state.range(1) ? ClusteredIds(state.range(0), seed)
+                        : RandomIds(state.range(0), seed);
+}
+
+static std::set<uint32_t> StdIds(benchmark::State &state, unsigned seed) {
+  std::set<uint32_t> ids;
+  Ids(state, seed).for_each([&](uint32_t id) { ids.insert(id); });
+  return ids;
+}
+
+// libstdc++ red-black nodes: color, parent, left and right before the value
+static const double kStdSetBytesPerId = 4 * sizeof(void *) + sizeof(uint32_t);
+
+// Size of the intersection of two id sets: a lookup in one per id of the
+// other, and the heap node of every id
+static void BM_IdIntersectSet(benchmark::State &state) {
+  s21::set<uint32_t> first = Ids(state, 1);
+  s21::set<uint32_t> second = Ids(state, 2);
+  for (auto _ : state) {
+    size_t common = 0;
+    first.for_each([&](uint32_t id) { common += second.contains(id); });
+    benchmark::DoNotOptimize(common);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+  state.counters["bytes_per_id"] = sizeof(s21::Node<uint32_t, uint32_t>);
+}
+
+// A merge walk of the two trees
+static void BM_IdIntersectStdSet(benchmark::State &state) {
+  std::set<uint32_t> first = StdIds(state, 1);
+  std::set<uint32_t> second = StdIds(state, 2);
+  std::vector<uint32_t> common;
+  common.reserve(first.size());
+  for (auto _ : state) {
+    common.clear();
+    std::set_intersection(first.begin(), first.end(), second.begin(),
+                          second.end(), std::back_inserter(common));
+    benchmark::DoNotOptimize(common.size());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+  state.counters["bytes_per_id"] = kStdSetBytesPerId;
+}
+
+// The same over bitsets of the whole id range: a copy, an and and a count
+// of 2^18 words
+static void BM_IdIntersectBitset(benchmark::State &state) {
+  s21::dynamic_bitset first(Ids(state, 1));
+  s21::dynamic_bitset second(Ids(state, 2));
+  first.resize(1 << 24);
+  second.resize(1 << 24);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize((first & second).count());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+  state.counters["bytes_per_id"] =
+      static_cast<double>(first.memory_usage()) / state.range(0);
+}
+
+// Chunk by chunk over roaring sets, optimized as a built set of ids would be
+static void BM_IdIntersectRoaring(benchmark::State &state) {
+  s21::roaring_set first(Ids(state, 1));
+  s21::roaring_set second(Ids(state, 2));
+  first.optimize();
+  second.optimize();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize((first & second).size());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+  state.counters["bytes_per_id"] =
+      static_cast<double>(first.memory_usage()) / state.range(0);
+}
+
+// Union into a copy of the first set: an insertion per id of the second
+static void BM_IdUnionSet(benchmark::State &state) {
+  s21::set<uint32_t> first = Ids(state, 1);
+  s21::set<uint32_t> second = Ids(state, 2);
+  for (auto _ : state) {
+    s21::set<uint32_t> either(first);
+    second.for_each([&](uint32_t id) { either.insert(id); });
+    benchmark::DoNotOptimize(either.size());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void BM_IdUnionStdSet(benchmark::State &state) {
+  std::set<uint32_t> first = StdIds(state, 1);
+  std::set<uint32_t> second = StdIds(state, 2);
+  std::vector<uint32_t> either;
+  either.reserve(first.size() + second.size());
+  for (auto _ : state) {
+    either.clear();
+    std::set_union(first.begin(), first.end(), second.begin(), second.end(),
+                   std::back_inserter(either));
+    benchmark::DoNotOptimize(either.size());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void BM_IdUnionRoaring(benchmark::State &state) {
+  s21::roaring_set first(Ids(state, 1));
+  s21::roaring_set second(Ids(state, 2));
+  first.optimize();
+  second.optimize();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize((first | second).size());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void IdSetArgs(benchmark::internal::Benchmark *bench) {
+  for (long clustered : {0L, 1L}) {
+    for (long n : {1L << 14, 1L << 17, 1L << 20}) bench->Args({n, clustered});
+  }
+  bench->Unit(benchmark::kMicrosecond);
+}
+
+BENCHMARK(BM_IdIntersectSet)->Apply(IdSetArgs);
+BENCHMARK(BM_IdIntersectStdSet)->Apply(IdSetArgs);
+BENCHMARK(BM_IdIntersectBitset)->Apply(IdSetArgs);
+BENCHMARK(BM_IdIntersectRoaring)->Apply(IdSetArgs);
+BENCHMARK(BM_IdUnionSet)->Apply(IdSetArgs);
+BENCHMARK(BM_IdUnionStdSet)->Apply(IdSetArgs);
+BENCHMARK(BM_IdUnionRoaring)->Apply(IdSetArgs);
+
+// request-scoped arenas
+
+// A request of range(0) random ids: collected in a vector, a list and a
+// deque, deduplicated in a set and an unordered_set, counted in a map and an
+// unordered_map and handed out through a queue, then all dropped. Alloc is
+// the allocator every container is built with
+template <typename Alloc>
+static long ServeRequest(int count, std::mt19937 &engine, const Alloc &alloc) {
+  using Pairs = typename std::allocator_traits<Alloc>::template rebind_alloc<
+      std::pair<const int, int>>;
+  s21::vector<int, Alloc> ids(alloc);
+  s21::list<int, Alloc> history(alloc);
+  s21::set<int, std::less<int>, Alloc> seen(alloc);
+  s21::map<int, int, std::less<int>, Pairs> hits(alloc);
+  s21::queue<int, s21::ring_buffer<int, Alloc>> pending(alloc);
+  s21::deque<int, Alloc> recent(alloc);
+  s21::unordered_set<int, std::hash<int>, std::equal_to<int>, Alloc> known(
+      alloc);
+  s21::unordered_map<int, int, std::hash<int>, std::equal_to<int>, Pairs>
+      counts(alloc);
+  for (int i = 0; i < count; ++i) {
+    int id = static_cast<int>(engine() % (count / 2 + 1));
+    ids.push_back(id);
+    history.push_back(id);
+    recent.push_front(id);
+    if (seen.insert(id).second) pending.push(id);
+    known.insert(id);
+    ++hits[id];
+    ++counts[id];
+  }
+  long total = static_cast<long>(ids.size() + history.size() + recent.size() +
+                                 known.size());
+  while (!pending.empty()) {
+    total += hits.at(pending.front()) + counts.at(pending.front());
+    pending.pop();
+  }
+  return total;
+}
+
+// Every container on the heap through std::allocator
+static void BM_RequestHeap(benchmark::State &state) {
+  const int count = static_cast<int>(state.range(0));
+  std::mt19937 engine(7);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        ServeRequest(count, engine, std::allocator<int>()));
+  }
+  state.SetItemsProcessed(state.iterations() * count);
+}
+
+// The same through polymorphic allocators over the default resource: the
+// cost of the virtual calls alone
+static void BM_RequestPmrHeap(benchmark::State &state) {
+  const int count = static_cast<int>(state.range(0));
+  std::mt19937 engine(7);
+  std::pmr::polymorphic_allocator<int> alloc(std::pmr::get_default_resource());
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(ServeRequest(count, engine, alloc));
+  }
+  state.SetItemsProcessed(state.iterations() * count);
+}
+
+// A monotonic arena over a buffer kept between requests: deallocations are
+// no-ops and release() rewinds it once the request is over
+static void BM_RequestArena(benchmark::State &state) {
+  const int count = static_cast<int>(state.range(0));
+  std::mt19937 engine(7);
+  std::vector<std::byte> buffer(1 << 20);
+  std::pmr::monotonic_buffer_resource arena(buffer.data(), buffer.size());
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(ServeRequest(
+        count, engine, std::pmr::polymorphic_allocator<int>(&arena)));
+    arena.release();
+  }
+  state.SetItemsProcessed(state.iterations() * count);
+}
+
+static void RequestArgs(benchmark::internal::Benchmark *bench) {
+  for (long n : {16, 128, 1024}) bench->Arg(n);
+}
+
+BENCHMARK(BM_RequestHeap)->Apply(RequestArgs);
+BENCHMARK(BM_RequestPmrHeap)->Apply(RequestArgs);
+BENCHMARK(BM_RequestArena)->Apply(RequestArgs);
+
+// cold start: filling a map from a file written by serialize_file
+
+// Serialized map<int, int> of n elements with even keys, written once per
+// size into the temporary directory
+static std::string ColdStartFile(long n) {
+  const char *dir = std::getenv("TMPDIR");
+  std::string path = std::string(dir ? dir : "/tmp") + "/s21_cold_start_" +
+                     std::to_string(n) + ".bin";
+  if (std::ifstream(path).good()) return path;
+  s21::vector<std::pair<int, int>> records;
+  records.reserve(n);
+  for (long i = 0; i < n; ++i) {
+    records.push_back({static_cast<int>(2 * i), static_cast<int>(i)});
+  }
+  s21::map<int, int> map;
+  map.assign_sorted(records.begin(), records.end());
+  s21::serialize_file(path, map);
+  return path;
+}
+
+// The records read in place from the mapping and inserted one at a time
+static void BM_ColdStartInsert(benchmark::State &state) {
+  const std::string path = ColdStartFile(state.range(0));
+  for (auto _ : state) {
+    s21::map_view<int, int> records(path);
+    s21::map<int, int> map;
+    for (size_t i = 0; i < records.size(); ++i) {
+      map.insert(records.keys()[i], records.values()[i]);
+    }
+    benchmark::DoNotOptimize(map.size());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// deserialize from an ifstream: bulk reads, then the O(n) tree build
+static void BM_ColdStartStream(benchmark::State &state) {
+  const std::string path = ColdStartFile(state.range(0));
+  for (auto _ : state) {
+    std::ifstream in(path, std::ios::binary);
+    s21::map<int, int> map;
+    s21::deserialize(in, map);
+    benchmark::DoNotOptimize(map.size());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// deserialize_file: the tree built straight from the mapping
+static void BM_ColdStartMapped(benchmark::State &state) {
+  const std::string path = ColdStartFile(state.range(0));
+  for (auto _ : state) {
+    s21::map<int, int> map;
+    s21::deserialize_file(path, map);
+    benchmark::DoNotOptimize(map.size());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// A read-only map_view: opening maps the file, a first lookup touches a
+// handful of pages
+static void BM_ColdStartView(benchmark::State &state) {
+  const std::string path = ColdStartFile(state.range(0));
+  for (auto _ : state) {
+    s21::map_view<int, int> view(path);
+    benchmark::DoNotOptimize(view.at(static_cast<int>(state.range(0))));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// 1M, 8M and, when S21_BENCH_MAX_SIZE allows it, the 50M of the request
+static void ColdStartArgs(benchmark::internal::Benchmark *bench) {
+  for (long n : {1L << 20, 1L << 23, 50000000L}) {
+    if (n <= SuiteMaxSize()) bench->Arg(n);
+  }
+}
+
+BENCHMARK(BM_ColdStartInsert)
+    ->Apply(ColdStartArgs)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_ColdStartStream)
+    ->Apply(ColdStartArgs)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_ColdStartMapped)
+    ->Apply(ColdStartArgs)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_ColdStartView)
+    ->Apply(ColdStartArgs)
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
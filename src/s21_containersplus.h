@@ -2,5 +2,32 @@
 #define S21_CONTAINERSPLUS_H
 
 #include "Array/s21_array.hpp"
+#include "BTreeMap/s21_btree_map.h"
+#include "BTreeSet/s21_btree_set.h"
+#include "Bitset/s21_bitset.h"
+#include "Cache/s21_cache.h"
+#include "CompactMap/s21_compact_map.h"
+#include "CompactSet/s21_compact_set.h"
+#include "ConcurrentMap/s21_concurrent_map.h"
+#include "Deque/s21_deque.h"
+#include "DynamicBitset/s21_dynamic_bitset.h"
+#include "IntrusiveList/s21_intrusive_list.h"
+#include "IntrusiveSet/s21_intrusive_set.h"
+#include "MpmcQueue/s21_mpmc_queue.h"
+#include "Multimap/s21_multimap.cpp"
+#include "Multiset/s21_multiset.cpp"
+#include "PairingHeap/s21_pairing_heap.h"
+#include "PersistentMap/s21_persistent_map.h"
+#include "PersistentSet/s21_persistent_set.h"
+#include "PriorityQueue/s21_priority_queue.h"
+#include "RoaringSet/s21_roaring_set.h"
+#include "Serialization/s21_serialization.h"
+#include "SpscQueue/s21_spsc_queue.h"
+#include "StaticQueue/s21_static_queue.h"
+#include "StaticVector/s21_static_vector.h"
+#include "ThreadPool/s21_thread_pool.h"
+#include "UnorderedMap/s21_unordered_map.h"
+#include "UnorderedSet/s21_unordered_set.h"
+#include "WorkStealingDeque/s21_work_stealing_deque.h"
 
 #endif  // S21_CONTAINERSPLUS_H
\ No newline at end of file
@@ -1,13 +1,26 @@
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <array>
+#include <atomic>
+#include <bitset>
+#include <cstdio>
 #include <deque>
 #include <iostream>
 #include <list>
 #include <map>
+#include <memory>
+#include <memory_resource>
+#include <optional>
 #include <queue>
 #include <set>
+#include <sstream>
 #include <stack>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
@@ -213,6 +226,22 @@ TEST(test_modifiers_array, test_2) {
 }
 
 // set
+// Checks parent links, cached heights and sizes and the AVL balance of a
+// subtree, returns its size
+template <typename Node>
+size_t CheckSubtree(const Node *node, const Node *parent) {
+  if (node == nullptr) return 0;
+  EXPECT_EQ(node->parent, parent);
+  size_t size = CheckSubtree(node->left, node) + 1 +
+                CheckSubtree(node->right, node);
+  int left = node->left ? node->left->height : 0;
+  int right = node->right ? node->right->height : 0;
+  EXPECT_EQ(node->height, std::max(left, right) + 1);
+  EXPECT_LE(std::abs(left - right), 1);
+  EXPECT_EQ(node->size_, size);
+  return size;
+}
+
 TEST(setTest, Default) {
   s21::set<int> s;
   EXPECT_TRUE(s.empty());
@@ -290,6 +319,29 @@ TEST(setTest, Find) {
   EXPECT_EQ(it2, s.end());
 }
 
+TEST(setTest, RebalancesOnInsertAndErase) {
+  s21::set<int> s;
+  std::set<int> expected;
+  // Ascending and zigzag keys need single and double rotations
+  for (int i = 0; i < 1000; ++i) {
+    int key = i % 2 ? i : 2000 - i;
+    s.insert(key);
+    expected.insert(key);
+  }
+  for (int key = 0; key < 2000; key += 3) {
+    auto it = s.find(key);
+    if (it != s.end()) s.erase(it);
+    expected.erase(key);
+  }
+  ASSERT_EQ(s.size(), expected.size());
+  ASSERT_TRUE(std::equal(expected.begin(), expected.end(), s.begin()));
+  const auto *root = s.get_tree().GetRoot();
+  EXPECT_EQ(root->parent, nullptr);
+  EXPECT_EQ(root->size_, expected.size());
+  // AVL height bound: 1.44 * log2(n + 2)
+  EXPECT_LE(root->height, 13);
+}
+
 TEST(setTest, Remove) {
   s21::AVLTree<int, int> tree;
   tree.Insert(5);
@@ -315,6 +367,143 @@ TEST(AVLTreeTest, RemoveTest) {
   tree.Remove(50);
 }
 
+TEST(setTest, MatchesStdSet) {
+  s21::set<int> s;
+  std::set<int> expected;
+  unsigned seed = 12345;
+  for (int i = 0; i < 20000; ++i) {
+    seed = seed * 1103515245 + 12345;
+    int key = static_cast<int>((seed >> 8) % 2000);
+    if (seed % 3 == 0) {
+      auto it = s.find(key);
+      if (it != s.end()) s.erase(it);
+      expected.erase(key);
+    } else {
+      ASSERT_EQ(s.insert(key).second, expected.insert(key).second);
+    }
+  }
+  ASSERT_EQ(s.size(), expected.size());
+  ASSERT_TRUE(std::equal(expected.begin(), expected.end(), s.begin()));
+  // AVL height bound: 1.44 * log2(n + 2)
+  ASSERT_LE(s.get_tree().GetRoot()->height, 16);
+}
+
+TEST(setTest, CustomCompare) {
+  s21::set<int, std::greater<int>> s{1, 3, 2};
+  ASSERT_EQ(*s.begin(), 3);
+  ASSERT_FALSE(s.insert(2).second);
+  ASSERT_TRUE(s.contains(1));
+}
+
+TEST(setTest, TransparentLookup) {
+  s21::set<std::string, std::less<>> s{"apple", "pear", "plum"};
+  std::string_view probe = "pear";
+  ASSERT_TRUE(s.contains(probe));
+  ASSERT_EQ(*s.find(probe), "pear");
+  ASSERT_FALSE(s.contains(std::string_view("fig")));
+  ASSERT_EQ(s.find("fig"), s.end());
+}
+
+TEST(setTest, Bounds) {
+  s21::set<int> s{10, 20, 30, 40};
+  EXPECT_EQ(*s.lower_bound(20), 20);
+  EXPECT_EQ(*s.lower_bound(21), 30);
+  EXPECT_EQ(*s.upper_bound(20), 30);
+  EXPECT_EQ(s.lower_bound(41), s.end());
+  EXPECT_EQ(s.upper_bound(40), s.end());
+  EXPECT_EQ(*s.upper_bound(5), 10);
+
+  auto hit = s.equal_range(30);
+  EXPECT_EQ(*hit.first, 30);
+  EXPECT_EQ(*hit.second, 40);
+  auto miss = s.equal_range(25);
+  EXPECT_EQ(miss.first, miss.second);
+  EXPECT_EQ(*miss.first, 30);
+}
+
+TEST(setTest, RangeView) {
+  s21::set<int> s;
+  for (int i = 0; i < 100; ++i) s.insert(i * 2);
+  int sum = 0;
+  int count = 0;
+  for (int key : s.range(11, 21)) {
+    sum += key;
+    ++count;
+  }
+  EXPECT_EQ(count, 5);
+  EXPECT_EQ(sum, 12 + 14 + 16 + 18 + 20);
+  EXPECT_TRUE(s.range(201, 300).empty());
+  EXPECT_TRUE(s.range(13, 13).empty());
+}
+
+// The copy is a separate tree of the same shape: its parent links stay
+// inside it and updates on either side do not show on the other
+TEST(setTest, CopyPreservesStructure) {
+  s21::set<int> source;
+  for (int i = 0; i < 2000; ++i) source.insert(i * 37 % 2003);
+  for (int i = 0; i < 2000; i += 3) source.erase(source.find(i));
+  s21::set<int> copy(source);
+  const auto *root = copy.get_tree().GetRoot();
+  EXPECT_EQ(CheckSubtree(root, decltype(root)()), source.size());
+  EXPECT_NE(root, source.get_tree().GetRoot());
+  EXPECT_EQ(root->height, source.get_tree().GetRoot()->height);
+
+  copy.insert(-1);
+  source.erase(source.begin());
+  EXPECT_EQ(*copy.begin(), -1);
+  EXPECT_EQ(copy.size(), source.size() + 2);
+
+  s21::set<int> assigned{5, 6};
+  assigned = copy;
+  for (auto it = copy.begin(), other = assigned.begin(); it != copy.end();
+       ++it, ++other) {
+    ASSERT_EQ(*it, *other);
+  }
+  assigned = static_cast<const s21::set<int> &>(assigned);
+  EXPECT_EQ(assigned.size(), copy.size());
+  CheckSubtree(assigned.get_tree().GetRoot(), decltype(root)());
+}
+
+TEST(setTest, ReverseIterationFromEnd) {
+  s21::set<int> s;
+  for (int i = 0; i < 100; ++i) s.insert(i);
+  EXPECT_EQ(*--s.end(), 99);
+  int expected = 100;
+  for (auto it = s.end(); it != s.begin();) EXPECT_EQ(*--it, --expected);
+  EXPECT_EQ(expected, 0);
+
+  // An iterator stepped past the last element finds its way back
+  auto it = s.find(99);
+  ++it;
+  EXPECT_EQ(it, s.end());
+  EXPECT_EQ(*--it, 99);
+  EXPECT_EQ(*--s.upper_bound(99), 99);
+}
+
+TEST(setTest, ForEachAndVisitRange) {
+  s21::set<int> s;
+  std::vector<int> expected;
+  for (int i = 0; i < 2000; ++i) s.insert(i * 7919 % 10007);
+  for (int key : s) expected.push_back(key);
+
+  std::vector<int> visited;
+  s.for_each([&visited](int key) { visited.push_back(key); });
+  EXPECT_EQ(visited, expected);
+
+  for (int first : {expected[0] - 1, expected[17], expected[17] + 1}) {
+    int last = expected[1500];
+    visited.clear();
+    s.visit_range(first, last, [&visited](int key) { visited.push_back(key); });
+    std::vector<int> bounded;
+    for (int key : s.range(first, last)) bounded.push_back(key);
+    EXPECT_EQ(visited, bounded);
+  }
+  visited.clear();
+  s.visit_range(5, 5, [&visited](int key) { visited.push_back(key); });
+  s21::set<int>().for_each([&visited](int key) { visited.push_back(key); });
+  EXPECT_TRUE(visited.empty());
+}
+
 // map
 TEST(mapTest, Default) {
   s21::map<int, std::string> m;
@@ -469,6 +658,1111 @@ TEST(mapTest, Contains) {
   EXPECT_FALSE(map.contains(3));
 }
 
+TEST(mapTest, FindAndBounds) {
+  s21::map<int, std::string> map{{1, "a"}, {3, "c"}, {5, "e"}, {7, "g"}};
+  EXPECT_EQ(map.find(3)->second, "c");
+  EXPECT_EQ(map.find(4), map.end());
+  EXPECT_EQ(map.lower_bound(4)->first, 5);
+  EXPECT_EQ(map.upper_bound(5)->first, 7);
+  EXPECT_EQ(map.upper_bound(7), map.end());
+
+  auto range = map.equal_range(5);
+  EXPECT_EQ(range.first->first, 5);
+  EXPECT_EQ(range.second->first, 7);
+
+  std::string letters;
+  for (auto &item : map.range(2, 7)) letters += item.second;
+  EXPECT_EQ(letters, "ce");
+}
+
+TEST(mapTest, CompareAndTransparentLookup) {
+  s21::map<std::string, int, std::less<>> map;
+  for (int i = 0; i < 1000; ++i) map[std::to_string(i)] = i;
+  EXPECT_EQ(map.size(), 1000u);
+  EXPECT_TRUE(map.contains(std::string_view("999")));
+  EXPECT_FALSE(map.contains(std::string_view("1000")));
+  EXPECT_EQ(map.begin()->first, "0");
+
+  s21::map<int, int, std::greater<int>> reversed{{1, 1}, {3, 3}, {2, 2}};
+  EXPECT_EQ(reversed.begin()->first, 3);
+  EXPECT_EQ(reversed.at(2), 2);
+}
+
+TEST(mapTest, CopyAssignment) {
+  s21::map<int, std::string> source;
+  for (int i = 0; i < 500; ++i) source.insert(i, std::to_string(i));
+  s21::map<int, std::string> target{{1, "old"}, {1000, "gone"}};
+  target = source;
+  EXPECT_EQ(target.size(), 500u);
+  EXPECT_EQ(target.at(1), "1");
+  EXPECT_FALSE(target.contains(1000));
+  target[7] = "seven";
+  EXPECT_EQ(source.at(7), "7");
+  CheckSubtree(target.get_tree().GetRoot(),
+               decltype(target.get_tree().GetRoot())());
+
+  s21::map<int, std::string> moved;
+  moved = std::move(target);
+  EXPECT_EQ(moved.at(7), "seven");
+  EXPECT_TRUE(target.empty());
+}
+
+TEST(mapTest, ScansInKeyOrder) {
+  s21::map<int, std::string> map;
+  for (int i = 9; i >= 0; --i) map.insert(i, std::string(1, 'a' + i));
+  std::string letters;
+  map.for_each([&letters](const std::pair<const int, std::string> &item) {
+    letters += item.second;
+  });
+  EXPECT_EQ(letters, "abcdefghij");
+  letters.clear();
+  map.visit_range(3, 7, [&letters](const auto &item) {
+    letters += item.second;
+  });
+  EXPECT_EQ(letters, "defg");
+  EXPECT_EQ((--map.end())->second, "j");
+}
+
+// multiset / multimap
+TEST(multisetTest, MatchesStdMultiset) {
+  s21::multiset<int> s;
+  std::multiset<int> expected;
+  unsigned seed = 777;
+  for (int i = 0; i < 20000; ++i) {
+    seed = seed * 1103515245 + 12345;
+    int key = static_cast<int>((seed >> 8) % 300);
+    switch (seed % 7) {
+      case 0:
+        ASSERT_EQ(s.erase(key), expected.erase(key));
+        break;
+      case 1: {
+        auto it = s.find(key);
+        if (it != s.end()) s.erase(it);
+        auto std_it = expected.find(key);
+        if (std_it != expected.end()) expected.erase(std_it);
+        break;
+      }
+      default:
+        ASSERT_EQ(*s.insert(key), key);
+        expected.insert(key);
+    }
+    ASSERT_EQ(s.count(key), expected.count(key));
+  }
+  ASSERT_EQ(s.size(), expected.size());
+  ASSERT_TRUE(std::equal(expected.begin(), expected.end(), s.begin()));
+  CheckSubtree(s.get_tree().GetRoot(), decltype(s.get_tree().GetRoot())());
+}
+
+TEST(multisetTest, EraseAllDuplicates) {
+  s21::multiset<int> s;
+  for (int i = 0; i < 1000; ++i) s.insert(i % 10 == 0 ? 5 : i);
+  size_t before = s.size();
+  EXPECT_EQ(s.count(5), 101u);
+  EXPECT_EQ(s.erase(5), 101u);
+  EXPECT_EQ(s.erase(5), 0u);
+  EXPECT_EQ(s.size(), before - 101);
+  EXPECT_FALSE(s.contains(5));
+  EXPECT_EQ(*s.lower_bound(5), 6);
+  CheckSubtree(s.get_tree().GetRoot(), decltype(s.get_tree().GetRoot())());
+
+  s21::multiset<int> same{3, 3, 3};
+  EXPECT_EQ(same.erase(3), 3u);
+  EXPECT_TRUE(same.empty());
+  EXPECT_EQ(same.begin(), same.end());
+}
+
+TEST(multisetTest, EqualRangeAndMerge) {
+  s21::multiset<int> s{4, 1, 4, 2, 4};
+  auto range = s.equal_range(4);
+  int count = 0;
+  for (auto it = range.first; it != range.second; ++it, ++count) {
+    EXPECT_EQ(*it, 4);
+  }
+  EXPECT_EQ(count, 3);
+  EXPECT_EQ(range.second, s.end());
+  EXPECT_EQ(*s.upper_bound(1), 2);
+
+  s21::multiset<int> other{1, 4};
+  s.merge(other);
+  EXPECT_TRUE(other.empty());
+  EXPECT_EQ(s.size(), 7u);
+  EXPECT_EQ(s.count(4), 4u);
+  EXPECT_EQ(s.count(1), 2u);
+
+  s21::multiset<int> copy(s);
+  std::multiset<int> expected{1, 1, 2, 4, 4, 4, 4};
+  EXPECT_EQ(copy.size(), expected.size());
+  EXPECT_TRUE(std::equal(expected.begin(), expected.end(), copy.begin()));
+}
+
+TEST(multimapTest, KeepsInsertionOrderOfEqualKeys) {
+  s21::multimap<int, std::string> m{{2, "b"}, {1, "a"}, {2, "c"}};
+  m.insert(2, "d");
+  m.insert(3, "e");
+  EXPECT_EQ(m.size(), 5u);
+  EXPECT_EQ(m.count(2), 3u);
+  EXPECT_EQ(m.find(2)->second, "b");
+
+  std::string values;
+  for (auto &item : m.range(2, 3)) values += item.second;
+  EXPECT_EQ(values, "bcd");
+
+  EXPECT_EQ(m.erase(2), 3u);
+  EXPECT_EQ(m.size(), 2u);
+  EXPECT_EQ(m.begin()->second, "a");
+  EXPECT_EQ(m.lower_bound(2)->second, "e");
+}
+
+TEST(multimapTest, MatchesStdMultimap) {
+  s21::multimap<int, int> m;
+  std::multimap<int, int> expected;
+  unsigned seed = 4242;
+  for (int i = 0; i < 10000; ++i) {
+    seed = seed * 1103515245 + 12345;
+    int key = static_cast<int>((seed >> 8) % 100);
+    if (seed % 5 == 0) {
+      ASSERT_EQ(m.erase(key), expected.erase(key));
+    } else {
+      m.insert(key, i);
+      expected.emplace(key, i);
+    }
+  }
+  ASSERT_EQ(m.size(), expected.size());
+  auto it = m.begin();
+  for (auto &item : expected) {
+    ASSERT_EQ(it->first, item.first);
+    ASSERT_EQ(it->second, item.second);
+    ++it;
+  }
+  CheckSubtree(m.get_tree().GetRoot(), decltype(m.get_tree().GetRoot())());
+}
+
+// unordered_set / unordered_map
+// Has no move constructor, so containers that grow with move_if_noexcept
+// copy it; the copy throws once copies_left runs out
+struct ThrowingCopy {
+  static int live;
+  static int copies_left;
+  int value;
+  explicit ThrowingCopy(int v) : value(v) { ++live; }
+  ThrowingCopy(const ThrowingCopy &other) : value(other.value) {
+    if (copies_left-- == 0) throw std::runtime_error("copy failed");
+    ++live;
+  }
+  ThrowingCopy &operator=(const ThrowingCopy &other) = default;
+  ~ThrowingCopy() { --live; }
+};
+int ThrowingCopy::live = 0;
+int ThrowingCopy::copies_left = 0;
+
+TEST(unorderedSetTest, MatchesStdUnorderedSet) {
+  s21::unordered_set<int> s;
+  std::unordered_set<int> expected;
+  unsigned seed = 99;
+  for (int i = 0; i < 50000; ++i) {
+    seed = seed * 1103515245 + 12345;
+    int key = static_cast<int>((seed >> 8) % 5000);
+    if (seed % 3 == 0) {
+      ASSERT_EQ(s.erase(key), expected.erase(key));
+    } else {
+      ASSERT_EQ(s.insert(key).second, expected.insert(key).second);
+    }
+    ASSERT_EQ(s.contains(key), expected.count(key) == 1);
+  }
+  ASSERT_EQ(s.size(), expected.size());
+  size_t visited = 0;
+  for (int key : s) {
+    ASSERT_EQ(expected.count(key), 1u);
+    ++visited;
+  }
+  ASSERT_EQ(visited, expected.size());
+  ASSERT_LE(s.load_factor(), s.max_load_factor());
+}
+
+TEST(unorderedSetTest, HashPolicy) {
+  s21::unordered_set<int> s;
+  EXPECT_EQ(s.bucket_count(), 0u);
+  EXPECT_EQ(s.begin(), s.end());
+  EXPECT_FALSE(s.contains(1));
+
+  s.reserve(1000);
+  size_t buckets = s.bucket_count();
+  EXPECT_GE(buckets * s.max_load_factor(), 1000.0f);
+  for (int i = 0; i < 1000; ++i) s.insert(i);
+  EXPECT_EQ(s.bucket_count(), buckets);
+
+  s.max_load_factor(0.5f);
+  EXPECT_LE(s.load_factor(), 0.5f);
+  EXPECT_THROW(s.max_load_factor(1.5f), std::invalid_argument);
+  for (int i = 0; i < 1000; ++i) ASSERT_TRUE(s.contains(i));
+
+  s.rehash(1 << 14);
+  EXPECT_EQ(s.bucket_count(), 1u << 14);
+  EXPECT_EQ(s.size(), 1000u);
+  s.clear();
+  EXPECT_TRUE(s.empty());
+  EXPECT_EQ(s.begin(), s.end());
+}
+
+// Only the hash of a key is shared; erasing and reinserting must keep
+// probing past deleted slots
+TEST(unorderedSetTest, Collisions) {
+  struct ConstantHash {
+    size_t operator()(int) const { return 42; }
+  };
+  s21::unordered_set<int, ConstantHash> s;
+  for (int i = 0; i < 100; ++i) s.insert(i);
+  for (int i = 0; i < 100; i += 2) EXPECT_EQ(s.erase(i), 1u);
+  for (int i = 0; i < 100; ++i) EXPECT_EQ(s.contains(i), i % 2 == 1);
+  for (int i = 0; i < 100; i += 2) EXPECT_TRUE(s.insert(i).second);
+  EXPECT_EQ(s.size(), 100u);
+}
+
+TEST(unorderedSetTest, CopyMoveAndMerge) {
+  s21::unordered_set<std::string> s{"a", "b", "c"};
+  s21::unordered_set<std::string> copy(s);
+  s21::unordered_set<std::string> moved(std::move(copy));
+  EXPECT_EQ(moved.size(), 3u);
+  EXPECT_TRUE(copy.empty());
+
+  s21::unordered_set<std::string> other{"c", "d"};
+  s.merge(other);
+  EXPECT_EQ(s.size(), 4u);
+  EXPECT_EQ(other.size(), 1u);
+  EXPECT_TRUE(other.contains("c"));
+
+  s.erase(s.find("a"));
+  EXPECT_FALSE(s.contains("a"));
+  EXPECT_EQ(*s.emplace(3, 'x').first, "xxx");
+}
+
+struct StringHash {
+  using is_transparent = void;
+  size_t operator()(std::string_view text) const {
+    return std::hash<std::string_view>()(text);
+  }
+};
+
+TEST(unorderedMapTest, AccessAndTransparentLookup) {
+  s21::unordered_map<std::string, int, StringHash, std::equal_to<>> map{
+      {"one", 1}, {"two", 2}};
+  map["three"] = 3;
+  EXPECT_EQ(map.size(), 3u);
+  EXPECT_EQ(map.at("two"), 2);
+  EXPECT_THROW(map.at("four"), std::invalid_argument);
+  EXPECT_TRUE(map.contains(std::string_view("three")));
+  EXPECT_EQ(map.find(std::string_view("one"))->second, 1);
+
+  EXPECT_FALSE(map.insert("one", 10).second);
+  EXPECT_FALSE(map.insert_or_assign("one", 10).second);
+  EXPECT_EQ(map["one"], 10);
+  EXPECT_TRUE(map.try_emplace("five", 5).second);
+  EXPECT_EQ(map.erase("five"), 1u);
+  EXPECT_EQ(map.erase("five"), 0u);
+
+  const auto &view = map;
+  int sum = 0;
+  for (const auto &item : view) sum += item.second;
+  EXPECT_EQ(sum, 15);
+}
+
+TEST(unorderedMapTest, MatchesStdUnorderedMap) {
+  s21::unordered_map<int, int> map;
+  std::unordered_map<int, int> expected;
+  unsigned seed = 2024;
+  for (int i = 0; i < 50000; ++i) {
+    seed = seed * 1103515245 + 12345;
+    int key = static_cast<int>((seed >> 8) % 3000);
+    if (seed % 4 == 0) {
+      ASSERT_EQ(map.erase(key), expected.erase(key));
+    } else {
+      map[key] += i;
+      expected[key] += i;
+    }
+  }
+  ASSERT_EQ(map.size(), expected.size());
+  for (auto &item : expected) ASSERT_EQ(map.at(item.first), item.second);
+}
+
+// A rehash whose copies throw leaves the table as it was
+TEST(unorderedMapTest, RehashStrongGuarantee) {
+  ThrowingCopy::copies_left = 1000;
+  {
+    s21::unordered_map<int, ThrowingCopy> map(64);
+    int count = 0;
+    // Fills the table up to the insertion that rehashes it
+    while (map.size() < static_cast<size_t>(map.bucket_count() *
+                                            map.max_load_factor())) {
+      map.try_emplace(count, count);
+      ++count;
+    }
+    size_t buckets = map.bucket_count();
+    ASSERT_EQ(ThrowingCopy::live, count);
+    ThrowingCopy::copies_left = count / 2;
+    EXPECT_THROW(map.try_emplace(count, count), std::runtime_error);
+    EXPECT_EQ(map.size(), static_cast<size_t>(count));
+    EXPECT_EQ(map.bucket_count(), buckets);
+    EXPECT_EQ(ThrowingCopy::live, count);
+    for (int i = 0; i < count; ++i) ASSERT_EQ(map.at(i).value, i);
+
+    ThrowingCopy::copies_left = 1000;
+    map.try_emplace(count, count);
+    EXPECT_GT(map.bucket_count(), buckets);
+    EXPECT_EQ(map.at(count).value, count);
+  }
+  EXPECT_EQ(ThrowingCopy::live, 0);
+}
+
+// Not noexcept, so a rehash hashes every element before moving any; throws
+// once calls_left runs out
+struct ThrowingHash {
+  static int calls_left;
+  size_t operator()(const std::string &key) const {
+    if (calls_left-- == 0) throw std::runtime_error("hash failed");
+    return std::hash<std::string>()(key);
+  }
+};
+int ThrowingHash::calls_left = 0;
+
+// A hash that throws during a rehash leaves the elements unmoved, though
+// std::string moves without throwing
+TEST(unorderedSetTest, RehashThrowingHash) {
+  ThrowingHash::calls_left = 1 << 30;
+  s21::unordered_set<std::string, ThrowingHash> set(64);
+  int count = 0;
+  while (set.size() <
+         static_cast<size_t>(set.bucket_count() * set.max_load_factor())) {
+    set.insert(std::string(40, 'a') + std::to_string(count++));
+  }
+  size_t buckets = set.bucket_count();
+  ThrowingHash::calls_left = count / 2;
+  EXPECT_THROW(set.insert("new"), std::runtime_error);
+  ThrowingHash::calls_left = 1 << 30;
+  EXPECT_EQ(set.size(), static_cast<size_t>(count));
+  EXPECT_EQ(set.bucket_count(), buckets);
+  for (int i = 0; i < count; ++i) {
+    ASSERT_TRUE(set.contains(std::string(40, 'a') + std::to_string(i)));
+  }
+  set.insert("new");
+  EXPECT_GT(set.bucket_count(), buckets);
+  EXPECT_TRUE(set.contains("new"));
+}
+
+// Inserting a copy of one of its own elements, including at every growth
+// point: the value is read before the elements move to the new slots
+TEST(unorderedMapTest, InsertOwnElement) {
+  s21::unordered_map<int, std::string> map;
+  map.insert(0, std::string(40, 'x'));
+  for (int i = 1; i < 2000; ++i) {
+    size_t buckets = map.bucket_count();
+    map.insert(i, map.at(i / 2));
+    ASSERT_EQ(map.at(i), std::string(40, 'x')) << "buckets " << buckets;
+  }
+  s21::unordered_map<int, std::string> other;
+  other.insert(0, std::string(40, 'y'));
+  for (int i = 1; i < 200; ++i) other.try_emplace(i, other.at(0), 1);
+  EXPECT_EQ(other.at(199), std::string(39, 'y'));
+  EXPECT_EQ(other.at(0), std::string(40, 'y'));
+}
+
+// lru_cache / lfu_cache
+TEST(lruCacheTest, EvictsLeastRecentlyUsed) {
+  s21::lru_cache<int, std::string> cache(3);
+  EXPECT_TRUE(cache.put(1, "one"));
+  EXPECT_TRUE(cache.put(2, "two"));
+  EXPECT_TRUE(cache.put(3, "three"));
+  EXPECT_EQ(*cache.get(1), "one");
+  EXPECT_TRUE(cache.put(4, "four"));
+  EXPECT_FALSE(cache.contains(2));
+  EXPECT_EQ(cache.get(2), nullptr);
+  // peek leaves 3 the least recently used
+  EXPECT_EQ(*cache.peek(3), "three");
+  EXPECT_FALSE(cache.put(1, "uno"));
+  cache.put(5, "five");
+  EXPECT_FALSE(cache.contains(3));
+  EXPECT_EQ(*cache.get(1), "uno");
+  EXPECT_EQ(cache.size(), 3u);
+
+  s21::cache_counters counters = cache.counters();
+  EXPECT_EQ(counters.hits, 2u);
+  EXPECT_EQ(counters.misses, 1u);
+  EXPECT_EQ(counters.insertions, 5u);
+  EXPECT_EQ(counters.evictions, 2u);
+  EXPECT_DOUBLE_EQ(counters.hit_ratio(), 2.0 / 3);
+
+  s21::lru_cache<int, std::string> moved(std::move(cache));
+  EXPECT_EQ(moved.erase(4), 1u);
+  EXPECT_EQ(moved.erase(4), 0u);
+  EXPECT_EQ(moved.size(), 2u);
+  EXPECT_TRUE(cache.empty());
+  moved.clear();
+  EXPECT_TRUE(moved.empty());
+  EXPECT_EQ(moved.memory_usage(), 0u);
+  EXPECT_THROW((s21::lru_cache<int, int>(0)), std::invalid_argument);
+}
+
+struct StringWeigher {
+  size_t operator()(int, const std::string &value) const {
+    return value.size();
+  }
+};
+
+TEST(lruCacheTest, MemoryBudget) {
+  using Cache = s21::lru_cache<int, std::string, std::hash<int>,
+                               std::equal_to<int>, StringWeigher>;
+  const size_t overhead = Cache::kEntryOverhead;
+  Cache cache(100, 3 * (overhead + 10));
+  for (int i = 0; i < 3; ++i) cache.put(i, std::string(10, 'a'));
+  EXPECT_EQ(cache.memory_usage(), 3 * (overhead + 10));
+  cache.put(3, std::string(15, 'b'));
+  EXPECT_EQ(cache.size(), 2u);
+  EXPECT_FALSE(cache.contains(0));
+  EXPECT_FALSE(cache.contains(1));
+  // Growing an entry evicts the others, never the entry itself
+  cache.put(3, std::string(2 * overhead + 20, 'c'));
+  EXPECT_EQ(cache.size(), 1u);
+  EXPECT_TRUE(cache.contains(3));
+  cache.put(4, std::string(10 * overhead, 'd'));
+  EXPECT_EQ(cache.size(), 1u);
+  EXPECT_TRUE(cache.contains(4));
+  EXPECT_EQ(cache.memory_usage(), 11 * overhead);
+}
+
+TEST(lruCacheTest, MatchesReferenceModel) {
+  s21::lru_cache<int, int> cache(64);
+  std::list<std::pair<int, int>> order;
+  std::unordered_map<int, std::list<std::pair<int, int>>::iterator> index;
+  unsigned seed = 99;
+  for (int i = 0; i < 50000; ++i) {
+    seed = seed * 1103515245 + 12345;
+    int key = static_cast<int>((seed >> 8) % 200);
+    auto found = index.find(key);
+    if (seed % 3 == 0) {
+      int *value = cache.get(key);
+      ASSERT_EQ(value != nullptr, found != index.end());
+      if (value == nullptr) continue;
+      ASSERT_EQ(*value, found->second->second);
+      order.splice(order.begin(), order, found->second);
+    } else {
+      ASSERT_EQ(cache.put(key, i), found == index.end());
+      if (found != index.end()) order.erase(found->second);
+      order.emplace_front(key, i);
+      index[key] = order.begin();
+      if (order.size() > 64) {
+        index.erase(order.back().first);
+        order.pop_back();
+      }
+    }
+  }
+  ASSERT_EQ(cache.size(), order.size());
+  for (auto &item : order) ASSERT_EQ(*cache.peek(item.first), item.second);
+}
+
+TEST(lfuCacheTest, EvictsLeastFrequentlyUsed) {
+  s21::lfu_cache<int, int> cache(3);
+  cache.put(1, 10);
+  cache.put(2, 20);
+  cache.put(3, 30);
+  cache.get(1);
+  cache.get(1);
+  cache.get(2);
+  EXPECT_EQ(cache.frequency(1), 3u);
+  EXPECT_EQ(cache.frequency(3), 1u);
+  cache.put(4, 40);
+  EXPECT_FALSE(cache.contains(3));
+  // 2 and 4 tie on two accesses after this, 2 being the older
+  cache.get(4);
+  cache.put(5, 50);
+  EXPECT_FALSE(cache.contains(2));
+  EXPECT_TRUE(cache.contains(4));
+  EXPECT_EQ(cache.frequency(5), 1u);
+  EXPECT_FALSE(cache.put(5, 55));
+  EXPECT_EQ(cache.frequency(5), 2u);
+  EXPECT_EQ(*cache.peek(5), 55);
+  EXPECT_EQ(cache.counters().evictions, 2u);
+
+  s21::lfu_cache<int, int> other(1);
+  other = std::move(cache);
+  EXPECT_EQ(other.size(), 3u);
+  EXPECT_EQ(other.capacity(), 3u);
+  EXPECT_EQ(*other.get(1), 10);
+  EXPECT_EQ(other.erase(1), 1u);
+  EXPECT_EQ(other.frequency(1), 0u);
+}
+
+TEST(lfuCacheTest, MatchesReferenceModel) {
+  s21::lfu_cache<int, int> cache(32);
+  struct Use {
+    int value;
+    size_t frequency;
+    long last;
+  };
+  std::map<int, Use> expected;
+  unsigned seed = 4242;
+  for (long i = 0; i < 20000; ++i) {
+    seed = seed * 1103515245 + 12345;
+    int key = static_cast<int>((seed >> 8) % 100);
+    auto found = expected.find(key);
+    if (seed % 2 == 0) {
+      int *value = cache.get(key);
+      ASSERT_EQ(value != nullptr, found != expected.end());
+      if (value == nullptr) continue;
+      ASSERT_EQ(*value, found->second.value);
+      ++found->second.frequency;
+      found->second.last = i;
+    } else if (found != expected.end()) {
+      ASSERT_FALSE(cache.put(key, static_cast<int>(i)));
+      found->second = {static_cast<int>(i), found->second.frequency + 1, i};
+    } else {
+      if (expected.size() == 32) {
+        auto victim = expected.begin();
+        for (auto it = expected.begin(); it != expected.end(); ++it) {
+          if (std::make_pair(it->second.frequency, it->second.last) <
+              std::make_pair(victim->second.frequency, victim->second.last)) {
+            victim = it;
+          }
+        }
+        expected.erase(victim);
+      }
+      ASSERT_TRUE(cache.put(key, static_cast<int>(i)));
+      expected[key] = {static_cast<int>(i), 1, i};
+    }
+  }
+  ASSERT_EQ(cache.size(), expected.size());
+  for (auto &item : expected) {
+    ASSERT_EQ(*cache.peek(item.first), item.second.value);
+    ASSERT_EQ(cache.frequency(item.first), item.second.frequency);
+  }
+}
+
+// 64-byte nodes keep a few elements per node, so a small tree is already
+// several levels deep and exercises splits, borrows and merges
+TEST(btreeSetTest, MatchesStdSet) {
+  s21::btree_set<int, std::less<int>, 64> s;
+  std::set<int> expected;
+  unsigned seed = 4242;
+  for (int i = 0; i < 30000; ++i) {
+    seed = seed * 1103515245 + 12345;
+    int key = static_cast<int>((seed >> 8) % 2000);
+    if (seed % 3 == 0) {
+      auto it = s.find(key);
+      ASSERT_EQ(it != s.end(), expected.count(key) == 1);
+      if (it != s.end()) s.erase(it);
+      expected.erase(key);
+    } else {
+      ASSERT_EQ(s.insert(key).second, expected.insert(key).second);
+    }
+  }
+  ASSERT_EQ(s.size(), expected.size());
+  ASSERT_TRUE(std::equal(expected.begin(), expected.end(), s.begin()));
+  ASSERT_TRUE(std::equal(expected.rbegin(), expected.rend(),
+                         std::make_reverse_iterator(s.end())));
+  EXPECT_GT(s.get_tree().Height(), 2);
+  while (!s.empty()) s.erase(s.begin());
+  EXPECT_EQ(s.begin(), s.end());
+  EXPECT_EQ(s.get_tree().MemoryUsage(), 0u);
+}
+
+TEST(btreeSetTest, BoundsAndRange) {
+  s21::btree_set<int, std::less<int>, 64> s;
+  for (int i = 0; i < 1000; i += 2) s.insert(i);
+  EXPECT_EQ(*s.lower_bound(101), 102);
+  EXPECT_EQ(*s.lower_bound(102), 102);
+  EXPECT_EQ(*s.upper_bound(102), 104);
+  EXPECT_EQ(s.lower_bound(999), s.end());
+  EXPECT_EQ(*--s.end(), 998);
+  auto eq = s.equal_range(500);
+  EXPECT_EQ(std::distance(eq.first, eq.second), 1);
+  int expected = 100;
+  for (int key : s.range(100, 200)) {
+    EXPECT_EQ(key, expected);
+    expected += 2;
+  }
+  EXPECT_EQ(expected, 200);
+  EXPECT_FALSE(s.contains(501));
+  EXPECT_TRUE(s.contains(500));
+}
+
+TEST(btreeSetTest, CopyMoveAndMerge) {
+  s21::btree_set<int> s = {5, 1, 3};
+  s21::btree_set<int> copy(s);
+  copy.insert(7);
+  EXPECT_EQ(s.size(), 3u);
+  EXPECT_EQ(copy.size(), 4u);
+  s21::btree_set<int> moved(std::move(copy));
+  EXPECT_EQ(moved.size(), 4u);
+  EXPECT_TRUE(copy.empty());
+  s21::btree_set<int> other = {1, 2, 7, 9};
+  moved.merge(other);
+  EXPECT_EQ(moved.size(), 6u);
+  EXPECT_EQ(other.size(), 2u);
+  EXPECT_TRUE(other.contains(1));
+  EXPECT_TRUE(other.contains(7));
+  moved.swap(s);
+  EXPECT_EQ(s.size(), 6u);
+  EXPECT_EQ(moved.size(), 3u);
+}
+
+// Copying throws once copies_left runs out, moving never throws
+struct FragileKey {
+  static int live;
+  static int copies_left;
+  int value;
+  explicit FragileKey(int v) : value(v) { ++live; }
+  FragileKey(const FragileKey &other) : value(other.value) {
+    if (copies_left-- == 0) throw std::runtime_error("copy failed");
+    ++live;
+  }
+  FragileKey(FragileKey &&other) noexcept : value(other.value) { ++live; }
+  FragileKey &operator=(const FragileKey &) = default;
+  ~FragileKey() { --live; }
+  bool operator<(const FragileKey &other) const { return value < other.value; }
+};
+int FragileKey::live = 0;
+int FragileKey::copies_left = -1;
+
+TEST(btreeSetTest, ThrowingCopyFreesNodes) {
+  using FragileSet = s21::btree_set<FragileKey, std::less<FragileKey>, 64>;
+  FragileKey::live = 0;
+  FragileKey::copies_left = -1;
+  FragileSet s;
+  for (int i = 0; i < 500; ++i) s.insert(FragileKey(i * 7 % 500));
+  int live = FragileKey::live;
+  for (int copies : {0, 1, 9, 120, 480}) {
+    FragileKey::copies_left = copies;
+    EXPECT_THROW(FragileSet copy(s), std::runtime_error);
+    EXPECT_EQ(FragileKey::live, live);
+  }
+  FragileKey::copies_left = -1;
+}
+
+TEST(btreeSetTest, ThrowingInsertKeepsTree) {
+  FragileKey::live = 0;
+  {
+    s21::btree_set<FragileKey, std::less<FragileKey>, 64> s;
+    std::set<int> expected;
+    unsigned seed = 42;
+    for (int i = 0; i < 3000; ++i) {
+      seed = seed * 1103515245 + 12345;
+      FragileKey key(static_cast<int>((seed >> 8) % 2000));
+      FragileKey::copies_left = static_cast<int>(seed % 3);
+      try {
+        s.insert(key);
+        expected.insert(key.value);
+      } catch (const std::runtime_error &) {
+      }
+      FragileKey::copies_left = -1;
+    }
+    ASSERT_EQ(s.size(), expected.size());
+    auto it = s.begin();
+    for (int value : expected) {
+      ASSERT_EQ(it->value, value);
+      ++it;
+      ASSERT_NE(s.find(FragileKey(value)), s.end());
+    }
+    EXPECT_EQ(it, s.end());
+  }
+  EXPECT_EQ(FragileKey::live, 0);
+}
+
+TEST(btreeMapTest, MatchesStdMap) {
+  s21::btree_map<int, std::string, std::less<int>, 128> m;
+  std::map<int, std::string> expected;
+  unsigned seed = 99;
+  for (int i = 0; i < 10000; ++i) {
+    seed = seed * 1103515245 + 12345;
+    int key = static_cast<int>((seed >> 8) % 1000);
+    std::string value = std::to_string(i);
+    if (seed % 4 == 0) {
+      auto it = m.find(key);
+      if (it != m.end()) m.erase(it);
+      expected.erase(key);
+    } else if (seed % 4 == 1) {
+      m.insert_or_assign(key, value);
+      expected.insert_or_assign(key, value);
+    } else {
+      m[key] += value;
+      expected[key] += value;
+    }
+  }
+  ASSERT_EQ(m.size(), expected.size());
+  ASSERT_TRUE(std::equal(expected.begin(), expected.end(), m.begin()));
+  for (const auto& item : expected) ASSERT_EQ(m.at(item.first), item.second);
+}
+
+TEST(btreeMapTest, AccessAndTransparentLookup) {
+  s21::btree_map<std::string, int, std::less<>> m = {{"one", 1}, {"two", 2}};
+  EXPECT_EQ(m.at("one"), 1);
+  EXPECT_THROW(m.at("three"), std::invalid_argument);
+  EXPECT_FALSE(m.insert("one", 10).second);
+  EXPECT_EQ(m["one"], 1);
+  EXPECT_TRUE(m.contains(std::string_view("two")));
+  EXPECT_EQ(m.find(std::string_view("two"))->second, 2);
+  const auto& view = m;
+  EXPECT_EQ(view.at("two"), 2);
+  EXPECT_EQ(view.find("zero"), view.end());
+}
+
+TEST(compactSetTest, MatchesStdSet) {
+  s21::compact_set<int> s;
+  std::set<int> expected;
+  unsigned seed = 1234;
+  for (int i = 0; i < 30000; ++i) {
+    seed = seed * 1103515245 + 12345;
+    int key = static_cast<int>((seed >> 8) % 2000);
+    switch (seed % 5) {
+      case 0:
+        ASSERT_EQ(s.erase(key), expected.erase(key));
+        break;
+      case 1: {
+        auto it = s.find(key);
+        ASSERT_EQ(it != s.end(), expected.count(key) == 1);
+        if (it != s.end()) s.erase(it);
+        expected.erase(key);
+        break;
+      }
+      default:
+        ASSERT_EQ(s.insert(key).second, expected.insert(key).second);
+    }
+  }
+  ASSERT_EQ(s.size(), expected.size());
+  ASSERT_TRUE(std::equal(expected.begin(), expected.end(), s.begin()));
+  ASSERT_TRUE(std::equal(expected.rbegin(), expected.rend(),
+                         std::make_reverse_iterator(s.end())));
+  // AVL bound: height < 1.45 log2(n + 2)
+  EXPECT_LE(s.get_tree().Height(), 16);
+  EXPECT_EQ(*s.lower_bound(-1), *expected.begin());
+  EXPECT_EQ(s.upper_bound(*expected.rbegin()), s.end());
+}
+
+TEST(compactSetTest, SmallerNodes) {
+  using plain = s21::compact_set<int>::tree_type;
+  using ranked = s21::compact_set<int, std::less<int>,
+                                  s21::avl_order_statistics_policy>::tree_type;
+  EXPECT_EQ(plain::kNodeBytes, 3 * sizeof(void*));
+  EXPECT_EQ(ranked::kNodeBytes, 4 * sizeof(void*));
+  EXPECT_LT(ranked::kNodeBytes, sizeof(s21::Node<int, int>));
+  s21::compact_set<int> s = {3, 1, 2};
+  EXPECT_EQ(s.get_tree().MemoryUsage(), 3 * plain::kNodeBytes);
+}
+
+TEST(compactSetTest, OrderStatistics) {
+  s21::compact_set<int, std::less<int>, s21::avl_order_statistics_policy> s;
+  for (int i = 0; i < 1000; ++i) s.insert((i * 37) % 1000 * 2);
+  for (int i = 0; i < 1000; i += 7) {
+    EXPECT_EQ(*s.find_by_order(i), 2 * i);
+    EXPECT_EQ(s.order_of_key(2 * i), static_cast<size_t>(i));
+    EXPECT_EQ(s.order_of_key(2 * i + 1), static_cast<size_t>(i + 1));
+  }
+  EXPECT_EQ(s.find_by_order(1000), s.end());
+  for (int i = 0; i < 500; ++i) s.erase(4 * i);
+  EXPECT_EQ(*s.find_by_order(0), 2);
+  EXPECT_EQ(s.order_of_key(1000), 250u);
+}
+
+TEST(compactMapTest, AccessCopyAndMerge) {
+  s21::compact_map<std::string, int> m = {{"one", 1}, {"two", 2}};
+  EXPECT_EQ(m.at("one"), 1);
+  EXPECT_THROW(m.at("three"), std::invalid_argument);
+  m["three"] = 3;
+  EXPECT_FALSE(m.insert("one", 10).second);
+  m.insert_or_assign("two", 20);
+  s21::compact_map<std::string, int> copy(m);
+  m.erase("one");
+  EXPECT_EQ(copy.size(), 3u);
+  EXPECT_EQ(copy.at("two"), 20);
+  EXPECT_EQ(m.size(), 2u);
+  s21::compact_map<std::string, int> other = {{"one", 100}, {"two", 200}};
+  m.merge(other);
+  EXPECT_EQ(m.at("one"), 100);
+  EXPECT_EQ(other.size(), 1u);
+  EXPECT_EQ(other.at("two"), 200);
+  std::string keys;
+  for (const auto& item : m) keys += item.first;
+  EXPECT_EQ(keys, "onethreetwo");
+}
+
+TEST(persistentSetTest, SnapshotsAreIsolated) {
+  s21::persistent_set<int> s;
+  std::set<int> expected;
+  std::vector<std::pair<s21::persistent_set<int>, std::set<int>>> versions;
+  unsigned seed = 31;
+  for (int i = 0; i < 20000; ++i) {
+    seed = seed * 1103515245 + 12345;
+    int key = static_cast<int>((seed >> 8) % 1500);
+    if (seed % 3 == 0) {
+      ASSERT_EQ(s.erase(key), expected.erase(key));
+    } else {
+      ASSERT_EQ(s.insert(key).second, expected.insert(key).second);
+    }
+    if (i % 1000 == 0) versions.emplace_back(s.snapshot(), expected);
+  }
+  ASSERT_TRUE(std::equal(expected.begin(), expected.end(), s.begin()));
+  for (const auto &version : versions) {
+    ASSERT_EQ(version.first.size(), version.second.size());
+    ASSERT_TRUE(std::equal(version.second.begin(), version.second.end(),
+                           version.first.begin()));
+  }
+  EXPECT_LE(s.get_tree().Height(), 15);
+}
+
+TEST(persistentSetTest, SnapshotSharesRoot) {
+  s21::persistent_set<int> s = {1, 2, 3};
+  s21::persistent_set<int> view = s.snapshot();
+  EXPECT_TRUE(view.get_tree().SharesRoot(s.get_tree()));
+  EXPECT_FALSE(s.insert(2).second);
+  EXPECT_TRUE(view.get_tree().SharesRoot(s.get_tree()));
+  s.erase(s.find(1));
+  EXPECT_FALSE(view.get_tree().SharesRoot(s.get_tree()));
+  EXPECT_TRUE(view.contains(1));
+  EXPECT_FALSE(s.contains(1));
+  EXPECT_EQ(*view.lower_bound(0), 1);
+  EXPECT_EQ(*s.lower_bound(0), 2);
+}
+
+TEST(persistentMapTest, AssignKeepsSnapshotValues) {
+  s21::persistent_map<std::string, int> m = {{"one", 1}, {"two", 2}};
+  auto before = m.snapshot();
+  EXPECT_FALSE(m.insert_or_assign("one", 10).second);
+  EXPECT_TRUE(m.insert("three", 3).second);
+  EXPECT_FALSE(m.insert("two", 20).second);
+  EXPECT_EQ(m.at("one"), 10);
+  EXPECT_EQ(m.at("two"), 2);
+  EXPECT_EQ(before.at("one"), 1);
+  EXPECT_THROW(before.at("three"), std::invalid_argument);
+  EXPECT_EQ(before.size(), 2u);
+  EXPECT_EQ(m.size(), 3u);
+}
+
+// Element copies that throw partway through an update, at every depth,
+// leave the map and the snapshots sharing its nodes as they were
+TEST(persistentMapTest, ThrowingCopyKeepsVersions) {
+  ThrowingCopy::copies_left = 1 << 30;
+  {
+    s21::persistent_map<int, ThrowingCopy> m;
+    std::map<int, int> expected;
+    for (int i = 0; i < 1000; ++i) {
+      m.insert(2 * i, ThrowingCopy(i));
+      expected.emplace(2 * i, i);
+    }
+    const s21::persistent_map<int, ThrowingCopy> first = m.snapshot();
+    const std::map<int, int> first_expected = expected;
+    s21::persistent_map<int, ThrowingCopy> latest = m.snapshot();
+    auto matches = [](const s21::persistent_map<int, ThrowingCopy> &map,
+                      const std::map<int, int> &items) {
+      if (map.size() != items.size()) return false;
+      auto it = items.begin();
+      for (const auto &item : map) {
+        if (item.first != it->first || item.second.value != it->second) {
+          return false;
+        }
+        ++it;
+      }
+      return true;
+    };
+    int thrown = 0;
+    unsigned seed = 5;
+    for (int i = 0; i < 600; ++i) {
+      seed = seed * 1103515245 + 12345;
+      int key = static_cast<int>((seed >> 8) % 2000);
+      ThrowingCopy::copies_left = static_cast<int>((seed >> 4) % 24);
+      try {
+        if (seed % 3 == 0) {
+          m.erase(key);
+          expected.erase(key);
+        } else if (seed % 3 == 1) {
+          m.insert_or_assign(key, ThrowingCopy(-key));
+          expected[key] = -key;
+        } else {
+          m.insert(key, ThrowingCopy(key));
+          expected.emplace(key, key);
+        }
+      } catch (const std::runtime_error &) {
+        ++thrown;
+      }
+      ThrowingCopy::copies_left = 1 << 30;
+      ASSERT_TRUE(matches(m, expected));
+      if (i % 10 == 0) latest = m.snapshot();
+    }
+    EXPECT_GT(thrown, 100);
+    EXPECT_LT(thrown, 500);
+    EXPECT_TRUE(matches(first, first_expected));
+    EXPECT_LE(m.get_tree().Height(), 15);
+  }
+  EXPECT_EQ(ThrowingCopy::live, 0);
+}
+
+// Readers walk their snapshots and drop them while the writer keeps
+// updating and taking new ones; the nodes they share are freed by whichever
+// version goes last
+TEST(persistentMapTest, ConcurrentReaders) {
+  s21::persistent_map<int, int> m;
+  for (int i = 0; i < 1000; ++i) m.insert(i, 1);
+  std::vector<std::thread> readers;
+  std::atomic<int> failures{0};
+  for (int round = 0; round < 8; ++round) {
+    s21::persistent_map<int, int> view = m.snapshot();
+    readers.emplace_back([view, &failures]() mutable {
+      for (int pass = 0; pass < 20; ++pass) {
+        long long sum = 0;
+        for (const auto &item : view) sum += item.second;
+        if (sum != static_cast<long long>(view.size())) ++failures;
+      }
+      view.clear();
+    });
+    for (int i = 0; i < 500; ++i) {
+      m.insert_or_assign((round * 500 + i) % 2000, 1);
+    }
+  }
+  for (auto &reader : readers) reader.join();
+  EXPECT_EQ(failures.load(), 0);
+  EXPECT_EQ(m.size(), 2000u);
+}
+
+// concurrent_map
+TEST(concurrentMapTest, LookupsAndUpdates) {
+  s21::concurrent_map<int, std::string> m{{1, "one"}, {3, "three"}};
+  EXPECT_TRUE(m.insert(2, "two"));
+  EXPECT_FALSE(m.insert(2, "deux"));
+  EXPECT_EQ(m.find(2).value(), "two");
+  EXPECT_FALSE(m.find(4).has_value());
+  EXPECT_FALSE(m.insert_or_assign(2, "deux"));
+  EXPECT_TRUE(m.insert_or_assign(5, "five"));
+  EXPECT_EQ(m.find(2).value(), "deux");
+  EXPECT_EQ(m.lower_bound(4)->first, 5);
+  EXPECT_FALSE(m.lower_bound(6).has_value());
+  EXPECT_EQ(m.erase(3), 1u);
+  EXPECT_EQ(m.erase(3), 0u);
+  EXPECT_FALSE(m.contains(3));
+  EXPECT_EQ(m.size(), 3u);
+
+  s21::persistent_map<int, std::string> view = m.snapshot();
+  m.clear();
+  EXPECT_TRUE(m.empty());
+  EXPECT_TRUE(m.insert(0, "zero"));
+  std::map<int, std::string> expected{{1, "one"}, {2, "deux"}, {5, "five"}};
+  EXPECT_EQ(view.size(), expected.size());
+  EXPECT_TRUE(std::equal(expected.begin(), expected.end(), view.begin()));
+}
+
+TEST(concurrentMapTest, EpochWaitsForPinnedReaders) {
+  s21::epoch_domain &domain = s21::epoch_domain::instance();
+  s21::epoch_domain::epoch_type retired = domain.epoch();
+  {
+    s21::epoch_guard guard;
+    s21::epoch_guard nested;
+    domain.try_advance();
+    domain.try_advance();
+    EXPECT_LE(domain.epoch(), retired + 1);
+    EXPECT_FALSE(s21::epoch_domain::is_safe(retired, domain.epoch()));
+  }
+  domain.try_advance();
+  domain.try_advance();
+  EXPECT_TRUE(s21::epoch_domain::is_safe(retired, domain.epoch()));
+}
+
+// A writer whose element copies throw publishes nothing, while readers
+// keep looking up the published version
+TEST(concurrentMapTest, ThrowingWriterLeavesReaders) {
+  ThrowingCopy::copies_left = 1 << 30;
+  {
+    s21::concurrent_map<int, ThrowingCopy> m;
+    for (int i = 0; i < 2000; ++i) m.insert(i, ThrowingCopy(2 * i));
+    std::atomic<bool> done{false};
+    std::atomic<int> failures{0};
+    std::vector<std::thread> readers;
+    for (int r = 0; r < 3; ++r) {
+      readers.emplace_back([&m, &done, &failures, r] {
+        for (int i = r; !done.load(std::memory_order_relaxed); ++i) {
+          int key = i % 2000;
+          // Snapshots copy no elements, only the writer does
+          s21::persistent_map<int, ThrowingCopy> view = m.snapshot();
+          auto it = view.find(key);
+          if (it == view.end() || it->second.value != 2 * key) ++failures;
+          if (!m.contains(key)) ++failures;
+        }
+      });
+    }
+    // Every update runs out of copies before its path is built, a path of
+    // at least 11 nodes for 2000 elements
+    int thrown = 0;
+    for (int i = 0; i < 200; ++i) {
+      ThrowingCopy::copies_left = i % 8;
+      try {
+        m.insert_or_assign(i * 7 % 2000, ThrowingCopy(-1));
+      } catch (const std::runtime_error &) {
+        ++thrown;
+      }
+    }
+    ThrowingCopy::copies_left = 1 << 30;
+    done.store(true);
+    for (auto &reader : readers) reader.join();
+    EXPECT_EQ(thrown, 200);
+    EXPECT_EQ(failures.load(), 0);
+    EXPECT_EQ(m.size(), 2000u);
+    for (int i = 0; i < 2000; ++i) ASSERT_EQ(m.find(i)->value, 2 * i);
+  }
+  EXPECT_EQ(ThrowingCopy::live, 0);
+}
+
+// Writers keep every present key k mapped to 2k and readers check that no
+// lookup or snapshot ever sees anything else; meant for the tsan target
+TEST(concurrentMapTest, ReadersAndWritersStress) {
+  const int kKeys = 256;
+  s21::concurrent_map<int, int> m;
+  std::atomic<bool> done{false};
+  std::atomic<int> failures{0};
+  std::vector<std::thread> threads;
+  for (int w = 0; w < 2; ++w) {
+    threads.emplace_back([&m, w] {
+      for (int i = 0; i < 4000; ++i) {
+        int key = (i * 7 + w) % kKeys;
+        if (i % 3 == 0) {
+          m.erase(key);
+        } else {
+          m.insert_or_assign(key, 2 * key);
+        }
+      }
+    });
+  }
+  for (int r = 0; r < 4; ++r) {
+    threads.emplace_back([&m, &done, &failures, r] {
+      for (int i = r; !done.load(std::memory_order_relaxed); ++i) {
+        int key = i % kKeys;
+        std::optional<int> value = m.find(key);
+        if (value && *value != 2 * key) ++failures;
+        std::optional<std::pair<const int, int>> next = m.lower_bound(key);
+        if (next && (next->first < key || next->second != 2 * next->first)) {
+          ++failures;
+        }
+        if (i % 64 == 0) {
+          int previous = -1;
+          for (const auto &item : m.snapshot()) {
+            if (item.first <= previous || item.second != 2 * item.first) {
+              ++failures;
+            }
+            previous = item.first;
+          }
+        }
+      }
+    });
+  }
+  threads[0].join();
+  threads[1].join();
+  done.store(true);
+  for (size_t t = 2; t < threads.size(); ++t) threads[t].join();
+  EXPECT_EQ(failures.load(), 0);
+  size_t present = 0;
+  for (int key = 0; key < kKeys; ++key) {
+    std::optional<int> value = m.find(key);
+    if (value) {
+      ++present;
+      EXPECT_EQ(*value, 2 * key);
+    }
+  }
+  EXPECT_EQ(m.size(), present);
+}
+
 // list
 template <typename value_type>
 bool compare_lists(s21::list<value_type> my_list,
@@ -779,6 +2073,142 @@ TEST(ListTest, Erase_1) {
   EXPECT_TRUE(compare_lists(my_list1, std_list1));
 }
 
+// intrusive_list / intrusive_set
+struct Linked {
+  int key;
+  s21::list_hook<Linked> order;
+  s21::list_hook<Linked> pending;
+  s21::set_hook<Linked> by_key;
+
+  bool operator<(const Linked &other) const { return key < other.key; }
+};
+
+// Compares elements with each other and with bare keys
+struct LinkedLess {
+  bool operator()(const Linked &a, const Linked &b) const {
+    return a.key < b.key;
+  }
+  bool operator()(const Linked &a, int key) const { return a.key < key; }
+  bool operator()(int key, const Linked &b) const { return key < b.key; }
+};
+
+template <typename List>
+static std::vector<int> ListKeys(const List &list) {
+  std::vector<int> keys;
+  for (const Linked &item : list) keys.push_back(item.key);
+  return keys;
+}
+
+TEST(intrusiveListTest, LinksElementsInPlace) {
+  std::vector<Linked> arena(6);
+  for (int i = 0; i < 6; ++i) arena[i].key = i;
+  s21::intrusive_list<Linked, &Linked::order> order;
+  s21::intrusive_list<Linked, &Linked::pending> pending;
+  EXPECT_THROW(order.front(), std::out_of_range);
+  for (int i = 1; i < 5; ++i) order.push_back(arena[i]);
+  order.push_front(arena[0]);
+  order.insert(order.end(), arena[5]);
+  EXPECT_EQ(ListKeys(order), (std::vector<int>{0, 1, 2, 3, 4, 5}));
+  EXPECT_EQ(order.front().key, 0);
+  EXPECT_EQ(order.back().key, 5);
+  EXPECT_EQ((--order.end())->key, 5);
+
+  // The same objects in a second list through their second hook
+  pending.push_back(arena[4]);
+  pending.insert(pending.begin(), arena[2]);
+  EXPECT_EQ(ListKeys(pending), (std::vector<int>{2, 4}));
+
+  auto next = order.erase(order.iterator_to(arena[2]));
+  EXPECT_EQ(next->key, 3);
+  EXPECT_FALSE(arena[2].order.is_linked());
+  EXPECT_TRUE(arena[2].pending.is_linked());
+  order.pop_front();
+  order.pop_back();
+  EXPECT_EQ(ListKeys(order), (std::vector<int>{1, 3, 4}));
+  EXPECT_EQ(order.size(), 3u);
+  EXPECT_THROW(order.push_back(arena[3]), std::invalid_argument);
+
+  s21::intrusive_list<Linked, &Linked::order> moved(std::move(order));
+  EXPECT_TRUE(order.empty());
+  EXPECT_EQ(ListKeys(moved), (std::vector<int>{1, 3, 4}));
+  moved.clear();
+  for (const Linked &item : arena) EXPECT_FALSE(item.order.is_linked());
+  {
+    s21::intrusive_list<Linked, &Linked::order> scoped;
+    scoped.push_back(arena[0]);
+  }
+  EXPECT_FALSE(arena[0].order.is_linked());
+}
+
+TEST(intrusiveSetTest, MatchesStdSet) {
+  std::vector<Linked> arena(3000);
+  for (int i = 0; i < 3000; ++i) arena[i].key = i % 1000;
+  s21::intrusive_set<Linked, &Linked::by_key, LinkedLess> set;
+  std::set<int> expected;
+  unsigned seed = 31337;
+  for (int i = 0; i < 60000; ++i) {
+    seed = seed * 1103515245 + 12345;
+    Linked &item = arena[(seed >> 8) % arena.size()];
+    if (seed % 3 == 0) {
+      ASSERT_EQ(set.erase(item.key), expected.erase(item.key));
+    } else if (!item.by_key.is_linked()) {
+      bool inserted = expected.insert(item.key).second;
+      auto result = set.insert(item);
+      ASSERT_EQ(result.second, inserted);
+      ASSERT_EQ(result.first->key, item.key);
+      ASSERT_EQ(item.by_key.is_linked(), inserted);
+    }
+  }
+  ASSERT_EQ(set.size(), expected.size());
+  ASSERT_EQ(ListKeys(set), std::vector<int>(expected.begin(), expected.end()));
+  ASSERT_LE(set.height(), 15);
+  EXPECT_EQ(set.lower_bound(-1)->key, *expected.begin());
+  EXPECT_EQ((--set.end())->key, *expected.rbegin());
+  for (int key = 0; key < 1000; ++key) {
+    ASSERT_EQ(set.contains(key), expected.count(key) == 1);
+    auto bound = set.upper_bound(key);
+    auto std_bound = expected.upper_bound(key);
+    ASSERT_EQ(bound == set.end(), std_bound == expected.end());
+    if (bound != set.end()) {
+      ASSERT_EQ(bound->key, *std_bound);
+    }
+  }
+
+  // Erasing in order through iterators leaves every hook reset
+  for (auto it = set.begin(); it != set.end();) it = set.erase(it);
+  EXPECT_TRUE(set.empty());
+  for (const Linked &item : arena) ASSERT_FALSE(item.by_key.is_linked());
+}
+
+TEST(intrusiveSetTest, SafeModeAndMoves) {
+  std::vector<Linked> arena(100);
+  for (int i = 0; i < 100; ++i) arena[i].key = 99 - i;
+  s21::intrusive_set<Linked, &Linked::by_key> set;
+  for (Linked &item : arena) set.insert(item);
+  EXPECT_THROW(set.insert(arena[7]), std::invalid_argument);
+  EXPECT_EQ(set.begin()->key, 0);
+  EXPECT_EQ(&*set.find(arena[7]), &arena[7]);
+
+  // A copy of an element carries no links
+  Linked copy = arena[7];
+  EXPECT_FALSE(copy.by_key.is_linked());
+  EXPECT_FALSE(set.insert(copy).second);
+
+  s21::intrusive_set<Linked, &Linked::by_key> moved;
+  moved = std::move(set);
+  EXPECT_EQ(moved.size(), 100u);
+  EXPECT_TRUE(set.empty());
+  moved.clear();
+  for (const Linked &item : arena) ASSERT_FALSE(item.by_key.is_linked());
+
+  s21::intrusive_set<Linked, &Linked::by_key, std::less<Linked>,
+                     s21::link_mode::normal>
+      fast;
+  for (Linked &item : arena) fast.insert(item);
+  EXPECT_EQ(fast.size(), 100u);
+  EXPECT_EQ((--fast.end())->key, 99);
+}
+
 // queue
 TEST(test_container, queue_test_1) {
   s21::queue<int> s21_queue;
@@ -975,6 +2405,660 @@ TEST(test_container, insert_many_back) {
   }
 }
 
+TEST(test_container, queue_test_wrap_around) {
+  s21::queue<int> s21_queue;
+  std::queue<int> orig_queue;
+
+  for (int i = 0; i < 1000; ++i) {
+    s21_queue.push(i);
+    orig_queue.push(i);
+    if (i % 3 == 2) {
+      s21_queue.pop();
+      orig_queue.pop();
+    }
+    ASSERT_EQ(s21_queue.front(), orig_queue.front());
+    ASSERT_EQ(s21_queue.back(), orig_queue.back());
+  }
+  ASSERT_EQ(s21_queue.size(), orig_queue.size());
+
+  while (!orig_queue.empty()) {
+    ASSERT_EQ(s21_queue.front(), orig_queue.front());
+    s21_queue.pop();
+    orig_queue.pop();
+  }
+  ASSERT_TRUE(s21_queue.empty());
+  ASSERT_THROW(s21_queue.pop(), std::out_of_range);
+}
+
+TEST(test_container, queue_test_list_container) {
+  s21::queue<std::string, s21::list<std::string>> s21_queue{"a", "b"};
+  s21_queue.insert_many_back("c", "d");
+  s21::queue<std::string, s21::list<std::string>> s21_queue2(s21_queue);
+
+  ASSERT_EQ(s21_queue2.size(), 4u);
+  ASSERT_EQ(s21_queue2.front(), "a");
+  ASSERT_EQ(s21_queue2.back(), "d");
+  s21_queue2.pop();
+  ASSERT_EQ(s21_queue2.front(), "b");
+  ASSERT_EQ(s21_queue.size(), 4u);
+}
+
+TEST(test_container, ring_buffer_capacity) {
+  s21::ring_buffer<std::string> buffer;
+  ASSERT_EQ(buffer.capacity(), 0u);
+  buffer.reserve(100);
+  ASSERT_EQ(buffer.capacity(), 128u);
+
+  for (int i = 0; i < 200; ++i) {
+    buffer.push_back(std::to_string(i));
+    buffer.pop_front();
+    buffer.emplace_back(3, 'x');
+  }
+  ASSERT_EQ(buffer.size(), 200u);
+  ASSERT_EQ(buffer.capacity(), 256u);
+  ASSERT_EQ(buffer.front(), "100");
+  ASSERT_EQ(buffer[199], "xxx");
+
+  s21::ring_buffer<std::string> copy(buffer);
+  buffer.clear();
+  ASSERT_TRUE(buffer.empty());
+  ASSERT_EQ(copy.size(), 200u);
+  ASSERT_EQ(copy.back(), "xxx");
+}
+
+TEST(test_container, ring_buffer_grow_strong_guarantee) {
+  ThrowingCopy::copies_left = 100;
+  {
+    s21::ring_buffer<ThrowingCopy> buffer;
+    for (int i = 0; i < 11; ++i) buffer.emplace_back(i);
+    for (int i = 0; i < 3; ++i) buffer.pop_front();
+    ASSERT_EQ(buffer.capacity(), 16u);
+    for (int i = 11; i < 27; ++i) {
+      if (buffer.size() < buffer.capacity()) buffer.emplace_back(i);
+    }
+    ASSERT_EQ(buffer.size(), 16u);
+    ThrowingCopy::copies_left = 5;
+    EXPECT_THROW(buffer.emplace_back(99), std::runtime_error);
+    EXPECT_EQ(ThrowingCopy::live, 16);
+    ASSERT_EQ(buffer.size(), 16u);
+    EXPECT_EQ(buffer.capacity(), 16u);
+    for (int i = 0; i < 16; ++i) EXPECT_EQ(buffer[i].value, i + 3);
+
+    ThrowingCopy::copies_left = 100;
+    buffer.emplace_back(99);
+    EXPECT_EQ(buffer.capacity(), 32u);
+    EXPECT_EQ(buffer.front().value, 3);
+    EXPECT_EQ(buffer.back().value, 99);
+  }
+  EXPECT_EQ(ThrowingCopy::live, 0);
+}
+
+// Pushing one of its own elements into a full buffer: the element is read
+// before Grow moves it away
+TEST(test_container, ring_buffer_push_own_element) {
+  s21::ring_buffer<std::string> words;
+  for (int i = 0; i < 16; ++i) words.push_back(std::string(40, 'a' + i));
+  ASSERT_EQ(words.size(), words.capacity());
+  words.push_back(words.front());
+  EXPECT_EQ(words.back(), std::string(40, 'a'));
+  EXPECT_EQ(words.front(), std::string(40, 'a'));
+
+  s21::ring_buffer<std::shared_ptr<int>> pointers;
+  pointers.push_back(std::make_shared<int>(7));
+  while (pointers.size() < pointers.capacity()) {
+    pointers.push_back(std::make_shared<int>(0));
+  }
+  pointers.emplace_back(pointers.front());
+  EXPECT_EQ(*pointers.back(), 7);
+  EXPECT_EQ(pointers.front().use_count(), 2);
+
+  s21::queue<std::string> queue;
+  for (int i = 0; i < 16; ++i) queue.push(std::string(40, 'a' + i));
+  for (int i = 0; i < 40; ++i) {
+    queue.push(queue.front());
+    queue.pop();
+  }
+  EXPECT_EQ(queue.size(), 16u);
+  EXPECT_EQ(queue.back(), std::string(40, 'a' + 39 % 16));
+}
+
+// deque
+TEST(DequeTest, PushPopBothEnds) {
+  s21::deque<int> my_deque;
+  std::deque<int> std_deque;
+  for (int i = 0; i < 5000; ++i) {
+    if (i % 2) {
+      my_deque.push_back(i);
+      std_deque.push_back(i);
+    } else {
+      my_deque.push_front(i);
+      std_deque.push_front(i);
+    }
+  }
+  ASSERT_EQ(my_deque.size(), std_deque.size());
+  for (size_t i = 0; i < std_deque.size(); i += 37) {
+    ASSERT_EQ(my_deque[i], std_deque[i]);
+  }
+  while (!std_deque.empty()) {
+    ASSERT_EQ(my_deque.front(), std_deque.front());
+    ASSERT_EQ(my_deque.back(), std_deque.back());
+    my_deque.pop_front();
+    std_deque.pop_front();
+    if (!std_deque.empty()) {
+      my_deque.pop_back();
+      std_deque.pop_back();
+    }
+  }
+  EXPECT_TRUE(my_deque.empty());
+  EXPECT_THROW(my_deque.pop_back(), std::out_of_range);
+  EXPECT_THROW(my_deque.at(0), std::out_of_range);
+}
+
+TEST(DequeTest, NoRelocationOnGrowth) {
+  s21::deque<std::string> my_deque{"first"};
+  const std::string *address = &my_deque.front();
+  for (int i = 0; i < 10000; ++i) {
+    my_deque.push_back(std::to_string(i));
+    my_deque.emplace_front(2, 'x');
+  }
+  EXPECT_EQ(address, &my_deque[10000]);
+  EXPECT_EQ(*address, "first");
+}
+
+TEST(DequeTest, IteratorsAndCopy) {
+  s21::deque<int> my_deque{5, 1, 4, 2, 3};
+  std::sort(my_deque.begin(), my_deque.end());
+  s21::deque<int> copy(my_deque);
+  my_deque.clear();
+  EXPECT_TRUE(my_deque.empty());
+  EXPECT_EQ(copy.end() - copy.begin(), 5);
+  int expected = 1;
+  for (int value : copy) EXPECT_EQ(value, expected++);
+
+  s21::deque<int> moved(std::move(copy));
+  EXPECT_EQ(moved.size(), 5u);
+  EXPECT_TRUE(copy.empty());
+}
+
+TEST(DequeTest, AsQueueAndStackContainer) {
+  s21::queue<int, s21::deque<int>> queue{1, 2, 3};
+  queue.push(4);
+  queue.pop();
+  EXPECT_EQ(queue.front(), 2);
+  EXPECT_EQ(queue.back(), 4);
+
+  s21::stack<int, s21::deque<int>> stack;
+  stack.push(1);
+  stack.push(2);
+  EXPECT_EQ(stack.top(), 2);
+  stack.pop();
+  EXPECT_EQ(stack.top(), 1);
+  EXPECT_EQ(stack.size(), 1u);
+}
+
+// priority_queue / pairing_heap
+// Random pushes, pops and fused operations against std::priority_queue
+template <typename Queue>
+void CheckAgainstStdHeap() {
+  Queue queue;
+  std::priority_queue<int> expected;
+  unsigned seed = 31337;
+  for (int i = 0; i < 20000; ++i) {
+    seed = seed * 1103515245 + 12345;
+    int key = static_cast<int>((seed >> 8) % 1000);
+    switch (seed % 5) {
+      case 0:
+      case 1:
+        queue.push(key);
+        expected.push(key);
+        break;
+      case 2:
+        if (!expected.empty()) {
+          queue.pop();
+          expected.pop();
+        }
+        break;
+      case 3: {
+        expected.push(key);
+        int top = expected.top();
+        expected.pop();
+        ASSERT_EQ(queue.push_pop(key), top);
+        break;
+      }
+      default:
+        if (!expected.empty()) {
+          int top = expected.top();
+          expected.pop();
+          expected.push(key);
+          ASSERT_EQ(queue.replace_top(key), top);
+        }
+    }
+    ASSERT_EQ(queue.size(), expected.size());
+    if (!expected.empty()) {
+      ASSERT_EQ(queue.top(), expected.top());
+    }
+  }
+  while (!expected.empty()) {
+    ASSERT_EQ(queue.top(), expected.top());
+    queue.pop();
+    expected.pop();
+  }
+  EXPECT_TRUE(queue.empty());
+}
+
+TEST(priorityQueueTest, MatchesStdPriorityQueue) {
+  CheckAgainstStdHeap<s21::priority_queue<int>>();
+  CheckAgainstStdHeap<
+      s21::priority_queue<int, s21::vector<int>, std::less<int>, 2>>();
+  CheckAgainstStdHeap<
+      s21::priority_queue<int, s21::deque<int>, std::less<int>, 8>>();
+}
+
+TEST(priorityQueueTest, BuildsFromRange) {
+  std::vector<int> items;
+  for (int i = 0; i < 1000; ++i) items.push_back(i * 7919 % 1009);
+  s21::priority_queue<int, s21::vector<int>, std::greater<int>> queue(
+      items.begin(), items.end());
+  std::sort(items.begin(), items.end());
+  for (int item : items) {
+    ASSERT_EQ(queue.top(), item);
+    queue.pop();
+  }
+  EXPECT_THROW(queue.top(), std::out_of_range);
+  EXPECT_THROW(queue.pop(), std::out_of_range);
+  EXPECT_THROW(queue.replace_top(1), std::out_of_range);
+  EXPECT_EQ(queue.push_pop(1), 1);
+  EXPECT_TRUE(queue.empty());
+
+  s21::priority_queue<int> small{3, 1, 4, 1, 5};
+  EXPECT_EQ(small.top(), 5);
+  EXPECT_EQ(small.push_pop(9), 9);
+  EXPECT_EQ(small.push_pop(2), 5);
+  EXPECT_EQ(small.top(), 4);
+}
+
+TEST(priorityQueueTest, EmplacesPairs) {
+  s21::priority_queue<std::pair<int, std::string>> queue;
+  queue.emplace(2, "two");
+  queue.emplace(3, "three");
+  queue.push({1, "one"});
+  EXPECT_EQ(queue.top().second, "three");
+  s21::priority_queue<std::pair<int, std::string>> moved(std::move(queue));
+  moved.pop();
+  EXPECT_EQ(moved.top().second, "two");
+  EXPECT_EQ(moved.size(), 2u);
+}
+
+// Handles are updated in both directions and erased against a set of the
+// live values, which are distinct so that a pop tells which handle it ends
+TEST(pairingHeapTest, UpdateAndErase) {
+  s21::pairing_heap<int, std::greater<int>> heap;
+  std::vector<s21::pairing_heap<int, std::greater<int>>::handle> handles;
+  std::vector<int> values;
+  std::set<int> expected;
+  unsigned seed = 5150;
+  for (int i = 0; i < 20000; ++i) {
+    seed = seed * 1103515245 + 12345;
+    int key = static_cast<int>((seed >> 8) % 5000) * 20000 + i;
+    size_t slot = handles.empty() ? 0 : (seed >> 4) % handles.size();
+    switch (seed % 6) {
+      case 0:
+      case 1:
+        handles.push_back(heap.push(key));
+        values.push_back(key);
+        expected.insert(key);
+        break;
+      case 2:
+      case 3:
+        if (!handles.empty()) {
+          ASSERT_EQ(heap.value(handles[slot]), values[slot]);
+          expected.erase(values[slot]);
+          expected.insert(key);
+          heap.update(handles[slot], key);
+          values[slot] = key;
+        }
+        break;
+      case 4:
+        if (!handles.empty()) {
+          heap.erase(handles[slot]);
+          expected.erase(values[slot]);
+          handles[slot] = handles.back();
+          values[slot] = values.back();
+          handles.pop_back();
+          values.pop_back();
+        }
+        break;
+      default:
+        if (!handles.empty()) {
+          ASSERT_EQ(heap.top(), *expected.begin());
+          size_t index = std::find(values.begin(), values.end(), heap.top()) -
+                         values.begin();
+          heap.pop();
+          expected.erase(expected.begin());
+          handles[index] = handles.back();
+          values[index] = values.back();
+          handles.pop_back();
+          values.pop_back();
+        }
+    }
+    ASSERT_EQ(heap.size(), expected.size());
+    if (!expected.empty()) {
+      ASSERT_EQ(heap.top(), *expected.begin());
+    }
+  }
+  s21::pairing_heap<int, std::greater<int>> moved(std::move(heap));
+  EXPECT_TRUE(heap.empty());
+  EXPECT_THROW(heap.pop(), std::out_of_range);
+  while (!expected.empty()) {
+    ASSERT_EQ(moved.top(), *expected.begin());
+    moved.pop();
+    expected.erase(expected.begin());
+  }
+  EXPECT_TRUE(moved.empty());
+}
+
+// spsc_queue
+TEST(SpscQueueTest, TryPushPop) {
+  s21::spsc_queue<std::string> queue(3);
+  EXPECT_EQ(queue.capacity(), 4u);
+  EXPECT_TRUE(queue.empty());
+  EXPECT_TRUE(queue.try_push("one"));
+  EXPECT_TRUE(queue.try_emplace(3, 't'));
+  EXPECT_TRUE(queue.try_push(std::string("three")));
+  EXPECT_TRUE(queue.try_push("four"));
+  EXPECT_FALSE(queue.try_push("five"));
+  EXPECT_EQ(queue.size(), 4u);
+
+  std::string value;
+  EXPECT_TRUE(queue.try_pop(value));
+  EXPECT_EQ(value, "one");
+  EXPECT_TRUE(queue.try_pop(value));
+  EXPECT_EQ(value, "ttt");
+  EXPECT_EQ(queue.size(), 2u);
+}
+
+TEST(SpscQueueTest, Batch) {
+  s21::spsc_queue<int> queue(8);
+  std::vector<int> input{1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+  EXPECT_EQ(queue.try_push_many(input.begin(), input.end()), 8u);
+
+  std::vector<int> output;
+  EXPECT_EQ(queue.try_pop_many(std::back_inserter(output), 5), 5u);
+  EXPECT_EQ(queue.try_push_many(input.begin() + 8, input.end()), 2u);
+  EXPECT_EQ(queue.try_pop_many(std::back_inserter(output), 100), 5u);
+  EXPECT_EQ(output, input);
+  EXPECT_TRUE(queue.empty());
+}
+
+// Move assignment throws for the element whose id is fail_id
+struct FragileJob {
+  static int fail_id;
+  int id = 0;
+  FragileJob() = default;
+  explicit FragileJob(int value) : id(value) {}
+  FragileJob(const FragileJob &) = default;
+  FragileJob(FragileJob &&) noexcept = default;
+  FragileJob &operator=(const FragileJob &) = default;
+  FragileJob &operator=(FragileJob &&other) {
+    if (other.id == fail_id) throw std::runtime_error("move assignment failed");
+    id = other.id;
+    return *this;
+  }
+};
+int FragileJob::fail_id = -1;
+
+TEST(SpscQueueTest, ThrowingBatchKeepsProgress) {
+  ThrowingCopy::live = 0;
+  {
+    std::vector<ThrowingCopy> input;
+    input.reserve(4);
+    for (int i = 0; i < 4; ++i) input.emplace_back(i);
+    s21::spsc_queue<ThrowingCopy> queue(8);
+    ThrowingCopy::copies_left = 2;
+    EXPECT_THROW(queue.try_push_many(input.begin(), input.end()),
+                 std::runtime_error);
+    EXPECT_EQ(queue.size(), 2u);
+    EXPECT_EQ(ThrowingCopy::live, 6);
+  }
+  EXPECT_EQ(ThrowingCopy::live, 0);
+
+  s21::spsc_queue<FragileJob> queue(4);
+  for (int id = 0; id < 4; ++id) EXPECT_TRUE(queue.try_emplace(id));
+  std::vector<FragileJob> output(4);
+  FragileJob::fail_id = 2;
+  EXPECT_THROW(queue.try_pop_many(output.begin(), 4), std::runtime_error);
+  FragileJob::fail_id = -1;
+  EXPECT_EQ(output[1].id, 1);
+  EXPECT_EQ(queue.size(), 2u);
+  EXPECT_TRUE(queue.try_emplace(4));
+  EXPECT_TRUE(queue.try_emplace(5));
+  EXPECT_EQ(queue.try_pop_many(output.begin(), 4), 4u);
+  EXPECT_EQ(output[0].id, 2);
+  EXPECT_EQ(output[3].id, 5);
+}
+
+TEST(SpscQueueTest, Stress) {
+  const int count = 200000;
+  s21::spsc_queue<int> queue(64);
+  std::thread producer([&queue] {
+    for (int i = 0; i < count; ++i) queue.push(i);
+  });
+
+  bool ordered = true;
+  for (int i = 0; i < count; ++i) {
+    int value = -1;
+    queue.pop(value);
+    if (value != i) ordered = false;
+  }
+  producer.join();
+  EXPECT_TRUE(ordered);
+  EXPECT_TRUE(queue.empty());
+}
+
+// mpmc_queue
+TEST(MpmcQueueTest, TryPushPop) {
+  s21::mpmc_queue<std::string> queue(2);
+  EXPECT_TRUE(queue.try_push("one"));
+  EXPECT_TRUE(queue.try_emplace(3, 't'));
+  EXPECT_FALSE(queue.try_push("three"));
+
+  std::string value;
+  EXPECT_TRUE(queue.try_pop(value));
+  EXPECT_EQ(value, "one");
+  EXPECT_TRUE(queue.try_push("three"));
+
+  std::vector<std::string> output;
+  EXPECT_EQ(queue.try_pop_many(std::back_inserter(output), 10), 2u);
+  EXPECT_EQ(output, std::vector<std::string>({"ttt", "three"}));
+  EXPECT_FALSE(queue.try_pop(value));
+}
+
+// No default constructor, and the constructor throws for negative ids
+struct Job {
+  int id;
+  explicit Job(int value) : id(value) {
+    if (value < 0) throw std::invalid_argument("negative id");
+  }
+};
+
+TEST(MpmcQueueTest, ThrowingConstructor) {
+  s21::mpmc_queue<Job> queue(4);
+  EXPECT_TRUE(queue.try_emplace(1));
+  EXPECT_THROW(queue.try_emplace(-1), std::invalid_argument);
+  EXPECT_TRUE(queue.try_emplace(2));
+  EXPECT_EQ(queue.size(), 2u);
+
+  std::vector<Job> output;
+  EXPECT_EQ(queue.try_pop_many(std::back_inserter(output), 10), 2u);
+  ASSERT_EQ(output.size(), 2u);
+  EXPECT_EQ(output[0].id, 1);
+  EXPECT_EQ(output[1].id, 2);
+  EXPECT_TRUE(queue.empty());
+}
+
+TEST(MpmcQueueTest, ThrowingTakeReleasesCell) {
+  s21::mpmc_queue<FragileJob> queue(4);
+  FragileJob job;
+  for (int lap = 0; lap < 3; ++lap) {
+    EXPECT_TRUE(queue.try_emplace(2 * lap));
+    EXPECT_TRUE(queue.try_emplace(2 * lap + 1));
+    FragileJob::fail_id = 2 * lap;
+    EXPECT_THROW(queue.try_pop(job), std::runtime_error);
+    EXPECT_EQ(queue.size(), 1u);
+    ASSERT_TRUE(queue.try_pop(job));
+    EXPECT_EQ(job.id, 2 * lap + 1);
+  }
+
+  std::vector<FragileJob> output(3);
+  for (int id = 6; id < 9; ++id) EXPECT_TRUE(queue.try_emplace(id));
+  FragileJob::fail_id = 7;
+  EXPECT_THROW(queue.try_pop_many(output.begin(), 3), std::runtime_error);
+  FragileJob::fail_id = -1;
+  EXPECT_EQ(output[0].id, 6);
+  EXPECT_EQ(queue.try_pop_many(output.begin(), 3), 1u);
+  EXPECT_EQ(output[0].id, 8);
+  EXPECT_TRUE(queue.empty());
+}
+
+TEST(MpmcQueueTest, Stress) {
+  const int producers = 4;
+  const int consumers = 4;
+  const int per_producer = 50000;
+  s21::mpmc_queue<int> queue(128);
+  std::atomic<long long> sum(0);
+  std::atomic<int> received(0);
+
+  std::vector<std::thread> threads;
+  for (int p = 0; p < producers; ++p) {
+    threads.emplace_back([&queue, p] {
+      for (int i = 0; i < per_producer; ++i) queue.push(p * per_producer + i);
+    });
+  }
+  for (int c = 0; c < consumers; ++c) {
+    threads.emplace_back([&] {
+      int value;
+      while (received.load() < producers * per_producer) {
+        if (queue.try_pop(value)) {
+          sum += value;
+          ++received;
+        } else {
+          std::this_thread::yield();
+        }
+      }
+    });
+  }
+  for (auto &thread : threads) thread.join();
+
+  long long total = static_cast<long long>(producers) * per_producer;
+  EXPECT_EQ(received.load(), total);
+  EXPECT_EQ(sum.load(), total * (total - 1) / 2);
+  EXPECT_TRUE(queue.empty());
+}
+
+// work_stealing_deque
+TEST(WorkStealingDequeTest, OwnerAndThief) {
+  s21::work_stealing_deque<int> deque(2);
+  for (int i = 0; i < 100; ++i) deque.push(i);
+  EXPECT_EQ(deque.size(), 100u);
+
+  int value = -1;
+  EXPECT_TRUE(deque.steal(value));
+  EXPECT_EQ(value, 0);
+  EXPECT_TRUE(deque.pop(value));
+  EXPECT_EQ(value, 99);
+  while (deque.pop(value)) {
+  }
+  EXPECT_EQ(value, 1);
+  EXPECT_TRUE(deque.empty());
+  EXPECT_FALSE(deque.steal(value));
+}
+
+TEST(WorkStealingDequeTest, Stress) {
+  const int count = 100000;
+  const int thieves = 3;
+  s21::work_stealing_deque<int> deque(4);
+  std::vector<std::atomic<int>> seen(count);
+  std::atomic<bool> done(false);
+
+  std::vector<std::thread> threads;
+  for (int t = 0; t < thieves; ++t) {
+    threads.emplace_back([&] {
+      int value;
+      while (!done.load() || !deque.empty()) {
+        if (deque.steal(value)) seen[value]++;
+      }
+    });
+  }
+  int value;
+  for (int i = 0; i < count; ++i) {
+    deque.push(i);
+    if (i % 3 == 0 && deque.pop(value)) seen[value]++;
+  }
+  while (deque.pop(value)) seen[value]++;
+  done.store(true);
+  for (auto &thread : threads) thread.join();
+
+  int once = 0;
+  for (auto &flag : seen) once += flag.load() == 1;
+  EXPECT_EQ(once, count);
+}
+
+// thread_pool
+static long long ParallelFibonacci(s21::thread_pool &pool, int n) {
+  if (n < 12) return n < 2 ? n : ParallelFibonacci(pool, n - 1) +
+                                     ParallelFibonacci(pool, n - 2);
+  long long left = 0;
+  s21::task_group group(pool);
+  group.run([&] { left = ParallelFibonacci(pool, n - 1); });
+  long long right = ParallelFibonacci(pool, n - 2);
+  group.wait();
+  return left + right;
+}
+
+TEST(ThreadPoolTest, ForkJoin) {
+  s21::thread_pool pool(4);
+  EXPECT_EQ(pool.size(), 4u);
+  EXPECT_EQ(ParallelFibonacci(pool, 25), 75025);
+}
+
+TEST(ThreadPoolTest, ParallelForOverVector) {
+  s21::thread_pool pool(3);
+  s21::vector<long long> values;
+  for (int i = 0; i < 10000; ++i) values.push_back(i);
+
+  pool.parallel_for(size_t(0), values.size(),
+                    [&values](size_t i) { values[i] *= 2; });
+  long long sum = 0;
+  for (long long value : values) sum += value;
+  EXPECT_EQ(sum, 9999LL * 10000);
+}
+
+TEST(ThreadPoolTest, ParallelForEachOverMap) {
+  s21::thread_pool pool(2);
+  s21::map<int, int> map;
+  for (int i = 0; i < 200; ++i) map.insert(i, i);
+
+  std::atomic<int> sum(0);
+  pool.parallel_for_each(map.begin(), map.end(),
+                         [&sum](const auto &item) { sum += item.second; },
+                         7);
+  EXPECT_EQ(sum.load(), 199 * 200 / 2);
+}
+
+TEST(ThreadPoolTest, SubmitAndErrors) {
+  std::atomic<int> counter(0);
+  {
+    s21::thread_pool pool(2);
+    for (int i = 0; i < 100; ++i) pool.submit([&counter] { ++counter; });
+
+    s21::task_group group(pool);
+    group.run([] { throw std::runtime_error("task failed"); });
+    group.run([&counter] { ++counter; });
+    EXPECT_THROW(group.wait(), std::runtime_error);
+  }
+  EXPECT_EQ(counter.load(), 101);
+}
+
 // stack
 TEST(StackTest, test1) {
   s21::stack<int> stack;
@@ -1013,6 +3097,39 @@ TEST(StackTest, test3) {
   ASSERT_EQ(stack.size(), stack_orig.size());
 }
 
+TEST(StackTest, MoveOnlyPop) {
+  s21::stack<std::unique_ptr<int>> stack;
+  stack.push(std::make_unique<int>(1));
+  stack.emplace(new int(2));
+  std::unique_ptr<int> top = stack.pop_value();
+  ASSERT_EQ(*top, 2);
+  ASSERT_EQ(*stack.top(), 1);
+  stack.pop();
+  ASSERT_TRUE(stack.empty());
+  ASSERT_THROW(stack.pop(), std::out_of_range);
+  ASSERT_THROW(stack.pop_value(), std::out_of_range);
+}
+
+TEST(StackTest, BulkOperations) {
+  s21::stack<std::string> stack;
+  stack.reserve(16);
+  std::vector<std::string> input{"a", "b", "c", "d"};
+  stack.push_range(input.begin(), input.end());
+  ASSERT_EQ(stack.size(), 4u);
+  ASSERT_EQ(stack.top(), "d");
+
+  std::vector<std::string> output;
+  stack.pop_n(3, std::back_inserter(output));
+  ASSERT_EQ(output, std::vector<std::string>({"d", "c", "b"}));
+  ASSERT_EQ(stack.top(), "a");
+  ASSERT_THROW(stack.pop_n(2, std::back_inserter(output)), std::out_of_range);
+
+  s21::stack<std::string, s21::deque<std::string>> deque_stack;
+  deque_stack.reserve(10);
+  deque_stack.push_range(input.begin(), input.end());
+  ASSERT_EQ(deque_stack.top(), "d");
+}
+
 // vector
 TEST(VectorTest, test1) {
   s21::vector<int> vec;
@@ -1030,6 +3147,1044 @@ TEST(VectorTest, test2) {
   ASSERT_EQ(vec1.at(0), 6);
 }
 
+TEST(VectorTest, CopyAndMove) {
+  s21::vector<std::string> source = {"a", "b", "c"};
+  s21::vector<std::string> copy(source);
+  copy[0] = "z";
+  ASSERT_EQ(source[0], "a");
+  ASSERT_EQ(copy.size(), 3u);
+
+  s21::vector<std::string> moved(std::move(copy));
+  ASSERT_EQ(moved[0], "z");
+  ASSERT_EQ(copy.size(), 0u);
+
+  copy = moved;
+  ASSERT_EQ(copy[2], "c");
+  source = std::move(moved);
+  ASSERT_EQ(source[0], "z");
+}
+
+// static_vector / static_queue
+static_assert(s21::static_vector<int, 8>::capacity() == 8,
+              "capacity is a constant expression");
+static_assert(s21::static_queue<std::string, 5>::max_size() == 5,
+              "max_size is a constant expression");
+
+// Counts live instances and has no default constructor
+struct Tracked {
+  static int live;
+  std::string name;
+  explicit Tracked(std::string value) : name(std::move(value)) { ++live; }
+  Tracked(const Tracked &other) : name(other.name) { ++live; }
+  Tracked(Tracked &&other) noexcept : name(std::move(other.name)) { ++live; }
+  Tracked &operator=(const Tracked &other) = default;
+  Tracked &operator=(Tracked &&other) = default;
+  ~Tracked() { --live; }
+};
+int Tracked::live = 0;
+
+TEST(StaticVectorTest, InlineUpToCapacity) {
+  {
+    s21::static_vector<Tracked, 4> vec;
+    EXPECT_EQ(Tracked::live, 0);
+    vec.emplace_back("a");
+    vec.push_back(Tracked("b"));
+    vec.emplace_back("c");
+    EXPECT_EQ(Tracked::live, 3);
+    EXPECT_GE(reinterpret_cast<const char *>(vec.data()),
+              reinterpret_cast<const char *>(&vec));
+    EXPECT_LT(reinterpret_cast<const char *>(vec.data() + 3),
+              reinterpret_cast<const char *>(&vec + 1));
+    vec.emplace_back("d");
+    EXPECT_TRUE(vec.full());
+    EXPECT_THROW(vec.emplace_back("e"), std::length_error);
+    EXPECT_EQ(vec.size(), 4u);
+    EXPECT_EQ(vec.back().name, "d");
+    vec.pop_back();
+    EXPECT_EQ(Tracked::live, 3);
+    EXPECT_THROW(vec.at(3), std::out_of_range);
+    EXPECT_THROW(vec.reserve(5), std::length_error);
+
+    s21::static_vector<Tracked, 4> copy(vec);
+    EXPECT_EQ(Tracked::live, 6);
+    s21::static_vector<Tracked, 4> moved(std::move(copy));
+    EXPECT_TRUE(copy.empty());
+    EXPECT_EQ(Tracked::live, 6);
+    moved.pop_back();
+    moved.swap(vec);
+    EXPECT_EQ(vec.size(), 2u);
+    EXPECT_EQ(moved.size(), 3u);
+    EXPECT_EQ(moved[2].name, "c");
+    EXPECT_EQ(vec.front().name, "a");
+    EXPECT_EQ(Tracked::live, 5);
+    vec = moved;
+    EXPECT_EQ(vec.size(), 3u);
+    EXPECT_EQ(Tracked::live, 6);
+  }
+  EXPECT_EQ(Tracked::live, 0);
+
+  s21::static_vector<int, 8> numbers{5, 1, 4};
+  numbers.resize(5);
+  std::sort(numbers.begin(), numbers.end());
+  EXPECT_EQ(std::vector<int>(numbers.begin(), numbers.end()),
+            std::vector<int>({0, 0, 1, 4, 5}));
+  numbers.assign(8, 7);
+  EXPECT_THROW(numbers.push_back(1), std::length_error);
+  EXPECT_THROW((s21::static_vector<int, 2>{1, 2, 3}), std::length_error);
+}
+
+TEST(StaticQueueTest, WrapsAroundLikeStdQueue) {
+  s21::static_queue<int, 5> queue;
+  std::queue<int> expected;
+  EXPECT_THROW(queue.front(), std::out_of_range);
+  EXPECT_THROW(queue.pop(), std::out_of_range);
+  for (int i = 0; i < 1000; ++i) {
+    if (i % 3 != 2 && !queue.full()) {
+      queue.push(i);
+      expected.push(i);
+    } else if (!expected.empty()) {
+      queue.pop();
+      expected.pop();
+    }
+    ASSERT_EQ(queue.size(), expected.size());
+    if (!expected.empty()) {
+      ASSERT_EQ(queue.front(), expected.front());
+      ASSERT_EQ(queue.back(), expected.back());
+    }
+  }
+  while (!queue.full()) queue.push(-1);
+  EXPECT_THROW(queue.push(1), std::length_error);
+
+  s21::static_queue<std::string, 3> strings{"a", "b"};
+  strings.pop();
+  strings.insert_many_back("c", "d");
+  EXPECT_THROW(strings.insert_many_back("e"), std::length_error);
+  s21::static_queue<std::string, 3> copy(strings);
+  EXPECT_EQ(copy[0], "b");
+  EXPECT_EQ(copy.back(), "d");
+  s21::static_queue<std::string, 3> other{"x"};
+  other.swap(strings);
+  EXPECT_EQ(other.size(), 3u);
+  EXPECT_EQ(other.front(), "b");
+  EXPECT_EQ(strings.front(), "x");
+  strings = std::move(other);
+  EXPECT_TRUE(other.empty());
+  EXPECT_EQ(strings.back(), "d");
+}
+
+// bitset / dynamic_bitset
+// Positions of the set bits through find_first / find_next
+template <typename Bits>
+std::vector<size_t> SetBits(const Bits &bits) {
+  std::vector<size_t> positions;
+  for (size_t pos = bits.find_first(); pos != Bits::npos;
+       pos = bits.find_next(pos)) {
+    positions.push_back(pos);
+  }
+  return positions;
+}
+
+TEST(bitsetTest, MatchesStdBitset) {
+  s21::bitset<200> bits;
+  s21::bitset<200> other;
+  std::bitset<200> expected;
+  std::bitset<200> expected_other;
+  unsigned seed = 48;
+  for (int i = 0; i < 600; ++i) {
+    seed = seed * 1103515245 + 12345;
+    size_t pos = (seed >> 8) % 200;
+    if (seed % 3 == 0) {
+      bits.flip(pos);
+      expected.flip(pos);
+    } else {
+      other.set(pos, seed % 2);
+      expected_other.set(pos, seed % 2);
+    }
+  }
+  EXPECT_EQ(bits.count(), expected.count());
+  EXPECT_THROW(bits.test(200), std::out_of_range);
+  s21::bitset<200> and_not = bits;
+  and_not.and_not(other);
+  const std::pair<s21::bitset<200>, std::bitset<200>> results[] = {
+      {bits & other, expected & expected_other},
+      {bits | other, expected | expected_other},
+      {bits ^ other, expected ^ expected_other},
+      {and_not, expected & ~expected_other},
+      {~bits, ~expected}};
+  for (const auto &pair : results) {
+    std::vector<size_t> positions;
+    for (size_t pos = 0; pos < 200; ++pos) {
+      if (pair.second[pos]) positions.push_back(pos);
+    }
+    ASSERT_EQ(SetBits(pair.first), positions);
+    for (size_t k = 0; k < positions.size(); ++k) {
+      ASSERT_EQ(pair.first.select(k), positions[k]);
+      ASSERT_EQ(pair.first.rank(positions[k]), k);
+    }
+    ASSERT_EQ(pair.first.select(positions.size()), s21::bitset<200>::npos);
+    ASSERT_EQ(pair.first.rank(200), positions.size());
+  }
+  bits.set();
+  EXPECT_TRUE(bits.all());
+  EXPECT_EQ(bits.count(), 200u);
+  bits.reset();
+  EXPECT_TRUE(bits.none());
+  EXPECT_EQ(bits.find_first(), s21::bitset<200>::npos);
+}
+
+TEST(dynamicBitsetTest, GrowsAndCombinesLikeIdSets) {
+  s21::dynamic_bitset bits;
+  std::vector<bool> expected;
+  for (int i = 0; i < 3000; ++i) {
+    bool value = i % 7 == 0 || i % 11 == 0;
+    bits.push_back(value);
+    expected.push_back(value);
+  }
+  bits.resize(3100, true);
+  expected.resize(3100, true);
+  bits.resize(3050);
+  expected.resize(3050);
+  ASSERT_EQ(bits.size(), expected.size());
+  std::vector<size_t> positions;
+  for (size_t pos = 0; pos < expected.size(); ++pos) {
+    ASSERT_EQ(bits[pos], expected[pos]);
+    if (expected[pos]) positions.push_back(pos);
+  }
+  EXPECT_EQ(SetBits(bits), positions);
+  EXPECT_EQ(bits.count(), positions.size());
+
+  // Same answers with and without the rank index
+  for (int pass = 0; pass < 2; ++pass) {
+    if (pass == 1) bits.build_rank_index();
+    EXPECT_EQ(bits.has_rank_index(), pass == 1);
+    size_t ones = 0;
+    for (size_t pos = 0; pos <= bits.size(); ++pos) {
+      ASSERT_EQ(bits.rank(pos), ones);
+      if (pos < bits.size() && bits[pos]) ++ones;
+    }
+    for (size_t k = 0; k < positions.size(); ++k) {
+      ASSERT_EQ(bits.select(k), positions[k]);
+    }
+    EXPECT_EQ(bits.select(positions.size()), s21::dynamic_bitset::npos);
+  }
+  bits.flip(0);
+  EXPECT_FALSE(bits.has_rank_index());
+  EXPECT_THROW(bits.set(3050), std::out_of_range);
+  EXPECT_THROW(bits.rank(3051), std::out_of_range);
+
+  s21::dynamic_bitset small(100);
+  small.set(5).set(64).set(77).set(99);
+  s21::dynamic_bitset both = bits & small;
+  EXPECT_EQ(both.size(), 3050u);
+  EXPECT_EQ(SetBits(both), std::vector<size_t>({77, 99}));
+  s21::dynamic_bitset either = small | bits;
+  EXPECT_EQ(either.size(), 3050u);
+  EXPECT_EQ(either.count(), bits.count() + 2);
+  EXPECT_EQ(SetBits(small.and_not(bits)), std::vector<size_t>({5, 64}));
+  EXPECT_TRUE((bits ^ bits).none());
+  EXPECT_EQ((~bits).count(), bits.size() - bits.count());
+}
+
+TEST(dynamicBitsetTest, ConvertsFromAndToSet) {
+  s21::set<uint32_t> ids;
+  for (uint32_t i = 0; i < 5000; ++i) ids.insert(i * 2654435761u % 100003);
+  s21::dynamic_bitset bits(ids);
+  s21::bitset<100003> fixed(ids);
+  EXPECT_EQ(bits.count(), ids.size());
+  EXPECT_EQ(fixed.count(), ids.size());
+  EXPECT_EQ(bits.size(), *--ids.end() + 1);
+  ids.for_each([&](uint32_t id) { EXPECT_TRUE(bits.test(id)); });
+
+  s21::set<uint32_t> back = bits.to_set();
+  EXPECT_EQ(back.size(), ids.size());
+  auto expected = ids.begin();
+  for (auto it = back.begin(); it != back.end(); ++it, ++expected) {
+    ASSERT_EQ(*it, *expected);
+  }
+  EXPECT_EQ(fixed.to_set().size(), ids.size());
+  EXPECT_THROW(s21::bitset<10>{ids}, std::out_of_range);
+  EXPECT_TRUE(s21::dynamic_bitset(s21::set<uint32_t>()).empty());
+}
+
+// roaring_set
+// Keys spread over chunks that end up as arrays, bitmaps and runs, the last
+// chunk reaching the largest key
+std::set<uint32_t> MixedIds(unsigned seed) {
+  std::set<uint32_t> ids;
+  for (int i = 0; i < 12000; ++i) {
+    seed = seed * 1103515245 + 12345;
+    uint32_t low = (seed >> 8) & 0xFFFF;
+    switch (i % 4) {
+      case 0:
+        ids.insert(low);
+        break;
+      case 1:
+        ids.insert(0x10000 | (low & 0x1FFF));
+        ids.insert(0x12000 | (low >> 3));
+        break;
+      case 2:
+        for (uint32_t k = 0; k < 20; ++k) ids.insert(0x30000 | (low + k));
+        break;
+      default:
+        ids.insert(0xFFFF0000u | low);
+    }
+  }
+  ids.insert(0xFFFFFFFFu);
+  return ids;
+}
+
+template <typename Set>
+std::vector<uint32_t> Keys(Set &&keys) {
+  std::vector<uint32_t> result;
+  for (auto it = keys.begin(); it != keys.end(); ++it) result.push_back(*it);
+  return result;
+}
+
+TEST(roaringSetTest, MatchesStdSet) {
+  s21::roaring_set ids;
+  std::set<uint32_t> expected;
+  for (uint32_t id : MixedIds(49)) {
+    EXPECT_TRUE(ids.insert(id).second);
+    expected.insert(id);
+  }
+  EXPECT_FALSE(ids.insert(0xFFFFFFFFu).second);
+  EXPECT_EQ(*ids.insert(0x30005).first, 0x30005u);
+  expected.insert(0x30005);
+  unsigned seed = 4;
+  for (int pass = 0; pass < 2; ++pass) {
+    if (pass == 1) {
+      size_t before = ids.memory_usage();
+      ids.optimize();
+      EXPECT_LT(ids.memory_usage(), before);
+    }
+    ASSERT_EQ(ids.size(), expected.size());
+    ASSERT_EQ(Keys(ids), Keys(expected));
+    for (int i = 0; i < 2000; ++i) {
+      seed = seed * 1103515245 + 12345;
+      uint32_t key = (seed >> 4) % 0x40000;
+      if (i % 2) key |= 0xFFFF0000u;
+      ASSERT_EQ(ids.contains(key), expected.count(key) == 1);
+      auto lower = expected.lower_bound(key);
+      auto found = ids.lower_bound(key);
+      ASSERT_EQ(found == ids.end(), lower == expected.end());
+      if (lower != expected.end()) {
+        ASSERT_EQ(*found, *lower);
+      }
+    }
+  }
+  // Erasing from a run chunk unpacks it
+  for (uint32_t id = 0x30000; id < 0x40000; id += 3) {
+    ASSERT_EQ(ids.erase(id), expected.erase(id));
+  }
+  for (uint32_t id : MixedIds(49)) {
+    if (id % 5 == 0) {
+      ids.erase(ids.find(id));
+      expected.erase(id);
+    }
+  }
+  EXPECT_EQ(ids.erase(0x20000), 0u);
+  ASSERT_EQ(Keys(ids), Keys(expected));
+  EXPECT_EQ(ids.find(5), expected.count(5) ? ids.lower_bound(5) : ids.end());
+  EXPECT_EQ(ids.upper_bound(0xFFFFFFFFu), ids.end());
+
+  std::vector<uint32_t> visited;
+  ids.visit_range(0x10000, 0x30010, [&](uint32_t id) {
+    visited.push_back(id);
+  });
+  std::vector<uint32_t> in_range(expected.lower_bound(0x10000),
+                                 expected.lower_bound(0x30010));
+  EXPECT_EQ(visited, in_range);
+  visited.clear();
+  for (uint32_t id : ids.range(0x10000, 0x30010)) visited.push_back(id);
+  EXPECT_EQ(visited, in_range);
+  visited.clear();
+  ids.for_each([&](uint32_t id) { visited.push_back(id); });
+  EXPECT_EQ(visited, Keys(expected));
+}
+
+TEST(roaringSetTest, SetOperationsMatchStdAlgorithms) {
+  std::set<uint32_t> left = MixedIds(1);
+  std::set<uint32_t> right = MixedIds(2);
+  for (uint32_t id = 0x10000; id < 0x14000; id += 2) right.insert(id);
+  for (int pass = 0; pass < 2; ++pass) {
+    s21::roaring_set a;
+    s21::roaring_set b;
+    a.assign_sorted(left.begin(), left.end());
+    b.assign_sorted(right.begin(), right.end());
+    if (pass == 1) {
+      a.optimize();
+      b.optimize();
+    }
+    std::vector<uint32_t> either;
+    std::vector<uint32_t> both;
+    std::vector<uint32_t> only;
+    std::set_union(left.begin(), left.end(), right.begin(), right.end(),
+                   std::back_inserter(either));
+    std::set_intersection(left.begin(), left.end(), right.begin(),
+                          right.end(), std::back_inserter(both));
+    std::set_difference(left.begin(), left.end(), right.begin(), right.end(),
+                        std::back_inserter(only));
+    s21::roaring_set difference = a;
+    difference.and_not(b);
+    EXPECT_EQ(Keys(a | b), either);
+    EXPECT_EQ((a | b).size(), either.size());
+    EXPECT_EQ(Keys(a & b), both);
+    EXPECT_EQ((b & a).size(), both.size());
+    EXPECT_EQ(Keys(difference), only);
+    EXPECT_EQ(difference.size(), only.size());
+    EXPECT_TRUE((a & b) == (b & a));
+    EXPECT_TRUE(difference != a);
+
+    // merge leaves in b the keys a already had
+    a.merge(b);
+    EXPECT_EQ(Keys(a), either);
+    EXPECT_EQ(Keys(b), both);
+  }
+}
+
+TEST(roaringSetTest, ConvertsFromAndToSet) {
+  s21::set<uint32_t> ids;
+  for (uint32_t i = 0; i < 5000; ++i) ids.insert(i * 2654435761u);
+  s21::roaring_set compact(ids);
+  EXPECT_EQ(compact.size(), ids.size());
+  s21::set<uint32_t> back = compact.to_set();
+  EXPECT_EQ(Keys(back), Keys(ids));
+  s21::roaring_set moved(std::move(compact));
+  EXPECT_TRUE(compact.empty());
+  EXPECT_EQ(moved.size(), ids.size());
+  s21::roaring_set small{7, 3, 70000};
+  small.swap(moved);
+  EXPECT_EQ(Keys(moved), std::vector<uint32_t>({3, 7, 70000}));
+  small.clear();
+  EXPECT_TRUE(small.empty());
+  EXPECT_EQ(small.begin(), small.end());
+}
+
+// pmr
+// Counts what passes through it on top of the default resource
+class CountingResource : public std::pmr::memory_resource {
+ public:
+  size_t allocations = 0;
+  size_t live_bytes = 0;
+
+ private:
+  void *do_allocate(size_t bytes, size_t alignment) override {
+    ++allocations;
+    live_bytes += bytes;
+    return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+  }
+  void do_deallocate(void *p, size_t bytes, size_t alignment) override {
+    live_bytes -= bytes;
+    std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+  }
+  bool do_is_equal(const memory_resource &other) const noexcept override {
+    return this == &other;
+  }
+};
+
+TEST(pmrTest, ContainersAllocateFromTheResource) {
+  CountingResource fallback;
+  std::pmr::memory_resource *previous =
+      std::pmr::set_default_resource(&fallback);
+  CountingResource resource;
+  {
+    s21::pmr::vector<int> numbers(&resource);
+    s21::pmr::list<std::string> words(&resource);
+    s21::pmr::set<int> keys(&resource);
+    s21::pmr::multiset<int> repeated(&resource);
+    s21::pmr::map<int, int> squares(&resource);
+    s21::pmr::multimap<int, int> pairs(&resource);
+    s21::pmr::queue<int> pending(&resource);
+    s21::pmr::stack<int> undo(&resource);
+    s21::pmr::deque<int> ends(&resource);
+    s21::pmr::unordered_set<int> seen(&resource);
+    s21::pmr::unordered_map<int, int> cubes(&resource);
+    s21::pmr::btree_set<int> ordered(&resource);
+    s21::pmr::btree_map<int, int> ranks(&resource);
+    s21::pmr::compact_set<int> small(&resource);
+    s21::pmr::compact_map<int, int> halves(&resource);
+    s21::pmr::persistent_set<int> versions(&resource);
+    s21::pmr::persistent_map<int, int> history(&resource);
+    s21::pmr::lru_cache<int, int> recent(200, &resource);
+    s21::pmr::lfu_cache<int, int> frequent(200, &resource);
+    s21::pmr::pairing_heap<int> ranked(&resource);
+    s21::pmr::concurrent_map<int, int> shared(&resource);
+    for (int i = 0; i < 100; ++i) {
+      numbers.push_back(i);
+      words.push_back("w");
+      keys.insert(i);
+      repeated.insert(i % 10);
+      squares.insert({i, i * i});
+      pairs.insert({i % 10, i});
+      pending.push(i);
+      undo.push(i);
+      ends.push_front(i);
+      seen.insert(i);
+      cubes.insert({i, i * i * i});
+      ordered.insert(i);
+      ranks.insert({i, -i});
+      small.insert(i);
+      halves.insert({i, i / 2});
+      versions.insert(i);
+      history.insert({i, i + 1});
+      recent.put(i, -i);
+      frequent.put(i, i * 3);
+      ranked.push(i % 37);
+      shared.insert(i, 4 * i);
+    }
+    EXPECT_GE(resource.allocations, 21u);
+    EXPECT_EQ(fallback.allocations, 0u);
+    EXPECT_EQ(keys.get_allocator().resource(), &resource);
+    EXPECT_EQ(squares.get_allocator().resource(), &resource);
+    EXPECT_EQ(words.get_allocator().resource(), &resource);
+    EXPECT_EQ(squares.at(9), 81);
+    EXPECT_EQ(repeated.count(3), 10u);
+    EXPECT_EQ(pending.front(), 0);
+    EXPECT_EQ(undo.top(), 99);
+    EXPECT_EQ(ends.front(), 99);
+    EXPECT_TRUE(seen.contains(42));
+    EXPECT_EQ(cubes.at(5), 125);
+    EXPECT_EQ(ends.get_allocator().resource(), &resource);
+    EXPECT_EQ(seen.get_allocator().resource(), &resource);
+    EXPECT_EQ(cubes.get_allocator().resource(), &resource);
+    EXPECT_TRUE(ordered.contains(42));
+    EXPECT_EQ(ranks.at(9), -9);
+    EXPECT_EQ(ordered.get_allocator().resource(), &resource);
+    EXPECT_EQ(ranks.get_allocator().resource(), &resource);
+    EXPECT_TRUE(small.contains(42));
+    EXPECT_EQ(halves.at(9), 4);
+    EXPECT_EQ(small.get_allocator().resource(), &resource);
+    EXPECT_EQ(halves.get_allocator().resource(), &resource);
+    EXPECT_TRUE(versions.contains(42));
+    EXPECT_EQ(history.at(9), 10);
+    EXPECT_EQ(versions.get_allocator().resource(), &resource);
+    EXPECT_EQ(history.get_allocator().resource(), &resource);
+    EXPECT_EQ(*recent.get(9), -9);
+    EXPECT_EQ(*frequent.get(9), 27);
+    EXPECT_EQ(recent.get_allocator().resource(), &resource);
+    EXPECT_EQ(frequent.get_allocator().resource(), &resource);
+    EXPECT_EQ(ranked.top(), 36);
+    EXPECT_EQ(ranked.get_allocator().resource(), &resource);
+    EXPECT_EQ(shared.find(9), 36);
+    EXPECT_EQ(shared.get_allocator().resource(), &resource);
+    EXPECT_EQ(shared.snapshot().get_allocator().resource(), &resource);
+
+    // Copies ask the allocator, which for pmr gives the default resource
+    s21::pmr::set<int> copy(keys);
+    EXPECT_EQ(copy.get_allocator().resource(), &fallback);
+    EXPECT_GT(fallback.allocations, 0u);
+  }
+  EXPECT_EQ(resource.live_bytes, 0u);
+  EXPECT_EQ(fallback.live_bytes, 0u);
+  std::pmr::set_default_resource(previous);
+}
+
+// Between different resources moves go element by element and leave the
+// source with its resource and its nodes
+TEST(pmrTest, MovesBetweenResources) {
+  CountingResource first;
+  CountingResource second;
+  {
+    s21::pmr::map<int, std::string> source(&first);
+    s21::pmr::list<int> items({1, 2, 3}, &first);
+    s21::pmr::vector<int> numbers({4, 5, 6}, &first);
+    s21::pmr::deque<int> ends({7, 8, 9}, &first);
+    s21::pmr::unordered_map<int, std::string> names(&first);
+    s21::pmr::btree_map<int, std::string> sorted(&first);
+    s21::pmr::compact_map<int, std::string> packed(&first);
+    s21::pmr::persistent_map<int, std::string> timeline(&first);
+    for (int i = 0; i < 50; ++i) {
+      source.insert({i, std::to_string(i)});
+      names.insert({i, std::to_string(i)});
+      sorted.insert({i, std::to_string(i)});
+      packed.insert({i, std::to_string(i)});
+      timeline.insert({i, std::to_string(i)});
+    }
+    size_t held = first.live_bytes;
+
+    s21::pmr::map<int, std::string> target(std::move(source), &second);
+    EXPECT_EQ(target.size(), 50u);
+    EXPECT_EQ(target.at(7), "7");
+    EXPECT_EQ(target.get_allocator().resource(), &second);
+    EXPECT_EQ(first.live_bytes, held);
+    EXPECT_GT(second.live_bytes, 0u);
+
+    s21::pmr::list<int> other_items(&second);
+    other_items = std::move(items);
+    EXPECT_EQ(other_items.size(), 3u);
+    EXPECT_EQ(other_items.front(), 1);
+    EXPECT_EQ(other_items.get_allocator().resource(), &second);
+
+    s21::pmr::vector<int> other_numbers(&second);
+    other_numbers = std::move(numbers);
+    EXPECT_EQ(other_numbers.size(), 3u);
+    EXPECT_EQ(other_numbers[2], 6);
+    EXPECT_EQ(other_numbers.get_allocator().resource(), &second);
+
+    s21::pmr::deque<int> other_ends(&second);
+    other_ends = std::move(ends);
+    EXPECT_EQ(other_ends.size(), 3u);
+    EXPECT_EQ(other_ends.back(), 9);
+    EXPECT_EQ(other_ends.get_allocator().resource(), &second);
+
+    s21::pmr::unordered_map<int, std::string> other_names(std::move(names),
+                                                          &second);
+    EXPECT_EQ(other_names.size(), 50u);
+    EXPECT_EQ(other_names.at(7), "7");
+    EXPECT_EQ(other_names.get_allocator().resource(), &second);
+    s21::pmr::unordered_map<int, std::string> copied(&first);
+    copied = other_names;
+    EXPECT_EQ(copied.at(7), "7");
+    EXPECT_EQ(copied.get_allocator().resource(), &first);
+
+    s21::pmr::btree_map<int, std::string> other_sorted(&second);
+    other_sorted = std::move(sorted);
+    EXPECT_EQ(other_sorted.size(), 50u);
+    EXPECT_EQ(other_sorted.at(7), "7");
+    EXPECT_EQ(other_sorted.get_allocator().resource(), &second);
+    s21::pmr::btree_map<int, std::string> sorted_copy(other_sorted, &first);
+    EXPECT_EQ(sorted_copy.at(49), "49");
+    EXPECT_EQ(sorted_copy.get_allocator().resource(), &first);
+
+    s21::pmr::compact_map<int, std::string> other_packed(std::move(packed),
+                                                         &second);
+    EXPECT_EQ(other_packed.size(), 50u);
+    EXPECT_EQ(other_packed.at(7), "7");
+    EXPECT_EQ(other_packed.get_allocator().resource(), &second);
+    s21::pmr::compact_map<int, std::string> packed_copy(&first);
+    packed_copy = other_packed;
+    EXPECT_EQ(packed_copy.at(49), "49");
+    EXPECT_EQ(packed_copy.get_allocator().resource(), &first);
+
+    s21::pmr::persistent_map<int, std::string> other_timeline(
+        std::move(timeline), &second);
+    EXPECT_EQ(other_timeline.size(), 50u);
+    EXPECT_EQ(other_timeline.at(7), "7");
+    EXPECT_EQ(other_timeline.get_allocator().resource(), &second);
+
+    // The same resource hands the nodes over
+    s21::pmr::map<int, std::string> taken(std::move(target), &second);
+    EXPECT_EQ(taken.size(), 50u);
+    EXPECT_TRUE(target.empty());
+    s21::pmr::unordered_map<int, std::string> kept(std::move(other_names),
+                                                   &second);
+    EXPECT_EQ(kept.size(), 50u);
+    EXPECT_TRUE(other_names.empty());
+    s21::pmr::btree_map<int, std::string> sorted_kept(std::move(other_sorted),
+                                                      &second);
+    EXPECT_EQ(sorted_kept.size(), 50u);
+    EXPECT_TRUE(other_sorted.empty());
+  }
+  EXPECT_EQ(first.live_bytes, 0u);
+  EXPECT_EQ(second.live_bytes, 0u);
+}
+
+// Between resources a cache moves its entries one at a time, keeping their
+// recency and access counts, and a heap pushes its elements again
+TEST(pmrTest, PooledContainersMoveBetweenResources) {
+  CountingResource first;
+  CountingResource second;
+  {
+    s21::pmr::lru_cache<int, std::string> recent(3, &first);
+    s21::pmr::lfu_cache<int, std::string> frequent(4, &first);
+    for (int i = 0; i < 4; ++i) {
+      recent.put(i, std::to_string(i));
+      frequent.put(i, std::to_string(i));
+    }
+    recent.get(1);
+    frequent.get(0);
+    frequent.get(0);
+    frequent.get(2);
+
+    s21::pmr::lru_cache<int, std::string> other_recent(1, &second);
+    other_recent = std::move(recent);
+    EXPECT_TRUE(recent.empty());
+    EXPECT_EQ(other_recent.size(), 3u);
+    EXPECT_EQ(other_recent.capacity(), 3u);
+    EXPECT_EQ(other_recent.get_allocator().resource(), &second);
+    EXPECT_EQ(other_recent.counters().hits, 1u);
+    other_recent.put(4, "4");
+    EXPECT_FALSE(other_recent.contains(2));
+    EXPECT_EQ(*other_recent.get(1), "1");
+    EXPECT_EQ(*other_recent.get(3), "3");
+
+    s21::pmr::lfu_cache<int, std::string> other_frequent(1, &second);
+    other_frequent = std::move(frequent);
+    EXPECT_TRUE(frequent.empty());
+    EXPECT_EQ(other_frequent.get_allocator().resource(), &second);
+    EXPECT_EQ(other_frequent.frequency(0), 3u);
+    EXPECT_EQ(other_frequent.frequency(1), 1u);
+    EXPECT_EQ(other_frequent.frequency(2), 2u);
+    EXPECT_EQ(other_frequent.frequency(3), 1u);
+    other_frequent.put(4, "4");
+    EXPECT_FALSE(other_frequent.contains(1));
+    other_frequent.put(5, "5");
+    EXPECT_FALSE(other_frequent.contains(3));
+    EXPECT_EQ(*other_frequent.peek(2), "2");
+
+    // Elements of a heap are pushed again, whatever shape it had
+    s21::pmr::pairing_heap<int, std::greater<int>> pending(&first);
+    for (int i = 0; i < 40; ++i) pending.push((i * 7) % 40);
+    for (int i = 0; i < 15; ++i) pending.pop();
+    s21::pmr::pairing_heap<int, std::greater<int>> other_pending(
+        std::move(pending), &second);
+    EXPECT_TRUE(pending.empty());
+    EXPECT_EQ(other_pending.size(), 25u);
+    EXPECT_EQ(other_pending.get_allocator().resource(), &second);
+    for (int i = 15; i < 40; ++i) {
+      ASSERT_EQ(other_pending.top(), i);
+      other_pending.pop();
+    }
+
+    // The same resource hands the storage over
+    s21::pmr::lfu_cache<int, std::string> kept(1, &second);
+    kept = std::move(other_frequent);
+    EXPECT_EQ(kept.size(), 4u);
+    EXPECT_EQ(kept.frequency(0), 3u);
+    EXPECT_TRUE(other_frequent.empty());
+  }
+  EXPECT_EQ(first.live_bytes, 0u);
+  EXPECT_EQ(second.live_bytes, 0u);
+}
+
+// Snapshots of a concurrent_map are dropped on reader threads, so its
+// resource has to be a synchronized one
+TEST(pmrTest, ConcurrentMapOnASynchronizedPool) {
+  CountingResource upstream;
+  {
+    std::pmr::synchronized_pool_resource pool(&upstream);
+    s21::pmr::concurrent_map<int, int> m(&pool);
+    std::atomic<bool> done{false};
+    std::atomic<int> failures{0};
+    std::vector<std::thread> readers;
+    for (int r = 0; r < 3; ++r) {
+      readers.emplace_back([&m, &done, &failures, &pool] {
+        while (!done.load(std::memory_order_relaxed)) {
+          s21::pmr::persistent_map<int, int> view = m.snapshot();
+          if (view.get_allocator().resource() != &pool) ++failures;
+          for (const auto &item : view) {
+            if (item.second != -item.first) ++failures;
+          }
+        }
+      });
+    }
+    for (int i = 0; i < 3000; ++i) {
+      if (i % 4 == 3) {
+        m.erase(i - 2);
+      } else {
+        m.insert(i, -i);
+      }
+    }
+    done.store(true);
+    for (auto &reader : readers) reader.join();
+    EXPECT_EQ(failures.load(), 0);
+    EXPECT_EQ(m.size(), 1500u);
+    EXPECT_GT(upstream.allocations, 0u);
+  }
+  EXPECT_EQ(upstream.live_bytes, 0u);
+}
+
+// A snapshot keeps the resource and shares the nodes; a version with
+// another resource gets its own copies, so each resource frees only what
+// came from it
+TEST(pmrTest, PersistentVersionsKeepTheirResource) {
+  CountingResource first;
+  CountingResource second;
+  {
+    s21::pmr::persistent_set<int> current(&first);
+    for (int i = 0; i < 100; ++i) current.insert(i);
+    size_t held = first.live_bytes;
+    s21::pmr::persistent_set<int> view = current.snapshot();
+    EXPECT_TRUE(view.get_tree().SharesRoot(current.get_tree()));
+    EXPECT_EQ(view.get_allocator().resource(), &first);
+    EXPECT_EQ(first.live_bytes, held);
+
+    s21::pmr::persistent_set<int> moved(view, &second);
+    EXPECT_FALSE(moved.get_tree().SharesRoot(view.get_tree()));
+    EXPECT_EQ(second.live_bytes, held);
+    current.erase(50);
+    moved.insert(1000);
+    current = moved;
+    EXPECT_EQ(current.get_allocator().resource(), &first);
+    EXPECT_TRUE(current.contains(1000));
+    EXPECT_TRUE(current.contains(50));
+    EXPECT_FALSE(view.contains(1000));
+    EXPECT_EQ(view.size(), 100u);
+  }
+  EXPECT_EQ(first.live_bytes, 0u);
+  EXPECT_EQ(second.live_bytes, 0u);
+}
+
+// Erasing most of a map keeps its node blocks until shrink_to_fit, which
+// frees those left without live nodes and moves none of the others
+TEST(pmrTest, ShrinkToFitReturnsEmptyBlocks) {
+  CountingResource resource;
+  s21::pmr::map<int, int> squares(&resource);
+  for (int i = 0; i < 20000; ++i) squares.insert({i, i * i});
+  size_t peak = resource.live_bytes;
+  for (int i = 0; i < 20000; ++i) {
+    if (i >= 1000 && i < 19000) squares.erase(squares.find(i));
+  }
+  EXPECT_EQ(resource.live_bytes, peak);
+  auto kept = squares.find(19500);
+  squares.shrink_to_fit();
+  EXPECT_LT(resource.live_bytes, peak / 3);
+  EXPECT_EQ(squares.size(), 2000u);
+  EXPECT_EQ(kept->second, 19500 * 19500);
+  int expected = 0;
+  for (auto it = squares.begin(); it != squares.end(); ++it) {
+    ASSERT_EQ(it->first, expected);
+    expected = expected == 999 ? 19000 : expected + 1;
+  }
+  for (int i = 1000; i < 3000; ++i) squares.insert({i, -i});
+  EXPECT_EQ(squares.at(2999), -2999);
+  squares.clear();
+  squares.shrink_to_fit();
+  EXPECT_EQ(resource.live_bytes, 0u);
+
+  s21::set<int> keys{3, 1, 2};
+  keys.erase(keys.find(2));
+  keys.shrink_to_fit();
+  EXPECT_EQ(*keys.begin(), 1);
+}
+
+// With no upstream the arena throws as soon as anything would fall back
+// to the heap
+TEST(pmrTest, MonotonicArena) {
+  std::array<std::byte, 1 << 16> buffer;
+  std::pmr::monotonic_buffer_resource arena(buffer.data(), buffer.size(),
+                                            std::pmr::null_memory_resource());
+  s21::pmr::map<int, int> counts(&arena);
+  s21::pmr::vector<int> order(&arena);
+  for (int i = 0; i < 200; ++i) {
+    ++counts[i % 20];
+    order.push_back(i);
+  }
+  EXPECT_EQ(counts.size(), 20u);
+  EXPECT_EQ(counts[3], 10);
+  EXPECT_EQ(order[199], 199);
+  s21::pmr::set<int> keys({5, 1, 3}, &arena);
+  keys.erase(keys.find(1));
+  EXPECT_EQ(*keys.begin(), 3);
+  s21::pmr::list<int> big(&arena);
+  EXPECT_THROW(
+      {
+        for (int i = 0; i < 1 << 16; ++i) big.push_back(i);
+      },
+      std::bad_alloc);
+}
+
+// serialization
+TEST(serializationTest, VectorAndArrayRoundTrip) {
+  s21::vector<int> numbers{3, 1, 4, 1, 5};
+  s21::vector<std::string> words{"", "alpha", std::string(300, 'x')};
+  s21::S21Array<double, 3> array{0.5, 1.5, 2.5};
+  std::stringstream stream;
+  s21::serialize(stream, numbers);
+  s21::serialize(stream, words);
+  s21::serialize(stream, array);
+
+  s21::vector<int> numbers_copy{9};
+  s21::vector<std::string> words_copy;
+  s21::S21Array<double, 3> array_copy;
+  s21::deserialize(stream, numbers_copy);
+  s21::deserialize(stream, words_copy);
+  s21::deserialize(stream, array_copy);
+  ASSERT_EQ(numbers_copy.size(), numbers.size());
+  EXPECT_TRUE(std::equal(numbers.begin(), numbers.end(), numbers_copy.begin()));
+  ASSERT_EQ(words_copy.size(), words.size());
+  EXPECT_TRUE(std::equal(words.begin(), words.end(), words_copy.begin()));
+  EXPECT_EQ(array_copy[2], 2.5);
+
+  const std::string path = testing::TempDir() + "s21_vector.bin";
+  s21::serialize_file(path, numbers);
+  s21::vector<int> mapped;
+  s21::deserialize_file(path, mapped);
+  EXPECT_TRUE(std::equal(numbers.begin(), numbers.end(), mapped.begin()));
+  std::remove(path.c_str());
+}
+
+// Loaded trees are built balanced with consistent parent links, heights and
+// sizes, and stay usable for updates
+TEST(serializationTest, SetAndMapRoundTrip) {
+  s21::map<int, double> prices;
+  std::map<int, double> expected;
+  for (int i = 0; i < 5000; ++i) {
+    prices.insert(i * 7 % 5003, i * 0.5);
+    expected.emplace(i * 7 % 5003, i * 0.5);
+  }
+  const std::string path = testing::TempDir() + "s21_map.bin";
+  s21::serialize_file(path, prices);
+  s21::map<int, double> loaded{{-1, 1.0}};
+  s21::deserialize_file(path, loaded);
+  std::remove(path.c_str());
+  ASSERT_EQ(loaded.size(), expected.size());
+  EXPECT_TRUE(std::equal(expected.begin(), expected.end(), loaded.begin()));
+  EXPECT_EQ(CheckSubtree(loaded.get_tree().GetRoot(),
+                         decltype(loaded.get_tree().GetRoot())()),
+            expected.size());
+  loaded.insert(-5, 2.0);
+  EXPECT_EQ(loaded.begin()->first, -5);
+
+  s21::map<std::string, int> counts{{"b", 2}, {"a", 1}, {"c", 3}};
+  std::stringstream stream;
+  s21::serialize(stream, counts);
+  s21::map<std::string, int> counts_copy;
+  s21::deserialize(stream, counts_copy);
+  EXPECT_EQ(counts_copy.size(), 3u);
+  EXPECT_EQ(counts_copy.at("b"), 2);
+
+  s21::set<std::string> names{"zed", "amy", "kim"};
+  s21::serialize(stream, names);
+  s21::set<std::string> names_copy;
+  s21::deserialize(stream, names_copy);
+  std::set<std::string> expected_names{"zed", "amy", "kim"};
+  EXPECT_TRUE(std::equal(expected_names.begin(), expected_names.end(),
+                         names_copy.begin()));
+}
+
+TEST(serializationTest, MappedViews) {
+  s21::set<long> keys;
+  s21::map<int, short> values;
+  for (int i = 0; i < 1000; ++i) {
+    keys.insert(i * 3L);
+    values.insert(i * 2, static_cast<short>(i));
+  }
+  const std::string set_path = testing::TempDir() + "s21_set_view.bin";
+  const std::string map_path = testing::TempDir() + "s21_map_view.bin";
+  s21::serialize_file(set_path, keys);
+  s21::serialize_file(map_path, values);
+  {
+    s21::set_view<long> set_view(set_path);
+    EXPECT_EQ(set_view.size(), 1000u);
+    EXPECT_TRUE(set_view.contains(2997));
+    EXPECT_FALSE(set_view.contains(10));
+    EXPECT_EQ(*set_view.lower_bound(10), 12);
+    EXPECT_EQ(set_view.upper_bound(2997), set_view.end());
+
+    s21::map_view<int, short> map_view(map_path);
+    EXPECT_EQ(map_view.size(), 1000u);
+    EXPECT_EQ(map_view.at(1000), 500);
+    EXPECT_THROW(map_view.at(1001), std::invalid_argument);
+    EXPECT_EQ(map_view.keys()[map_view.lower_bound(1001)], 1002);
+    EXPECT_EQ(map_view.find(-1), map_view.size());
+  }
+  std::remove(set_path.c_str());
+  std::remove(map_path.c_str());
+}
+
+TEST(serializationTest, RejectsMismatchedInput) {
+  s21::set<int> numbers{1, 2, 3};
+  std::stringstream stream;
+  s21::serialize(stream, numbers);
+  const std::string bytes = stream.str();
+
+  std::stringstream as_map(bytes);
+  s21::map<int, int> wrong_kind;
+  EXPECT_THROW(s21::deserialize(as_map, wrong_kind), std::runtime_error);
+  std::stringstream as_longs(bytes);
+  s21::set<long> wrong_size;
+  EXPECT_THROW(s21::deserialize(as_longs, wrong_size), std::runtime_error);
+  std::stringstream truncated(bytes.substr(0, bytes.size() - 1));
+  s21::set<int> partial;
+  EXPECT_THROW(s21::deserialize(truncated, partial), std::runtime_error);
+  std::stringstream garbage(std::string(64, 'x'));
+  EXPECT_THROW(s21::deserialize(garbage, partial), std::runtime_error);
+
+  std::vector<int> unsorted{1, 3, 2};
+  EXPECT_THROW(partial.assign_sorted(unsorted.begin(), unsorted.end()),
+               std::invalid_argument);
+  EXPECT_TRUE(partial.empty());
+}
+
+// stats
+#ifdef S21_CONTAINERS_STATS
+TEST(StatsTest, TreeCounters) {
+  s21::stats_reset();
+  s21::set<int> set;
+  for (int i = 0; i < 100; ++i) set.insert(i);
+
+  s21::container_stats stats = set.stats();
+  ASSERT_EQ(stats.allocations, 100u);
+  ASSERT_EQ(stats.bytes_allocated, 100 * sizeof(s21::Node<int, int>));
+  ASSERT_GT(stats.rotations, 0u);
+  ASSERT_GT(stats.comparisons, 0u);
+
+  size_t lookups = stats.lookups;
+  ASSERT_TRUE(set.contains(42));
+  stats = set.stats();
+  ASSERT_EQ(stats.lookups, lookups + 1);
+  ASSERT_LE(stats.visits_per_lookup(), 8.0);
+
+  set.erase(set.find(42));
+  ASSERT_EQ(set.stats().deallocations, 1u);
+  ASSERT_EQ(s21::stats_snapshot().allocations, 100u);
+}
+
+TEST(StatsTest, VectorReallocations) {
+  s21::stats_reset();
+  s21::vector<int> vec;
+  for (int i = 0; i < 16; ++i) vec.push_back(i);
+  // 1 -> 2 -> 4 -> 8 -> 16
+  ASSERT_EQ(vec.stats().allocations, 5u);
+  ASSERT_EQ(vec.stats().reallocations, 4u);
+
+  s21::stack<int> stack;
+  stack.reserve(16);
+  ASSERT_EQ(stack.stats().allocations, 1u);
+  ASSERT_EQ(s21::stats_snapshot().allocations, 6u);
+
+  s21::stats_reset();
+  ASSERT_EQ(s21::stats_snapshot().allocations, 0u);
+}
+
+TEST(StatsTest, OneComparisonPerLevel) {
+  s21::map<int, int> map;
+  for (int i = 0; i < 1023; ++i) map.insert(i, i);
+
+  s21::container_stats before = map.stats();
+  for (int i = 0; i < 1023; ++i) ASSERT_TRUE(map.contains(i));
+  s21::container_stats after = map.stats();
+  size_t lookups = after.lookups - before.lookups;
+  size_t visits = after.node_visits - before.node_visits;
+  // one comparison per visited node plus the final equality check
+  ASSERT_EQ(after.comparisons - before.comparisons, visits + lookups);
+  ASSERT_LE(after.visits_per_lookup(), 11.0);
+}
+
+TEST(StatsTest, PathCopying) {
+  s21::persistent_set<int> set;
+  for (int i = 0; i < 1023; ++i) set.insert(i);
+  size_t allocations = set.stats().allocations;
+  set.insert(5000);
+  // an unshared tree is updated in place
+  ASSERT_EQ(set.stats().allocations, allocations + 1);
+
+  s21::persistent_set<int> view = set.snapshot();
+  allocations = set.stats().allocations;
+  set.insert(-1);
+  size_t copied = set.stats().allocations - allocations;
+  ASSERT_GT(copied, 1u);
+  ASSERT_LE(copied, static_cast<size_t>(set.get_tree().Height()) + 1);
+  ASSERT_EQ(view.size(), 1024u);
+}
+#else
+TEST(StatsTest, DisabledByDefault) {
+  s21::set<int> set = {1, 2, 3};
+  s21::vector<int> vec = {1, 2, 3};
+  ASSERT_EQ(set.stats().allocations, 0u);
+  ASSERT_EQ(vec.stats().reallocations, 0u);
+  ASSERT_EQ(s21::stats_snapshot().comparisons, 0u);
+  // no counters are stored in the containers
+  struct RingBufferLayout {
+    int *data;
+    size_t head, size, capacity;
+    std::allocator<int> allocator;
+  };
+  ASSERT_EQ(sizeof(s21::ring_buffer<int>), sizeof(RingBufferLayout));
+}
+#endif
+
 int main(int argc, char *argv[]) {
   testing::InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();